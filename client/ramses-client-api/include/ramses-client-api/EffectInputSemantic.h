@@ -30,7 +30,9 @@ namespace ramses
         EEffectUniformSemantic_NormalMatrix,                /// transposed and inverse of mvp for vertex normals
         EEffectUniformSemantic_RendererScreenResolution,    /// Resolution of renderer display vector 2 (width, height)
 
-        EEffectUniformSemantic_TextTexture                  /// Text specific - texture input for font characters
+        EEffectUniformSemantic_TextTexture,                 /// Text specific - texture input for font characters
+
+        EEffectUniformSemantic_InstanceModelMatrices        /// Array of mesh model matrices 4x4 indexed with gl_InstanceID, filled when render pass batches meshes to instanced draws
     };
 
     /**
@@ -235,6 +235,32 @@ namespace ramses
         */
         status_t retriggerRenderOnce();
 
+        /**
+        * @brief Set/unset batching of identical meshes into instanced draw calls.
+        *        When enabled, the renderer draws consecutive meshes of this render pass
+        *        which share effect, geometry, appearance state and uniform values with
+        *        a single instanced draw call. Their model matrices are provided to the shader
+        *        in a mat4 array uniform with semantic \c EEffectUniformSemantic_InstanceModelMatrices,
+        *        to be indexed with gl_InstanceID.
+        *
+        *        Meshes whose effect does not have such uniform, uses any other model dependent
+        *        semantic (e.g. model view projection matrix) or draws multiple instances itself
+        *        are always drawn one by one. The number of meshes in one batch is limited
+        *        by the array size of the uniform.
+        *
+        * @param enable The flag which indicates if meshes are batched to instanced draw calls (Default:false)
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setInstanceBatching(bool enable);
+
+        /**
+        * @brief Get the instance batching state of the render pass
+        *
+        * @return Indicates if meshes of the render pass are batched to instanced draw calls
+        */
+        bool isInstanceBatchingEnabled() const;
+
         /**
         * Stores internal data for implementation specifics of RenderPass.
         */
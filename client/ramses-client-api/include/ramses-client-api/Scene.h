@@ -312,6 +312,40 @@ namespace ramses
         **/
         TransformationNode* createTransformationNode(const char* name = 0);
 
+        /**
+        * @brief Creates multiple unnamed transformation nodes at once.
+        * @details Scene capacity for all nodes is reserved upfront. Optionally every node can be given a parent
+        *          from the created nodes and a translation.
+        *          Note that the nodes are still distributed to renderers as the same scene changes as when
+        *          created one by one, there is no compact bulk representation. Only the growth of the scene is
+        *          done once for all nodes.
+        *
+        * @param[in] count Number of nodes to create.
+        * @param[out] nodes Array of \p count pointers which receives the created nodes.
+        * @param[in] parentIndices Optional array of \p count indices of the parent of each node within the created nodes,
+        *            -1 for no parent. Parent must precede its child, i.e. parent index must be smaller than index of the node.
+        * @param[in] translations Optional array of 3 * \p count floats, x, y and z translation of each node.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage(). No node is created on failure.
+        **/
+        status_t createTransformationNodes(uint32_t count, TransformationNode** nodes, const int32_t* parentIndices = 0, const float* translations = 0);
+
+        /**
+        * @brief Creates multiple unnamed mesh nodes sharing the same appearance and geometry at once.
+        * @details Scene capacity for all mesh nodes is reserved upfront.
+        *          Note that the mesh nodes are still distributed to renderers as the same scene changes as when
+        *          created one by one and assigned appearance and geometry, there is no compact bulk representation.
+        *          Only the growth of the scene is done once for all mesh nodes.
+        *
+        * @param[in] count Number of mesh nodes to create.
+        * @param[out] meshNodes Array of \p count pointers which receives the created mesh nodes.
+        * @param[in] appearance Appearance to be set to all created mesh nodes.
+        * @param[in] geometry Geometry binding to be set to all created mesh nodes, must be compatible with appearance.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage(). No mesh node is created on failure.
+        **/
+        status_t createMeshNodes(uint32_t count, MeshNode** meshNodes, Appearance& appearance, GeometryBinding& geometry);
+
         /**
         * @brief Create a RenderGroup instance in the scene.
         *
@@ -76,7 +76,7 @@ namespace ramses_internal
 
     void ClientApplicationLogic::flush(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation& timeInfo)
     {
-        PlatformGuard guard(m_frameworkLock);
+        // scene graph component locks framework only for the parts of flush touching shared state
         m_scenegraphProviderComponent->handleFlush(sceneId, flushMode, timeInfo);
     }
 
@@ -88,9 +88,9 @@ namespace ramses_internal
         m_scenegraphProviderComponent->handleRemoveScene(sceneId);
     }
 
-    void ClientApplicationLogic::handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID)
+    void ClientApplicationLogic::handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex)
     {
-        m_scenegraphProviderComponent->handleSceneSubscription(sceneId, consumerID);
+        m_scenegraphProviderComponent->handleSceneSubscription(sceneId, consumerID, sceneInstanceEpoch, lastAppliedFlushIndex);
     }
 
     void ClientApplicationLogic::handleUnsubscribeScene(const SceneId& sceneId, const Guid& consumerID)
@@ -52,7 +52,7 @@ namespace ramses_internal
         void flush(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation& timeInfo);
         void removeScene(SceneId sceneId);
 
-        virtual void handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID) override;
+        virtual void handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) override;
         virtual void handleUnsubscribeScene(const SceneId& sceneId, const Guid& consumerID) override;
 
         // Resource handling
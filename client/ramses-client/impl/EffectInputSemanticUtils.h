@@ -46,6 +46,8 @@ namespace ramses
                 return ramses_internal::EFixedSemantics_RendererScreenResolution;
             case EEffectUniformSemantic_TextTexture:
                 return ramses_internal::EFixedSemantics_TextTextureUniform;
+            case EEffectUniformSemantic_InstanceModelMatrices:
+                return ramses_internal::EFixedSemantics_InstanceModelMatrices;
             default:
                 assert(false);
                 return ramses_internal::EFixedSemantics_Invalid;
@@ -80,6 +82,8 @@ namespace ramses
                 return EEffectUniformSemantic_NormalMatrix;
             case ramses_internal::EFixedSemantics_TextTextureUniform:
                 return EEffectUniformSemantic_TextTexture;
+            case ramses_internal::EFixedSemantics_InstanceModelMatrices:
+                return EEffectUniformSemantic_InstanceModelMatrices;
             case ramses_internal::EFixedSemantics_Invalid:
                 return EEffectUniformSemantic_Invalid;
             default:
@@ -812,7 +812,12 @@ namespace ramses
 
         // now the scene is registered, so it's possible to load the low level content into the scene
         LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "    Reading low level scene from stream");
-        ramses_internal::ScenePersistation::ReadSceneFromStream(inputStream, *internalScene, &animSystemFactory);
+        if (!ramses_internal::ScenePersistation::ReadSceneFromStream(inputStream, *internalScene, &animSystemFactory))
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "    Failed to read low level scene from stream");
+            delete &pimpl;
+            return nullptr;
+        }
 
         LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "    Deserializing high level scene objects from stream");
         DeserializationContext deserializationContext;
@@ -1354,6 +1359,8 @@ namespace ramses
 
     void RamsesClientImpl::updateClientResourceCache()
     {
+        // called from flush of any scene, which can happen concurrently from multiple threads
+        ramses_internal::PlatformGuard g(m_clientLock);
         const auto timeNow = std::chrono::steady_clock::now();
         while (m_clientResourceCache.size() != 0 && timeNow > m_clientResourceCache.front().first + m_clientResourceCacheTimeout)
         {
@@ -405,4 +405,15 @@ namespace ramses
         getIScene().retriggerRenderPassRenderOnce(m_renderPassHandle);
         return StatusOK;
     }
+
+    status_t RenderPassImpl::setInstanceBatching(bool enable)
+    {
+        getIScene().setRenderPassInstanceBatching(m_renderPassHandle, enable);
+        return StatusOK;
+    }
+
+    bool RenderPassImpl::isInstanceBatchingEnabled() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).isInstanceBatchingEnabled;
+    }
 }
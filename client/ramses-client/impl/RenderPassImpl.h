@@ -73,6 +73,8 @@ namespace ramses
         status_t setRenderOnce(bool enable);
         bool     isRenderOnce() const;
         status_t retriggerRenderOnce();
+        status_t setInstanceBatching(bool enable);
+        bool     isInstanceBatchingEnabled() const;
 
         ramses_internal::RenderPassHandle getRenderPassHandle() const;
 
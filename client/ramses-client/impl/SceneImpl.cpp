@@ -753,6 +753,74 @@ namespace ramses
         return newNode;
     }
 
+    status_t SceneImpl::createTransformationNodes(uint32_t count, TransformationNode** nodes, const int32_t* parentIndices, const float* translations)
+    {
+        if (nodes == nullptr)
+        {
+            return addErrorEntry("Scene::createTransformationNodes failed, no array provided to receive created nodes.");
+        }
+        if (parentIndices != nullptr)
+        {
+            for (uint32_t i = 0u; i < count; ++i)
+            {
+                if (parentIndices[i] < -1 || parentIndices[i] >= static_cast<int32_t>(i))
+                {
+                    return addErrorEntry("Scene::createTransformationNodes failed, parent index must be -1 or refer to a node created before its child.");
+                }
+            }
+        }
+
+        reserveNodeCapacity(ERamsesObjectType_TransformationNode, count, translations != nullptr ? count : 0u, 0u);
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            NodeImpl& pimpl = *new NodeImpl(*this, ERamsesObjectType_TransformationNode, "");
+            pimpl.initializeFrameworkData();
+            nodes[i] = new TransformationNode(pimpl);
+            registerCreatedObject(*nodes[i]);
+
+            if (translations != nullptr)
+            {
+                pimpl.setTranslation(translations[3u * i], translations[3u * i + 1u], translations[3u * i + 2u]);
+            }
+            if (parentIndices != nullptr && parentIndices[i] >= 0)
+            {
+                pimpl.setParent(nodes[parentIndices[i]]->impl);
+            }
+        }
+
+        return StatusOK;
+    }
+
+    status_t SceneImpl::createMeshNodes(uint32_t count, MeshNode** meshNodes, Appearance& appearance, GeometryBinding& geometry)
+    {
+        if (meshNodes == nullptr)
+        {
+            return addErrorEntry("Scene::createMeshNodes failed, no array provided to receive created mesh nodes.");
+        }
+        if (!containsSceneObject(appearance.impl) || !containsSceneObject(geometry.impl))
+        {
+            return addErrorEntry("Scene::createMeshNodes failed, appearance or geometry is not from this scene.");
+        }
+        if (geometry.impl.getEffectHash() != appearance.impl.getEffectImpl()->getLowlevelResourceHash())
+        {
+            return addErrorEntry("Scene::createMeshNodes failed, geometry does not provide all vertex attributes required by the appearance.");
+        }
+
+        reserveNodeCapacity(ERamsesObjectType_MeshNode, count, 0u, count);
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            MeshNodeImpl& pimpl = *new MeshNodeImpl(*this, "");
+            pimpl.initializeFrameworkData();
+            meshNodes[i] = new MeshNode(pimpl);
+            registerCreatedObject(*meshNodes[i]);
+
+            pimpl.setAppearance(appearance.impl);
+            pimpl.setGeometryBinding(geometry.impl);
+        }
+
+        return StatusOK;
+    }
+
     VisibilityNode* SceneImpl::createVisibilityNode(const char* name)
     {
         NodeImpl* pimpl = new NodeImpl(*this, ERamsesObjectType_VisibilityNode, name);
@@ -1492,6 +1560,18 @@ namespace ramses
         m_objectRegistry.addObject(object);
     }
 
+    void SceneImpl::reserveNodeCapacity(ERamsesObjectType type, uint32_t nodeCount, uint32_t transformCount, uint32_t renderableCount)
+    {
+        m_objectRegistry.reserveAdditionalObjectCapacity(type, nodeCount);
+
+        // preallocation is also sent to renderer with the scene actions, so it can reserve its scene memory at once as well
+        ramses_internal::SceneSizeInformation sizeInfo = m_scene.getSceneSizeInformation();
+        sizeInfo.nodeCount += nodeCount;
+        sizeInfo.transformCount += transformCount;
+        sizeInfo.renderableCount += renderableCount;
+        m_scene.preallocateSceneSize(sizeInfo);
+    }
+
     const RamsesObject* SceneImpl::findObjectByName(const char* name) const
     {
         return m_objectRegistry.findObjectByName(name);
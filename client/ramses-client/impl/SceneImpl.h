@@ -123,8 +123,10 @@ namespace ramses
         RotateNode*         createRotateNode(const char* name);
         ScaleNode*          createScaleNode(const char* name);
         TransformationNode* createTransformationNode(const char* name);
+        status_t            createTransformationNodes(uint32_t count, TransformationNode** nodes, const int32_t* parentIndices, const float* translations);
 
         MeshNode*           createMeshNode(const char* name);
+        status_t            createMeshNodes(uint32_t count, MeshNode** meshNodes, Appearance& appearance, GeometryBinding& geometry);
         VisibilityNode*     createVisibilityNode(const char* name);
 
         ramses::RenderGroup*  createRenderGroup(const char* name);
@@ -247,6 +249,7 @@ namespace ramses
     private:
         RenderPass* createRenderPassInternal(const char* name);
         void registerCreatedObject(SceneObject& object);
+        void reserveNodeCapacity(ERamsesObjectType type, uint32_t nodeCount, uint32_t transformCount, uint32_t renderableCount);
         AnimationSystemImpl& createAnimationSystemImpl(uint32_t flags, ERamsesObjectType type, const char* name);
         template <typename ObjectType, typename ObjectImplType>
         status_t createAndDeserializeObjectImpls(ramses_internal::IInputStream& inStream, DeserializationContext& serializationContext, uint32_t count);
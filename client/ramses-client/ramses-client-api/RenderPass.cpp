@@ -153,4 +153,16 @@ namespace ramses
         LOG_HL_CLIENT_API_NOARG(status);
         return status;
     }
+
+    status_t RenderPass::setInstanceBatching(bool enable)
+    {
+        const status_t status = impl.setInstanceBatching(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    bool RenderPass::isInstanceBatchingEnabled() const
+    {
+        return impl.isInstanceBatchingEnabled();
+    }
 }
@@ -241,6 +241,20 @@ namespace ramses
         return transformationNode;
     }
 
+    status_t Scene::createTransformationNodes(uint32_t count, TransformationNode** nodes, const int32_t* parentIndices, const float* translations)
+    {
+        const status_t status = impl.createTransformationNodes(count, nodes, parentIndices, translations);
+        LOG_HL_CLIENT_API4(status, count, LOG_API_GENERIC_PTR_STRING(nodes), LOG_API_GENERIC_PTR_STRING(parentIndices), LOG_API_GENERIC_PTR_STRING(translations));
+        return status;
+    }
+
+    status_t Scene::createMeshNodes(uint32_t count, MeshNode** meshNodes, Appearance& appearance, GeometryBinding& geometry)
+    {
+        const status_t status = impl.createMeshNodes(count, meshNodes, appearance, geometry);
+        LOG_HL_CLIENT_API4(status, count, LOG_API_GENERIC_PTR_STRING(meshNodes), LOG_API_RAMSESOBJECT_STRING(appearance), LOG_API_RAMSESOBJECT_STRING(geometry));
+        return status;
+    }
+
     const RamsesObject* Scene::findObjectByName(const char* name) const
     {
         return impl.findObjectByName(name);
@@ -59,9 +59,9 @@ namespace ramses
 
         ramses_internal::ISceneGraphConsumerComponent* m_sceneGraphConsumer;
 
-        virtual void handleInitializeScene(const ramses_internal::SceneInfo& sceneInfo, const ramses_internal::Guid& providerID) override
+        virtual void handleInitializeScene(const ramses_internal::SceneInfo& sceneInfo, const ramses_internal::Guid& providerID, const ramses_internal::Guid& sceneInstanceEpoch, bool deltaSinceLastAppliedFlush) override
         {
-            ramses_internal::SceneRendererServiceHandlerMock::handleInitializeScene(sceneInfo, providerID);
+            ramses_internal::SceneRendererServiceHandlerMock::handleInitializeScene(sceneInfo, providerID, sceneInstanceEpoch, deltaSinceLastAppliedFlush);
         }
 
         virtual void handleSceneActionList(const ramses_internal::SceneId& sceneId, ramses_internal::SceneActionCollection&& actions, const uint64_t& counter, const ramses_internal::Guid& providerID) override
@@ -78,7 +78,7 @@ namespace ramses
             {
                 ramses_foreach(newScenes, it)
                 {
-                    m_sceneGraphConsumer->subscribeScene(providerID, it->sceneID);
+                    m_sceneGraphConsumer->subscribeScene(providerID, it->sceneID, ramses_internal::Guid(), 0u);
                 }
             }
         }
@@ -152,7 +152,7 @@ namespace ramses
             const ramses_internal::IScene& iscene = this->m_scene.impl.getIScene();
             ramses_internal::SceneInfo info(iscene.getSceneId(), iscene.getName());
             EXPECT_CALL(this->sceneActionsCollector, handleNewScenesAvailable(ramses_internal::SceneInfoVector(1, info), _));
-            EXPECT_CALL(this->sceneActionsCollector, handleInitializeScene(info, _));
+            EXPECT_CALL(this->sceneActionsCollector, handleInitializeScene(info, _, _, _));
             EXPECT_EQ(StatusOK, m_scene.publish(EScenePublicationMode_LocalOnly));
 
             m_node = &this->template createObject<T>("node");
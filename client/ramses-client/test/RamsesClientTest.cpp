@@ -378,7 +378,7 @@ namespace ramses
         ramses_internal::SceneId internalSceneId(sceneId);
 
         EXPECT_CALL(sceneActionsCollector, handleNewScenesAvailable(SceneInfoVector(1, SceneInfo(internalSceneId, ramses_internal::String(scene->getName()))), testing::_));
-        EXPECT_CALL(sceneActionsCollector, handleInitializeScene(testing::_, testing::_));
+        EXPECT_CALL(sceneActionsCollector, handleInitializeScene(testing::_, testing::_, testing::_, testing::_));
         EXPECT_CALL(sceneActionsCollector, handleSceneActionList_rvr(ramses_internal::SceneId(sceneId), testing::_, testing::_, testing::_));
         EXPECT_CALL(sceneActionsCollector, handleScenesBecameUnavailable(SceneInfoVector(1, SceneInfo(internalSceneId)), testing::_));
 
@@ -679,4 +679,17 @@ namespace ramses
     {
         EXPECT_NE(StatusOK, renderpass.retriggerRenderOnce());
     }
+
+    TEST_F(ARenderPass, hasInstanceBatchingDisabledInitially)
+    {
+        EXPECT_FALSE(renderpass.isInstanceBatchingEnabled());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableInstanceBatching)
+    {
+        EXPECT_EQ(StatusOK, renderpass.setInstanceBatching(true));
+        EXPECT_TRUE(renderpass.isInstanceBatchingEnabled());
+        EXPECT_EQ(StatusOK, renderpass.setInstanceBatching(false));
+        EXPECT_FALSE(renderpass.isInstanceBatchingEnabled());
+    }
 }
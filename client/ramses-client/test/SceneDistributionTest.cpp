@@ -35,7 +35,7 @@ namespace ramses
             const ramses_internal::IScene& iscene = m_scene.impl.getIScene();
             ramses_internal::SceneInfo info(iscene.getSceneId(), iscene.getName());
             EXPECT_CALL(sceneActionsCollector, handleNewScenesAvailable(ramses_internal::SceneInfoVector(1, info), _));
-            EXPECT_CALL(sceneActionsCollector, handleInitializeScene(info, _));
+            EXPECT_CALL(sceneActionsCollector, handleInitializeScene(info, _, _, _));
             EXPECT_EQ(StatusOK, m_scene.publish());
         }
 
@@ -15,6 +15,8 @@
 #include "ramses-client-api/RemoteCamera.h"
 #include "ramses-client-api/ScaleNode.h"
 #include "ramses-client-api/MeshNode.h"
+#include "ramses-client-api/TransformationNode.h"
+#include "ramses-client-api/GeometryBinding.h"
 #include "ramses-client-api/DataFloat.h"
 #include "ramses-client-api/TextureSampler.h"
 #include "ramses-client-api/Texture2D.h"
@@ -143,6 +145,61 @@ namespace ramses
         EXPECT_TRUE(group2->impl.getAllMeshes().empty());
     }
 
+    TEST_F(AScene, createsTransformationNodesWithParentsAndTranslations)
+    {
+        const int32_t parentIndices[] = { -1, 0, 0, 1 };
+        const float translations[] = { 1.f, 2.f, 3.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 4.f, 5.f, 6.f };
+        TransformationNode* nodes[4] = {};
+        EXPECT_EQ(StatusOK, m_scene.createTransformationNodes(4u, nodes, parentIndices, translations));
+
+        EXPECT_EQ(nullptr, nodes[0]->getParent());
+        EXPECT_EQ(nodes[0], nodes[1]->getParent());
+        EXPECT_EQ(nodes[0], nodes[2]->getParent());
+        EXPECT_EQ(nodes[1], nodes[3]->getParent());
+
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+        EXPECT_EQ(StatusOK, nodes[3]->getTranslation(x, y, z));
+        EXPECT_EQ(4.f, x);
+        EXPECT_EQ(5.f, y);
+        EXPECT_EQ(6.f, z);
+        EXPECT_EQ(4u, m_scene.impl.getObjectRegistry().getNumberOfObjects(ERamsesObjectType_TransformationNode));
+    }
+
+    TEST_F(AScene, failsToCreateTransformationNodesIfParentDoesNotPrecedeChild)
+    {
+        const int32_t parentIndices[] = { -1, 2, 0 };
+        TransformationNode* nodes[3] = {};
+        EXPECT_NE(StatusOK, m_scene.createTransformationNodes(3u, nodes, parentIndices));
+        EXPECT_EQ(0u, m_scene.impl.getObjectRegistry().getNumberOfObjects(ERamsesObjectType_TransformationNode));
+    }
+
+    TEST_F(AScene, createsMeshNodesSharingAppearanceAndGeometry)
+    {
+        Effect* effect = TestEffects::CreateTestEffect(client);
+        Appearance* appearance = m_scene.createAppearance(*effect);
+        GeometryBinding* geometry = m_scene.createGeometryBinding(*effect);
+
+        MeshNode* meshNodes[3] = {};
+        EXPECT_EQ(StatusOK, m_scene.createMeshNodes(3u, meshNodes, *appearance, *geometry));
+        for (const auto meshNode : meshNodes)
+        {
+            EXPECT_EQ(appearance, meshNode->getAppearance());
+            EXPECT_EQ(geometry, meshNode->getGeometryBinding());
+        }
+    }
+
+    TEST_F(AScene, failsToCreateMeshNodesWithIncompatibleAppearanceAndGeometry)
+    {
+        Appearance* appearance = m_scene.createAppearance(*TestEffects::CreateTestEffect(client));
+        GeometryBinding* geometry = m_scene.createGeometryBinding(*TestEffects::CreateDifferentTestEffect(client));
+
+        MeshNode* meshNodes[3] = {};
+        EXPECT_NE(StatusOK, m_scene.createMeshNodes(3u, meshNodes, *appearance, *geometry));
+        EXPECT_EQ(0u, m_scene.impl.getObjectRegistry().getNumberOfObjects(ERamsesObjectType_MeshNode));
+    }
+
     TEST_F(AScene, failsToCreateAppearanceWhenEffectIsFromAnotherClient)
     {
         EffectDescription effectDescriptionEmpty;
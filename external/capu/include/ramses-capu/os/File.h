@@ -79,7 +79,7 @@ namespace ramses_capu
          */
         status_t remove();
         /**
-         * Rename the file.
+         * Rename the file, an existing file at the new path is replaced.
          * @param newPath The new path/filename.
          * @return return CAPU_OK if file was renamed
          *        CAPU_ERROR otherwise
@@ -170,7 +170,7 @@ namespace ramses_capu
         inline
         status_t File::renameTo(const ramses_capu::String& newPath)
         {
-            int_t status = MoveFileExA(mPath.c_str(), newPath.c_str(), 0);
+            int_t status = MoveFileExA(mPath.c_str(), newPath.c_str(), MOVEFILE_REPLACE_EXISTING);
             if (status == 0)
             {
                 return CAPU_ERROR;
@@ -117,6 +117,7 @@ namespace ramses_internal
         ESceneActionId_SetRenderPassEnabled,
         ESceneActionId_SetRenderPassRenderOnce,
         ESceneActionId_RetriggerRenderPassRenderOnce,
+        ESceneActionId_SetRenderPassInstanceBatching,
         ESceneActionId_AddRenderGroupToRenderPass,
         ESceneActionId_RemoveRenderGroupFromRenderPass,
 
@@ -312,6 +313,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId_SetRenderPassEnabled);
             CreateNameForEnumID(ESceneActionId_SetRenderPassRenderOnce);
             CreateNameForEnumID(ESceneActionId_RetriggerRenderPassRenderOnce);
+            CreateNameForEnumID(ESceneActionId_SetRenderPassInstanceBatching);
             CreateNameForEnumID(ESceneActionId_AddRenderGroupToRenderPass);
             CreateNameForEnumID(ESceneActionId_RemoveRenderGroupFromRenderPass);
 
@@ -67,7 +67,7 @@ namespace ramses_internal
             return true;
         }
 
-        virtual bool sendSubscribeScene(const Guid& /*to*/, const SceneId& /*sceneId*/) override
+        virtual bool sendSubscribeScene(const Guid& /*to*/, const SceneId& /*sceneId*/, const Guid& /*sceneInstanceEpoch*/, UInt64 /*lastAppliedFlushIndex*/) override
         {
             return true;
         }
@@ -82,7 +82,7 @@ namespace ramses_internal
             return true;
         }
 
-        virtual bool sendInitializeScene(const Guid& /*to*/, const SceneInfo& /*sceneInfo*/) override
+        virtual bool sendInitializeScene(const Guid& /*to*/, const SceneInfo& /*sceneInfo*/, const Guid& /*sceneInstanceEpoch*/, Bool /*deltaSinceLastAppliedFlush*/) override
         {
             return true;
         }
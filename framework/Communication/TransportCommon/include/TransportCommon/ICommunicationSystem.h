@@ -52,11 +52,11 @@ namespace ramses_internal
         virtual bool broadcastScenesBecameUnavailable(const SceneInfoVector& unavailableScenes) = 0;
         virtual bool sendScenesAvailable(const Guid& to, const SceneInfoVector& availableScenes) = 0;
 
-        virtual bool sendSubscribeScene(const Guid& to, const SceneId& sceneId) = 0;
+        virtual bool sendSubscribeScene(const Guid& to, const SceneId& sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) = 0;
         virtual bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) = 0;
         virtual bool sendSceneNotAvailable(const Guid& to, const SceneId& sceneId) = 0;
 
-        virtual bool sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo) = 0;
+        virtual bool sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush) = 0;
         virtual uint64_t sendSceneActionList(const Guid& to, const SceneId& sceneId, const SceneActionCollection& actions, const uint64_t& actionListCounter) = 0;
 
         // message limits configuration
@@ -9,7 +9,7 @@
 #ifndef RAMSES_RAMSESTRANSPORTPROTOCOLVERSION_H
 #define RAMSES_RAMSESTRANSPORTPROTOCOLVERSION_H
 
-#define RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR 73
+#define RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR 75
 
 // use minor to implement features in backward compatible way by checking remote minor version
 #define RAMSES_TRANSPORT_PROTOCOL_VERSION_MINOR 0
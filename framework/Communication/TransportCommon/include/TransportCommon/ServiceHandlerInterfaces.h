@@ -41,7 +41,8 @@ namespace ramses_internal
     public:
         virtual ~ISceneProviderServiceHandler() {}
 
-        virtual void handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID) = 0;
+        // consumer may hold a copy of the scene up to given flush of given scene instance (invalid epoch if not)
+        virtual void handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) = 0;
         virtual void handleUnsubscribeScene(const SceneId& sceneId, const Guid& consumerID) = 0;
     };
 
@@ -55,7 +56,8 @@ namespace ramses_internal
 
         virtual void handleSceneNotAvailable(const SceneId& sceneId, const Guid& providerID) = 0;
 
-        virtual void handleInitializeScene(const SceneInfo& sceneInfo, const Guid& providerID) = 0;
+        // if delta, only the flushes after the last one applied to consumer's scene copy follow instead of the full scene
+        virtual void handleInitializeScene(const SceneInfo& sceneInfo, const Guid& providerID, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush) = 0;
         virtual void handleSceneActionList(const SceneId& sceneId, SceneActionCollection&& actions, const uint64_t& counter, const Guid& providerID) = 0;
     };
 }
@@ -45,10 +45,10 @@ namespace ramses_internal
         EXPECT_FALSE(csw->commSystem->broadcastNewScenesAvailable(SceneInfoVector()));
         EXPECT_FALSE(csw->commSystem->broadcastScenesBecameUnavailable(SceneInfoVector()));
         EXPECT_FALSE(csw->commSystem->sendScenesAvailable(to, SceneInfoVector()));
-        EXPECT_FALSE(csw->commSystem->sendSubscribeScene(to, SceneId(123)));
+        EXPECT_FALSE(csw->commSystem->sendSubscribeScene(to, SceneId(123), Guid(), 0u));
         EXPECT_FALSE(csw->commSystem->sendUnsubscribeScene(to, SceneId(123)));
         EXPECT_FALSE(csw->commSystem->sendSceneNotAvailable(to, SceneId(123)));
-        EXPECT_FALSE(csw->commSystem->sendInitializeScene(to, SceneInfo()));
+        EXPECT_FALSE(csw->commSystem->sendInitializeScene(to, SceneInfo(), Guid(), false));
         EXPECT_EQ(0u, csw->commSystem->sendSceneActionList(to, SceneId(123), SceneActionCollection(), 1));
     }
 
@@ -65,10 +65,10 @@ namespace ramses_internal
         EXPECT_FALSE(csw->commSystem->broadcastNewScenesAvailable(SceneInfoVector()));
         EXPECT_FALSE(csw->commSystem->broadcastScenesBecameUnavailable(SceneInfoVector()));
         EXPECT_FALSE(csw->commSystem->sendScenesAvailable(to, SceneInfoVector()));
-        EXPECT_FALSE(csw->commSystem->sendSubscribeScene(to, SceneId(123)));
+        EXPECT_FALSE(csw->commSystem->sendSubscribeScene(to, SceneId(123), Guid(), 0u));
         EXPECT_FALSE(csw->commSystem->sendUnsubscribeScene(to, SceneId(123)));
         EXPECT_FALSE(csw->commSystem->sendSceneNotAvailable(to, SceneId(123)));
-        EXPECT_FALSE(csw->commSystem->sendInitializeScene(to, SceneInfo()));
+        EXPECT_FALSE(csw->commSystem->sendInitializeScene(to, SceneInfo(), Guid(), false));
         EXPECT_EQ(0u, csw->commSystem->sendSceneActionList(to, SceneId(123), SceneActionCollection(), 1));
     }
 
@@ -174,9 +174,9 @@ namespace ramses_internal
         SceneId sceneId;
         {
             PlatformGuard g(receiver->frameworkLock);
-            EXPECT_CALL(handler, handleSubscribeScene(sceneId, sender->id)).WillOnce(SendHandlerCalledEvent(state.get()));
+            EXPECT_CALL(handler, handleSubscribeScene(sceneId, sender->id, Guid(), 0u)).WillOnce(SendHandlerCalledEvent(state.get()));
         }
-        sender->commSystem->sendSubscribeScene(receiver->id, sceneId);
+        sender->commSystem->sendSubscribeScene(receiver->id, sceneId, Guid(), 0u);
         ASSERT_TRUE(state->event.waitForEvents(1));
 
         state->disconnectAll();
@@ -216,11 +216,11 @@ namespace ramses_internal
         StrictMock<SceneProviderServiceHandlerMock> handler_2;
         csw_2->commSystem->setSceneProviderServiceHandler(&handler_2);
 
-        EXPECT_CALL(handler_1, handleSubscribeScene(sceneId_2, csw_2->id)).WillOnce(SendHandlerCalledEvent(state.get()));
-        EXPECT_CALL(handler_2, handleSubscribeScene(sceneId_1, csw_1->id)).WillOnce(SendHandlerCalledEvent(state.get()));
+        EXPECT_CALL(handler_1, handleSubscribeScene(sceneId_2, csw_2->id, Guid(), 0u)).WillOnce(SendHandlerCalledEvent(state.get()));
+        EXPECT_CALL(handler_2, handleSubscribeScene(sceneId_1, csw_1->id, Guid(), 0u)).WillOnce(SendHandlerCalledEvent(state.get()));
 
-        csw_1->commSystem->sendSubscribeScene(csw_2->id, sceneId_1);
-        csw_2->commSystem->sendSubscribeScene(csw_1->id, sceneId_2);
+        csw_1->commSystem->sendSubscribeScene(csw_2->id, sceneId_1, Guid(), 0u);
+        csw_2->commSystem->sendSubscribeScene(csw_1->id, sceneId_2, Guid(), 0u);
         ASSERT_TRUE(state->event.waitForEvents(2));
 
         state->disconnectAll();
@@ -242,8 +242,8 @@ namespace ramses_internal
 
         SceneId sceneId;
 
-        EXPECT_CALL(handlerOk, handleSubscribeScene(sceneId, sender->id)).WillOnce(SendHandlerCalledEvent(state.get()));
-        sender->commSystem->sendSubscribeScene(receiverOk->id, sceneId);
+        EXPECT_CALL(handlerOk, handleSubscribeScene(sceneId, sender->id, Guid(), 0u)).WillOnce(SendHandlerCalledEvent(state.get()));
+        sender->commSystem->sendSubscribeScene(receiverOk->id, sceneId, Guid(), 0u);
         ASSERT_TRUE(state->event.waitForEvents(1));
 
         // As it's usually hard to prove the nonexistence of something try to dispatch again
@@ -426,8 +426,8 @@ namespace ramses_internal
 
         SceneId sceneId;
 
-        EXPECT_CALL(handler, handleSubscribeScene(sceneId, sender->id)).WillOnce(SendHandlerCalledEvent(state.get()));
-        sender->commSystem->sendSubscribeScene(receiver->id, sceneId);
+        EXPECT_CALL(handler, handleSubscribeScene(sceneId, sender->id, Guid(), 0u)).WillOnce(SendHandlerCalledEvent(state.get()));
+        sender->commSystem->sendSubscribeScene(receiver->id, sceneId, Guid(), 0u);
         ASSERT_TRUE(state->event.waitForEvents(1));
 
         state->disconnectAll();
@@ -51,11 +51,11 @@ namespace ramses_internal
         return m_connectionStatusUpdateNotifier;
     }
 
-    bool ForwardingCommunicationSystem::sendSubscribeScene(const Guid& to, const SceneId& sceneId)
+    bool ForwardingCommunicationSystem::sendSubscribeScene(const Guid& to, const SceneId& sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex)
     {
         if (m_targetCommunicationSystem && m_targetCommunicationSystem->m_sceneProviderHandler && to == m_targetCommunicationSystem->m_id)
         {
-            m_targetCommunicationSystem->m_sceneProviderHandler->handleSubscribeScene(sceneId, m_id);
+            m_targetCommunicationSystem->m_sceneProviderHandler->handleSubscribeScene(sceneId, m_id, sceneInstanceEpoch, lastAppliedFlushIndex);
         }
         return true;
     }
@@ -134,11 +134,11 @@ namespace ramses_internal
         return true;
     }
 
-    bool ForwardingCommunicationSystem::sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo)
+    bool ForwardingCommunicationSystem::sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush)
     {
         if (m_targetCommunicationSystem && m_targetCommunicationSystem->m_sceneRendererHandler && to == m_targetCommunicationSystem->m_id)
         {
-            m_targetCommunicationSystem->m_sceneRendererHandler->handleInitializeScene(sceneInfo, m_id);
+            m_targetCommunicationSystem->m_sceneRendererHandler->handleInitializeScene(sceneInfo, m_id, sceneInstanceEpoch, deltaSinceLastAppliedFlush);
         }
         return true;
     }
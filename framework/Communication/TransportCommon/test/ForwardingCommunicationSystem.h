@@ -38,11 +38,11 @@ namespace ramses_internal
         virtual bool broadcastScenesBecameUnavailable(const SceneInfoVector& unavailableScenes) override;
         virtual bool sendScenesAvailable(const Guid& to, const SceneInfoVector& availableScenes) override;
 
-        virtual bool sendSubscribeScene(const Guid& to, const SceneId& sceneId) override;
+        virtual bool sendSubscribeScene(const Guid& to, const SceneId& sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) override;
         virtual bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) override;
         virtual bool sendSceneNotAvailable(const Guid& to, const SceneId& sceneId) override;
 
-        virtual bool sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo) override;
+        virtual bool sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush) override;
         virtual uint64_t sendSceneActionList(const Guid& to, const SceneId& sceneId, const SceneActionCollection& actions, const uint64_t& actionListCounter) override;
 
         // message limits configuration
@@ -121,10 +121,11 @@ namespace ramses_internal
         return sendMessage(std::move(msg));
     }
 
-    bool TCPConnectionSystem::sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo)
+    bool TCPConnectionSystem::sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush)
     {
         const Guid& providerID = m_participantAddress.getParticipantId();
-        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem::sendCreateScene: to " << to << ", senderId " << providerID << ", sceneName " << sceneInfo.friendlyName << ", sceneId " << sceneInfo.sceneID.getValue());
+        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem::sendCreateScene: to " << to << ", senderId " << providerID << ", sceneName " << sceneInfo.friendlyName << ", sceneId " << sceneInfo.sceneID.getValue()
+            << ", epoch " << sceneInstanceEpoch << ", delta " << deltaSinceLastAppliedFlush);
 
         OutMessage msg(EConnectionType_OrderedControlMessages, EMessageId_CreateScene, to);
         BinaryOutputStream& stream = *msg.stream;
@@ -132,6 +133,8 @@ namespace ramses_internal
         stream << providerID;
         stream << sceneInfo.sceneID.getValue();
         stream << sceneInfo.friendlyName;
+        stream << sceneInstanceEpoch;
+        stream << deltaSinceLastAppliedFlush;
 
         return sendMessage(std::move(msg));
     }
@@ -227,8 +230,14 @@ namespace ramses_internal
             Guid consumerID;
             message.stream >> consumerID;
 
+            Guid sceneInstanceEpoch;
+            message.stream >> sceneInstanceEpoch;
+
+            UInt64 lastAppliedFlushIndex = 0u;
+            message.stream >> lastAppliedFlushIndex;
+
             PlatformGuard guard(m_frameworkLock);
-            m_sceneProviderHandler->handleSubscribeScene(sceneId, consumerID);
+            m_sceneProviderHandler->handleSubscribeScene(sceneId, consumerID, sceneInstanceEpoch, lastAppliedFlushIndex);
         }
     }
 
@@ -346,8 +355,14 @@ namespace ramses_internal
             message.stream >> sceneInfo.sceneID.getReference();
             message.stream >> sceneInfo.friendlyName;
 
+            Guid sceneInstanceEpoch;
+            message.stream >> sceneInstanceEpoch;
+
+            Bool deltaSinceLastAppliedFlush = false;
+            message.stream >> deltaSinceLastAppliedFlush;
+
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleInitializeScene(sceneInfo, providerID);
+            m_sceneRendererHandler->handleInitializeScene(sceneInfo, providerID, sceneInstanceEpoch, deltaSinceLastAppliedFlush);
         }
     }
 
@@ -475,16 +490,19 @@ namespace ramses_internal
         return true;
     }
 
-    bool TCPConnectionSystem::sendSubscribeScene(const Guid& to, const SceneId& sceneId)
+    bool TCPConnectionSystem::sendSubscribeScene(const Guid& to, const SceneId& sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex)
     {
         const Guid& consumerID = m_participantAddress.getParticipantId();
-        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem::sendSubscribeScene: to " << to << ", sceneId " << sceneId.getValue() << ", consumer " << consumerID);
+        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem::sendSubscribeScene: to " << to << ", sceneId " << sceneId.getValue() << ", consumer " << consumerID
+            << ", epoch " << sceneInstanceEpoch << ", lastAppliedFlushIndex " << lastAppliedFlushIndex);
 
         OutMessage msg(EConnectionType_OrderedControlMessages, EMessageId_SubscribeScene, to);
         BinaryOutputStream& stream = *msg.stream;
 
         stream << sceneId.getValue();
         stream << consumerID;
+        stream << sceneInstanceEpoch;
+        stream << lastAppliedFlushIndex;
 
         return sendMessage(std::move(msg));
     }
@@ -14,12 +14,15 @@
 #include "Scene/ClientScene.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "Scene/Scene.h"
+#include "Components/FlushTimeInformation.h"
+#include "PlatformAbstraction/PlatformLock.h"
+#include "Collections/HashMap.h"
+#include <deque>
 
 namespace ramses_internal
 {
     class ISceneGraphSender;
     class StatisticCollectionScene;
-    struct FlushTimeInformation;
 
     class ClientSceneLogicBase
     {
@@ -30,32 +33,74 @@ namespace ramses_internal
         void publish(EScenePublicationMode publicationMode);
         void unpublish();
         Bool isPublished() const;
-        void addSubscriber(const Guid& newSubscriber);
+        // subscriber holding a copy of this scene instance up to lastAppliedFlushIndex is resynchronized
+        // by resending the flushes it missed instead of the whole scene, if they are still in the flush history
+        void addSubscriber(const Guid& newSubscriber, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex);
         void removeSubscriber(const Guid& subscriber);
 
         Vector<Guid> getWaitingAndActiveSubscribers() const;
 
-        virtual void flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo) = 0;
+        // flush is split into a scene local part, which is only serialized with other operations on this scene
+        // and can run concurrently with flushes of other scenes, and the distribution of the flushed actions
+        // to subscribers, which has to be serialized by caller with all other sending (framework lock)
+        struct PreparedFlush
+        {
+            SceneActionCollection actions;
+            Vector<Guid>          receivers;
+            UInt64                flushIndex = 0u;
+            FlushTimeInformation  flushTimeInfo;
+        };
+
+        void flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo);
+        void prepareFlush(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, PreparedFlush& flush);
+        void sendPreparedFlush(PreparedFlush& flush);
 
         const char* getSceneStateString() const;
 
+        // bounds of the flush history kept for resynchronization of returning subscribers
+        static const UInt32 FlushHistoryMaxNumberOfFlushes = 32u;
+        static const UInt   FlushHistoryMaxSizeInBytes = 4u * 1024u * 1024u;
+
     protected:
         virtual void postAddSubscriber() {};
+        virtual void prepareFlushLocked(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, PreparedFlush& flush) = 0;
+        virtual void sendSceneToWaitingSubscribersAfterFlush(const PreparedFlush& flush) = 0;
         void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo);
+        void addFlushToHistory(const SceneActionCollection& flushedActions);
+        void clearFlushHistory();
         void printFlushInfo(StringOutputStream& sos, const char* name, const SceneActionCollection& collection, ESceneFlushMode flushMode) const;
 
         ISceneGraphSender&     m_scenegraphSender;
         const Guid             m_myID;
         const SceneId          m_sceneId;
+        // identifies this instance of the scene, flush indices of a recreated scene with same ID start over
+        const Guid             m_sceneInstanceEpoch;
         ClientScene&           m_scene;
 
+        // guards all state of scene logic, always taken after framework lock if both are needed
+        mutable PlatformLock   m_sceneLock;
+
         typedef Vector<Guid> AddressVector;
         AddressVector  m_subscribersActive;
         AddressVector  m_subscribersWaitingForScene;
+        // flush counter at which active subscriber got the scene, it already contains all flushes up to that index
+        HashMap<Guid, UInt64> m_subscriberSceneFlushIndex;
         EScenePublicationMode m_scenePublicationMode;
 
         UInt64                 m_flushCounter = 0u;
         AnimationSystemFactory m_animationSystemFactory;
+
+    private:
+        Bool sendFlushHistoryToSubscriber(const Guid& subscriber, UInt64 lastAppliedFlushIndex);
+
+        // flushed actions are kept as sent, including the flush action with its original flush time information
+        struct FlushHistoryEntry
+        {
+            UInt64                flushIndex;
+            SceneActionCollection actions;
+        };
+        std::deque<FlushHistoryEntry> m_flushHistory;
+        UInt                          m_flushHistorySizeInBytes = 0u;
     };
 }
 
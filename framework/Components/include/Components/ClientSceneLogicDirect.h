@@ -18,9 +18,10 @@ namespace ramses_internal
     public:
         ClientSceneLogicDirect(ISceneGraphSender& sceneGraphSender, ClientScene& scene, const Guid& clientAddress);
 
-        virtual void flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo) override;
-
     private:
+        virtual void prepareFlushLocked(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, PreparedFlush& flush) override;
+        virtual void sendSceneToWaitingSubscribersAfterFlush(const PreparedFlush& flush) override;
+
         SceneSizeInformation   m_previousSceneSizes;
     };
 }
@@ -19,10 +19,10 @@ namespace ramses_internal
     public:
         ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, const Guid& clientAddress);
 
-        virtual void flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo) override;
-
     private:
         virtual void postAddSubscriber() override;
+        virtual void prepareFlushLocked(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, PreparedFlush& flush) override;
+        virtual void sendSceneToWaitingSubscribersAfterFlush(const PreparedFlush& flush) override;
         void sendShadowCopySceneToWaitingSubscribers();
 
         SceneWithExplicitMemory m_sceneShadowCopy;
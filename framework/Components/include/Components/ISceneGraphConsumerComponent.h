@@ -22,7 +22,7 @@ namespace ramses_internal
         virtual ~ISceneGraphConsumerComponent() {}
 
         virtual void setSceneRendererServiceHandler(ISceneRendererServiceHandler* sceneRendererHandler) = 0;
-        virtual void subscribeScene(const Guid& to, SceneId sceneId) = 0;
+        virtual void subscribeScene(const Guid& to, SceneId sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) = 0;
         virtual void unsubscribeScene(const Guid& to, SceneId sceneId) = 0;
     };
 }
@@ -30,7 +30,7 @@ namespace ramses_internal
         virtual void handleUnpublishScene(SceneId sceneId) = 0;
         virtual void handleFlush(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo) = 0;
         virtual void handleRemoveScene(SceneId sceneId) = 0;
-        virtual void handleSceneSubscription(SceneId sceneId, const Guid& subscriber) = 0;
+        virtual void handleSceneSubscription(SceneId sceneId, const Guid& subscriber, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) = 0;
         virtual void handleSceneUnsubscription(SceneId sceneId, const Guid& subscriber) = 0;
     };
 }
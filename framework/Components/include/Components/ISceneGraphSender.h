@@ -22,7 +22,7 @@ namespace ramses_internal
         virtual ~ISceneGraphSender() {}
         virtual void sendPublishScene        (SceneId sceneId, const Guid& clientThatHasScene, EScenePublicationMode publicationMode, const String& name) = 0;
         virtual void sendUnpublishScene      (SceneId sceneId, EScenePublicationMode publicationMode) = 0;
-        virtual void sendCreateScene         (const Guid& to, const SceneInfo& sceneInfo, EScenePublicationMode publicationMode) = 0;
+        virtual void sendCreateScene         (const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush, EScenePublicationMode publicationMode) = 0;
         virtual void sendSceneActionList     (const Vector<Guid>& to, SceneActionCollection&& sceneAction, SceneId sceneId, EScenePublicationMode mode) = 0;
     };
 }
@@ -41,11 +41,11 @@ namespace ramses_internal
         virtual void setSceneRendererServiceHandler(ISceneRendererServiceHandler* sceneRendererHandler) override;
         virtual void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) override;
 
-        virtual void sendCreateScene(const Guid& to, const SceneInfo& sceneInfo, EScenePublicationMode mode) override;
+        virtual void sendCreateScene(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush, EScenePublicationMode mode) override;
         virtual void sendSceneActionList(const Vector<Guid>& toVec, SceneActionCollection&& sceneAction, SceneId sceneId, EScenePublicationMode mode) override;
         virtual void sendPublishScene(SceneId sceneId, const Guid& clientThatHasScene, EScenePublicationMode mode, const String& name) override;
         virtual void sendUnpublishScene(SceneId sceneId, EScenePublicationMode mode) override;
-        virtual void subscribeScene(const Guid& to, SceneId sceneId) override;
+        virtual void subscribeScene(const Guid& to, SceneId sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) override;
         virtual void unsubscribeScene(const Guid& to, SceneId sceneId) override;
         virtual void newParticipantHasConnected(const Guid& guid) override;
         virtual void participantHasDisconnected(const Guid& guid) override;
@@ -55,7 +55,7 @@ namespace ramses_internal
         virtual void handleUnpublishScene(SceneId sceneId) override;
         virtual void handleFlush(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo) override;
         virtual void handleRemoveScene(SceneId sceneId) override;
-        virtual void handleSceneSubscription(SceneId sceneId, const Guid& subscriber) override;
+        virtual void handleSceneSubscription(SceneId sceneId, const Guid& subscriber, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex) override;
         virtual void handleSceneUnsubscription(SceneId sceneId, const Guid& subscriber) override;
 
         virtual void triggerLogMessageForPeriodicLog() const override;
@@ -25,6 +25,7 @@ namespace ramses_internal
         : m_scenegraphSender(scenegraphProviderComponent)
         , m_myID(clientAddress)
         , m_sceneId(scene.getSceneId())
+        , m_sceneInstanceEpoch(true)
         , m_scene(scene)
         , m_scenePublicationMode(EScenePublicationMode_Unpublished)
         , m_animationSystemFactory(ramses_internal::EAnimationSystemOwner_Scenemanager)
@@ -38,6 +39,7 @@ namespace ramses_internal
 
     void ClientSceneLogicBase::publish(EScenePublicationMode publicationMode)
     {
+        PlatformGuard guard(m_sceneLock);
         if (m_scenePublicationMode == EScenePublicationMode_Unpublished)
         {
             m_scenePublicationMode = publicationMode;
@@ -47,6 +49,7 @@ namespace ramses_internal
 
     void ClientSceneLogicBase::unpublish()
     {
+        PlatformGuard guard(m_sceneLock);
         if (m_scenePublicationMode != EScenePublicationMode_Unpublished)
         {
             m_scenegraphSender.sendUnpublishScene(m_sceneId, m_scenePublicationMode);
@@ -57,6 +60,8 @@ namespace ramses_internal
         // reset to initial state
         m_subscribersActive.clear();
         m_subscribersWaitingForScene.clear();
+        m_subscriberSceneFlushIndex.clear();
+        clearFlushHistory();
     }
 
     Bool ClientSceneLogicBase::isPublished() const
@@ -64,25 +69,135 @@ namespace ramses_internal
         return m_scenePublicationMode != EScenePublicationMode_Unpublished;
     }
 
-    void ClientSceneLogicBase::addSubscriber(const Guid& newSubscriber)
+    void ClientSceneLogicBase::addSubscriber(const Guid& newSubscriber, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex)
     {
+        PlatformGuard guard(m_sceneLock);
         if (m_subscribersActive.contains(newSubscriber) || m_subscribersWaitingForScene.contains(newSubscriber))
         {
             LOG_WARN(CONTEXT_CLIENT, "ClientSceneLogic::addSubscriber: already has " << newSubscriber << " for scene " << m_sceneId.getValue());
             return;
         }
 
-        LOG_INFO(CONTEXT_CLIENT, "ClientSceneLogic::addSubscriber: add " << newSubscriber << " for scene " << m_sceneId.getValue() << ", flushCounter " << m_flushCounter);
+        LOG_INFO(CONTEXT_CLIENT, "ClientSceneLogic::addSubscriber: add " << newSubscriber << " for scene " << m_sceneId.getValue() << ", flushCounter " << m_flushCounter
+            << ", subscriber epoch " << sceneInstanceEpoch << ", lastAppliedFlushIndex " << lastAppliedFlushIndex);
+        if (sceneInstanceEpoch == m_sceneInstanceEpoch && sendFlushHistoryToSubscriber(newSubscriber, lastAppliedFlushIndex))
+        {
+            m_subscriberSceneFlushIndex.put(newSubscriber, m_flushCounter);
+            m_subscribersActive.push_back(newSubscriber);
+            return;
+        }
+
         m_subscribersWaitingForScene.push_back(newSubscriber);
         postAddSubscriber();
     }
 
+    Bool ClientSceneLogicBase::sendFlushHistoryToSubscriber(const Guid& subscriber, UInt64 lastAppliedFlushIndex)
+    {
+        // history must contain every flush after the last one applied by subscriber, otherwise fall back to full scene
+        if (!isPublished() || lastAppliedFlushIndex == 0u || lastAppliedFlushIndex > m_flushCounter)
+        {
+            return false;
+        }
+        if (m_flushHistory.empty() ? lastAppliedFlushIndex != m_flushCounter
+            : (m_flushHistory.front().flushIndex > lastAppliedFlushIndex + 1u || m_flushHistory.back().flushIndex != m_flushCounter))
+        {
+            return false;
+        }
+
+        m_scenegraphSender.sendCreateScene(subscriber, SceneInfo(m_sceneId, m_scene.getName()), m_sceneInstanceEpoch, true, m_scenePublicationMode);
+
+        const Vector<Guid> receiver{ subscriber };
+        UInt32 numSentActions = 0u;
+        for (const auto& entry : m_flushHistory)
+        {
+            if (entry.flushIndex > lastAppliedFlushIndex)
+            {
+                numSentActions += entry.actions.numberOfActions();
+                m_scenegraphSender.sendSceneActionList(receiver, entry.actions.copy(), m_sceneId, m_scenePublicationMode);
+            }
+        }
+
+        LOG_INFO(CONTEXT_CLIENT, "ClientSceneLogic::sendFlushHistoryToSubscriber: resynchronized " << subscriber << " for scene " << m_sceneId.getValue()
+            << " from flush " << lastAppliedFlushIndex << " to " << m_flushCounter << " with " << numSentActions << " actions");
+        m_scene.getStatisticCollection().statSceneActionsSent.incCounter(numSentActions);
+        return true;
+    }
+
+    void ClientSceneLogicBase::addFlushToHistory(const SceneActionCollection& flushedActions)
+    {
+        const UInt flushSize = flushedActions.collectionData().size();
+        if (flushSize > FlushHistoryMaxSizeInBytes)
+        {
+            // flush cannot be part of any delta, so neither can older flushes
+            clearFlushHistory();
+            return;
+        }
+
+        while (!m_flushHistory.empty() &&
+            (m_flushHistory.size() >= FlushHistoryMaxNumberOfFlushes || m_flushHistorySizeInBytes + flushSize > FlushHistoryMaxSizeInBytes))
+        {
+            m_flushHistorySizeInBytes -= m_flushHistory.front().actions.collectionData().size();
+            m_flushHistory.pop_front();
+        }
+
+        m_flushHistory.push_back({ m_flushCounter, flushedActions.copy() });
+        m_flushHistorySizeInBytes += flushSize;
+    }
+
+    void ClientSceneLogicBase::clearFlushHistory()
+    {
+        m_flushHistory.clear();
+        m_flushHistorySizeInBytes = 0u;
+    }
+
+    void ClientSceneLogicBase::flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo)
+    {
+        PreparedFlush flush;
+        prepareFlush(flushMode, flushTimeInfo, flush);
+        sendPreparedFlush(flush);
+    }
+
+    void ClientSceneLogicBase::prepareFlush(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, PreparedFlush& flush)
+    {
+        PlatformGuard guard(m_sceneLock);
+        prepareFlushLocked(flushMode, flushTimeInfo, flush);
+        flush.flushIndex = m_flushCounter;
+        flush.flushTimeInfo = flushTimeInfo;
+    }
+
+    void ClientSceneLogicBase::sendPreparedFlush(PreparedFlush& flush)
+    {
+        PlatformGuard guard(m_sceneLock);
+
+        // subscribers added since flush was prepared already got its actions with the scene,
+        // this includes subscribers that were removed and added again in the meantime
+        AddressVector receivers;
+        for (const auto& receiver : flush.receivers)
+        {
+            UInt64 sceneFlushIndex = 0u;
+            if (m_subscriberSceneFlushIndex.get(receiver, sceneFlushIndex) == EStatus_RAMSES_OK && sceneFlushIndex < flush.flushIndex)
+            {
+                receivers.push_back(receiver);
+            }
+        }
+
+        if (isPublished() && !receivers.empty())
+        {
+            m_scene.getStatisticCollection().statSceneActionsSent.incCounter(flush.actions.numberOfActions()*static_cast<UInt32>(receivers.size()));
+            m_scenegraphSender.sendSceneActionList(receivers, std::move(flush.actions), m_sceneId, m_scenePublicationMode);
+        }
+
+        sendSceneToWaitingSubscribersAfterFlush(flush);
+    }
+
     void ClientSceneLogicBase::removeSubscriber(const Guid& subscriber)
     {
+        PlatformGuard guard(m_sceneLock);
         auto it = m_subscribersActive.find(subscriber);
         if (it != m_subscribersActive.end())
         {
             m_subscribersActive.erase(it);
+            m_subscriberSceneFlushIndex.remove(subscriber);
             LOG_INFO(CONTEXT_CLIENT, "ClientSceneLogic::removeSubscriber: remove active subscriber " << subscriber << " from scene " << m_sceneId.getValue() << ", numRemaining " << m_subscribersActive.size());
         }
         else
@@ -98,6 +213,7 @@ namespace ramses_internal
 
     Vector<Guid> ClientSceneLogicBase::getWaitingAndActiveSubscribers() const
     {
+        PlatformGuard guard(m_sceneLock);
         Vector<Guid> result(m_subscribersActive);
         result.insert(result.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
         return result;
@@ -129,11 +245,15 @@ namespace ramses_internal
 
         ramses_foreach(m_subscribersWaitingForScene, subscriber)
         {
-            m_scenegraphSender.sendCreateScene(*subscriber, SceneInfo(m_sceneId, scene.getName()), m_scenePublicationMode);
+            m_scenegraphSender.sendCreateScene(*subscriber, SceneInfo(m_sceneId, scene.getName()), m_sceneInstanceEpoch, false, m_scenePublicationMode);
         }
         m_scene.getStatisticCollection().statSceneActionsSent.incCounter(collection.numberOfActions()*static_cast<UInt32>(m_subscribersWaitingForScene.size()));
         m_scenegraphSender.sendSceneActionList(m_subscribersWaitingForScene, std::move(collection), m_sceneId, m_scenePublicationMode);
 
+        for (const auto& subscriber : m_subscribersWaitingForScene)
+        {
+            m_subscriberSceneFlushIndex.put(subscriber, m_flushCounter);
+        }
         m_subscribersActive.insert(m_subscribersActive.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
         m_subscribersWaitingForScene.clear();
     }
@@ -168,6 +288,7 @@ namespace ramses_internal
 
     const char* ClientSceneLogicBase::getSceneStateString() const
     {
+        PlatformGuard guard(m_sceneLock);
         if (m_subscribersActive.size() > 0)
         {
             return "Subscribed";
@@ -28,7 +28,7 @@ namespace ramses_internal
     {
     }
 
-    void ClientSceneLogicDirect::flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo)
+    void ClientSceneLogicDirect::prepareFlushLocked(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, PreparedFlush& flush)
     {
         const SceneSizeInformation sceneSizes(m_scene.getSceneSizeInformation());
 
@@ -65,9 +65,15 @@ namespace ramses_internal
                 sceneSizes,
                 m_scene.getResourceChanges(),
                 flushTimeInfo);
+            addFlushToHistory(collection);
 
             m_previousSceneSizes = sceneSizes;
         }
+        else
+        {
+            // flush is never sent, so history has a gap
+            clearFlushHistory();
+        }
 
         // reserve memory in ClientScene after flush because flush might add a lot of data
         m_scene.getSceneActionCollection().reserveAdditionalCapacity(collection.collectionData().size(), collection.numberOfActions());
@@ -82,15 +88,18 @@ namespace ramses_internal
 
         if (isPublished() && !m_subscribersActive.empty())
         {
-            m_scene.getStatisticCollection().statSceneActionsSent.incCounter(collection.numberOfActions()*static_cast<UInt32>(m_subscribersActive.size()));
-            m_scenegraphSender.sendSceneActionList(m_subscribersActive, std::move(collection), m_sceneId, m_scenePublicationMode);
+            flush.actions = std::move(collection);
+            flush.receivers = m_subscribersActive;
         }
 
         m_scene.clearResourceChanges();
+    }
 
+    void ClientSceneLogicDirect::sendSceneToWaitingSubscribersAfterFlush(const PreparedFlush& flush)
+    {
         if (isPublished())
         {
-            sendSceneToWaitingSubscribers(m_scene, flushTimeInfo);
+            sendSceneToWaitingSubscribers(m_scene, flush.flushTimeInfo);
         }
     }
 }
@@ -34,7 +34,7 @@ namespace ramses_internal
         sendShadowCopySceneToWaitingSubscribers();
     }
 
-    void ClientSceneLogicShadowCopy::flushSceneActions(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo)
+    void ClientSceneLogicShadowCopy::prepareFlushLocked(ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo, PreparedFlush& flush)
     {
         const SceneSizeInformation sceneSizes(m_scene.getSceneSizeInformation());
 
@@ -69,6 +69,12 @@ namespace ramses_internal
                 sceneSizes,
                 m_scene.getResourceChanges(),
                 flushTimeInfo);
+            addFlushToHistory(collection);
+        }
+        else
+        {
+            // flush is never sent, so history has a gap
+            clearFlushHistory();
         }
 
         // reserve memory in ClientScene after flush because flush might add a lot of data
@@ -86,17 +92,20 @@ namespace ramses_internal
 
         if (isPublished() && !m_subscribersActive.empty())
         {
-            m_scene.getStatisticCollection().statSceneActionsSent.incCounter(collection.numberOfActions()*static_cast<UInt32>(m_subscribersActive.size()));
-            m_scenegraphSender.sendSceneActionList(m_subscribersActive, std::move(collection), m_sceneId, m_scenePublicationMode);
+            flush.actions = std::move(collection);
+            flush.receivers = m_subscribersActive;
         }
 
         m_scene.clearResourceChanges();
 
         // store flush time info for async new subscribers, scene validity must also be guaranteed for them
         m_flushTimeInfoOfLastFlush = flushTimeInfo;
+    }
 
+    void ClientSceneLogicShadowCopy::sendSceneToWaitingSubscribersAfterFlush(const PreparedFlush& flush)
+    {
         // send to subscribers if flushed for first time
-        if (m_flushCounter == 1u)
+        if (flush.flushIndex == 1u)
         {
             sendShadowCopySceneToWaitingSubscribers();
         }
@@ -72,20 +72,20 @@ namespace ramses_internal
         m_communicationSystem.setSceneProviderServiceHandler(handler);
     }
 
-    void SceneGraphComponent::sendCreateScene(const Guid& to, const SceneInfo& sceneInfo, EScenePublicationMode mode)
+    void SceneGraphComponent::sendCreateScene(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush, EScenePublicationMode mode)
     {
         if (m_myID == to)
         {
             if (m_sceneRendererHandler)
             {
-                m_sceneRendererHandler->handleInitializeScene(sceneInfo, m_myID);
+                m_sceneRendererHandler->handleInitializeScene(sceneInfo, m_myID, sceneInstanceEpoch, deltaSinceLastAppliedFlush);
             }
         }
         else
         {
             assert(mode != EScenePublicationMode_LocalOnly);
             UNUSED(mode);
-            m_communicationSystem.sendInitializeScene(to, sceneInfo);
+            m_communicationSystem.sendInitializeScene(to, sceneInfo, sceneInstanceEpoch, deltaSinceLastAppliedFlush);
             m_subscriptions[Subscription(to, sceneInfo.sceneID)] = 1u;
             LOG_DEBUG(CONTEXT_FRAMEWORK, "SceneGraphComponent::sendCreateScene: initialize counter for sceneid " << sceneInfo.sceneID << " to 1u");
         }
@@ -176,7 +176,7 @@ namespace ramses_internal
         }
     }
 
-    void SceneGraphComponent::subscribeScene(const Guid& to, SceneId sceneId)
+    void SceneGraphComponent::subscribeScene(const Guid& to, SceneId sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex)
     {
         if (m_myID == to)
         {
@@ -184,13 +184,13 @@ namespace ramses_internal
             {
                 LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::subscribeScene: subscribing to local scene " << sceneId.getValue());
                 PlatformGuard guard(m_frameworkLock);
-                m_sceneProviderHandler->handleSubscribeScene(sceneId, m_myID);
+                m_sceneProviderHandler->handleSubscribeScene(sceneId, m_myID, sceneInstanceEpoch, lastAppliedFlushIndex);
             }
         }
         else
         {
             LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::subscribeScene: subscribing to scene " << sceneId.getValue() << " from " << to);
-            m_communicationSystem.sendSubscribeScene(to, sceneId);
+            m_communicationSystem.sendSubscribeScene(to, sceneId, sceneInstanceEpoch, lastAppliedFlushIndex);
         }
     }
 
@@ -316,11 +316,19 @@ namespace ramses_internal
 
     void SceneGraphComponent::handleFlush(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation& flushTimeInfo)
     {
-        assert(m_clientSceneLogicMap.contains(sceneId));
+        ClientSceneLogicBase* sceneLogic = nullptr;
+        {
+            PlatformGuard guard(m_frameworkLock);
+            assert(m_clientSceneLogicMap.contains(sceneId));
+            sceneLogic = *m_clientSceneLogicMap.get(sceneId);
+        }
 
-        ClientSceneLogicBase& sceneLogic = **m_clientSceneLogicMap.get(sceneId);
+        // scene local part of flush does not hold framework lock, so that independent scenes can be flushed concurrently
+        ClientSceneLogicBase::PreparedFlush flush;
+        sceneLogic->prepareFlush(flushMode, flushTimeInfo, flush);
 
-        sceneLogic.flushSceneActions(flushMode, flushTimeInfo);
+        PlatformGuard guard(m_frameworkLock);
+        sceneLogic->sendPreparedFlush(flush);
     }
 
     void SceneGraphComponent::handleRemoveScene(SceneId sceneId)
@@ -332,13 +340,13 @@ namespace ramses_internal
         delete sceneLogic;
     }
 
-    void SceneGraphComponent::handleSceneSubscription(SceneId sceneId, const Guid& subscriber)
+    void SceneGraphComponent::handleSceneSubscription(SceneId sceneId, const Guid& subscriber, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex)
     {
         ClientSceneLogicBase** sceneLogic = m_clientSceneLogicMap.get(sceneId);
         if (sceneLogic != nullptr)
         {
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleSceneSubscription: received scene subscription for scene " << sceneId.getValue() << " from " << subscriber);
-            (*sceneLogic)->addSubscriber(subscriber);
+            (*sceneLogic)->addSubscriber(subscriber, sceneInstanceEpoch, lastAppliedFlushIndex);
         }
         else
         {
@@ -95,7 +95,7 @@ public:
     virtual ~SceneGraphSenderMock() {}
     MOCK_METHOD4(sendPublishScene, void(SceneId sceneId, const Guid& clientThatHasScene, EScenePublicationMode publicationMode, const String& name));
     MOCK_METHOD2(sendUnpublishScene, void(SceneId sceneId, EScenePublicationMode publicationMode));
-    MOCK_METHOD3(sendCreateScene, void(const Guid& to, const SceneInfo& sceneInfo, EScenePublicationMode publicationMode));
+    MOCK_METHOD5(sendCreateScene, void(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, bool deltaSinceLastAppliedFlush, EScenePublicationMode publicationMode));
     MOCK_METHOD4(sendSceneActionList_rvr, void(const Vector<Guid>& to, const SceneActionCollection & sceneAction, SceneId sceneId, EScenePublicationMode publicationMode));
 
     void sendSceneActionList(const Vector<Guid>& to, SceneActionCollection&& sceneAction, SceneId sceneId, EScenePublicationMode publicationMode) override
@@ -133,7 +133,7 @@ protected:
 
     void addSubscriber()
     {
-        m_sceneLogic.addSubscriber(m_rendererID);
+        m_sceneLogic.addSubscriber(m_rendererID, Guid(), 0u);
     }
 
     void flush(FlushTimeInformation fti = {})
@@ -169,10 +169,32 @@ protected:
         Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
     }
 
+    Guid publishAndAddSubscriberAndGetSceneInstanceEpoch()
+    {
+        publish();
+        Guid sceneInstanceEpoch;
+        EXPECT_CALL(m_sceneGraphProviderComponent, sendCreateScene(m_rendererID, _, _, false, _)).WillOnce(SaveArg<2>(&sceneInstanceEpoch));
+        expectFlushSceneActionList();
+        addSubscriber();
+        flush();
+        Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
+        return sceneInstanceEpoch;
+    }
+
+    static void ReadFlushParameters(const SceneActionCollection& actions, UInt64& flushIndex, FlushTimeInformation& flushTimeInfo)
+    {
+        ASSERT_EQ(ESceneActionId_Flush, actions.back().type());
+        bool isSync;
+        bool hasSizeInfo;
+        SceneSizeInformation sizeInfo;
+        SceneResourceChanges resourceChanges;
+        SceneActionApplier::ReadParameterForFlushAction(actions.back(), flushIndex, isSync, hasSizeInfo, sizeInfo, resourceChanges, flushTimeInfo, nullptr);
+    }
+
     void expectSceneSend()
     {
         const SceneInfo sceneInfo(m_sceneId, m_scene.getName());
-        EXPECT_CALL(m_sceneGraphProviderComponent, sendCreateScene(m_rendererID, sceneInfo, _));
+        EXPECT_CALL(m_sceneGraphProviderComponent, sendCreateScene(m_rendererID, sceneInfo, _, false, _));
     }
 
     void expectSceneUnpublish()
@@ -341,10 +363,10 @@ TEST_F(AClientSceneLogic_ShadowCopy, doesNotClearPendingActionsIfWaitingSubscrib
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
 
     this->expectFlushSceneActionList();
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     this->m_sceneLogic.removeSubscriber(newRendererID);
     EXPECT_FALSE(this->m_scene.getSceneActionCollection().empty());
 
@@ -360,7 +382,7 @@ TEST_F(AClientSceneLogic_Direct, doesNotClearPendingActionsIfWaitingSubscriberRe
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
 
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     this->m_sceneLogic.removeSubscriber(newRendererID);
     EXPECT_FALSE(this->m_scene.getSceneActionCollection().empty());
 
@@ -373,9 +395,9 @@ TEST_F(AClientSceneLogic_ShadowCopy, doesNotClearPendingActionsIfSubscriberRemov
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
     this->expectFlushSceneActionList();
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
 
     this->m_scene.allocateNode();
 
@@ -393,7 +415,7 @@ TEST_F(AClientSceneLogic_Direct, doesNotClearPendingActionsIfSubscriberRemovedIs
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
 
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     this->m_scene.allocateNode();
     this->m_sceneLogic.removeSubscriber(newRendererID);
     EXPECT_FALSE(this->m_scene.getSceneActionCollection().empty());
@@ -409,7 +431,7 @@ TEST_F(AClientSceneLogic_ShadowCopy, willSendSceneAgainToSubscriberThatUnsubscri
 
     expectSceneSend();
     this->expectFlushSceneActionList();
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
 
     this->expectSceneUnpublish();
 }
@@ -422,7 +444,7 @@ TEST_F(AClientSceneLogic_Direct, willSendSceneAgainToSubscriberThatUnsubscribedA
 
     expectSceneSend();
     this->expectFlushSceneActionList();
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
     flush();
 
     this->expectSceneUnpublish();
@@ -573,7 +595,7 @@ TEST_F(AClientSceneLogic_ShadowCopy, sendsOutDistributedSceneToNewlySubscribedRe
     this->expectSceneSend();
     this->expectFlushSceneActionList();
     this->flush();
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
 
     this->expectSceneUnpublish();
 }
@@ -585,7 +607,7 @@ TEST_F(AClientSceneLogic_Direct, sendsOutDistributedSceneToNewlySubscribedRender
     this->expectSceneSend();
     this->expectFlushSceneActionList();
     this->flush();
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
     this->flush();
 
     this->expectSceneUnpublish();
@@ -598,9 +620,9 @@ TEST_F(AClientSceneLogic_ShadowCopy, doesNothingIfExistingSubscriberAddedAgain)
     this->expectSceneSend();
     this->expectFlushSceneActionList();
     this->flush();
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
 
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
     // No call expectation
 
     this->expectSceneUnpublish();
@@ -612,12 +634,12 @@ TEST_F(AClientSceneLogic_Direct, doesNotAddAgainIfExistingSubscriberAddedAgain)
 
     this->expectSceneSend();
     this->expectFlushSceneActionList();
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
     this->flush();
     Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
 
     this->expectFlushSceneActionList(false);
-    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(), 0u);
     this->flush();
 
     this->expectSceneUnpublish();
@@ -633,9 +655,9 @@ TEST_F(AClientSceneLogic_ShadowCopy, canSubscribeToSceneEvenWithPendingActions)
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
     this->expectFlushSceneActionList();
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
 
     this->expectSceneUnpublish();
 }
@@ -656,10 +678,10 @@ TEST_F(AClientSceneLogic_Direct, canSubscribeToSceneEvenWithPendingActions)
     creator.flush(2u, false, true, this->m_scene.getSceneSizeInformation());
 
     EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneActionList_rvr(Vector<Guid>{ this->m_rendererID }, IsSceneActionCollection(collection), _, _));
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
     EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneActionList_rvr(Vector<Guid>{ newRendererID }, IsSceneActionCollection(collection), _, _));
 
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     this->flush();
 
     this->expectSceneUnpublish();
@@ -674,10 +696,10 @@ TEST_F(AClientSceneLogic_ShadowCopy, SendCleanSceneToNewSubscriber)
 
     // expect direct scene send to new renderer
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
     this->expectFlushSceneActionList();
 
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
 
     this->expectSceneUnpublish();
 }
@@ -691,9 +713,9 @@ TEST_F(AClientSceneLogic_Direct, SendCleanSceneToNewSubscriber)
 
     // expect direct scene send to new renderer
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
 
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneActionList_rvr(Vector<Guid>{this->m_rendererID}, IsSceneActionCollection(createFlushSceneActionList(false, 2)), _, _));
     EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneActionList_rvr(Vector<Guid>{newRendererID}, IsSceneActionCollection(createFlushSceneActionList(true, 2)), _, _));
     this->flush();
@@ -1047,11 +1069,11 @@ TEST_F(AClientSceneLogic_ShadowCopy, sendsSceneToNewlySubscribedRendererAfterFlu
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
     // expect newly flushed actions to new renderer
     SceneActionCollection actionsFromSendScene;
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(Vector<Guid>{ newRendererID }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene)));
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     ASSERT_EQ(2u, actionsFromSendScene.numberOfActions());
     EXPECT_EQ(ESceneActionId_AllocateNode, actionsFromSendScene[0].type());
     EXPECT_EQ(ESceneActionId_Flush, actionsFromSendScene[1].type());
@@ -1083,10 +1105,10 @@ TEST_F(AClientSceneLogic_ShadowCopy, sendsSceneToNewlySubscribedRendererWithNewR
     this->m_scene.allocateNode(); // action not flushed
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, _, _, false, _));
     SceneActionCollection actionsFromSendScene;
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(Vector<Guid>{ newRendererID }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene)));
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     ASSERT_EQ(3u, actionsFromSendScene.numberOfActions());
     ASSERT_EQ(ESceneActionId_Flush, actionsFromSendScene.back().type());
 
@@ -1120,9 +1142,9 @@ TEST_F(AClientSceneLogic_Direct, sendsSceneToNewlySubscribedRendererWithNewResou
     this->m_scene.allocateNode(); // action not flushed
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
 
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, _, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, _, _, false, _));
     SceneActionCollection actionsFromSendScene;
     SceneActionCollection actionsForExistingRenderer;
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(Vector<Guid>{ newRendererID }, _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(actionsFromSendScene)));
@@ -1158,9 +1180,9 @@ TEST_F(AClientSceneLogic_ShadowCopy, doesNotSendSceneUpdatesToNewSubscriberThatU
 
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
-    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, sceneInfo, _, false, _));
     this->expectFlushSceneActionList();
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
 
     this->m_scene.allocateNode();
 
@@ -1183,7 +1205,7 @@ TEST_F(AClientSceneLogic_Direct, doesNotSendAnythingToNewSubscriberThatUnsubscri
     const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
     const SceneInfo sceneInfo(this->m_sceneId, this->m_scene.getName());
 
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     this->m_scene.allocateNode();
     this->m_sceneLogic.removeSubscriber(newRendererID);
 
@@ -1391,7 +1413,7 @@ TEST_F(AClientSceneLogic_Direct, getWaitingAndActiveSubscribersDoesWhatItSays)
     EXPECT_THAT(this->m_sceneLogic.getWaitingAndActiveSubscribers(), UnorderedElementsAre(this->m_rendererID));
 
     const Guid newRendererID(true);
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     EXPECT_THAT(this->m_sceneLogic.getWaitingAndActiveSubscribers(), UnorderedElementsAre(this->m_rendererID, newRendererID));
 
     this->expectSceneUnpublish();
@@ -1401,7 +1423,7 @@ TEST_F(AClientSceneLogic_Direct, removeSubscriberRemoveOnlyGivenSubscriber)
 {
     const Guid newRendererID(true);
     this->publishAndAddSubscriberWithoutPendingActions();
-    this->m_sceneLogic.addSubscriber(newRendererID);
+    this->m_sceneLogic.addSubscriber(newRendererID, Guid(), 0u);
     EXPECT_THAT(this->m_sceneLogic.getWaitingAndActiveSubscribers(), UnorderedElementsAre(this->m_rendererID, newRendererID));
 
     this->m_sceneLogic.removeSubscriber(this->m_rendererID);
@@ -1412,3 +1434,146 @@ TEST_F(AClientSceneLogic_Direct, removeSubscriberRemoveOnlyGivenSubscriber)
 
     this->expectSceneUnpublish();
 }
+
+TYPED_TEST(AClientSceneLogic_All, doesNotSendPreparedFlushToSubscriberRemovedBeforeSending)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    this->m_scene.allocateNode();
+    ClientSceneLogicBase::PreparedFlush preparedFlush;
+    this->m_sceneLogic.prepareFlush(ESceneFlushMode_Asynchronous, {}, preparedFlush);
+    this->m_sceneLogic.removeSubscriber(this->m_rendererID);
+
+    // strict mock ensures nothing is sent
+    this->m_sceneLogic.sendPreparedFlush(preparedFlush);
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, sendsPreparedFlushOnlyOnceToSubscriberAddedBeforeSending)
+{
+    this->publish();
+    this->flush();
+
+    this->m_scene.allocateNode();
+    ClientSceneLogicBase::PreparedFlush preparedFlush;
+    this->m_sceneLogic.prepareFlush(ESceneFlushMode_Asynchronous, {}, preparedFlush);
+
+    // new subscriber gets scene including prepared flush, either right away or with sending of flush
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(ElementsAre(this->m_rendererID), _, this->m_sceneId, _));
+    this->addSubscriber();
+    this->m_sceneLogic.sendPreparedFlush(preparedFlush);
+    Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, sendsPreparedFlushOnlyOnceToSubscriberRemovedAndAddedAgainBeforeSending)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    this->m_scene.allocateNode();
+    ClientSceneLogicBase::PreparedFlush preparedFlush;
+    this->m_sceneLogic.prepareFlush(ESceneFlushMode_Asynchronous, {}, preparedFlush);
+
+    // subscriber added again gets scene including prepared flush, but not the prepared flush itself
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(ElementsAre(this->m_rendererID), _, this->m_sceneId, _));
+    this->m_sceneLogic.removeSubscriber(this->m_rendererID);
+    this->addSubscriber();
+    this->m_sceneLogic.sendPreparedFlush(preparedFlush);
+    Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, resendsOnlyMissedFlushesWithOriginalTimeInfoToReturningSubscriberOfSameSceneInstance)
+{
+    const Guid sceneInstanceEpoch = this->publishAndAddSubscriberAndGetSceneInstanceEpoch();
+    EXPECT_FALSE(sceneInstanceEpoch.isInvalid());
+    this->m_sceneLogic.removeSubscriber(this->m_rendererID);
+
+    const FlushTimeInformation fti2{ std::chrono::milliseconds(1), FlushTimeClock::time_point(std::chrono::milliseconds(2)), FlushTimeClock::time_point(std::chrono::milliseconds(3)) };
+    const FlushTimeInformation fti3{ std::chrono::milliseconds(4), FlushTimeClock::time_point(std::chrono::milliseconds(5)), FlushTimeClock::time_point(std::chrono::milliseconds(6)) };
+    this->m_scene.allocateNode();
+    this->flush(fti2);
+    this->m_scene.allocateNode();
+    this->flush(fti3);
+
+    SceneActionCollection resentFlush2;
+    SceneActionCollection resentFlush3;
+    {
+        InSequence seq;
+        EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(this->m_rendererID, _, sceneInstanceEpoch, true, _));
+        EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(ElementsAre(this->m_rendererID), _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(resentFlush2)));
+        EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(ElementsAre(this->m_rendererID), _, this->m_sceneId, _)).WillOnce(WithArgs<1>(INVOKE_SAVE_SCENEACTIONCOLLECTION(resentFlush3)));
+    }
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, sceneInstanceEpoch, 1u);
+    Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
+
+    UInt64 flushIndex = 0u;
+    FlushTimeInformation flushTimeInfo;
+    this->ReadFlushParameters(resentFlush2, flushIndex, flushTimeInfo);
+    EXPECT_EQ(ESceneActionId_AllocateNode, resentFlush2[0].type());
+    EXPECT_EQ(2u, flushIndex);
+    EXPECT_EQ(fti2, flushTimeInfo);
+    this->ReadFlushParameters(resentFlush3, flushIndex, flushTimeInfo);
+    EXPECT_EQ(ESceneActionId_AllocateNode, resentFlush3[0].type());
+    EXPECT_EQ(3u, flushIndex);
+    EXPECT_EQ(fti3, flushTimeInfo);
+
+    // subscriber is active right away
+    this->expectFlushSceneActionList(false, 4u);
+    this->flush();
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, sendsFullSceneToReturningSubscriberOfOtherSceneInstance)
+{
+    this->publishAndAddSubscriberAndGetSceneInstanceEpoch();
+    this->m_sceneLogic.removeSubscriber(this->m_rendererID);
+    this->flush();
+
+    // scene with same ID was recreated in between, flush indices of subscriber's copy are meaningless
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(this->m_rendererID, _, _, false, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(ElementsAre(this->m_rendererID), _, this->m_sceneId, _)).Times(AtLeast(1));
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, Guid(true), 1u);
+    this->flush();
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, sendsFullSceneToReturningSubscriberIfMissedFlushesAreNoLongerInHistory)
+{
+    const Guid sceneInstanceEpoch = this->publishAndAddSubscriberAndGetSceneInstanceEpoch();
+    this->m_sceneLogic.removeSubscriber(this->m_rendererID);
+    for (UInt32 i = 0u; i < ClientSceneLogicBase::FlushHistoryMaxNumberOfFlushes + 1u; ++i)
+    {
+        this->flush();
+    }
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(this->m_rendererID, _, sceneInstanceEpoch, false, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(ElementsAre(this->m_rendererID), _, this->m_sceneId, _)).Times(AtLeast(1));
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, sceneInstanceEpoch, 1u);
+    this->flush();
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, sendsFullSceneToReturningSubscriberIfSceneWasFlushedWhileUnpublished)
+{
+    const Guid sceneInstanceEpoch = this->publishAndAddSubscriberAndGetSceneInstanceEpoch();
+    this->unpublish();
+    this->m_scene.allocateNode();
+    this->flush();
+    this->publish();
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(this->m_rendererID, _, sceneInstanceEpoch, false, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneActionList_rvr(ElementsAre(this->m_rendererID), _, this->m_sceneId, _)).Times(AtLeast(1));
+    this->m_sceneLogic.addSubscriber(this->m_rendererID, sceneInstanceEpoch, 1u);
+    this->flush();
+
+    this->expectSceneUnpublish();
+}
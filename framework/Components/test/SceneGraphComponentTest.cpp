@@ -64,15 +64,15 @@ TEST_F(ASceneGraphComponent, sendsSceneToLocalConsumer)
 {
     sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
 
-    EXPECT_CALL(consumer, handleInitializeScene(_, _)).Times(1);
-    sceneGraphComponent.sendCreateScene(localParticipantID, SceneInfo(SceneId(666u), "test scene"), EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(consumer, handleInitializeScene(_, _, _, _)).Times(1);
+    sceneGraphComponent.sendCreateScene(localParticipantID, SceneInfo(SceneId(666u), "test scene"), Guid(), false, EScenePublicationMode_LocalAndRemote);
 }
 
 TEST_F(ASceneGraphComponent, doesntSendSceneIfLocalConsumerIsntSet)
 {
-    EXPECT_CALL(consumer, handleInitializeScene(_, localParticipantID)).Times(0);
+    EXPECT_CALL(consumer, handleInitializeScene(_, localParticipantID, _, _)).Times(0);
 
-    sceneGraphComponent.sendCreateScene(localParticipantID, SceneInfo(SceneId(666u), "test scene"), EScenePublicationMode_LocalAndRemote);
+    sceneGraphComponent.sendCreateScene(localParticipantID, SceneInfo(SceneId(666u), "test scene"), Guid(), false, EScenePublicationMode_LocalAndRemote);
 }
 
 TEST_F(ASceneGraphComponent, sendsSceneToRemoteProvider)
@@ -80,8 +80,8 @@ TEST_F(ASceneGraphComponent, sendsSceneToRemoteProvider)
     sceneGraphComponent.setSceneProviderServiceHandler(&provider);
 
     SceneInfo sceneInfo(SceneId(666u), "test scene");
-    EXPECT_CALL(communicationSystem, sendInitializeScene(remoteParticipantID, sceneInfo));
-    sceneGraphComponent.sendCreateScene(remoteParticipantID, sceneInfo, EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(remoteParticipantID, sceneInfo, _, _));
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, sceneInfo, Guid(), false, EScenePublicationMode_LocalAndRemote);
 }
 
 TEST_F(ASceneGraphComponent, publishesSceneAtLocalConsumerInLocalAndRemoteMode)
@@ -207,22 +207,22 @@ TEST_F(ASceneGraphComponent, subscribeSceneAtLocalProvider)
 {
     sceneGraphComponent.setSceneProviderServiceHandler(&provider);
 
-    EXPECT_CALL(provider, handleSubscribeScene(_, _)).Times(1);
-    sceneGraphComponent.subscribeScene(localParticipantID, SceneId(0u));
+    EXPECT_CALL(provider, handleSubscribeScene(_, _, _, _)).Times(1);
+    sceneGraphComponent.subscribeScene(localParticipantID, SceneId(0u), Guid(), 0u);
 }
 
 TEST_F(ASceneGraphComponent, doesntSubscribeSceneIfLocalProviderIsntSet)
 {
-    EXPECT_CALL(provider, handleSubscribeScene(_, _)).Times(0);
-    sceneGraphComponent.subscribeScene(localParticipantID, SceneId(0u));
+    EXPECT_CALL(provider, handleSubscribeScene(_, _, _, _)).Times(0);
+    sceneGraphComponent.subscribeScene(localParticipantID, SceneId(0u), Guid(), 0u);
 }
 
 TEST_F(ASceneGraphComponent, subscribeSceneAtRemoteConsumer)
 {
     sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
     SceneId sceneId;
-    EXPECT_CALL(communicationSystem, sendSubscribeScene(remoteParticipantID, sceneId));
-    sceneGraphComponent.subscribeScene(remoteParticipantID, sceneId);
+    EXPECT_CALL(communicationSystem, sendSubscribeScene(remoteParticipantID, sceneId, _, _));
+    sceneGraphComponent.subscribeScene(remoteParticipantID, sceneId, Guid(), 0u);
 }
 
 TEST_F(ASceneGraphComponent, unsubscribesSceneAtLocalProvider)
@@ -243,8 +243,8 @@ TEST_F(ASceneGraphComponent, unsubscribesSceneAtRemoteConsumer)
 {
     const SceneId sceneId(1ull << 63);
     sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
-    EXPECT_CALL(communicationSystem, sendSubscribeScene(_, _));
-    sceneGraphComponent.subscribeScene(remoteParticipantID, sceneId);
+    EXPECT_CALL(communicationSystem, sendSubscribeScene(_, _, _, _));
+    sceneGraphComponent.subscribeScene(remoteParticipantID, sceneId, Guid(), 0u);
     EXPECT_CALL(communicationSystem, sendUnsubscribeScene(remoteParticipantID, sceneId));
     sceneGraphComponent.unsubscribeScene(remoteParticipantID, sceneId);
 }
@@ -269,8 +269,8 @@ TEST_F(ASceneGraphComponent, sendsSceneActionToRemoteProvider)
 {
     sceneGraphComponent.setSceneProviderServiceHandler(&provider);
     SceneId sceneId;
-    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
-    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ sceneId }, EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _, _, _)).Times(1);
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ sceneId }, Guid(), false, EScenePublicationMode_LocalAndRemote);
 
     SceneActionCollection list(createFakeSceneActionCollectionFromTypes({ ESceneActionId_TestAction }));
     EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, sceneId, _, _));
@@ -281,8 +281,8 @@ TEST_F(ASceneGraphComponent, sendsAllSceneActionsAtOnceToRemoteProvider)
 {
     sceneGraphComponent.setSceneProviderServiceHandler(&provider);
     SceneId sceneId;
-    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
-    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ sceneId }, EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _, _, _)).Times(1);
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ sceneId }, Guid(), false, EScenePublicationMode_LocalAndRemote);
 
     SceneActionCollection list(createFakeSceneActionCollectionFromTypes({ ESceneActionId_TestAction, ESceneActionId_SetDataVector2fArray, ESceneActionId_AllocateNode }));
     EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, sceneId, _, _)).Times(1);
@@ -371,8 +371,8 @@ TEST_F(ASceneGraphComponent, sceneactionCounterIsAlwaysZeroWithLocalScenes)
 TEST_F(ASceneGraphComponent, sceneactionCounterIsCountingUpForNOnLocalScenes)
 {
     sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
-    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
-    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{SceneId(666u)}, EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _, _, _)).Times(1);
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{SceneId(666u)}, Guid(), false, EScenePublicationMode_LocalAndRemote);
 
     SceneActionCollection list(createFakeSceneActionCollectionFromTypes({ ESceneActionId_TestAction }));
     testing::InSequence sequence;
@@ -389,8 +389,8 @@ TEST_F(ASceneGraphComponent, sceneactionCounterIsCountingUpForNOnLocalScenes)
 TEST_F(ASceneGraphComponent, sceneactionCounterIsCountingAccordingToNumberOfSentChunks)
 {
     sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
-    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
-    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ SceneId(666u) }, EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _, _, _)).Times(1);
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ SceneId(666u) }, Guid(), false, EScenePublicationMode_LocalAndRemote);
 
     SceneActionCollection list(createFakeSceneActionCollectionFromTypes({ ESceneActionId_TestAction }));
     testing::InSequence sequence;
@@ -407,8 +407,8 @@ TEST_F(ASceneGraphComponent, sceneactionCounterIsCountingAccordingToNumberOfSent
 TEST_F(ASceneGraphComponent, sceneactionCounterIsWrappedAround)
 {
     sceneGraphComponent.setSceneRendererServiceHandler(&consumer);
-    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
-    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ SceneId(666u) }, EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _, _, _)).Times(1);
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ SceneId(666u) }, Guid(), false, EScenePublicationMode_LocalAndRemote);
 
     SceneActionCollection list(createFakeSceneActionCollectionFromTypes({ ESceneActionId_TestAction }));
 
@@ -479,14 +479,14 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
 
     EXPECT_CALL(communicationSystem, sendScenesAvailable(remoteParticipantID, SceneInfoVector{ sceneInfo }));
     sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
-    sceneGraphComponent.handleSceneSubscription(SceneId(1), remoteParticipantID);
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), remoteParticipantID, Guid(), 0u);
 
-    sceneGraphComponent.handleSceneSubscription(SceneId(1), localParticipantID);
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), localParticipantID, Guid(), 0u);
 
-    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _, _, _));
     EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 1));
 
-    EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _));
+    EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _, _, _));
     EXPECT_CALL(consumer, handleSceneActionList_rvr(SceneId(1), _, 0, _));
 
     sceneGraphComponent.handleFlush(SceneId(1), ESceneFlushMode_Synchronous, {});
@@ -503,9 +503,9 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     EXPECT_CALL(communicationSystem, sendScenesAvailable(remoteParticipantID, SceneInfoVector{ sceneInfo }));
     sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
 
-    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _, _, _));
     EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 1)).WillOnce(Return(1));
-    sceneGraphComponent.handleSceneSubscription(SceneId(1), remoteParticipantID);
+    sceneGraphComponent.handleSceneSubscription(SceneId(1), remoteParticipantID, Guid(), 0u);
 
     // flush again, remote now at flushCounter 2, local always 0
     EXPECT_CALL(communicationSystem, sendSceneActionList(remoteParticipantID, SceneId(1), _, 2)).WillOnce(Return(1));
@@ -63,12 +63,13 @@ namespace ramses_internal
         const String name("test");
         const SceneId sceneId(1ull << 63);
         SceneInfo sceneInfo(sceneId, name);
+        const Guid sceneInstanceEpoch(true);
 
         {
             PlatformGuard g(receiverExpectCallLock);
-            EXPECT_CALL(consumerHandler, handleInitializeScene(sceneInfo, senderId)).WillOnce(SendHandlerCalledEvent(this));
+            EXPECT_CALL(consumerHandler, handleInitializeScene(sceneInfo, senderId, sceneInstanceEpoch, true)).WillOnce(SendHandlerCalledEvent(this));
         }
-        EXPECT_TRUE(sender.sendInitializeScene(receiverId, sceneInfo));
+        EXPECT_TRUE(sender.sendInitializeScene(receiverId, sceneInfo, sceneInstanceEpoch, true));
         ASSERT_TRUE(waitForEvent());
 
         EXPECT_LE(numberMessagesSent + 1, m_senderTestWrapper->statisticCollection.statMessagesSent.getCounterValue());
@@ -150,11 +151,12 @@ namespace ramses_internal
         uint32_t numberMessagesReceived = m_receiverTestWrapper->statisticCollection.statMessagesReceived.getCounterValue();
 
         SceneId sceneId;
+        const Guid sceneInstanceEpoch(true);
         {
             PlatformGuard g(receiverExpectCallLock);
-            EXPECT_CALL(providerHandler, handleSubscribeScene(sceneId, senderId)).WillOnce(SendHandlerCalledEvent(this));
+            EXPECT_CALL(providerHandler, handleSubscribeScene(sceneId, senderId, sceneInstanceEpoch, 1ull << 63)).WillOnce(SendHandlerCalledEvent(this));
         }
-        EXPECT_TRUE(sender.sendSubscribeScene(receiverId, sceneId));
+        EXPECT_TRUE(sender.sendSubscribeScene(receiverId, sceneId, sceneInstanceEpoch, 1ull << 63));
         ASSERT_TRUE(waitForEvent());
 
         EXPECT_LE(numberMessagesSent + 1, m_senderTestWrapper->statisticCollection.statMessagesSent.getCounterValue());
@@ -37,7 +37,7 @@ namespace ramses_internal
     {
         SceneId sceneid(1234u);
         SceneInfo info(sceneid);
-        scenegraphProvider.sendCreateScene(consumerGuid, info, EScenePublicationMode_LocalAndRemote);
+        scenegraphProvider.sendCreateScene(consumerGuid, info, Guid(), false, EScenePublicationMode_LocalAndRemote);
         EXPECT_CALL(consumer, handleSceneActionList_rvr(_, _, 1u, _));
         scenegraphProvider.sendSceneActionList({ consumerGuid }, SceneActionCollection(), sceneid, EScenePublicationMode_LocalAndRemote);
     }
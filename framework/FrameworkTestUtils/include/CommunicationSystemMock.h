@@ -38,11 +38,11 @@ namespace ramses_internal
         MOCK_METHOD1(broadcastScenesBecameUnavailable, bool(const SceneInfoVector& unavailableScenes));
         MOCK_METHOD2(sendScenesAvailable, bool(const Guid& to, const SceneInfoVector& availableScenes));
 
-        MOCK_METHOD2(sendSubscribeScene, bool(const Guid& to, const SceneId& sceneId));
+        MOCK_METHOD4(sendSubscribeScene, bool(const Guid& to, const SceneId& sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex));
         MOCK_METHOD2(sendUnsubscribeScene, bool(const Guid& to, const SceneId& sceneId));
         MOCK_METHOD2(sendSceneNotAvailable, bool(const Guid& to, const SceneId& sceneId));
 
-        MOCK_METHOD2(sendInitializeScene, bool(const Guid& to, const SceneInfo& sceneInfo));
+        MOCK_METHOD4(sendInitializeScene, bool(const Guid& to, const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush));
         MOCK_METHOD4(sendSceneActionList, uint64_t(const Guid& to, const SceneId& sceneId, const SceneActionCollection& actions, const uint64_t& actionListCounter));
 
         MOCK_CONST_METHOD0(logConnectionInfo, void());
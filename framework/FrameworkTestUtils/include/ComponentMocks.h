@@ -72,7 +72,7 @@ namespace ramses_internal
         MOCK_METHOD1(handleUnpublishScene, void(SceneId sceneId));
         MOCK_METHOD3(handleFlush, void(SceneId sceneId, ESceneFlushMode flushMode, const FlushTimeInformation&));
         MOCK_METHOD1(handleRemoveScene, void(SceneId sceneId));
-        MOCK_METHOD2(handleSceneSubscription, void(SceneId sceneId, const Guid& subscriber));
+        MOCK_METHOD4(handleSceneSubscription, void(SceneId sceneId, const Guid& subscriber, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex));
         MOCK_METHOD2(handleSceneUnsubscription, void(SceneId sceneId, const Guid& subscriber));
     };
 
@@ -82,7 +82,7 @@ namespace ramses_internal
         SceneGraphConsumerComponentMock();
         ~SceneGraphConsumerComponentMock() override;
 
-        MOCK_METHOD2(subscribeScene, void(const Guid& to, SceneId sceneId));
+        MOCK_METHOD4(subscribeScene, void(const Guid& to, SceneId sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex));
         MOCK_METHOD2(unsubscribeScene, void(const Guid& to, SceneId sceneId));
 
         virtual void setSceneRendererServiceHandler(ISceneRendererServiceHandler*) override
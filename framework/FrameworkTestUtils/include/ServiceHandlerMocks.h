@@ -40,7 +40,7 @@ namespace ramses_internal
         SceneProviderServiceHandlerMock();
         ~SceneProviderServiceHandlerMock() override;
 
-        MOCK_METHOD2(handleSubscribeScene, void(const SceneId& sceneId, const Guid& consumerID));
+        MOCK_METHOD4(handleSubscribeScene, void(const SceneId& sceneId, const Guid& consumerID, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex));
         MOCK_METHOD2(handleUnsubscribeScene, void(const SceneId& sceneId, const Guid& consumerID));
     };
 
@@ -55,7 +55,7 @@ namespace ramses_internal
 
         MOCK_METHOD2(handleSceneNotAvailable, void(const SceneId& sceneId, const Guid& providerID));
 
-        MOCK_METHOD2(handleInitializeScene, void(const SceneInfo& sceneInfo, const Guid& providerID));
+        MOCK_METHOD4(handleInitializeScene, void(const SceneInfo& sceneInfo, const Guid& providerID, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush));
         MOCK_METHOD4(handleSceneActionList_rvr, void(const SceneId& sceneId, const SceneActionCollection& actions, const uint64_t& counter, const Guid& providerID));
         virtual void handleSceneActionList(const SceneId& sceneId, SceneActionCollection&& actions, const uint64_t& counter, const Guid& providerID) override
         {
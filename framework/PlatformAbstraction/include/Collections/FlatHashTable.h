@@ -0,0 +1,813 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FLATHASHTABLE_H
+#define RAMSES_FLATHASHTABLE_H
+
+#include <ramses-capu/container/Hash.h>
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <type_traits>
+#include <functional>
+#include <utility>
+#include <new>
+#include <cstring>
+#include <cassert>
+
+namespace ramses_internal
+{
+    /*  Hash table with open addressing used as storage of HashMap and HashSet.
+
+        Key/value pairs are stored densely in an entry array in order of insertion. The index is a flat slot array
+        holding the entry of each slot, next to it an array of control bytes keeps for every slot either a 7 bit
+        fragment of the key's hash or a marker for an empty slot. Lookups probe linearly from the home slot and
+        compare 8 control bytes at once (SWAR), so the key comparator is only called for slots with matching hash fragment.
+
+        Probing never wraps around, overflow slots after the last home slot take up collisions at the end and
+        are doubled if a probe sequence runs past them, the control byte after the last slot is a sentinel.
+        Removal shifts following slots of the same probe sequence back instead of leaving tombstones in the index,
+        the removed entry stays unused until the entries are compacted when the table runs out of free entries.
+
+        Iteration visits elements from the most recently to the least recently inserted one, which is the order
+        the chained capu hash table used for keys in distinct buckets and which users rely on (e.g. for the order of renderer events).
+        An iterator which was used for removal stays valid and continues with the next element, removal does not
+        invalidate iterators and pointers to other elements. Any insertion which grows or compacts the table does.
+    */
+    template <class Key, class T, class C = std::equal_to<Key>, class H = ramses_capu::Hash<Key>>
+    class FlatHashTable final
+    {
+    public:
+        class Pair
+        {
+        public:
+            Pair(const Key& key_, const T& value_)
+                : key(key_)
+                , value(value_)
+            {
+            }
+
+            const Key key;
+            T value;
+        };
+
+    private:
+        typedef typename std::aligned_storage<sizeof(Pair), alignof(Pair)>::type Slot;
+
+        template <typename PairType, typename SlotType>
+        class IteratorBase
+        {
+        public:
+            PairType& operator*() const
+            {
+                return *reinterpret_cast<PairType*>(m_entries + m_position - 1u);
+            }
+
+            PairType* operator->() const
+            {
+                return reinterpret_cast<PairType*>(m_entries + m_position - 1u);
+            }
+
+        protected:
+            IteratorBase(const Bool* entryUsed, SlotType* entries, UInt position)
+                : m_entryUsed(entryUsed)
+                , m_entries(entries)
+                , m_position(position)
+            {
+                skipUnusedEntries();
+            }
+
+            void advance()
+            {
+                --m_position;
+                skipUnusedEntries();
+            }
+
+            void skipUnusedEntries()
+            {
+                while (m_position != 0u && !m_entryUsed[m_position - 1u])
+                {
+                    --m_position;
+                }
+            }
+
+            const Bool* m_entryUsed;
+            SlotType* m_entries;
+            // one past the index of the current entry, entries are visited backwards and 0 is the end
+            UInt m_position;
+
+            friend class FlatHashTable;
+        };
+
+    public:
+        class Iterator;
+
+        class ConstIterator : public IteratorBase<const Pair, const Slot>
+        {
+        public:
+            bool operator==(const ConstIterator& other) const
+            {
+                return this->m_position == other.m_position;
+            }
+
+            bool operator!=(const ConstIterator& other) const
+            {
+                return this->m_position != other.m_position;
+            }
+
+            ConstIterator& operator++()
+            {
+                this->advance();
+                return *this;
+            }
+
+            ConstIterator operator++(int32_t)
+            {
+                ConstIterator oldValue(*this);
+                this->advance();
+                return oldValue;
+            }
+
+        private:
+            ConstIterator(const Bool* entryUsed, const Slot* entries, UInt position)
+                : IteratorBase<const Pair, const Slot>(entryUsed, entries, position)
+            {
+            }
+
+            friend class FlatHashTable;
+            friend class Iterator;
+        };
+
+        class Iterator : public IteratorBase<Pair, Slot>
+        {
+        public:
+            Iterator(const ConstIterator& iter)
+                : IteratorBase<Pair, Slot>(iter.m_entryUsed, const_cast<Slot*>(iter.m_entries), iter.m_position)
+            {
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return this->m_position == other.m_position;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return this->m_position != other.m_position;
+            }
+
+            Iterator& operator++()
+            {
+                this->advance();
+                return *this;
+            }
+
+            Iterator operator++(int32_t)
+            {
+                Iterator oldValue(*this);
+                this->advance();
+                return oldValue;
+            }
+
+        private:
+            Iterator(const Bool* entryUsed, Slot* entries, UInt position)
+                : IteratorBase<Pair, Slot>(entryUsed, entries, position)
+            {
+            }
+
+            friend class FlatHashTable;
+        };
+
+        FlatHashTable();
+        explicit FlatHashTable(UInt capacity);
+        FlatHashTable(const FlatHashTable& other);
+        FlatHashTable(FlatHashTable&& other);
+        ~FlatHashTable();
+
+        FlatHashTable& operator=(const FlatHashTable& other);
+        FlatHashTable& operator=(FlatHashTable&& other);
+
+        // returns true if the key was inserted, false if the value of an existing key was overwritten
+        Bool put(const Key& key, const T& value);
+        T& operator[](const Key& key);
+
+        Iterator find(const Key& key);
+        ConstIterator find(const Key& key) const;
+        Bool contains(const Key& key) const;
+
+        // returns false if the key is not contained
+        Bool remove(const Key& key, T* value_old = nullptr);
+        // iterator is moved to the next element
+        void remove(Iterator& iter, T* value_old = nullptr);
+
+        UInt count() const;
+        // number of elements which can be stored without growing the table
+        UInt capacity() const;
+        void reserve(UInt capacity);
+        void clear();
+        void swap(FlatHashTable& other);
+
+        Iterator begin();
+        Iterator end();
+        ConstIterator begin() const;
+        ConstIterator end() const;
+
+    private:
+        static const UInt GroupWidth = 8u;
+        static const UInt MinimumOverflowSlots = GroupWidth;
+        static const UInt8 Empty = 0x80;
+        static const UInt8 Sentinel = 0xFF;
+        static const UInt64 LowBits = 0x0101010101010101ull;
+        static const UInt64 HighBits = 0x8080808080808080ull;
+
+        static UInt64 LoadGroup(const UInt8* control);
+        static UInt64 MatchTag(UInt64 group, UInt8 tag);
+        static UInt64 MatchNotFull(UInt64 group);
+        static UInt FirstMatch(UInt64 matches);
+        static UInt HomeSlotCountForCapacity(UInt capacity);
+        static UInt CapacityForHomeSlotCount(UInt homeSlotCount);
+
+        UInt64 mixedHash(const Key& key) const;
+        UInt homeSlot(UInt64 mixedHash) const;
+        static UInt8 Tag(UInt64 mixedHash);
+
+        Pair& entryAt(UInt entry);
+        const Pair& entryAt(UInt entry) const;
+
+        UInt findIndex(const Key& key) const;
+        UInt findInsertIndex(UInt64 mixedHash) const;
+        UInt insertNew(const Key& key, const T& value);
+        void removeAt(UInt index, T* value_old);
+        void allocateEntries(UInt capacity);
+        void allocateIndex(UInt homeSlotCount, UInt overflowSlotCount);
+        void rehash(UInt homeSlotCount);
+        void reindex(UInt homeSlotCount, UInt overflowSlotCount);
+        Bool indexAllEntries();
+        void destroyAll();
+        void release();
+
+        UInt8* m_control;
+        UInt32* m_slotEntries;
+        Slot* m_entries;
+        Bool* m_entryUsed;
+        UInt m_homeSlotCount;
+        UInt8 m_homeSlotBits;
+        UInt m_slotCount;
+        // entries after the last used one are free, entries before can be unused after removal
+        UInt m_entryCount;
+        UInt m_count;
+        UInt m_capacity;
+        C m_comparator;
+    };
+
+    template <class Key, class T, class C, class H>
+    inline FlatHashTable<Key, T, C, H>::FlatHashTable()
+        : m_control(nullptr)
+        , m_slotEntries(nullptr)
+        , m_entries(nullptr)
+        , m_entryUsed(nullptr)
+        , m_homeSlotCount(0u)
+        , m_homeSlotBits(0u)
+        , m_slotCount(0u)
+        , m_entryCount(0u)
+        , m_count(0u)
+        , m_capacity(0u)
+        , m_comparator()
+    {
+    }
+
+    template <class Key, class T, class C, class H>
+    inline FlatHashTable<Key, T, C, H>::FlatHashTable(UInt capacity)
+        : FlatHashTable()
+    {
+        reserve(capacity);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline FlatHashTable<Key, T, C, H>::FlatHashTable(const FlatHashTable& other)
+        : FlatHashTable()
+    {
+        if (other.m_count == 0u)
+        {
+            return;
+        }
+
+        // same layout as other, so entries and index can be copied one by one without rehashing
+        allocateEntries(other.m_capacity);
+        for (UInt entry = 0u; entry < other.m_entryCount; ++entry)
+        {
+            if (other.m_entryUsed[entry])
+            {
+                new (&m_entries[entry]) Pair(other.entryAt(entry));
+                m_entryUsed[entry] = true;
+            }
+        }
+        m_entryCount = other.m_entryCount;
+        m_count = other.m_count;
+
+        allocateIndex(other.m_homeSlotCount, other.m_slotCount - other.m_homeSlotCount);
+        std::memcpy(m_control, other.m_control, m_slotCount + GroupWidth);
+        std::memcpy(m_slotEntries, other.m_slotEntries, m_slotCount * sizeof(UInt32));
+    }
+
+    template <class Key, class T, class C, class H>
+    inline FlatHashTable<Key, T, C, H>::FlatHashTable(FlatHashTable&& other)
+        : FlatHashTable()
+    {
+        swap(other);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline FlatHashTable<Key, T, C, H>::~FlatHashTable()
+    {
+        release();
+    }
+
+    template <class Key, class T, class C, class H>
+    inline FlatHashTable<Key, T, C, H>& FlatHashTable<Key, T, C, H>::operator=(const FlatHashTable& other)
+    {
+        if (&other != this)
+        {
+            FlatHashTable copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline FlatHashTable<Key, T, C, H>& FlatHashTable<Key, T, C, H>::operator=(FlatHashTable&& other)
+    {
+        if (&other != this)
+        {
+            FlatHashTable empty;
+            swap(empty);
+            swap(other);
+        }
+        return *this;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline Bool FlatHashTable<Key, T, C, H>::put(const Key& key, const T& value)
+    {
+        const UInt index = findIndex(key);
+        if (index != m_slotCount)
+        {
+            entryAt(m_slotEntries[index]).value = value;
+            return false;
+        }
+
+        insertNew(key, value);
+        return true;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline T& FlatHashTable<Key, T, C, H>::operator[](const Key& key)
+    {
+        const UInt index = findIndex(key);
+        if (index == m_slotCount)
+        {
+            return entryAt(insertNew(key, T())).value;
+        }
+        return entryAt(m_slotEntries[index]).value;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline typename FlatHashTable<Key, T, C, H>::Iterator FlatHashTable<Key, T, C, H>::find(const Key& key)
+    {
+        const UInt index = findIndex(key);
+        return Iterator(m_entryUsed, m_entries, index == m_slotCount ? 0u : m_slotEntries[index] + 1u);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline typename FlatHashTable<Key, T, C, H>::ConstIterator FlatHashTable<Key, T, C, H>::find(const Key& key) const
+    {
+        const UInt index = findIndex(key);
+        return ConstIterator(m_entryUsed, m_entries, index == m_slotCount ? 0u : m_slotEntries[index] + 1u);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline Bool FlatHashTable<Key, T, C, H>::contains(const Key& key) const
+    {
+        return findIndex(key) != m_slotCount;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline Bool FlatHashTable<Key, T, C, H>::remove(const Key& key, T* value_old)
+    {
+        const UInt index = findIndex(key);
+        if (index == m_slotCount)
+        {
+            return false;
+        }
+
+        removeAt(index, value_old);
+        return true;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::remove(Iterator& iter, T* value_old)
+    {
+        removeAt(findIndex(iter->key), value_old);
+        // the entry is now unused, continue with the next one
+        iter.skipUnusedEntries();
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::count() const
+    {
+        return m_count;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::capacity() const
+    {
+        return m_capacity;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::reserve(UInt capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            rehash(HomeSlotCountForCapacity(capacity));
+        }
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::clear()
+    {
+        if (m_count == 0u)
+        {
+            return;
+        }
+
+        destroyAll();
+        std::memset(m_entryUsed, 0, m_entryCount * sizeof(Bool));
+        std::memset(m_control, Empty, m_slotCount);
+        m_entryCount = 0u;
+        m_count = 0u;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::swap(FlatHashTable& other)
+    {
+        using std::swap;
+        swap(m_control, other.m_control);
+        swap(m_slotEntries, other.m_slotEntries);
+        swap(m_entries, other.m_entries);
+        swap(m_entryUsed, other.m_entryUsed);
+        swap(m_homeSlotCount, other.m_homeSlotCount);
+        swap(m_homeSlotBits, other.m_homeSlotBits);
+        swap(m_slotCount, other.m_slotCount);
+        swap(m_entryCount, other.m_entryCount);
+        swap(m_count, other.m_count);
+        swap(m_capacity, other.m_capacity);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline typename FlatHashTable<Key, T, C, H>::Iterator FlatHashTable<Key, T, C, H>::begin()
+    {
+        return Iterator(m_entryUsed, m_entries, m_entryCount);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline typename FlatHashTable<Key, T, C, H>::Iterator FlatHashTable<Key, T, C, H>::end()
+    {
+        return Iterator(m_entryUsed, m_entries, 0u);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline typename FlatHashTable<Key, T, C, H>::ConstIterator FlatHashTable<Key, T, C, H>::begin() const
+    {
+        return ConstIterator(m_entryUsed, m_entries, m_entryCount);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline typename FlatHashTable<Key, T, C, H>::ConstIterator FlatHashTable<Key, T, C, H>::end() const
+    {
+        return ConstIterator(m_entryUsed, m_entries, 0u);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt64 FlatHashTable<Key, T, C, H>::LoadGroup(const UInt8* control)
+    {
+        // assembled byte by byte to be independent of endianess, compilers turn this into a single load
+        UInt64 group = 0u;
+        for (UInt i = 0u; i < GroupWidth; ++i)
+        {
+            group |= static_cast<UInt64>(control[i]) << (8u * i);
+        }
+        return group;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt64 FlatHashTable<Key, T, C, H>::MatchTag(UInt64 group, UInt8 tag)
+    {
+        // high bit set for every byte equal to tag, may have false positives (never on empty or sentinel bytes)
+        // which are sorted out by the key comparison
+        const UInt64 diff = group ^ (LowBits * tag);
+        return (diff - LowBits) & ~diff & HighBits;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt64 FlatHashTable<Key, T, C, H>::MatchNotFull(UInt64 group)
+    {
+        return group & HighBits;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::FirstMatch(UInt64 matches)
+    {
+        UInt index = 0u;
+        while ((matches & 0x80u) == 0u)
+        {
+            matches >>= 8u;
+            ++index;
+        }
+        return index;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::HomeSlotCountForCapacity(UInt capacity)
+    {
+        UInt homeSlotCount = GroupWidth;
+        while (CapacityForHomeSlotCount(homeSlotCount) < capacity)
+        {
+            homeSlotCount *= 2u;
+        }
+        return homeSlotCount;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::CapacityForHomeSlotCount(UInt homeSlotCount)
+    {
+        // maximum load factor of 3/4 keeps linear probe sequences within one or two groups
+        return homeSlotCount - homeSlotCount / 4u;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt64 FlatHashTable<Key, T, C, H>::mixedHash(const Key& key) const
+    {
+        // fibonacci hashing spreads the weak hashes of integral keys (e.g. handles) over all bits
+        return static_cast<UInt64>(H()(key)) * 0x9E3779B97F4A7C15ull;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::homeSlot(UInt64 mixedHash) const
+    {
+        return m_homeSlotBits == 0u ? 0u : static_cast<UInt>(mixedHash >> (64u - m_homeSlotBits));
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt8 FlatHashTable<Key, T, C, H>::Tag(UInt64 mixedHash)
+    {
+        return static_cast<UInt8>(mixedHash & 0x7Fu);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline typename FlatHashTable<Key, T, C, H>::Pair& FlatHashTable<Key, T, C, H>::entryAt(UInt entry)
+    {
+        return *reinterpret_cast<Pair*>(&m_entries[entry]);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline const typename FlatHashTable<Key, T, C, H>::Pair& FlatHashTable<Key, T, C, H>::entryAt(UInt entry) const
+    {
+        return *reinterpret_cast<const Pair*>(&m_entries[entry]);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::findIndex(const Key& key) const
+    {
+        if (m_count == 0u)
+        {
+            return m_slotCount;
+        }
+
+        const UInt64 hash = mixedHash(key);
+        const UInt8 tag = Tag(hash);
+        UInt position = homeSlot(hash);
+        for (;;)
+        {
+            // probe sequence ends at the first empty slot or the sentinel, there are no tombstones
+            const UInt64 group = LoadGroup(m_control + position);
+            const UInt64 notFull = MatchNotFull(group);
+            UInt64 matches = MatchTag(group, tag);
+            if (notFull != 0u)
+            {
+                // ignore matches behind the end of the probe sequence
+                matches &= (notFull ^ (notFull - 1u)) >> 1u;
+            }
+
+            while (matches != 0u)
+            {
+                const UInt index = position + FirstMatch(matches);
+                if (m_comparator(entryAt(m_slotEntries[index]).key, key))
+                {
+                    return index;
+                }
+                matches &= matches - 1u;
+            }
+
+            if (notFull != 0u)
+            {
+                return m_slotCount;
+            }
+            position += GroupWidth;
+        }
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::findInsertIndex(UInt64 mixedHash) const
+    {
+        UInt position = homeSlot(mixedHash);
+        for (;;)
+        {
+            const UInt64 notFull = MatchNotFull(LoadGroup(m_control + position));
+            if (notFull != 0u)
+            {
+                // may be the sentinel index if the probe sequence reached the end of the table
+                return position + FirstMatch(notFull);
+            }
+            position += GroupWidth;
+        }
+    }
+
+    template <class Key, class T, class C, class H>
+    inline UInt FlatHashTable<Key, T, C, H>::insertNew(const Key& key, const T& value)
+    {
+        if (m_entryCount == m_capacity)
+        {
+            // compact unused entries if at least half of the entries can be freed that way, grow otherwise
+            rehash(m_count < m_capacity / 2u ? m_homeSlotCount : HomeSlotCountForCapacity(m_capacity + 1u));
+        }
+
+        const UInt64 hash = mixedHash(key);
+        UInt index = findInsertIndex(hash);
+        while (index >= m_slotCount)
+        {
+            // probe sequence ran into the end of the overflow slots, more home slots would not help
+            // if many keys share the last home slots
+            reindex(m_homeSlotCount, (m_slotCount - m_homeSlotCount) * 2u);
+            index = findInsertIndex(hash);
+        }
+
+        const UInt entry = m_entryCount;
+        new (&m_entries[entry]) Pair(key, value);
+        m_entryUsed[entry] = true;
+        ++m_entryCount;
+
+        m_control[index] = Tag(hash);
+        m_slotEntries[index] = static_cast<UInt32>(entry);
+        ++m_count;
+        return entry;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::removeAt(UInt index, T* value_old)
+    {
+        const UInt entry = m_slotEntries[index];
+        if (value_old)
+        {
+            *value_old = entryAt(entry).value;
+        }
+        entryAt(entry).~Pair();
+        m_entryUsed[entry] = false;
+        // unused entries at the end are taken by following insertions right away
+        while (m_entryCount != 0u && !m_entryUsed[m_entryCount - 1u])
+        {
+            --m_entryCount;
+        }
+
+        // backward shift: move following slots of the probe sequence into the hole
+        // if the hole is not before their home slot, so that no probe sequence gets interrupted
+        UInt hole = index;
+        for (UInt next = index + 1u; m_control[next] < Empty; ++next)
+        {
+            if (homeSlot(mixedHash(entryAt(m_slotEntries[next]).key)) <= hole)
+            {
+                m_control[hole] = m_control[next];
+                m_slotEntries[hole] = m_slotEntries[next];
+                hole = next;
+            }
+        }
+
+        m_control[hole] = Empty;
+        --m_count;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::allocateEntries(UInt capacity)
+    {
+        m_capacity = capacity;
+        m_entries = new Slot[capacity];
+        m_entryUsed = new Bool[capacity]();
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::allocateIndex(UInt homeSlotCount, UInt overflowSlotCount)
+    {
+        assert(homeSlotCount >= GroupWidth && (homeSlotCount & (homeSlotCount - 1u)) == 0u);
+        delete[] m_control;
+        delete[] m_slotEntries;
+
+        m_homeSlotCount = homeSlotCount;
+        m_homeSlotBits = 0u;
+        while ((static_cast<UInt>(1u) << m_homeSlotBits) < homeSlotCount)
+        {
+            ++m_homeSlotBits;
+        }
+        m_slotCount = homeSlotCount + overflowSlotCount;
+
+        // one group of control bytes more than slots, so that groups can be loaded at any slot index
+        m_control = new UInt8[m_slotCount + GroupWidth];
+        std::memset(m_control, Empty, m_slotCount + GroupWidth);
+        m_control[m_slotCount] = Sentinel;
+        m_slotEntries = new UInt32[m_slotCount];
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::rehash(UInt homeSlotCount)
+    {
+        // move used entries without gaps and in same order to new storage
+        Slot* const oldEntries = m_entries;
+        Bool* const oldEntryUsed = m_entryUsed;
+        const UInt oldEntryCount = m_entryCount;
+        allocateEntries(CapacityForHomeSlotCount(homeSlotCount));
+        m_entryCount = 0u;
+        for (UInt entry = 0u; entry < oldEntryCount; ++entry)
+        {
+            if (oldEntryUsed[entry])
+            {
+                Pair& pair = *reinterpret_cast<Pair*>(&oldEntries[entry]);
+                new (&m_entries[m_entryCount]) Pair(std::move(pair));
+                pair.~Pair();
+                m_entryUsed[m_entryCount] = true;
+                ++m_entryCount;
+            }
+        }
+        delete[] oldEntries;
+        delete[] oldEntryUsed;
+
+        reindex(homeSlotCount, MinimumOverflowSlots);
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::reindex(UInt homeSlotCount, UInt overflowSlotCount)
+    {
+        allocateIndex(homeSlotCount, overflowSlotCount);
+        while (!indexAllEntries())
+        {
+            // very unlikely clustering at the end of the table, start over with more overflow slots
+            overflowSlotCount *= 2u;
+            allocateIndex(homeSlotCount, overflowSlotCount);
+        }
+    }
+
+    template <class Key, class T, class C, class H>
+    inline Bool FlatHashTable<Key, T, C, H>::indexAllEntries()
+    {
+        for (UInt entry = 0u; entry < m_entryCount; ++entry)
+        {
+            if (m_entryUsed[entry])
+            {
+                const UInt64 hash = mixedHash(entryAt(entry).key);
+                const UInt index = findInsertIndex(hash);
+                if (index >= m_slotCount)
+                {
+                    return false;
+                }
+                m_control[index] = Tag(hash);
+                m_slotEntries[index] = static_cast<UInt32>(entry);
+            }
+        }
+        return true;
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::destroyAll()
+    {
+        for (UInt entry = 0u; entry < m_entryCount; ++entry)
+        {
+            if (m_entryUsed[entry])
+            {
+                entryAt(entry).~Pair();
+            }
+        }
+    }
+
+    template <class Key, class T, class C, class H>
+    inline void FlatHashTable<Key, T, C, H>::release()
+    {
+        destroyAll();
+        delete[] m_control;
+        delete[] m_slotEntries;
+        delete[] m_entries;
+        delete[] m_entryUsed;
+    }
+}
+
+#endif
@@ -10,6 +10,7 @@
 #define RAMSES_UTILS_HASHMAP_H
 
 #include <ramses-capu/container/HashTable.h>
+#include "Collections/FlatHashTable.h"
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "PlatformAbstraction/PlatformError.h"
 #include <cmath>
@@ -20,8 +21,8 @@ namespace ramses_internal
     class HashMap
     {
     public:
-        typedef typename ramses_capu::HashTable<Key, T, C>::Iterator Iterator;
-        typedef typename ramses_capu::HashTable<Key, T, C>::ConstIterator ConstIterator;
+        typedef typename FlatHashTable<Key, T, C>::Iterator Iterator;
+        typedef typename FlatHashTable<Key, T, C>::ConstIterator ConstIterator;
 
         HashMap();
         HashMap(const HashMap& other);
@@ -52,7 +53,7 @@ namespace ramses_internal
         HashMap& operator=(HashMap<Key, T, C>&& other);
 
     private:
-        typename ramses_capu::HashTable<Key, T, C> m_hashTable;
+        FlatHashTable<Key, T, C> m_hashTable;
     };
 
     template <class Key, class T, class C>
@@ -118,14 +119,15 @@ namespace ramses_internal
     inline
     EStatus HashMap<Key, T, C>::put(const Key& key, const T& value)
     {
-        return static_cast<EStatus>(m_hashTable.put(key, value));
+        m_hashTable.put(key, value);
+        return EStatus_RAMSES_OK;
     }
 
     template<class Key, class T, class C>
     inline
     EStatus HashMap<Key, T, C>::get(const Key& key, T& value)  const
     {
-        HashMap<Key, T, C>::Iterator iter = m_hashTable.find(key);
+        ConstIterator iter = m_hashTable.find(key);
         if (iter != m_hashTable.end())
         {
             value = iter->value;
@@ -139,10 +141,10 @@ namespace ramses_internal
     T* HashMap<Key, T, C>::get(const Key& key) const
     {
         T* result = 0;
-        typename HashMap<Key, T, C>::Iterator iter = m_hashTable.find(key);
+        ConstIterator iter = m_hashTable.find(key);
         if (iter != m_hashTable.end())
         {
-            result = &iter->value;
+            result = const_cast<T*>(&iter->value);
         }
         return result;
     }
@@ -158,14 +160,15 @@ namespace ramses_internal
     inline
     EStatus HashMap<Key, T, C>::remove(const Key& key, T* value_old)
     {
-        return static_cast<EStatus>(m_hashTable.remove(key, value_old));
+        return m_hashTable.remove(key, value_old) ? EStatus_RAMSES_OK : EStatus_RAMSES_ERANGE;
     }
 
     template<class Key, class T, class C>
     inline
     EStatus HashMap<Key, T, C>::remove(Iterator& iter, T* value_old)
     {
-        return static_cast<EStatus>(m_hashTable.remove(iter, value_old));
+        m_hashTable.remove(iter, value_old);
+        return EStatus_RAMSES_OK;
     }
 
     template<class Key, class T, class C>
@@ -9,20 +9,72 @@
 #ifndef RAMSES_UTILS_HASHSET_H
 #define RAMSES_UTILS_HASHSET_H
 
-#include <ramses-capu/container/HashSet.h>
+#include "Collections/FlatHashTable.h"
 #include <PlatformAbstraction/PlatformError.h>
 #include "PlatformAbstraction/PlatformTypes.h"
 #include <cmath>
+#include <iterator>
 
 namespace ramses_internal
 {
     template<class T>
     class HashSet
     {
+    private:
+        typedef FlatHashTable<T, char> HashTableType;
+
+        template<typename HashTableIteratorType>
+        class HashSetIterator
+        {
+        public:
+            const T& operator*() const
+            {
+                return m_iter->key;
+            }
+
+            const T* operator->() const
+            {
+                return &m_iter->key;
+            }
+
+            bool operator==(const HashSetIterator& other) const
+            {
+                return m_iter == other.m_iter;
+            }
+
+            bool operator!=(const HashSetIterator& other) const
+            {
+                return m_iter != other.m_iter;
+            }
+
+            HashSetIterator& operator++()
+            {
+                ++m_iter;
+                return *this;
+            }
+
+            HashSetIterator operator++(int32_t)
+            {
+                HashSetIterator oldValue(*this);
+                ++m_iter;
+                return oldValue;
+            }
+
+        private:
+            friend class HashSet<T>;
+
+            HashSetIterator(const HashTableIteratorType& iter)
+                : m_iter(iter)
+            {
+            }
+
+            HashTableIteratorType m_iter;
+        };
+
     public:
         typedef T value_type;
-        typedef typename ramses_capu::HashSet<T>::Iterator Iterator;
-        typedef typename ramses_capu::HashSet<T>::ConstIterator ConstIterator;
+        typedef HashSetIterator<typename HashTableType::Iterator> Iterator;
+        typedef HashSetIterator<typename HashTableType::ConstIterator> ConstIterator;
 
         HashSet();
         HashSet(const HashSet<T>& other);
@@ -51,7 +103,7 @@ namespace ramses_internal
         void insert(InputIt first, InputIt last);
 
     private:
-        ramses_capu::HashSet<T> mHashSet;
+        HashTableType mHashSet;
     };
 
     template<class T>
@@ -100,70 +152,72 @@ namespace ramses_internal
     inline
     EStatus HashSet<T>::put(const T& value)
     {
-        return static_cast<EStatus>(mHashSet.put(value));
+        return mHashSet.put(value, 0) ? EStatus_RAMSES_OK : EStatus_RAMSES_ERROR;
     }
 
     template<class T>
     inline
     EStatus HashSet<T>::remove(const T& value)
     {
-        return static_cast<EStatus>(mHashSet.remove(value));
+        return mHashSet.remove(value) ? EStatus_RAMSES_OK : EStatus_RAMSES_ERANGE;
     }
 
     template<class T>
     inline
     EStatus HashSet<T>::remove(Iterator& iterator)
     {
-        return static_cast<EStatus>(mHashSet.removeAt(iterator));
+        mHashSet.remove(iterator.m_iter);
+        return EStatus_RAMSES_OK;
     }
 
     template<class T>
     inline
     UInt HashSet<T>::count() const
     {
-        return static_cast<EStatus>(mHashSet.count());
+        return mHashSet.count();
     }
 
     template<class T>
     inline
     EStatus HashSet<T>::clear()
     {
-        return static_cast<EStatus>(mHashSet.clear());
+        mHashSet.clear();
+        return EStatus_RAMSES_OK;
     }
 
     template<class T>
     inline
     typename HashSet<T>::ConstIterator HashSet<T>::begin() const
     {
-        return mHashSet.begin();
+        return ConstIterator(mHashSet.begin());
     }
 
     template<class T>
     inline
     typename HashSet<T>::ConstIterator HashSet<T>::end() const
     {
-        return mHashSet.end();
+        return ConstIterator(mHashSet.end());
     }
 
     template<class T>
     inline
     typename HashSet<T>::Iterator HashSet<T>::begin()
     {
-        return mHashSet.begin();
+        return Iterator(mHashSet.begin());
     }
 
     template<class T>
     inline
     typename HashSet<T>::Iterator HashSet<T>::end()
     {
-        return mHashSet.end();
+        return Iterator(mHashSet.end());
     }
 
     template<class T>
     inline
     bool HashSet<T>::hasElement(const T& element) const
     {
-        return mHashSet.hasElement(element);
+        return mHashSet.contains(element);
     }
 
     template<class T>
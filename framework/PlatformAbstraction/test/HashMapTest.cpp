@@ -0,0 +1,369 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
+#include "Collections/String.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <memory>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // all keys collide to the same home slot
+        struct CollidingHash
+        {
+            ramses_capu::uint_t operator()(const UInt32&)
+            {
+                return 0u;
+            }
+        };
+
+        struct InstanceCounter
+        {
+            InstanceCounter(Int32 value_ = 0)
+                : value(value_)
+            {
+                ++Instances;
+            }
+
+            InstanceCounter(const InstanceCounter& other)
+                : value(other.value)
+            {
+                ++Instances;
+            }
+
+            InstanceCounter& operator=(const InstanceCounter& other) = default;
+
+            ~InstanceCounter()
+            {
+                --Instances;
+            }
+
+            Int32 value;
+            static Int32 Instances;
+        };
+
+        Int32 InstanceCounter::Instances = 0;
+    }
+
+    TEST(AHashMap, isEmptyInitially)
+    {
+        HashMap<UInt32, UInt32> map;
+        EXPECT_EQ(0u, map.count());
+        EXPECT_TRUE(map.begin() == map.end());
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_TRUE(map.find(1u) == map.end());
+        EXPECT_EQ(nullptr, map.get(1u));
+    }
+
+    TEST(AHashMap, canPutGetAndOverwriteValues)
+    {
+        HashMap<UInt32, String> map;
+        EXPECT_EQ(EStatus_RAMSES_OK, map.put(1u, "one"));
+        EXPECT_EQ(EStatus_RAMSES_OK, map.put(2u, "two"));
+        EXPECT_EQ(EStatus_RAMSES_OK, map.put(1u, "uno"));
+
+        EXPECT_EQ(2u, map.count());
+        String value;
+        EXPECT_EQ(EStatus_RAMSES_OK, map.get(1u, value));
+        EXPECT_EQ(String("uno"), value);
+        ASSERT_TRUE(map.get(2u) != nullptr);
+        EXPECT_EQ(String("two"), *map.get(2u));
+        EXPECT_EQ(EStatus_RAMSES_NOT_EXIST, map.get(3u, value));
+    }
+
+    TEST(AHashMap, subscriptOperatorInsertsDefaultValue)
+    {
+        HashMap<UInt32, UInt32> map;
+        EXPECT_EQ(0u, map[5u]);
+        map[5u] = 7u;
+        EXPECT_EQ(7u, map[5u]);
+        EXPECT_EQ(1u, map.count());
+    }
+
+    TEST(AHashMap, canRemoveByKey)
+    {
+        HashMap<UInt32, UInt32> map;
+        map.put(1u, 10u);
+        map.put(2u, 20u);
+
+        UInt32 oldValue = 0u;
+        EXPECT_EQ(EStatus_RAMSES_OK, map.remove(1u, &oldValue));
+        EXPECT_EQ(10u, oldValue);
+        EXPECT_EQ(EStatus_RAMSES_ERANGE, map.remove(1u));
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_TRUE(map.contains(2u));
+        EXPECT_EQ(1u, map.count());
+    }
+
+    TEST(AHashMap, keepsAllElementsWhenGrowing)
+    {
+        HashMap<UInt32, UInt32> map;
+        for (UInt32 i = 0u; i < 10000u; ++i)
+        {
+            map.put(i, i * 2u);
+        }
+
+        EXPECT_EQ(10000u, map.count());
+        EXPECT_GE(map.capacity(), map.count());
+        for (UInt32 i = 0u; i < 10000u; ++i)
+        {
+            ASSERT_TRUE(map.contains(i));
+            EXPECT_EQ(i * 2u, *map.get(i));
+        }
+    }
+
+    TEST(AHashMap, doesNotGrowWhenReservedCapacityIsUsed)
+    {
+        HashMap<UInt32, UInt32> map(100u);
+        const UInt capacity = map.capacity();
+        EXPECT_GE(capacity, 100u);
+
+        for (UInt32 i = 0u; i < 100u; ++i)
+        {
+            map.put(i * 7919u, i);
+        }
+        EXPECT_EQ(capacity, map.capacity());
+    }
+
+    TEST(AHashMap, iteratesAllElementsOnce)
+    {
+        HashMap<UInt32, UInt32> map;
+        for (UInt32 i = 0u; i < 500u; ++i)
+        {
+            map.put(i * 3u, i);
+        }
+
+        std::map<UInt32, UInt32> visited;
+        for (const auto& entry : map)
+        {
+            visited[entry.key] = entry.value;
+        }
+
+        ASSERT_EQ(500u, visited.size());
+        for (UInt32 i = 0u; i < 500u; ++i)
+        {
+            EXPECT_EQ(i, visited[i * 3u]);
+        }
+    }
+
+    TEST(AHashMap, canRemoveWhileIteratingAndVisitsEveryElementOnce)
+    {
+        HashMap<UInt32, UInt32> map;
+        for (UInt32 i = 0u; i < 1000u; ++i)
+        {
+            map.put(i, i);
+        }
+
+        std::map<UInt32, UInt32> visitCount;
+        auto it = map.begin();
+        while (it != map.end())
+        {
+            ++visitCount[it->key];
+            if (it->key % 2u == 0u)
+            {
+                map.remove(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        EXPECT_EQ(1000u, visitCount.size());
+        for (const auto& entry : visitCount)
+        {
+            EXPECT_EQ(1u, entry.second);
+        }
+
+        EXPECT_EQ(500u, map.count());
+        for (UInt32 i = 0u; i < 1000u; ++i)
+        {
+            EXPECT_EQ(i % 2u == 1u, map.contains(i));
+        }
+    }
+
+    TEST(AHashMap, iteratesFromMostRecentlyToLeastRecentlyInsertedElement)
+    {
+        HashMap<UInt32, UInt32> map;
+        for (UInt32 i = 0u; i < 100u; ++i)
+        {
+            map.put(i * 5u, i);
+        }
+        for (UInt32 i = 0u; i < 100u; i += 3u)
+        {
+            map.remove(i * 5u);
+        }
+        // compacts and grows
+        for (UInt32 i = 100u; i < 200u; ++i)
+        {
+            map.put(i * 5u, i);
+        }
+
+        UInt32 expectedValue = 200u;
+        for (const auto& entry : map)
+        {
+            do
+            {
+                --expectedValue;
+            } while (expectedValue < 100u && expectedValue % 3u == 0u);
+            EXPECT_EQ(expectedValue, entry.value);
+        }
+        EXPECT_EQ(166u, map.count());
+    }
+
+    TEST(AHashMap, keepsOtherElementsInPlaceOnRemoval)
+    {
+        HashMap<UInt32, UInt32> map;
+        for (UInt32 i = 0u; i < 50u; ++i)
+        {
+            map.put(i, i);
+        }
+
+        const UInt32* value = map.get(25u);
+        for (UInt32 i = 0u; i < 50u; ++i)
+        {
+            if (i != 25u)
+            {
+                map.remove(i);
+            }
+        }
+        EXPECT_EQ(value, map.get(25u));
+        EXPECT_EQ(25u, *value);
+    }
+
+    TEST(AHashMap, findsRemainingElementsAfterRemovalFromCollidingProbeSequence)
+    {
+        FlatHashTable<UInt32, UInt32, std::equal_to<UInt32>, CollidingHash> table;
+        for (UInt32 i = 0u; i < 20u; ++i)
+        {
+            table.put(i, i);
+        }
+
+        for (UInt32 i = 0u; i < 20u; i += 3u)
+        {
+            EXPECT_TRUE(table.remove(i));
+        }
+
+        for (UInt32 i = 0u; i < 20u; ++i)
+        {
+            EXPECT_EQ(i % 3u != 0u, table.contains(i));
+        }
+    }
+
+    TEST(AHashMap, canBeCopiedAndMoved)
+    {
+        HashMap<UInt32, String> map;
+        map.put(1u, "one");
+        map.put(2u, "two");
+
+        HashMap<UInt32, String> copy(map);
+        EXPECT_EQ(2u, copy.count());
+        EXPECT_EQ(String("one"), *copy.get(1u));
+
+        HashMap<UInt32, String> moved(std::move(copy));
+        EXPECT_EQ(2u, moved.count());
+        EXPECT_EQ(String("two"), *moved.get(2u));
+        EXPECT_EQ(0u, copy.count());
+
+        HashMap<UInt32, String> assigned;
+        assigned.put(3u, "three");
+        assigned = map;
+        EXPECT_EQ(2u, assigned.count());
+        EXPECT_FALSE(assigned.contains(3u));
+
+        assigned = std::move(moved);
+        EXPECT_EQ(2u, assigned.count());
+        EXPECT_EQ(0u, moved.count());
+        moved.put(4u, "four");
+        EXPECT_TRUE(moved.contains(4u));
+    }
+
+    TEST(AHashMap, clearKeepsCapacity)
+    {
+        HashMap<UInt32, UInt32> map;
+        for (UInt32 i = 0u; i < 100u; ++i)
+        {
+            map.put(i, i);
+        }
+        const UInt capacity = map.capacity();
+
+        map.clear();
+        EXPECT_EQ(0u, map.count());
+        EXPECT_TRUE(map.begin() == map.end());
+        EXPECT_EQ(capacity, map.capacity());
+        EXPECT_FALSE(map.contains(5u));
+    }
+
+    TEST(AHashMap, destructsAllValues)
+    {
+        {
+            HashMap<UInt32, InstanceCounter> map;
+            for (UInt32 i = 0u; i < 100u; ++i)
+            {
+                map.put(i, InstanceCounter(i));
+            }
+            for (UInt32 i = 0u; i < 100u; i += 2u)
+            {
+                map.remove(i);
+            }
+            EXPECT_EQ(50, InstanceCounter::Instances);
+
+            HashMap<UInt32, InstanceCounter> copy(map);
+            EXPECT_EQ(100, InstanceCounter::Instances);
+            copy.clear();
+            EXPECT_EQ(50, InstanceCounter::Instances);
+        }
+        EXPECT_EQ(0, InstanceCounter::Instances);
+    }
+
+    TEST(AHashSet, canPutAndRemoveElements)
+    {
+        HashSet<String> set;
+        EXPECT_EQ(EStatus_RAMSES_OK, set.put("a"));
+        EXPECT_EQ(EStatus_RAMSES_OK, set.put("b"));
+        EXPECT_EQ(EStatus_RAMSES_ERROR, set.put("a"));
+        EXPECT_EQ(2u, set.count());
+        EXPECT_TRUE(set.hasElement("a"));
+
+        EXPECT_EQ(EStatus_RAMSES_OK, set.remove("a"));
+        EXPECT_EQ(EStatus_RAMSES_ERANGE, set.remove("a"));
+        EXPECT_FALSE(set.hasElement("a"));
+        EXPECT_EQ(1u, set.count());
+    }
+
+    TEST(AHashSet, canRemoveWhileIterating)
+    {
+        HashSet<UInt32> set;
+        set.insert({ 1u, 2u, 3u, 4u, 5u, 6u });
+
+        auto it = set.begin();
+        while (it != set.end())
+        {
+            if (*it > 3u)
+            {
+                set.remove(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        EXPECT_EQ(3u, set.count());
+        UInt32 sum = 0u;
+        for (const auto& value : set)
+        {
+            sum += value;
+        }
+        EXPECT_EQ(6u, sum);
+    }
+}
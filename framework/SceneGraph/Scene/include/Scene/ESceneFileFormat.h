@@ -0,0 +1,40 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENE_ESCENEFILEFORMAT_H
+#define RAMSES_SCENE_ESCENEFILEFORMAT_H
+
+namespace ramses_internal
+{
+    /**
+     * Specifies how the low level scene is stored in a scene file
+     */
+    enum ESceneFileFormat
+    {
+        ESceneFileFormat_ActionStream = 0,   ///< scene is described as scene actions which are replayed when loading
+        ESceneFileFormat_Snapshot            ///< scene pools are stored as contiguous arrays, see SceneSnapshot
+    };
+
+    inline const Char* EnumToString(ESceneFileFormat format)
+    {
+        switch (format)
+        {
+            case ESceneFileFormat_ActionStream:
+                return "ESceneFileFormat_ActionStream";
+            case ESceneFileFormat_Snapshot:
+                return "ESceneFileFormat_Snapshot";
+            default:
+                assert(false);
+                break;
+        }
+
+        return "ESceneFileFormat UNKNOWN";
+    }
+}
+
+#endif
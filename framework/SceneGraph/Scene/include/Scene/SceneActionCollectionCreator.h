@@ -143,6 +143,7 @@ namespace ramses_internal
         void setRenderPassEnabled(RenderPassHandle passHandle, Bool isEnabled);
         void setRenderPassRenderOnce(RenderPassHandle pass, Bool enabled);
         void retriggerRenderPassRenderOnce(RenderPassHandle pass);
+        void setRenderPassInstanceBatching(RenderPassHandle pass, Bool enabled);
         void addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order);
         void removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle);
 
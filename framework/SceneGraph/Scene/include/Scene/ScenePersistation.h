@@ -11,6 +11,7 @@
 
 #include "SceneAPI/SceneSizeInformation.h"
 #include "SceneAPI/IScene.h"
+#include "Scene/ESceneFileFormat.h"
 
 namespace ramses_internal
 {
@@ -20,17 +21,21 @@ namespace ramses_internal
     class IInputStream;
     class AnimationSystemFactory;
     struct SceneCreationInformation;
+    class SceneActionCollection;
 
     class ScenePersistation
     {
     public:
         static void WriteSceneMetadataToStream(IOutputStream& outStream, const IScene& scene);
-        static void WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene);
-        static void WriteSceneToFile(const String& filename, const ClientScene& scene);
+        static void WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene, ESceneFileFormat format = ESceneFileFormat_Snapshot);
+        static void WriteSceneToFile(const String& filename, const ClientScene& scene, ESceneFileFormat format = ESceneFileFormat_Snapshot);
 
         static void ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo);
-        static void ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory = NULL);
-        static void ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory = NULL);
+        static Bool ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory = NULL);
+        static Bool ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory = NULL);
+
+        static void WriteSceneActionsToStream(IOutputStream& outStream, const SceneActionCollection& actions);
+        static void ReadSceneActionsFromStream(IInputStream& inStream, SceneActionCollection& actions);
     };
 }
 
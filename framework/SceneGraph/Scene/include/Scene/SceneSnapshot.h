@@ -0,0 +1,85 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENESNAPSHOT_H
+#define RAMSES_SCENESNAPSHOT_H
+
+#include "SceneAPI/IScene.h"
+
+namespace ramses_internal
+{
+    class ClientScene;
+    class IOutputStream;
+    class IInputStream;
+    class AnimationSystemFactory;
+    class SnapshotInputStream;
+
+    /**
+        Stores a scene as a versioned snapshot where every scene pool is written as a contiguous
+        array of its allocated entries (handles and records serialized field by field). Loading a snapshot
+        bulk-reads the payload and allocates the pool entries directly with their original handles, avoiding
+        the intermediate SceneActionCollection and per-action decoding of the action stream format.
+        The payload starts with the SceneSizeInformation of the saved scene, the loaded scene is preallocated
+        to it before any pool entry is allocated.
+        Every count and size is validated against the remaining payload, a corrupt snapshot fails to load.
+        Animation systems are embedded as an action stream section.
+    */
+    class SceneSnapshot
+    {
+    public:
+        static const UInt32 Marker = 0x50414e53;  // {'S', 'N', 'A', 'P'}
+        static const UInt32 Version = 4u;
+
+        template <typename T>
+        static void WriteToStream(IOutputStream& outStream, const T& source);
+        // expects the snapshot marker to be consumed already by caller
+        static bool ReadFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory = NULL);
+
+    private:
+        static void WriteSceneSizeInformation(IOutputStream& stream, const IScene& source);
+        static void WriteNodes(IOutputStream& stream, const IScene& source);
+        static void WriteTransforms(IOutputStream& stream, const IScene& source);
+        static void WriteRenderables(IOutputStream& stream, const IScene& source);
+        static void WriteStates(IOutputStream& stream, const IScene& source);
+        static void WriteDataLayouts(IOutputStream& stream, const ClientScene& source);
+        static void WriteDataLayouts(IOutputStream& stream, const IScene& source);
+        static void WriteDataInstances(IOutputStream& stream, const IScene& source);
+        static void WriteCameras(IOutputStream& stream, const IScene& source);
+        static void WriteAnimationSystems(IOutputStream& stream, const IScene& source);
+        static void WriteRenderGroups(IOutputStream& stream, const IScene& source);
+        static void WriteRenderPasses(IOutputStream& stream, const IScene& source);
+        static void WriteBlitPasses(IOutputStream& stream, const IScene& source);
+        static void WriteDataBuffers(IOutputStream& stream, const IScene& source);
+        static void WriteTextureBuffers(IOutputStream& stream, const IScene& source);
+        static void WriteTextureSamplers(IOutputStream& stream, const IScene& source);
+        static void WriteRenderBuffersAndTargets(IOutputStream& stream, const IScene& source);
+        static void WriteStreamTextures(IOutputStream& stream, const IScene& source);
+        static void WriteDataSlots(IOutputStream& stream, const IScene& source);
+
+        static Bool ReadSceneSizeInformation(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadNodes(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadTransforms(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadRenderables(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadStates(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadDataLayouts(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadDataInstances(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadCameras(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadAnimationSystems(SnapshotInputStream& stream, IScene& scene, AnimationSystemFactory* animSystemFactory);
+        static Bool ReadRenderGroups(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadRenderPasses(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadBlitPasses(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadDataBuffers(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadTextureBuffers(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadTextureSamplers(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadRenderBuffersAndTargets(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadStreamTextures(SnapshotInputStream& stream, IScene& scene);
+        static Bool ReadDataSlots(SnapshotInputStream& stream, IScene& scene);
+    };
+}
+
+#endif
@@ -484,6 +484,12 @@ namespace ramses_internal
         m_creator.retriggerRenderPassRenderOnce(passHandle);
     }
 
+    void ActionCollectingScene::setRenderPassInstanceBatching(RenderPassHandle passHandle, Bool enable)
+    {
+        ResourceChangeCollectingScene::setRenderPassInstanceBatching(passHandle, enable);
+        m_creator.setRenderPassInstanceBatching(passHandle, enable);
+    }
+
     void ActionCollectingScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         ResourceChangeCollectingScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -119,6 +119,12 @@ namespace ramses_internal
         // implemented on renderer side only in a derived scene
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassInstanceBatching(RenderPassHandle passHandle, Bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->isInstanceBatchingEnabled = enable;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
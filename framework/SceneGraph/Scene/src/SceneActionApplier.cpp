@@ -780,6 +780,15 @@ namespace ramses_internal
             scene.retriggerRenderPassRenderOnce(passHandle);
             break;
         }
+        case ESceneActionId_SetRenderPassInstanceBatching:
+        {
+            RenderPassHandle passHandle;
+            Bool enabled;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassInstanceBatching(passHandle, enabled);
+            break;
+        }
         case ESceneActionId_AddRenderGroupToRenderPass:
         {
             RenderPassHandle passHandle;
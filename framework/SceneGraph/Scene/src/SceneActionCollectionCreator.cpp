@@ -551,6 +551,13 @@ namespace ramses_internal
         collection.write(pass);
     }
 
+    void SceneActionCollectionCreator::setRenderPassInstanceBatching(RenderPassHandle pass, Bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId_SetRenderPassInstanceBatching);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
     void SceneActionCollectionCreator::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         collection.beginWriteSceneAction(ESceneActionId_AddRenderGroupToRenderPass);
@@ -11,6 +11,7 @@
 #include "Scene/SceneActionApplier.h"
 #include "Scene/SceneDescriber.h"
 #include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneSnapshot.h"
 #include "Utils/File.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
@@ -75,69 +76,55 @@ namespace ramses_internal
         outStream << scene.getName();
     }
 
-    void ScenePersistation::WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene)
+    void ScenePersistation::WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene, ESceneFileFormat format)
     {
+        if (format == ESceneFileFormat_Snapshot)
+        {
+            SceneSnapshot::WriteToStream<ClientScene>(outStream, scene);
+            return;
+        }
+
         SceneActionCollection collection;
         SceneActionCollectionCreator creator(collection);
         creator.preallocateSceneSize(scene.getSceneSizeInformation());
         SceneDescriber::describeScene<ClientScene>(scene, creator);
 
-        const Vector<Byte>& actionData = collection.collectionData();
-
         outStream << static_cast<UInt32>(gSceneMarker);
-        outStream << static_cast<UInt32>(collection.numberOfActions());
+        WriteSceneActionsToStream(outStream, collection);
+    }
+
+    void ScenePersistation::WriteSceneActionsToStream(IOutputStream& outStream, const SceneActionCollection& actions)
+    {
+        const Vector<Byte>& actionData = actions.collectionData();
+
+        outStream << static_cast<UInt32>(actions.numberOfActions());
         outStream << static_cast<UInt32>(actionData.size());
 
         // write data
         outStream.write(actionData.data(), static_cast<UInt32>(actionData.size()));
 
         // write types and offsets
-        for (const auto& reader : collection)
+        for (const auto& reader : actions)
         {
             outStream << static_cast<UInt32>(reader.type());
             outStream << static_cast<UInt32>(reader.offsetInCollection());
         }
     }
 
-    void ScenePersistation::WriteSceneToFile(const String& filename, const ClientScene& scene)
-    {
-        File f(filename);
-        BinaryFileOutputStream stream(f);
-
-        if (stream.getState() == EStatus_RAMSES_OK)
-        {
-            ScenePersistation::WriteSceneToStream(stream, scene);
-        }
-        else
-        {
-            LOG_WARN(CONTEXT_FRAMEWORK, "ScenePersistation::WriteSceneToFile: failed to open stream");
-        }
-    }
-
-    void ScenePersistation::ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory)
+    void ScenePersistation::ReadSceneActionsFromStream(IInputStream& inStream, SceneActionCollection& actions)
     {
-        UInt32 sceneMarker = 0;
-        inStream >> sceneMarker;
-        if (sceneMarker != gSceneMarker)
-        {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
-            return;
-        }
-
         UInt32 numberOfSceneActionsToRead = 0;
         inStream >> numberOfSceneActionsToRead;
         UInt32 sizeOfAllSceneActions = 0;
         inStream >> sizeOfAllSceneActions;
 
-        SceneActionCollection actions(0, numberOfSceneActionsToRead);
+        actions.reserveAdditionalCapacity(0u, numberOfSceneActionsToRead);
 
         // read data
         Vector<Byte>& rawActionData = actions.getRawDataForDirectWriting();
         rawActionData.resize(sizeOfAllSceneActions);
         inStream.read(reinterpret_cast<char*>(rawActionData.data()), static_cast<UInt32>(rawActionData.size()));
 
-        std::array<uint32_t, ESceneActionId_NUMBER_OF_TYPES> objectCounts = {};
-
         // read types and offsets
         for (UInt32 i = 0; i < numberOfSceneActionsToRead; ++i)
         {
@@ -146,11 +133,54 @@ namespace ramses_internal
             UInt32 offsetInCollection;
             inStream >> offsetInCollection;
             actions.addRawSceneActionInformation(static_cast<ESceneActionId>(actionType), offsetInCollection);
-            ++objectCounts[actionType];
         }
+    }
+
+    void ScenePersistation::WriteSceneToFile(const String& filename, const ClientScene& scene, ESceneFileFormat format)
+    {
+        File f(filename);
+        BinaryFileOutputStream stream(f);
+
+        if (stream.getState() == EStatus_RAMSES_OK)
+        {
+            ScenePersistation::WriteSceneToStream(stream, scene, format);
+        }
+        else
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "ScenePersistation::WriteSceneToFile: failed to open stream");
+        }
+    }
+
+    Bool ScenePersistation::ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory)
+    {
+        UInt32 sceneMarker = 0;
+        inStream >> sceneMarker;
+        if (sceneMarker == SceneSnapshot::Marker)
+        {
+            if (!SceneSnapshot::ReadFromStream(inStream, scene, animSystemFactory))
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene snapshot");
+                return false;
+            }
+            return true;
+        }
+        if (sceneMarker != gSceneMarker)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
+            return false;
+        }
+
+        SceneActionCollection actions;
+        ReadSceneActionsFromStream(inStream, actions);
 
         LOG_DEBUG_F(ramses_internal::CONTEXT_PROFILING, ([&](ramses_internal::StringOutputStream& sos) {
-                    sos << "ScenePersistation::ReadSceneFromStream: SceneAction type counts for SceneID " << scene.getSceneId().getValue() << " (total: " << numberOfSceneActionsToRead << ")\n";
+                    std::array<uint32_t, ESceneActionId_NUMBER_OF_TYPES> objectCounts = {};
+                    for (const auto& reader : actions)
+                    {
+                        ++objectCounts[reader.type()];
+                    }
+
+                    sos << "ScenePersistation::ReadSceneFromStream: SceneAction type counts for SceneID " << scene.getSceneId().getValue() << " (total: " << actions.numberOfActions() << ")\n";
                     for (uint32_t i = 0; i < ESceneActionId_NUMBER_OF_TYPES; i++)
                     {
                         if (objectCounts[i] > 0)
@@ -161,9 +191,10 @@ namespace ramses_internal
                 }));
 
         SceneActionApplier::ApplyActionsOnScene(scene, actions, animSystemFactory);
+        return true;
     }
 
-    void ScenePersistation::ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory)
+    Bool ScenePersistation::ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory)
     {
         File f(filename);
         if (!f.exists())
@@ -176,11 +207,10 @@ namespace ramses_internal
         const EStatus state = stream.getState();
         if (EStatus_RAMSES_OK == state)
         {
-            ScenePersistation::ReadSceneFromStream(stream, scene, animSystemFactory);
-        }
-        else
-        {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromFile:  could not read scene from file");
+            return ScenePersistation::ReadSceneFromStream(stream, scene, animSystemFactory);
         }
+
+        LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromFile:  could not read scene from file");
+        return false;
     }
 }
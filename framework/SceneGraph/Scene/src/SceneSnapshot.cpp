@@ -0,0 +1,1844 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/SceneSnapshot.h"
+#include "Scene/ScenePersistation.h"
+#include "Scene/ClientScene.h"
+#include "Scene/SceneActionCollection.h"
+#include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneActionApplier.h"
+#include "Animation/AnimationSystemDescriber.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/MemoryUtils.h"
+#include "Utils/LogMacros.h"
+#include "Collections/Guid.h"
+#include "Math3d/Vector2i.h"
+#include "Math3d/Vector3i.h"
+#include "Math3d/Vector4i.h"
+#include "Math3d/Matrix22f.h"
+#include "Math3d/Matrix33f.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    // Reads from the snapshot payload in memory, every read is checked against the remaining payload size.
+    // Reading past the end puts the stream into error state and yields zeroed values instead of reading out of bounds.
+    class SnapshotInputStream final : public IInputStream
+    {
+    public:
+        SnapshotInputStream(const Byte* data, UInt32 size)
+            : m_current(data)
+            , m_remaining(size)
+        {
+        }
+
+        virtual IInputStream& operator>>(Int32& value) override
+        {
+            return read(reinterpret_cast<Char*>(&value), sizeof(value));
+        }
+
+        virtual IInputStream& operator>>(Int64& value) override
+        {
+            return read(reinterpret_cast<Char*>(&value), sizeof(value));
+        }
+
+        virtual IInputStream& operator>>(UInt32& value) override
+        {
+            return read(reinterpret_cast<Char*>(&value), sizeof(value));
+        }
+
+        virtual IInputStream& operator>>(UInt64& value) override
+        {
+            return read(reinterpret_cast<Char*>(&value), sizeof(value));
+        }
+
+        virtual IInputStream& operator>>(String& value) override
+        {
+            UInt32 length = 0u;
+            if (readCount(length, 1u))
+            {
+                value.resize(length);
+                read(value.data(), length);
+            }
+            return *this;
+        }
+
+        virtual IInputStream& operator>>(Bool& value) override
+        {
+            return read(reinterpret_cast<Char*>(&value), sizeof(value));
+        }
+
+        virtual IInputStream& operator>>(Float& value) override
+        {
+            return read(reinterpret_cast<Char*>(&value), sizeof(value));
+        }
+
+        virtual IInputStream& operator>>(UInt16& value) override
+        {
+            return read(reinterpret_cast<Char*>(&value), sizeof(value));
+        }
+
+        virtual IInputStream& operator>>(Guid& value) override
+        {
+            generic_uuid_t uuid;
+            read(reinterpret_cast<Char*>(&uuid), sizeof(uuid));
+            value = Guid(uuid);
+            return *this;
+        }
+
+        virtual IInputStream& operator>>(Matrix44f& value) override
+        {
+            return read(reinterpret_cast<Char*>(value.getRawData()), sizeof(Float) * 16u);
+        }
+
+        virtual IInputStream& operator>>(ResourceContentHash& value) override
+        {
+            return *this >> value.lowPart >> value.highPart;
+        }
+
+        virtual IInputStream& read(Char* data, UInt32 size) override
+        {
+            if (m_state != EStatus_RAMSES_OK || size > m_remaining)
+            {
+                m_state = EStatus_RAMSES_ERROR;
+                PlatformMemory::Set(data, 0, size);
+                return *this;
+            }
+
+            PlatformMemory::Copy(data, m_current, size);
+            m_current += size;
+            m_remaining -= size;
+            return *this;
+        }
+
+        virtual EStatus getState() const override
+        {
+            return m_state;
+        }
+
+        // reads the element count of an array and checks that the array fits into the remaining payload
+        Bool readCount(UInt32& count, UInt32 serializedElementSize)
+        {
+            *this >> count;
+            if (m_state == EStatus_RAMSES_OK && static_cast<UInt64>(count) * serializedElementSize <= m_remaining)
+            {
+                return true;
+            }
+
+            m_state = EStatus_RAMSES_ERROR;
+            count = 0u;
+            return false;
+        }
+
+        Bool isValid() const
+        {
+            return m_state == EStatus_RAMSES_OK;
+        }
+
+        UInt32 getRemainingSize() const
+        {
+            return m_remaining;
+        }
+
+    private:
+        const Byte* m_current;
+        UInt32 m_remaining;
+        EStatus m_state = EStatus_RAMSES_OK;
+    };
+
+    // plain-data records used for pools whose scene representation has no direct record type
+    struct SnapshotTransform
+    {
+        NodeHandle node;
+        Float translation[3];
+        Float rotation[3];
+        Float scaling[3];
+    };
+
+    struct SnapshotRenderPass
+    {
+        Bool               isEnabled;
+        Bool               isRenderOnce;
+        Bool               isInstanceBatchingEnabled;
+        CameraHandle       camera;
+        RenderTargetHandle renderTarget;
+        Int32              renderOrder;
+        Float              clearColor[4];
+        UInt32             clearFlags;
+        UInt32             renderGroupCount;
+    };
+
+    struct SnapshotDataBuffer
+    {
+        EDataBufferType bufferType;
+        EDataType       dataType;
+        UInt32          maximumSize;
+        UInt32          usedSize;
+    };
+
+    template <typename E>
+    static void WriteEnum(IOutputStream& stream, E value)
+    {
+        stream << static_cast<UInt32>(value);
+    }
+
+    template <typename E>
+    static void ReadEnum(IInputStream& stream, E& value)
+    {
+        UInt32 rawValue = 0u;
+        stream >> rawValue;
+        value = static_cast<E>(rawValue);
+    }
+
+    static void WriteFloats(IOutputStream& stream, const Float* values, UInt32 count)
+    {
+        for (UInt32 i = 0u; i < count; ++i)
+        {
+            stream << values[i];
+        }
+    }
+
+    static void ReadFloats(IInputStream& stream, Float* values, UInt32 count)
+    {
+        for (UInt32 i = 0u; i < count; ++i)
+        {
+            stream >> values[i];
+        }
+    }
+
+    // Every record is serialized field by field, Size is the number of bytes written per record.
+    // Sizes are used to validate array counts against the remaining payload before anything is allocated.
+    template <typename T>
+    struct SnapshotRecord;
+
+    template <>
+    struct SnapshotRecord<UInt32>
+    {
+        static const UInt32 Size = sizeof(UInt32);
+        static void Write(IOutputStream& stream, UInt32 value) { stream << value; }
+        static void Read(IInputStream& stream, UInt32& value) { stream >> value; }
+    };
+
+    template <typename TAG>
+    struct SnapshotRecord<TypedMemoryHandle<TAG>>
+    {
+        static const UInt32 Size = sizeof(MemoryHandle);
+        static void Write(IOutputStream& stream, TypedMemoryHandle<TAG> handle) { stream << handle.asMemoryHandle(); }
+        static void Read(IInputStream& stream, TypedMemoryHandle<TAG>& handle)
+        {
+            MemoryHandle rawHandle = InvalidMemoryHandle;
+            stream >> rawHandle;
+            handle = TypedMemoryHandle<TAG>(rawHandle);
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<ETextureFormat>
+    {
+        static const UInt32 Size = sizeof(UInt32);
+        static void Write(IOutputStream& stream, ETextureFormat format) { WriteEnum(stream, format); }
+        static void Read(IInputStream& stream, ETextureFormat& format) { ReadEnum(stream, format); }
+    };
+
+    template <>
+    struct SnapshotRecord<MipMapSize>
+    {
+        static const UInt32 Size = 2u * sizeof(UInt32);
+        static void Write(IOutputStream& stream, const MipMapSize& size) { stream << size.width << size.height; }
+        static void Read(IInputStream& stream, MipMapSize& size) { stream >> size.width >> size.height; }
+    };
+
+    template <>
+    struct SnapshotRecord<RenderableOrderEntry>
+    {
+        static const UInt32 Size = sizeof(MemoryHandle) + sizeof(Int32);
+        static void Write(IOutputStream& stream, const RenderableOrderEntry& entry) { stream << entry.renderable.asMemoryHandle() << entry.order; }
+        static void Read(IInputStream& stream, RenderableOrderEntry& entry)
+        {
+            SnapshotRecord<RenderableHandle>::Read(stream, entry.renderable);
+            stream >> entry.order;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<RenderGroupOrderEntry>
+    {
+        static const UInt32 Size = sizeof(MemoryHandle) + sizeof(Int32);
+        static void Write(IOutputStream& stream, const RenderGroupOrderEntry& entry) { stream << entry.renderGroup.asMemoryHandle() << entry.order; }
+        static void Read(IInputStream& stream, RenderGroupOrderEntry& entry)
+        {
+            SnapshotRecord<RenderGroupHandle>::Read(stream, entry.renderGroup);
+            stream >> entry.order;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<DataFieldInfo>
+    {
+        static const UInt32 Size = 3u * sizeof(UInt32);
+        static void Write(IOutputStream& stream, const DataFieldInfo& field)
+        {
+            WriteEnum(stream, field.dataType);
+            stream << field.elementCount;
+            WriteEnum(stream, field.semantics);
+        }
+        static void Read(IInputStream& stream, DataFieldInfo& field)
+        {
+            ReadEnum(stream, field.dataType);
+            stream >> field.elementCount;
+            ReadEnum(stream, field.semantics);
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<SnapshotTransform>
+    {
+        static const UInt32 Size = sizeof(MemoryHandle) + 9u * sizeof(Float);
+        static void Write(IOutputStream& stream, const SnapshotTransform& transform)
+        {
+            stream << transform.node.asMemoryHandle();
+            WriteFloats(stream, transform.translation, 3u);
+            WriteFloats(stream, transform.rotation, 3u);
+            WriteFloats(stream, transform.scaling, 3u);
+        }
+        static void Read(IInputStream& stream, SnapshotTransform& transform)
+        {
+            SnapshotRecord<NodeHandle>::Read(stream, transform.node);
+            ReadFloats(stream, transform.translation, 3u);
+            ReadFloats(stream, transform.rotation, 3u);
+            ReadFloats(stream, transform.scaling, 3u);
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<Renderable>
+    {
+        static const UInt32 Size = sizeof(ResourceContentHash) + sizeof(MemoryHandle) + sizeof(Bool) + 3u * sizeof(UInt32) + (ERenderableDataSlotType_MAX_SLOTS + 1u) * sizeof(MemoryHandle);
+        static void Write(IOutputStream& stream, const Renderable& renderable)
+        {
+            stream << renderable.effectResource << renderable.node.asMemoryHandle() << renderable.isVisible;
+            stream << renderable.startIndex << renderable.indexCount << renderable.instanceCount;
+            for (UInt32 slot = 0u; slot < ERenderableDataSlotType_MAX_SLOTS; ++slot)
+            {
+                stream << renderable.dataInstances[slot].asMemoryHandle();
+            }
+            stream << renderable.renderState.asMemoryHandle();
+        }
+        static void Read(IInputStream& stream, Renderable& renderable)
+        {
+            stream >> renderable.effectResource;
+            SnapshotRecord<NodeHandle>::Read(stream, renderable.node);
+            stream >> renderable.isVisible;
+            stream >> renderable.startIndex >> renderable.indexCount >> renderable.instanceCount;
+            for (UInt32 slot = 0u; slot < ERenderableDataSlotType_MAX_SLOTS; ++slot)
+            {
+                SnapshotRecord<DataInstanceHandle>::Read(stream, renderable.dataInstances[slot]);
+            }
+            SnapshotRecord<RenderStateHandle>::Read(stream, renderable.renderState);
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<RenderState>
+    {
+        static const UInt32 Size = 17u * sizeof(UInt32);
+        static void Write(IOutputStream& stream, const RenderState& state)
+        {
+            WriteEnum(stream, state.blendFactorSrcColor);
+            WriteEnum(stream, state.blendFactorDstColor);
+            WriteEnum(stream, state.blendFactorSrcAlpha);
+            WriteEnum(stream, state.blendFactorDstAlpha);
+            WriteEnum(stream, state.blendOperationColor);
+            WriteEnum(stream, state.blendOperationAlpha);
+            WriteEnum(stream, state.cullMode);
+            WriteEnum(stream, state.drawMode);
+            WriteEnum(stream, state.depthFunc);
+            WriteEnum(stream, state.depthWrite);
+            WriteEnum(stream, state.stencilFunc);
+            stream << state.stencilRefValue;
+            stream << static_cast<UInt32>(state.stencilMask);
+            WriteEnum(stream, state.stencilOpFail);
+            WriteEnum(stream, state.stencilOpDepthFail);
+            WriteEnum(stream, state.stencilOpDepthPass);
+            stream << state.colorWriteMask;
+        }
+        static void Read(IInputStream& stream, RenderState& state)
+        {
+            ReadEnum(stream, state.blendFactorSrcColor);
+            ReadEnum(stream, state.blendFactorDstColor);
+            ReadEnum(stream, state.blendFactorSrcAlpha);
+            ReadEnum(stream, state.blendFactorDstAlpha);
+            ReadEnum(stream, state.blendOperationColor);
+            ReadEnum(stream, state.blendOperationAlpha);
+            ReadEnum(stream, state.cullMode);
+            ReadEnum(stream, state.drawMode);
+            ReadEnum(stream, state.depthFunc);
+            ReadEnum(stream, state.depthWrite);
+            ReadEnum(stream, state.stencilFunc);
+            stream >> state.stencilRefValue;
+            UInt32 stencilMask = 0u;
+            stream >> stencilMask;
+            state.stencilMask = static_cast<UInt8>(stencilMask);
+            ReadEnum(stream, state.stencilOpFail);
+            ReadEnum(stream, state.stencilOpDepthFail);
+            ReadEnum(stream, state.stencilOpDepthPass);
+            stream >> state.colorWriteMask;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<Camera>
+    {
+        static const UInt32 Size = sizeof(UInt32) + 6u * sizeof(Float) + 4u * sizeof(UInt32) + sizeof(MemoryHandle);
+        static void Write(IOutputStream& stream, const Camera& camera)
+        {
+            WriteEnum(stream, camera.projectionType);
+            const Frustum& frustum = camera.frustum;
+            stream << frustum.leftPlane << frustum.rightPlane << frustum.bottomPlane << frustum.topPlane << frustum.nearPlane << frustum.farPlane;
+            stream << camera.viewport.posX << camera.viewport.posY << camera.viewport.width << camera.viewport.height;
+            stream << camera.node.asMemoryHandle();
+        }
+        static void Read(IInputStream& stream, Camera& camera)
+        {
+            ReadEnum(stream, camera.projectionType);
+            Frustum& frustum = camera.frustum;
+            stream >> frustum.leftPlane >> frustum.rightPlane >> frustum.bottomPlane >> frustum.topPlane >> frustum.nearPlane >> frustum.farPlane;
+            stream >> camera.viewport.posX >> camera.viewport.posY >> camera.viewport.width >> camera.viewport.height;
+            SnapshotRecord<NodeHandle>::Read(stream, camera.node);
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<SnapshotRenderPass>
+    {
+        static const UInt32 Size = 3u * sizeof(Bool) + 2u * sizeof(MemoryHandle) + sizeof(Int32) + 4u * sizeof(Float) + 2u * sizeof(UInt32);
+        static void Write(IOutputStream& stream, const SnapshotRenderPass& pass)
+        {
+            stream << pass.isEnabled << pass.isRenderOnce << pass.isInstanceBatchingEnabled;
+            stream << pass.camera.asMemoryHandle() << pass.renderTarget.asMemoryHandle() << pass.renderOrder;
+            WriteFloats(stream, pass.clearColor, 4u);
+            stream << pass.clearFlags << pass.renderGroupCount;
+        }
+        static void Read(IInputStream& stream, SnapshotRenderPass& pass)
+        {
+            stream >> pass.isEnabled >> pass.isRenderOnce >> pass.isInstanceBatchingEnabled;
+            SnapshotRecord<CameraHandle>::Read(stream, pass.camera);
+            SnapshotRecord<RenderTargetHandle>::Read(stream, pass.renderTarget);
+            stream >> pass.renderOrder;
+            ReadFloats(stream, pass.clearColor, 4u);
+            stream >> pass.clearFlags >> pass.renderGroupCount;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<PixelRectangle>
+    {
+        static const UInt32 Size = 2u * sizeof(UInt32) + 2u * sizeof(Int32);
+        static void Write(IOutputStream& stream, const PixelRectangle& rectangle) { stream << rectangle.x << rectangle.y << rectangle.width << rectangle.height; }
+        static void Read(IInputStream& stream, PixelRectangle& rectangle) { stream >> rectangle.x >> rectangle.y >> rectangle.width >> rectangle.height; }
+    };
+
+    template <>
+    struct SnapshotRecord<BlitPass>
+    {
+        static const UInt32 Size = sizeof(Bool) + sizeof(Int32) + 2u * sizeof(MemoryHandle) + 2u * SnapshotRecord<PixelRectangle>::Size;
+        static void Write(IOutputStream& stream, const BlitPass& blitPass)
+        {
+            stream << blitPass.isEnabled << blitPass.renderOrder;
+            stream << blitPass.sourceRenderBuffer.asMemoryHandle() << blitPass.destinationRenderBuffer.asMemoryHandle();
+            SnapshotRecord<PixelRectangle>::Write(stream, blitPass.sourceRegion);
+            SnapshotRecord<PixelRectangle>::Write(stream, blitPass.destinationRegion);
+        }
+        static void Read(IInputStream& stream, BlitPass& blitPass)
+        {
+            stream >> blitPass.isEnabled >> blitPass.renderOrder;
+            SnapshotRecord<RenderBufferHandle>::Read(stream, blitPass.sourceRenderBuffer);
+            SnapshotRecord<RenderBufferHandle>::Read(stream, blitPass.destinationRenderBuffer);
+            SnapshotRecord<PixelRectangle>::Read(stream, blitPass.sourceRegion);
+            SnapshotRecord<PixelRectangle>::Read(stream, blitPass.destinationRegion);
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<SnapshotDataBuffer>
+    {
+        static const UInt32 Size = 4u * sizeof(UInt32);
+        static void Write(IOutputStream& stream, const SnapshotDataBuffer& buffer)
+        {
+            WriteEnum(stream, buffer.bufferType);
+            WriteEnum(stream, buffer.dataType);
+            stream << buffer.maximumSize << buffer.usedSize;
+        }
+        static void Read(IInputStream& stream, SnapshotDataBuffer& buffer)
+        {
+            ReadEnum(stream, buffer.bufferType);
+            ReadEnum(stream, buffer.dataType);
+            stream >> buffer.maximumSize >> buffer.usedSize;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<TextureSampler>
+    {
+        static const UInt32 Size = 6u * sizeof(UInt32) + sizeof(ResourceContentHash) + sizeof(MemoryHandle);
+        static void Write(IOutputStream& stream, const TextureSampler& sampler)
+        {
+            const TextureSamplerStates& states = sampler.states;
+            WriteEnum(stream, states.m_addressModeU);
+            WriteEnum(stream, states.m_addressModeV);
+            WriteEnum(stream, states.m_addressModeR);
+            WriteEnum(stream, states.m_samplingMode);
+            stream << states.m_anisotropyLevel;
+            WriteEnum(stream, sampler.contentType);
+            stream << sampler.textureResource << sampler.contentHandle;
+        }
+        static void Read(IInputStream& stream, TextureSampler& sampler)
+        {
+            TextureSamplerStates& states = sampler.states;
+            ReadEnum(stream, states.m_addressModeU);
+            ReadEnum(stream, states.m_addressModeV);
+            ReadEnum(stream, states.m_addressModeR);
+            ReadEnum(stream, states.m_samplingMode);
+            stream >> states.m_anisotropyLevel;
+            ReadEnum(stream, sampler.contentType);
+            stream >> sampler.textureResource >> sampler.contentHandle;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<RenderBuffer>
+    {
+        static const UInt32 Size = 6u * sizeof(UInt32);
+        static void Write(IOutputStream& stream, const RenderBuffer& buffer)
+        {
+            stream << buffer.width << buffer.height;
+            WriteEnum(stream, buffer.type);
+            WriteEnum(stream, buffer.format);
+            WriteEnum(stream, buffer.accessMode);
+            stream << buffer.sampleCount;
+        }
+        static void Read(IInputStream& stream, RenderBuffer& buffer)
+        {
+            stream >> buffer.width >> buffer.height;
+            ReadEnum(stream, buffer.type);
+            ReadEnum(stream, buffer.format);
+            ReadEnum(stream, buffer.accessMode);
+            stream >> buffer.sampleCount;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<StreamTexture>
+    {
+        static const UInt32 Size = sizeof(ResourceContentHash) + sizeof(Bool) + sizeof(UInt32);
+        static void Write(IOutputStream& stream, const StreamTexture& streamTexture)
+        {
+            stream << streamTexture.fallbackTexture << streamTexture.forceFallbackTexture << static_cast<UInt32>(streamTexture.source);
+        }
+        static void Read(IInputStream& stream, StreamTexture& streamTexture)
+        {
+            UInt32 source = 0u;
+            stream >> streamTexture.fallbackTexture >> streamTexture.forceFallbackTexture >> source;
+            streamTexture.source = source;
+        }
+    };
+
+    template <>
+    struct SnapshotRecord<DataSlot>
+    {
+        static const UInt32 Size = 2u * sizeof(UInt32) + 2u * sizeof(MemoryHandle) + sizeof(ResourceContentHash) + sizeof(MemoryHandle);
+        static void Write(IOutputStream& stream, const DataSlot& dataSlot)
+        {
+            WriteEnum(stream, dataSlot.type);
+            stream << dataSlot.id.getValue();
+            stream << dataSlot.attachedNode.asMemoryHandle() << dataSlot.attachedDataReference.asMemoryHandle();
+            stream << dataSlot.attachedTexture << dataSlot.attachedTextureSampler.asMemoryHandle();
+        }
+        static void Read(IInputStream& stream, DataSlot& dataSlot)
+        {
+            ReadEnum(stream, dataSlot.type);
+            DataSlotId::BaseType id = 0u;
+            stream >> id;
+            dataSlot.id = DataSlotId(id);
+            SnapshotRecord<NodeHandle>::Read(stream, dataSlot.attachedNode);
+            SnapshotRecord<DataInstanceHandle>::Read(stream, dataSlot.attachedDataReference);
+            stream >> dataSlot.attachedTexture;
+            SnapshotRecord<TextureSamplerHandle>::Read(stream, dataSlot.attachedTextureSampler);
+        }
+    };
+
+    template <typename T>
+    static void WriteArray(IOutputStream& stream, const Vector<T>& items)
+    {
+        stream << static_cast<UInt32>(items.size());
+        for (const auto& item : items)
+        {
+            SnapshotRecord<T>::Write(stream, item);
+        }
+    }
+
+    // raw bytes (buffer data, texel data, data instance values) are written as is
+    static void WriteArray(IOutputStream& stream, const Vector<Byte>& bytes)
+    {
+        stream << static_cast<UInt32>(bytes.size());
+        if (!bytes.empty())
+        {
+            stream.write(bytes.data(), static_cast<UInt32>(bytes.size()));
+        }
+    }
+
+    template <typename T>
+    static Bool ReadArray(SnapshotInputStream& stream, Vector<T>& items)
+    {
+        UInt32 count = 0u;
+        if (!stream.readCount(count, SnapshotRecord<T>::Size))
+        {
+            return false;
+        }
+
+        items.resize(count);
+        for (auto& item : items)
+        {
+            SnapshotRecord<T>::Read(stream, item);
+        }
+        return stream.isValid();
+    }
+
+    static Bool ReadArray(SnapshotInputStream& stream, Vector<Byte>& bytes)
+    {
+        UInt32 count = 0u;
+        if (!stream.readCount(count, 1u))
+        {
+            return false;
+        }
+
+        bytes.resize(count);
+        if (count > 0u)
+        {
+            stream.read(reinterpret_cast<Char*>(bytes.data()), count);
+        }
+        return stream.isValid();
+    }
+
+    // sums up the per item counts of a flattened array and checks that they match its size
+    static Bool CountsMatchSize(const Vector<UInt32>& counts, UInt size)
+    {
+        UInt64 total = 0u;
+        for (const auto count : counts)
+        {
+            total += count;
+        }
+        return total == size;
+    }
+
+    template <typename HANDLE, typename ITEM, typename GETTER>
+    static void WritePool(IOutputStream& stream, UInt32 totalCount, const IScene& source, Bool (IScene::*isAllocated)(HANDLE) const, GETTER getter)
+    {
+        Vector<HANDLE> handles;
+        Vector<ITEM> items;
+        for (HANDLE h(0u); h < totalCount; ++h)
+        {
+            if ((source.*isAllocated)(h))
+            {
+                handles.push_back(h);
+                items.push_back(getter(h));
+            }
+        }
+        WriteArray(stream, handles);
+        WriteArray(stream, items);
+    }
+
+    template <typename HANDLE, typename ITEM>
+    static Bool ReadPool(SnapshotInputStream& stream, Vector<HANDLE>& handles, Vector<ITEM>& items)
+    {
+        return ReadArray(stream, handles)
+            && ReadArray(stream, items)
+            && handles.size() == items.size();
+    }
+
+    static const Byte* GetDataFieldValue(const IScene& source, DataInstanceHandle instance, DataFieldHandle field, EDataType dataType)
+    {
+        switch (dataType)
+        {
+        case EDataType_Float:     return reinterpret_cast<const Byte*>(source.getDataFloatArray(instance, field));
+        case EDataType_Vector2F:  return reinterpret_cast<const Byte*>(source.getDataVector2fArray(instance, field));
+        case EDataType_Vector3F:  return reinterpret_cast<const Byte*>(source.getDataVector3fArray(instance, field));
+        case EDataType_Vector4F:  return reinterpret_cast<const Byte*>(source.getDataVector4fArray(instance, field));
+        case EDataType_Matrix22F: return reinterpret_cast<const Byte*>(source.getDataMatrix22fArray(instance, field));
+        case EDataType_Matrix33F: return reinterpret_cast<const Byte*>(source.getDataMatrix33fArray(instance, field));
+        case EDataType_Matrix44F: return reinterpret_cast<const Byte*>(source.getDataMatrix44fArray(instance, field));
+        case EDataType_Int32:     return reinterpret_cast<const Byte*>(source.getDataIntegerArray(instance, field));
+        case EDataType_Vector2I:  return reinterpret_cast<const Byte*>(source.getDataVector2iArray(instance, field));
+        case EDataType_Vector3I:  return reinterpret_cast<const Byte*>(source.getDataVector3iArray(instance, field));
+        case EDataType_Vector4I:  return reinterpret_cast<const Byte*>(source.getDataVector4iArray(instance, field));
+        default:
+            return NULL;
+        }
+    }
+
+    static void SetDataFieldValue(IScene& scene, DataInstanceHandle instance, DataFieldHandle field, EDataType dataType, UInt32 elementCount, const Byte* value)
+    {
+        switch (dataType)
+        {
+        case EDataType_Float:     scene.setDataFloatArray(instance, field, elementCount, reinterpret_cast<const Float*>(value)); break;
+        case EDataType_Vector2F:  scene.setDataVector2fArray(instance, field, elementCount, reinterpret_cast<const Vector2*>(value)); break;
+        case EDataType_Vector3F:  scene.setDataVector3fArray(instance, field, elementCount, reinterpret_cast<const Vector3*>(value)); break;
+        case EDataType_Vector4F:  scene.setDataVector4fArray(instance, field, elementCount, reinterpret_cast<const Vector4*>(value)); break;
+        case EDataType_Matrix22F: scene.setDataMatrix22fArray(instance, field, elementCount, reinterpret_cast<const Matrix22f*>(value)); break;
+        case EDataType_Matrix33F: scene.setDataMatrix33fArray(instance, field, elementCount, reinterpret_cast<const Matrix33f*>(value)); break;
+        case EDataType_Matrix44F: scene.setDataMatrix44fArray(instance, field, elementCount, reinterpret_cast<const Matrix44f*>(value)); break;
+        case EDataType_Int32:     scene.setDataIntegerArray(instance, field, elementCount, reinterpret_cast<const Int32*>(value)); break;
+        case EDataType_Vector2I:  scene.setDataVector2iArray(instance, field, elementCount, reinterpret_cast<const Vector2i*>(value)); break;
+        case EDataType_Vector3I:  scene.setDataVector3iArray(instance, field, elementCount, reinterpret_cast<const Vector3i*>(value)); break;
+        case EDataType_Vector4I:  scene.setDataVector4iArray(instance, field, elementCount, reinterpret_cast<const Vector4i*>(value)); break;
+        default:
+            assert(false);
+            break;
+        }
+    }
+
+    const UInt32 SceneSnapshot::Marker;
+    const UInt32 SceneSnapshot::Version;
+
+    template <typename T>
+    void SceneSnapshot::WriteToStream(IOutputStream& outStream, const T& source)
+    {
+        // the whole snapshot is assembled in memory so that it can be read back with a single bulk read
+        BinaryOutputStream payload(1024u);
+
+        WriteSceneSizeInformation(    payload, source);
+        WriteNodes(                   payload, source);
+        WriteTransforms(              payload, source);
+        WriteRenderables(             payload, source);
+        WriteStates(                  payload, source);
+        WriteDataLayouts(             payload, source);
+        WriteDataInstances(           payload, source);
+        WriteCameras(                 payload, source);
+        WriteAnimationSystems(        payload, source);
+        WriteRenderGroups(            payload, source);
+        WriteRenderPasses(            payload, source);
+        WriteBlitPasses(              payload, source);
+        WriteDataBuffers(             payload, source);
+        WriteTextureBuffers(          payload, source);
+        WriteTextureSamplers(         payload, source);
+        WriteRenderBuffersAndTargets( payload, source);
+        WriteStreamTextures(          payload, source);
+        WriteDataSlots(               payload, source);
+        payload << source.getSceneVersionTag().getValue();
+
+        outStream << Marker;
+        outStream << Version;
+        outStream << payload.getSize();
+        outStream.write(payload.getData(), payload.getSize());
+    }
+
+    bool SceneSnapshot::ReadFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory)
+    {
+        UInt32 version = 0u;
+        inStream >> version;
+        if (version != Version)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: unsupported snapshot version " << version << ", expected " << Version);
+            return false;
+        }
+
+        UInt32 payloadSize = 0u;
+        inStream >> payloadSize;
+
+        // payload is read in chunks, so that a corrupt size never allocates more memory than the stream provides
+        const UInt32 payloadChunkSize = 1024u * 1024u;
+        Vector<Byte> payloadData;
+        while (payloadData.size() < payloadSize && inStream.getState() == EStatus_RAMSES_OK)
+        {
+            const UInt32 offset = static_cast<UInt32>(payloadData.size());
+            const UInt32 chunkSize = std::min(payloadSize - offset, payloadChunkSize);
+            payloadData.resize(offset + chunkSize);
+            inStream.read(reinterpret_cast<Char*>(payloadData.data() + offset), chunkSize);
+        }
+        if (inStream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: failed to read snapshot data of size " << payloadSize);
+            return false;
+        }
+
+        SnapshotInputStream payload(payloadData.data(), payloadSize);
+        const Bool contentRead =
+            ReadSceneSizeInformation(    payload, scene) &&
+            ReadNodes(                   payload, scene) &&
+            ReadTransforms(              payload, scene) &&
+            ReadRenderables(             payload, scene) &&
+            ReadStates(                  payload, scene) &&
+            ReadDataLayouts(             payload, scene) &&
+            ReadDataInstances(           payload, scene) &&
+            ReadCameras(                 payload, scene) &&
+            ReadAnimationSystems(        payload, scene, animSystemFactory) &&
+            ReadRenderGroups(            payload, scene) &&
+            ReadRenderPasses(            payload, scene) &&
+            ReadBlitPasses(              payload, scene) &&
+            ReadDataBuffers(             payload, scene) &&
+            ReadTextureBuffers(          payload, scene) &&
+            ReadTextureSamplers(         payload, scene) &&
+            ReadRenderBuffersAndTargets( payload, scene) &&
+            ReadStreamTextures(          payload, scene) &&
+            ReadDataSlots(               payload, scene);
+
+        SceneVersionTag::BaseType versionTag = InvalidSceneVersionTag.getValue();
+        payload >> versionTag;
+        if (!contentRead || !payload.isValid() || payload.getRemainingSize() != 0u)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: snapshot data of size " << payloadSize << " is corrupt");
+            return false;
+        }
+
+        if (SceneVersionTag(versionTag) != InvalidSceneVersionTag)
+        {
+            scene.setSceneVersionTag(SceneVersionTag(versionTag));
+        }
+
+        return true;
+    }
+
+    void SceneSnapshot::WriteSceneSizeInformation(IOutputStream& stream, const IScene& source)
+    {
+        const SceneSizeInformation sizeInfo = source.getSceneSizeInformation();
+        stream << sizeInfo.nodeCount;
+        stream << sizeInfo.cameraCount;
+        stream << sizeInfo.transformCount;
+        stream << sizeInfo.renderableCount;
+        stream << sizeInfo.renderStateCount;
+        stream << sizeInfo.datalayoutCount;
+        stream << sizeInfo.datainstanceCount;
+        stream << sizeInfo.renderGroupCount;
+        stream << sizeInfo.renderPassCount;
+        stream << sizeInfo.blitPassCount;
+        stream << sizeInfo.renderTargetCount;
+        stream << sizeInfo.renderBufferCount;
+        stream << sizeInfo.textureSamplerCount;
+        stream << sizeInfo.streamTextureCount;
+        stream << sizeInfo.dataSlotCount;
+        stream << sizeInfo.dataBufferCount;
+        stream << sizeInfo.animationSystemCount;
+        stream << sizeInfo.textureBufferCount;
+    }
+
+    Bool SceneSnapshot::ReadSceneSizeInformation(SnapshotInputStream& stream, IScene& scene)
+    {
+        SceneSizeInformation sizeInfo;
+        stream >> sizeInfo.nodeCount;
+        stream >> sizeInfo.cameraCount;
+        stream >> sizeInfo.transformCount;
+        stream >> sizeInfo.renderableCount;
+        stream >> sizeInfo.renderStateCount;
+        stream >> sizeInfo.datalayoutCount;
+        stream >> sizeInfo.datainstanceCount;
+        stream >> sizeInfo.renderGroupCount;
+        stream >> sizeInfo.renderPassCount;
+        stream >> sizeInfo.blitPassCount;
+        stream >> sizeInfo.renderTargetCount;
+        stream >> sizeInfo.renderBufferCount;
+        stream >> sizeInfo.textureSamplerCount;
+        stream >> sizeInfo.streamTextureCount;
+        stream >> sizeInfo.dataSlotCount;
+        stream >> sizeInfo.dataBufferCount;
+        stream >> sizeInfo.animationSystemCount;
+        stream >> sizeInfo.textureBufferCount;
+        if (!stream.isValid())
+        {
+            return false;
+        }
+
+        // pools are grown once to their final size instead of reallocating while entries are allocated
+        scene.preallocateSceneSize(sizeInfo);
+        return true;
+    }
+
+    void SceneSnapshot::WriteNodes(IOutputStream& stream, const IScene& source)
+    {
+        Vector<NodeHandle> nodes;
+        Vector<UInt32> childCounts;
+        Vector<NodeHandle> children;
+        const UInt32 totalNodeCount = source.getNodeCount();
+        for (NodeHandle n(0u); n < totalNodeCount; ++n)
+        {
+            if (source.isNodeAllocated(n))
+            {
+                const UInt32 childCount = source.getChildCount(n);
+                nodes.push_back(n);
+                childCounts.push_back(childCount);
+                for (UInt32 child = 0; child < childCount; ++child)
+                {
+                    children.push_back(source.getChild(n, child));
+                }
+            }
+        }
+
+        WriteArray(stream, nodes);
+        WriteArray(stream, childCounts);
+        WriteArray(stream, children);
+    }
+
+    Bool SceneSnapshot::ReadNodes(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<NodeHandle> nodes;
+        Vector<UInt32> childCounts;
+        Vector<NodeHandle> children;
+        if (!ReadArray(stream, nodes) ||
+            !ReadArray(stream, childCounts) ||
+            !ReadArray(stream, children) ||
+            nodes.size() != childCounts.size() ||
+            !CountsMatchSize(childCounts, children.size()))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < nodes.size(); ++i)
+        {
+            scene.allocateNode(childCounts[i], nodes[i]);
+        }
+
+        UInt childIdx = 0u;
+        for (UInt i = 0u; i < nodes.size(); ++i)
+        {
+            for (UInt32 child = 0u; child < childCounts[i]; ++child)
+            {
+                scene.addChildToNode(nodes[i], children[childIdx++]);
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteTransforms(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<TransformHandle, SnapshotTransform>(stream, source.getTransformCount(), source, &IScene::isTransformAllocated, [&source](TransformHandle t)
+        {
+            SnapshotTransform transform;
+            transform.node = source.getTransformNode(t);
+            PlatformMemory::Copy(transform.translation, source.getTranslation(t).data, sizeof(transform.translation));
+            PlatformMemory::Copy(transform.rotation, source.getRotation(t).data, sizeof(transform.rotation));
+            PlatformMemory::Copy(transform.scaling, source.getScaling(t).data, sizeof(transform.scaling));
+            return transform;
+        });
+    }
+
+    Bool SceneSnapshot::ReadTransforms(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<TransformHandle> handles;
+        Vector<SnapshotTransform> transforms;
+        if (!ReadPool(stream, handles, transforms))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const TransformHandle t = handles[i];
+            const SnapshotTransform& transform = transforms[i];
+            scene.allocateTransform(transform.node, t);
+
+            const Vector3 translation(transform.translation[0], transform.translation[1], transform.translation[2]);
+            if (translation != Vector3::Empty)
+            {
+                scene.setTranslation(t, translation);
+            }
+            const Vector3 rotation(transform.rotation[0], transform.rotation[1], transform.rotation[2]);
+            if (rotation != Vector3::Empty)
+            {
+                scene.setRotation(t, rotation);
+            }
+            const Vector3 scaling(transform.scaling[0], transform.scaling[1], transform.scaling[2]);
+            if (scaling != Vector3::Identity)
+            {
+                scene.setScaling(t, scaling);
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteRenderables(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<RenderableHandle, Renderable>(stream, source.getRenderableCount(), source, &IScene::isRenderableAllocated, [&source](RenderableHandle r)
+        {
+            return source.getRenderable(r);
+        });
+    }
+
+    Bool SceneSnapshot::ReadRenderables(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<RenderableHandle> handles;
+        Vector<Renderable> renderables;
+        if (!ReadPool(stream, handles, renderables))
+        {
+            return false;
+        }
+
+        const Renderable defaultRenderable;
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const RenderableHandle r = handles[i];
+            const Renderable& renderable = renderables[i];
+            scene.allocateRenderable(renderable.node, r);
+
+            if (renderable.effectResource != defaultRenderable.effectResource)
+                scene.setRenderableEffect(r, renderable.effectResource);
+            if (renderable.isVisible != defaultRenderable.isVisible)
+                scene.setRenderableVisibility(r, renderable.isVisible);
+            if (renderable.startIndex != defaultRenderable.startIndex)
+                scene.setRenderableStartIndex(r, renderable.startIndex);
+            if (renderable.indexCount != defaultRenderable.indexCount)
+                scene.setRenderableIndexCount(r, renderable.indexCount);
+            if (renderable.instanceCount != defaultRenderable.instanceCount)
+                scene.setRenderableInstanceCount(r, renderable.instanceCount);
+            if (renderable.renderState.isValid())
+                scene.setRenderableRenderState(r, renderable.renderState);
+            for (UInt32 slot = 0u; slot < ERenderableDataSlotType_MAX_SLOTS; ++slot)
+            {
+                if (renderable.dataInstances[slot].isValid())
+                    scene.setRenderableDataInstance(r, static_cast<ERenderableDataSlotType>(slot), renderable.dataInstances[slot]);
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteStates(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<RenderStateHandle, RenderState>(stream, source.getRenderStateCount(), source, &IScene::isRenderStateAllocated, [&source](RenderStateHandle s)
+        {
+            return source.getRenderState(s);
+        });
+    }
+
+    Bool SceneSnapshot::ReadStates(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<RenderStateHandle> handles;
+        Vector<RenderState> states;
+        if (!ReadPool(stream, handles, states))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const RenderStateHandle s = handles[i];
+            const RenderState& state = states[i];
+            scene.allocateRenderState(s);
+            scene.setRenderStateBlendFactors(s, state.blendFactorSrcColor, state.blendFactorDstColor, state.blendFactorSrcAlpha, state.blendFactorDstAlpha);
+            scene.setRenderStateBlendOperations(s, state.blendOperationColor, state.blendOperationAlpha);
+            scene.setRenderStateCullMode(s, state.cullMode);
+            scene.setRenderStateDrawMode(s, state.drawMode);
+            scene.setRenderStateDepthFunc(s, state.depthFunc);
+            scene.setRenderStateDepthWrite(s, state.depthWrite);
+            scene.setRenderStateStencilFunc(s, state.stencilFunc, state.stencilRefValue, state.stencilMask);
+            scene.setRenderStateStencilOps(s, state.stencilOpFail, state.stencilOpDepthFail, state.stencilOpDepthPass);
+            scene.setRenderStateColorWriteMask(s, state.colorWriteMask);
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteDataLayouts(IOutputStream& stream, const IScene& source)
+    {
+        Vector<DataLayoutHandle> handles;
+        Vector<UInt32> referenceCounts;
+        Vector<UInt32> fieldCounts;
+        Vector<DataFieldInfo> fields;
+        const UInt32 totalDataLayoutCount = source.getDataLayoutCount();
+        for (DataLayoutHandle l(0u); l < totalDataLayoutCount; ++l)
+        {
+            if (source.isDataLayoutAllocated(l))
+            {
+                const DataFieldInfoVector& layoutFields = source.getDataLayout(l).getDataFields();
+                handles.push_back(l);
+                referenceCounts.push_back(1u);
+                fieldCounts.push_back(static_cast<UInt32>(layoutFields.size()));
+                fields.insert(fields.end(), layoutFields.begin(), layoutFields.end());
+            }
+        }
+
+        WriteArray(stream, handles);
+        WriteArray(stream, referenceCounts);
+        WriteArray(stream, fieldCounts);
+        WriteArray(stream, fields);
+    }
+
+    // overload for a client scene which compacts data layouts and those must be expanded while serializing
+    void SceneSnapshot::WriteDataLayouts(IOutputStream& stream, const ClientScene& source)
+    {
+        Vector<DataLayoutHandle> handles;
+        Vector<UInt32> referenceCounts;
+        Vector<UInt32> fieldCounts;
+        Vector<DataFieldInfo> fields;
+        const UInt32 totalDataLayoutCount = source.getDataLayoutCount();
+        for (DataLayoutHandle l(0u); l < totalDataLayoutCount; ++l)
+        {
+            if (source.isDataLayoutAllocated(l))
+            {
+                const DataFieldInfoVector& layoutFields = source.getDataLayout(l).getDataFields();
+                handles.push_back(l);
+                referenceCounts.push_back(source.getNumDataLayoutReferences(l));
+                fieldCounts.push_back(static_cast<UInt32>(layoutFields.size()));
+                fields.insert(fields.end(), layoutFields.begin(), layoutFields.end());
+            }
+        }
+
+        WriteArray(stream, handles);
+        WriteArray(stream, referenceCounts);
+        WriteArray(stream, fieldCounts);
+        WriteArray(stream, fields);
+    }
+
+    Bool SceneSnapshot::ReadDataLayouts(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<DataLayoutHandle> handles;
+        Vector<UInt32> referenceCounts;
+        Vector<UInt32> fieldCounts;
+        Vector<DataFieldInfo> fields;
+        if (!ReadArray(stream, handles) ||
+            !ReadArray(stream, referenceCounts) ||
+            !ReadArray(stream, fieldCounts) ||
+            !ReadArray(stream, fields) ||
+            handles.size() != referenceCounts.size() ||
+            handles.size() != fieldCounts.size() ||
+            !CountsMatchSize(fieldCounts, fields.size()))
+        {
+            return false;
+        }
+
+        for (const auto& field : fields)
+        {
+            if (field.dataType >= EDataType_NUMBER_OF_ELEMENTS)
+            {
+                return false;
+            }
+        }
+
+        UInt fieldIdx = 0u;
+        DataFieldInfoVector layoutFields;
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            layoutFields.clear();
+            layoutFields.insert(layoutFields.end(), fields.begin() + fieldIdx, fields.begin() + fieldIdx + fieldCounts[i]);
+            fieldIdx += fieldCounts[i];
+            for (UInt32 r = 0u; r < referenceCounts[i]; ++r)
+            {
+                scene.allocateDataLayout(layoutFields, handles[i]);
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteDataInstances(IOutputStream& stream, const IScene& source)
+    {
+        Vector<DataInstanceHandle> handles;
+        Vector<DataLayoutHandle> layouts;
+        const UInt32 totalDataInstanceCount = source.getDataInstanceCount();
+        for (DataInstanceHandle i(0u); i < totalDataInstanceCount; ++i)
+        {
+            if (source.isDataInstanceAllocated(i))
+            {
+                handles.push_back(i);
+                layouts.push_back(source.getLayoutOfDataInstance(i));
+            }
+        }
+        WriteArray(stream, handles);
+        WriteArray(stream, layouts);
+
+        // per instance: a slab with all plain value fields followed by the non-value fields in field order
+        Vector<Byte> slab;
+        for (UInt idx = 0u; idx < handles.size(); ++idx)
+        {
+            const DataInstanceHandle i = handles[idx];
+            const DataLayout& layout = source.getDataLayout(layouts[idx]);
+
+            slab.clear();
+            for (DataFieldHandle f(0u); f < layout.getFieldCount(); ++f)
+            {
+                const DataFieldInfo& field = layout.getField(f);
+                const Byte* value = GetDataFieldValue(source, i, f, field.dataType);
+                if (value != NULL)
+                {
+                    slab.insert(slab.end(), value, value + field.elementCount * EnumToSize(field.dataType));
+                }
+            }
+            WriteArray(stream, slab);
+
+            for (DataFieldHandle f(0u); f < layout.getFieldCount(); ++f)
+            {
+                switch (layout.getField(f).dataType)
+                {
+                case EDataType_TextureSampler:
+                    stream << source.getDataTextureSamplerHandle(i, f).asMemoryHandle();
+                    break;
+                case EDataType_DataReference:
+                    stream << source.getDataReference(i, f).asMemoryHandle();
+                    break;
+                case EDataType_Indices:
+                case EDataType_UInt16Buffer:
+                case EDataType_FloatBuffer:
+                case EDataType_Vector2Buffer:
+                case EDataType_Vector3Buffer:
+                case EDataType_Vector4Buffer:
+                {
+                    const ResourceField& dataResource = source.getDataResource(i, f);
+                    stream << dataResource.hash << dataResource.dataBuffer.asMemoryHandle() << dataResource.instancingDivisor;
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
+    Bool SceneSnapshot::ReadDataInstances(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<DataInstanceHandle> handles;
+        Vector<DataLayoutHandle> layouts;
+        if (!ReadArray(stream, handles) ||
+            !ReadArray(stream, layouts) ||
+            handles.size() != layouts.size())
+        {
+            return false;
+        }
+
+        Vector<Byte> slab;
+        for (UInt idx = 0u; idx < handles.size(); ++idx)
+        {
+            if (!scene.isDataLayoutAllocated(layouts[idx]) || !ReadArray(stream, slab))
+            {
+                return false;
+            }
+
+            const DataInstanceHandle i = handles[idx];
+            scene.allocateDataInstance(layouts[idx], i);
+            const DataLayout& layout = scene.getDataLayout(layouts[idx]);
+
+            UInt32 slabOffset = 0u;
+            for (DataFieldHandle f(0u); f < layout.getFieldCount(); ++f)
+            {
+                const DataFieldInfo& field = layout.getField(f);
+                switch (field.dataType)
+                {
+                case EDataType_TextureSampler:
+                {
+                    TextureSamplerHandle sampler;
+                    SnapshotRecord<TextureSamplerHandle>::Read(stream, sampler);
+                    scene.setDataTextureSamplerHandle(i, f, sampler);
+                    break;
+                }
+                case EDataType_DataReference:
+                {
+                    DataInstanceHandle dataRef;
+                    SnapshotRecord<DataInstanceHandle>::Read(stream, dataRef);
+                    scene.setDataReference(i, f, dataRef);
+                    break;
+                }
+                case EDataType_Indices:
+                case EDataType_UInt16Buffer:
+                case EDataType_FloatBuffer:
+                case EDataType_Vector2Buffer:
+                case EDataType_Vector3Buffer:
+                case EDataType_Vector4Buffer:
+                {
+                    ResourceContentHash hash;
+                    DataBufferHandle dataBuffer;
+                    UInt32 instancingDivisor = 0u;
+                    stream >> hash;
+                    SnapshotRecord<DataBufferHandle>::Read(stream, dataBuffer);
+                    stream >> instancingDivisor;
+                    if (hash.isValid() || dataBuffer.isValid())
+                    {
+                        scene.setDataResource(i, f, hash, dataBuffer, instancingDivisor);
+                    }
+                    break;
+                }
+                default:
+                {
+                    // all value types are 4 byte based, slab is heap allocated so field values stay aligned
+                    const UInt64 fieldSize = static_cast<UInt64>(field.elementCount) * EnumToSize(field.dataType);
+                    if (slabOffset + fieldSize > slab.size())
+                    {
+                        return false;
+                    }
+                    const Byte* value = slab.data() + slabOffset;
+                    if (!MemoryUtils::AreAllBytesZero(value, static_cast<UInt32>(fieldSize)))
+                    {
+                        SetDataFieldValue(scene, i, f, field.dataType, field.elementCount, value);
+                    }
+                    slabOffset += static_cast<UInt32>(fieldSize);
+                    break;
+                }
+                }
+            }
+
+            if (!stream.isValid() || slabOffset != slab.size())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteCameras(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<CameraHandle, Camera>(stream, source.getCameraCount(), source, &IScene::isCameraAllocated, [&source](CameraHandle c)
+        {
+            return source.getCamera(c);
+        });
+    }
+
+    Bool SceneSnapshot::ReadCameras(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<CameraHandle> handles;
+        Vector<Camera> cameras;
+        if (!ReadPool(stream, handles, cameras))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const Camera& camera = cameras[i];
+            scene.allocateCamera(camera.projectionType, camera.node, handles[i]);
+            scene.setCameraViewport(handles[i], camera.viewport);
+            if (camera.projectionType != ECameraProjectionType_Renderer)
+            {
+                scene.setCameraFrustum(handles[i], camera.frustum);
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteAnimationSystems(IOutputStream& stream, const IScene& source)
+    {
+        // animation systems have no flat pool representation, they are embedded as scene actions
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator(collection);
+        for (auto animId = AnimationSystemHandle(0); animId < source.getAnimationSystemCount(); ++animId)
+        {
+            if (source.isAnimationSystemAllocated(animId))
+            {
+                const IAnimationSystem* animSystem = source.getAnimationSystem(animId);
+                assert(animSystem != NULL);
+                creator.addAnimationSystem(animId, animSystem->getFlags(), animSystem->getTotalSizeInformation());
+                AnimationSystemDescriber::DescribeAnimationSystem(*animSystem, creator, animId);
+            }
+        }
+
+        ScenePersistation::WriteSceneActionsToStream(stream, collection);
+    }
+
+    Bool SceneSnapshot::ReadAnimationSystems(SnapshotInputStream& stream, IScene& scene, AnimationSystemFactory* animSystemFactory)
+    {
+        // same layout as written by ScenePersistation::WriteSceneActionsToStream, read here to validate it against the payload
+        UInt32 actionCount = 0u;
+        UInt32 actionDataSize = 0u;
+        if (!stream.readCount(actionCount, 2u * sizeof(UInt32)) ||
+            !stream.readCount(actionDataSize, 1u))
+        {
+            return false;
+        }
+
+        SceneActionCollection collection;
+        collection.reserveAdditionalCapacity(0u, actionCount);
+        Vector<Byte>& actionData = collection.getRawDataForDirectWriting();
+        actionData.resize(actionDataSize);
+        if (actionDataSize > 0u)
+        {
+            stream.read(reinterpret_cast<Char*>(actionData.data()), actionDataSize);
+        }
+
+        UInt32 previousOffset = 0u;
+        for (UInt32 i = 0u; i < actionCount; ++i)
+        {
+            UInt32 actionType = 0u;
+            UInt32 offsetInCollection = 0u;
+            stream >> actionType >> offsetInCollection;
+            if (!stream.isValid() || actionType >= ESceneActionId_NUMBER_OF_TYPES || offsetInCollection < previousOffset || offsetInCollection > actionDataSize)
+            {
+                return false;
+            }
+            collection.addRawSceneActionInformation(static_cast<ESceneActionId>(actionType), offsetInCollection);
+            previousOffset = offsetInCollection;
+        }
+
+        if (!collection.empty())
+        {
+            SceneActionApplier::ApplyActionsOnScene(scene, collection, animSystemFactory);
+        }
+        return stream.isValid();
+    }
+
+    void SceneSnapshot::WriteRenderGroups(IOutputStream& stream, const IScene& source)
+    {
+        Vector<RenderGroupHandle> handles;
+        Vector<UInt32> renderableCounts;
+        Vector<UInt32> nestedGroupCounts;
+        Vector<RenderableOrderEntry> renderables;
+        Vector<RenderGroupOrderEntry> nestedGroups;
+        const UInt32 renderGroupTotalCount = source.getRenderGroupCount();
+        for (RenderGroupHandle renderGroup(0u); renderGroup < renderGroupTotalCount; ++renderGroup)
+        {
+            if (source.isRenderGroupAllocated(renderGroup))
+            {
+                const RenderGroup& rg = source.getRenderGroup(renderGroup);
+                handles.push_back(renderGroup);
+                renderableCounts.push_back(static_cast<UInt32>(rg.renderables.size()));
+                nestedGroupCounts.push_back(static_cast<UInt32>(rg.renderGroups.size()));
+                renderables.insert(renderables.end(), rg.renderables.begin(), rg.renderables.end());
+                nestedGroups.insert(nestedGroups.end(), rg.renderGroups.begin(), rg.renderGroups.end());
+            }
+        }
+
+        WriteArray(stream, handles);
+        WriteArray(stream, renderableCounts);
+        WriteArray(stream, nestedGroupCounts);
+        WriteArray(stream, renderables);
+        WriteArray(stream, nestedGroups);
+    }
+
+    Bool SceneSnapshot::ReadRenderGroups(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<RenderGroupHandle> handles;
+        Vector<UInt32> renderableCounts;
+        Vector<UInt32> nestedGroupCounts;
+        Vector<RenderableOrderEntry> renderables;
+        Vector<RenderGroupOrderEntry> nestedGroups;
+        if (!ReadArray(stream, handles) ||
+            !ReadArray(stream, renderableCounts) ||
+            !ReadArray(stream, nestedGroupCounts) ||
+            !ReadArray(stream, renderables) ||
+            !ReadArray(stream, nestedGroups) ||
+            handles.size() != renderableCounts.size() ||
+            handles.size() != nestedGroupCounts.size() ||
+            !CountsMatchSize(renderableCounts, renderables.size()) ||
+            !CountsMatchSize(nestedGroupCounts, nestedGroups.size()))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            scene.allocateRenderGroup(renderableCounts[i], nestedGroupCounts[i], handles[i]);
+        }
+
+        UInt renderableIdx = 0u;
+        UInt nestedGroupIdx = 0u;
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            for (UInt32 r = 0u; r < renderableCounts[i]; ++r, ++renderableIdx)
+                scene.addRenderableToRenderGroup(handles[i], renderables[renderableIdx].renderable, renderables[renderableIdx].order);
+            for (UInt32 g = 0u; g < nestedGroupCounts[i]; ++g, ++nestedGroupIdx)
+                scene.addRenderGroupToRenderGroup(handles[i], nestedGroups[nestedGroupIdx].renderGroup, nestedGroups[nestedGroupIdx].order);
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteRenderPasses(IOutputStream& stream, const IScene& source)
+    {
+        Vector<RenderPassHandle> handles;
+        Vector<SnapshotRenderPass> passes;
+        Vector<RenderGroupOrderEntry> renderGroups;
+        const UInt32 renderPassTotalCount = source.getRenderPassCount();
+        for (RenderPassHandle renderPass(0u); renderPass < renderPassTotalCount; ++renderPass)
+        {
+            if (source.isRenderPassAllocated(renderPass))
+            {
+                const RenderPass& rp = source.getRenderPass(renderPass);
+                SnapshotRenderPass pass;
+                pass.isEnabled = rp.isEnabled;
+                pass.isRenderOnce = rp.isRenderOnce;
+                pass.isInstanceBatchingEnabled = rp.isInstanceBatchingEnabled;
+                pass.camera = rp.camera;
+                pass.renderTarget = rp.renderTarget;
+                pass.renderOrder = rp.renderOrder;
+                PlatformMemory::Copy(pass.clearColor, rp.clearColor.data, sizeof(pass.clearColor));
+                pass.clearFlags = rp.clearFlags;
+                pass.renderGroupCount = static_cast<UInt32>(rp.renderGroups.size());
+
+                handles.push_back(renderPass);
+                passes.push_back(pass);
+                renderGroups.insert(renderGroups.end(), rp.renderGroups.begin(), rp.renderGroups.end());
+            }
+        }
+
+        WriteArray(stream, handles);
+        WriteArray(stream, passes);
+        WriteArray(stream, renderGroups);
+    }
+
+    Bool SceneSnapshot::ReadRenderPasses(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<RenderPassHandle> handles;
+        Vector<SnapshotRenderPass> passes;
+        Vector<RenderGroupOrderEntry> renderGroups;
+        if (!ReadArray(stream, handles) ||
+            !ReadArray(stream, passes) ||
+            !ReadArray(stream, renderGroups) ||
+            handles.size() != passes.size())
+        {
+            return false;
+        }
+
+        UInt64 totalRenderGroupCount = 0u;
+        for (const auto& pass : passes)
+        {
+            totalRenderGroupCount += pass.renderGroupCount;
+        }
+        if (totalRenderGroupCount != renderGroups.size())
+        {
+            return false;
+        }
+
+        UInt renderGroupIdx = 0u;
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const RenderPassHandle renderPass = handles[i];
+            const SnapshotRenderPass& pass = passes[i];
+            scene.allocateRenderPass(pass.renderGroupCount, renderPass);
+            scene.setRenderPassRenderOrder(renderPass, pass.renderOrder);
+            scene.setRenderPassClearColor(renderPass, Vector4(pass.clearColor[0], pass.clearColor[1], pass.clearColor[2], pass.clearColor[3]));
+            scene.setRenderPassClearFlag(renderPass, pass.clearFlags);
+            if (pass.camera.isValid())
+                scene.setRenderPassCamera(renderPass, pass.camera);
+            scene.setRenderPassRenderTarget(renderPass, pass.renderTarget);
+            scene.setRenderPassEnabled(renderPass, pass.isEnabled);
+            if (pass.isRenderOnce)
+                scene.setRenderPassRenderOnce(renderPass, true);
+            if (pass.isInstanceBatchingEnabled)
+                scene.setRenderPassInstanceBatching(renderPass, true);
+            for (UInt32 g = 0u; g < pass.renderGroupCount; ++g, ++renderGroupIdx)
+                scene.addRenderGroupToRenderPass(renderPass, renderGroups[renderGroupIdx].renderGroup, renderGroups[renderGroupIdx].order);
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteBlitPasses(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<BlitPassHandle, BlitPass>(stream, source.getBlitPassCount(), source, &IScene::isBlitPassAllocated, [&source](BlitPassHandle b)
+        {
+            return source.getBlitPass(b);
+        });
+    }
+
+    Bool SceneSnapshot::ReadBlitPasses(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<BlitPassHandle> handles;
+        Vector<BlitPass> blitPasses;
+        if (!ReadPool(stream, handles, blitPasses))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const BlitPass& blitPass = blitPasses[i];
+            scene.allocateBlitPass(blitPass.sourceRenderBuffer, blitPass.destinationRenderBuffer, handles[i]);
+            scene.setBlitPassRegions(handles[i], blitPass.sourceRegion, blitPass.destinationRegion);
+            scene.setBlitPassRenderOrder(handles[i], blitPass.renderOrder);
+            scene.setBlitPassEnabled(handles[i], blitPass.isEnabled);
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteDataBuffers(IOutputStream& stream, const IScene& source)
+    {
+        Vector<DataBufferHandle> handles;
+        Vector<SnapshotDataBuffer> buffers;
+        Vector<Byte> data;
+        const UInt32 dataBufferTotalCount = source.getDataBufferCount();
+        for (DataBufferHandle handle(0u); handle < dataBufferTotalCount; ++handle)
+        {
+            if (source.isDataBufferAllocated(handle))
+            {
+                const GeometryDataBuffer& dataBuffer = source.getDataBuffer(handle);
+                SnapshotDataBuffer buffer;
+                buffer.bufferType = dataBuffer.bufferType;
+                buffer.dataType = dataBuffer.dataType;
+                buffer.maximumSize = static_cast<UInt32>(dataBuffer.data.size());
+                buffer.usedSize = dataBuffer.usedSize;
+
+                handles.push_back(handle);
+                buffers.push_back(buffer);
+                data.insert(data.end(), dataBuffer.data.begin(), dataBuffer.data.begin() + dataBuffer.usedSize);
+            }
+        }
+
+        WriteArray(stream, handles);
+        WriteArray(stream, buffers);
+        WriteArray(stream, data);
+    }
+
+    Bool SceneSnapshot::ReadDataBuffers(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<DataBufferHandle> handles;
+        Vector<SnapshotDataBuffer> buffers;
+        Vector<Byte> data;
+        if (!ReadArray(stream, handles) ||
+            !ReadArray(stream, buffers) ||
+            !ReadArray(stream, data) ||
+            handles.size() != buffers.size())
+        {
+            return false;
+        }
+
+        UInt64 totalUsedSize = 0u;
+        for (const auto& buffer : buffers)
+        {
+            if (buffer.usedSize > buffer.maximumSize)
+            {
+                return false;
+            }
+            totalUsedSize += buffer.usedSize;
+        }
+        if (totalUsedSize != data.size())
+        {
+            return false;
+        }
+
+        UInt dataOffset = 0u;
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const SnapshotDataBuffer& buffer = buffers[i];
+            scene.allocateDataBuffer(buffer.bufferType, buffer.dataType, buffer.maximumSize, handles[i]);
+            scene.updateDataBuffer(handles[i], 0u, buffer.usedSize, data.data() + dataOffset);
+            dataOffset += buffer.usedSize;
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteTextureBuffers(IOutputStream& stream, const IScene& source)
+    {
+        Vector<TextureBufferHandle> handles;
+        Vector<ETextureFormat> formats;
+        Vector<UInt32> mipCounts;
+        Vector<MipMapSize> mipSizes;
+        Vector<Byte> data;
+        const UInt32 textureBufferTotalCount = source.getTextureBufferCount();
+        for (TextureBufferHandle textureBufferHandle(0u); textureBufferHandle < textureBufferTotalCount; ++textureBufferHandle)
+        {
+            if (source.isTextureBufferAllocated(textureBufferHandle))
+            {
+                const TextureBuffer& textureBuffer = source.getTextureBuffer(textureBufferHandle);
+                handles.push_back(textureBufferHandle);
+                formats.push_back(textureBuffer.textureFormat);
+                mipCounts.push_back(static_cast<UInt32>(textureBuffer.mipMapDimensions.size()));
+                mipSizes.insert(mipSizes.end(), textureBuffer.mipMapDimensions.begin(), textureBuffer.mipMapDimensions.end());
+                for (UInt32 mipMapLevel = 0u; mipMapLevel < textureBuffer.mipMapDimensions.size(); ++mipMapLevel)
+                {
+                    const MipMapSize mipMapSize = textureBuffer.mipMapDimensions[mipMapLevel];
+                    const UInt32 mipLevelDataSize = mipMapSize.width * mipMapSize.height * GetTexelSizeFromFormat(textureBuffer.textureFormat);
+                    const Byte* mipMapData = textureBuffer.mipMapData[mipMapLevel].data();
+                    data.insert(data.end(), mipMapData, mipMapData + mipLevelDataSize);
+                }
+            }
+        }
+
+        WriteArray(stream, handles);
+        WriteArray(stream, formats);
+        WriteArray(stream, mipCounts);
+        WriteArray(stream, mipSizes);
+        WriteArray(stream, data);
+    }
+
+    Bool SceneSnapshot::ReadTextureBuffers(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<TextureBufferHandle> handles;
+        Vector<ETextureFormat> formats;
+        Vector<UInt32> mipCounts;
+        Vector<MipMapSize> mipSizes;
+        Vector<Byte> data;
+        if (!ReadArray(stream, handles) ||
+            !ReadArray(stream, formats) ||
+            !ReadArray(stream, mipCounts) ||
+            !ReadArray(stream, mipSizes) ||
+            !ReadArray(stream, data) ||
+            handles.size() != formats.size() ||
+            handles.size() != mipCounts.size() ||
+            !CountsMatchSize(mipCounts, mipSizes.size()))
+        {
+            return false;
+        }
+
+        UInt64 totalDataSize = 0u;
+        UInt mipIdx = 0u;
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            if (formats[i] >= ETextureFormat_NUMBER_OF_TYPES)
+            {
+                return false;
+            }
+            for (UInt32 mipMapLevel = 0u; mipMapLevel < mipCounts[i]; ++mipMapLevel, ++mipIdx)
+            {
+                totalDataSize += static_cast<UInt64>(mipSizes[mipIdx].width) * mipSizes[mipIdx].height * GetTexelSizeFromFormat(formats[i]);
+            }
+        }
+        if (totalDataSize != data.size())
+        {
+            return false;
+        }
+
+        mipIdx = 0u;
+        UInt dataOffset = 0u;
+        MipMapDimensions mipMapDimensions;
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            mipMapDimensions.clear();
+            mipMapDimensions.insert(mipMapDimensions.end(), mipSizes.begin() + mipIdx, mipSizes.begin() + mipIdx + mipCounts[i]);
+            mipIdx += mipCounts[i];
+            scene.allocateTextureBuffer(formats[i], mipMapDimensions, handles[i]);
+
+            for (UInt32 mipMapLevel = 0u; mipMapLevel < mipMapDimensions.size(); ++mipMapLevel)
+            {
+                const MipMapSize mipMapSize = mipMapDimensions[mipMapLevel];
+                scene.updateTextureBuffer(handles[i], mipMapLevel, 0u, 0u, mipMapSize.width, mipMapSize.height, data.data() + dataOffset);
+                dataOffset += mipMapSize.width * mipMapSize.height * GetTexelSizeFromFormat(formats[i]);
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteTextureSamplers(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<TextureSamplerHandle, TextureSampler>(stream, source.getTextureSamplerCount(), source, &IScene::isTextureSamplerAllocated, [&source](TextureSamplerHandle s)
+        {
+            return source.getTextureSampler(s);
+        });
+    }
+
+    Bool SceneSnapshot::ReadTextureSamplers(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<TextureSamplerHandle> handles;
+        Vector<TextureSampler> samplers;
+        if (!ReadPool(stream, handles, samplers))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            scene.allocateTextureSampler(samplers[i], handles[i]);
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteRenderBuffersAndTargets(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<RenderBufferHandle, RenderBuffer>(stream, source.getRenderBufferCount(), source, &IScene::isRenderBufferAllocated, [&source](RenderBufferHandle b)
+        {
+            return source.getRenderBuffer(b);
+        });
+
+        Vector<RenderTargetHandle> targets;
+        Vector<UInt32> bufferCounts;
+        Vector<RenderBufferHandle> buffers;
+        const UInt32 renderTargetCount = source.getRenderTargetCount();
+        for (RenderTargetHandle renderTargetHandle(0u); renderTargetHandle < renderTargetCount; ++renderTargetHandle)
+        {
+            if (source.isRenderTargetAllocated(renderTargetHandle))
+            {
+                const UInt32 bufferCount = source.getRenderTargetRenderBufferCount(renderTargetHandle);
+                targets.push_back(renderTargetHandle);
+                bufferCounts.push_back(bufferCount);
+                for (UInt32 bufferIdx = 0u; bufferIdx < bufferCount; ++bufferIdx)
+                {
+                    buffers.push_back(source.getRenderTargetRenderBuffer(renderTargetHandle, bufferIdx));
+                }
+            }
+        }
+
+        WriteArray(stream, targets);
+        WriteArray(stream, bufferCounts);
+        WriteArray(stream, buffers);
+    }
+
+    Bool SceneSnapshot::ReadRenderBuffersAndTargets(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<RenderBufferHandle> bufferHandles;
+        Vector<RenderBuffer> renderBuffers;
+        Vector<RenderTargetHandle> targets;
+        Vector<UInt32> bufferCounts;
+        Vector<RenderBufferHandle> buffers;
+        if (!ReadPool(stream, bufferHandles, renderBuffers) ||
+            !ReadArray(stream, targets) ||
+            !ReadArray(stream, bufferCounts) ||
+            !ReadArray(stream, buffers) ||
+            targets.size() != bufferCounts.size() ||
+            !CountsMatchSize(bufferCounts, buffers.size()))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < bufferHandles.size(); ++i)
+        {
+            scene.allocateRenderBuffer(renderBuffers[i], bufferHandles[i]);
+        }
+
+        UInt bufferIdx = 0u;
+        for (UInt i = 0u; i < targets.size(); ++i)
+        {
+            scene.allocateRenderTarget(targets[i]);
+            for (UInt32 b = 0u; b < bufferCounts[i]; ++b)
+            {
+                scene.addRenderTargetRenderBuffer(targets[i], buffers[bufferIdx++]);
+            }
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteStreamTextures(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<StreamTextureHandle, StreamTexture>(stream, source.getStreamTextureCount(), source, &IScene::isStreamTextureAllocated, [&source](StreamTextureHandle s)
+        {
+            return source.getStreamTexture(s);
+        });
+    }
+
+    Bool SceneSnapshot::ReadStreamTextures(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<StreamTextureHandle> handles;
+        Vector<StreamTexture> streamTextures;
+        if (!ReadPool(stream, handles, streamTextures))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            const StreamTexture& streamTexture = streamTextures[i];
+            scene.allocateStreamTexture(streamTexture.source, streamTexture.fallbackTexture, handles[i]);
+            scene.setForceFallbackImage(handles[i], streamTexture.forceFallbackTexture);
+        }
+        return true;
+    }
+
+    void SceneSnapshot::WriteDataSlots(IOutputStream& stream, const IScene& source)
+    {
+        WritePool<DataSlotHandle, DataSlot>(stream, source.getDataSlotCount(), source, &IScene::isDataSlotAllocated, [&source](DataSlotHandle s)
+        {
+            return source.getDataSlot(s);
+        });
+    }
+
+    Bool SceneSnapshot::ReadDataSlots(SnapshotInputStream& stream, IScene& scene)
+    {
+        Vector<DataSlotHandle> handles;
+        Vector<DataSlot> dataSlots;
+        if (!ReadPool(stream, handles, dataSlots))
+        {
+            return false;
+        }
+
+        for (UInt i = 0u; i < handles.size(); ++i)
+        {
+            scene.allocateDataSlot(dataSlots[i], handles[i]);
+        }
+        return true;
+    }
+
+    template void SceneSnapshot::WriteToStream<IScene>(IOutputStream& outStream, const IScene& source);
+    template void SceneSnapshot::WriteToStream<ClientScene>(IOutputStream& outStream, const ClientScene& source);
+}
@@ -1049,6 +1049,12 @@ namespace ramses_internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderPassInstanceBatching(RenderPassHandle pass, Bool enable)
+    {
+        m_actionCollector.setRenderPassInstanceBatching(pass, enable);
+        flushPendingSceneActions();
+    }
+
     void ActionTestScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         m_actionCollector.addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -9,20 +9,49 @@
 #include "framework_common_gmock_header.h"
 #include "gtest/gtest.h"
 #include "Scene/ScenePersistation.h"
+#include "Scene/SceneSnapshot.h"
 #include "Scene/ClientScene.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/File.h"
 #include "TestingScene.h"
 
 using namespace testing;
 
 namespace ramses_internal
 {
+    namespace
+    {
+        Vector<Char> WriteSnapshot(const ClientScene& scene)
+        {
+            BinaryOutputStream stream;
+            ScenePersistation::WriteSceneToStream(stream, scene, ESceneFileFormat_Snapshot);
+            Vector<Char> data(stream.getSize());
+            PlatformMemory::Copy(data.data(), stream.getData(), stream.getSize());
+            return data;
+        }
+
+        Bool ReadSceneFromData(const Vector<Char>& data, IScene& scene)
+        {
+            File file("testfile");
+            EXPECT_EQ(EStatus_RAMSES_OK, file.open(EFileMode_WriteNewBinary));
+            EXPECT_EQ(EStatus_RAMSES_OK, file.write(data.data(), data.size()));
+            file.close();
+            return ScenePersistation::ReadSceneFromFile("testfile", scene);
+        }
+
+        void SetUInt32At(Vector<Char>& data, UInt offset, UInt32 value)
+        {
+            PlatformMemory::Copy(data.data() + offset, &value, sizeof(value));
+        }
+    }
+
     TEST(AScenePersistation, canReadWrite)
     {
         ClientScene scene;
         NodeHandle parentNodeHandle = scene.allocateNode();
         NodeHandle childNodeHandle = scene.allocateNode();
         scene.addChildToNode(parentNodeHandle, childNodeHandle);
-        ScenePersistation::WriteSceneToFile("testfile", scene);
+        ScenePersistation::WriteSceneToFile("testfile", scene, ESceneFileFormat_ActionStream);
 
         Scene loadedScene;
         ScenePersistation::ReadSceneFromFile("testfile", loadedScene);
@@ -33,10 +62,118 @@ namespace ramses_internal
     TEST(AScenePersistation, canReadWriteMockScene)
     {
         TestingScene<ClientScene> scene;
-        ScenePersistation::WriteSceneToFile("testfile", scene.getScene());
+        ScenePersistation::WriteSceneToFile("testfile", scene.getScene(), ESceneFileFormat_ActionStream);
+
+        Scene loadedScene;
+        ScenePersistation::ReadSceneFromFile("testfile", loadedScene);
+        scene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST(AScenePersistation, canReadWriteMockSceneAsSnapshot)
+    {
+        TestingScene<ClientScene> scene;
+        ScenePersistation::WriteSceneToFile("testfile", scene.getScene(), ESceneFileFormat_Snapshot);
 
         Scene loadedScene;
         ScenePersistation::ReadSceneFromFile("testfile", loadedScene);
         scene.CheckEquivalentTo<IScene>(loadedScene);
     }
+
+    TEST(AScenePersistation, snapshotIsReadIntoClientSceneWithSameContent)
+    {
+        TestingScene<ClientScene> scene;
+        ScenePersistation::WriteSceneToFile("testfile", scene.getScene(), ESceneFileFormat_Snapshot);
+
+        ClientScene loadedScene;
+        ScenePersistation::ReadSceneFromFile("testfile", loadedScene);
+        scene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST(AScenePersistation, snapshotKeepsHandlesOfSparselyAllocatedPools)
+    {
+        ClientScene scene;
+        const NodeHandle node1 = scene.allocateNode(0u, NodeHandle(3u));
+        const NodeHandle node2 = scene.allocateNode(0u, NodeHandle(7u));
+        scene.addChildToNode(node2, node1);
+        const TransformHandle transform = scene.allocateTransform(node1, TransformHandle(5u));
+        scene.setTranslation(transform, Vector3(1.f, 2.f, 3.f));
+        ScenePersistation::WriteSceneToFile("testfile", scene, ESceneFileFormat_Snapshot);
+
+        Scene loadedScene;
+        ScenePersistation::ReadSceneFromFile("testfile", loadedScene);
+        EXPECT_TRUE(loadedScene.isNodeAllocated(node1));
+        EXPECT_TRUE(loadedScene.isNodeAllocated(node2));
+        EXPECT_FALSE(loadedScene.isNodeAllocated(NodeHandle(0u)));
+        EXPECT_EQ(node2, loadedScene.getParent(node1));
+        EXPECT_TRUE(loadedScene.isTransformAllocated(transform));
+        EXPECT_EQ(node1, loadedScene.getTransformNode(transform));
+        EXPECT_EQ(Vector3(1.f, 2.f, 3.f), loadedScene.getTranslation(transform));
+    }
+
+    TEST(AScenePersistation, snapshotPreallocatesLoadedSceneToSizeOfSavedScene)
+    {
+        ClientScene scene;
+        scene.preallocateSceneSize(SceneSizeInformation(10u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 16u, 17u));
+        scene.allocateNode();
+        ScenePersistation::WriteSceneToFile("testfile", scene, ESceneFileFormat_Snapshot);
+
+        Scene loadedScene;
+        ASSERT_TRUE(ScenePersistation::ReadSceneFromFile("testfile", loadedScene));
+        EXPECT_EQ(scene.getSceneSizeInformation(), loadedScene.getSceneSizeInformation());
+    }
+
+    TEST(AScenePersistation, writesSnapshotByDefault)
+    {
+        ClientScene scene;
+        scene.allocateNode();
+        BinaryOutputStream stream;
+        ScenePersistation::WriteSceneToStream(stream, scene);
+
+        UInt32 marker = 0u;
+        PlatformMemory::Copy(&marker, stream.getData(), sizeof(marker));
+        EXPECT_EQ(SceneSnapshot::Marker, marker);
+    }
+
+    TEST(AScenePersistation, failsToLoadTruncatedSnapshot)
+    {
+        TestingScene<ClientScene> scene;
+        Vector<Char> data = WriteSnapshot(scene.getScene());
+        data.resize(data.size() - 1u);
+
+        Scene loadedScene;
+        EXPECT_FALSE(ReadSceneFromData(data, loadedScene));
+    }
+
+    TEST(AScenePersistation, failsToLoadSnapshotWithPayloadSizeNotMatchingContent)
+    {
+        TestingScene<ClientScene> scene;
+        Vector<Char> data = WriteSnapshot(scene.getScene());
+        // payload size follows marker and version
+        SetUInt32At(data, 2u * sizeof(UInt32), static_cast<UInt32>(data.size()) - 4u * sizeof(UInt32));
+
+        Scene loadedScene;
+        EXPECT_FALSE(ReadSceneFromData(data, loadedScene));
+    }
+
+    TEST(AScenePersistation, failsToLoadSnapshotWithArrayCountExceedingPayload)
+    {
+        TestingScene<ClientScene> scene;
+        Vector<Char> data = WriteSnapshot(scene.getScene());
+        // node count follows the 18 values of the scene size information at start of payload
+        SetUInt32At(data, (3u + 18u) * sizeof(UInt32), 0x7fffffffu);
+
+        Scene loadedScene;
+        EXPECT_FALSE(ReadSceneFromData(data, loadedScene));
+        EXPECT_FALSE(loadedScene.isNodeAllocated(NodeHandle(0u)));
+    }
+
+    TEST(AScenePersistation, failsToLoadSnapshotOfOtherVersion)
+    {
+        TestingScene<ClientScene> scene;
+        Vector<Char> data = WriteSnapshot(scene.getScene());
+        SetUInt32At(data, sizeof(UInt32), SceneSnapshot::Version + 1u);
+
+        Scene loadedScene;
+        EXPECT_FALSE(ReadSceneFromData(data, loadedScene));
+    }
 }
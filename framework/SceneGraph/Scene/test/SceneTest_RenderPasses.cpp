@@ -38,6 +38,7 @@ namespace ramses_internal
         EXPECT_FALSE(rp.renderTarget.isValid());
         EXPECT_EQ(0, rp.renderOrder);
         EXPECT_FALSE(rp.isRenderOnce);
+        EXPECT_FALSE(rp.isInstanceBatchingEnabled);
     }
 
     TYPED_TEST(AScene, RenderPassReleased)
@@ -172,4 +173,13 @@ namespace ramses_internal
         this->m_scene.setRenderPassRenderOnce(pass, false);
         EXPECT_FALSE(this->m_scene.getRenderPass(pass).isRenderOnce);
     }
+
+    TYPED_TEST(AScene, canSetInstanceBatching)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass();
+        this->m_scene.setRenderPassInstanceBatching(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).isInstanceBatchingEnabled);
+        this->m_scene.setRenderPassInstanceBatching(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isInstanceBatchingEnabled);
+    }
 }
@@ -154,6 +154,7 @@ namespace ramses_internal
             scene.setRenderPassRenderOrder(renderPass, 1);
             scene.setRenderPassEnabled(renderPass, false);
             scene.setRenderPassRenderOnce(renderPass, true);
+            scene.setRenderPassInstanceBatching(renderPass, true);
 
             scene.addRenderGroupToRenderPass(renderPass, renderGroup, 15);
             scene.addRenderGroupToRenderPass(renderPass, renderGroup2, 5);
@@ -461,6 +462,7 @@ namespace ramses_internal
             EXPECT_EQ(static_cast<UInt32>(EClearFlags::EClearFlags_None), rp.clearFlags);
             EXPECT_FALSE(rp.isEnabled);
             EXPECT_TRUE(rp.isRenderOnce);
+            EXPECT_TRUE(rp.isInstanceBatchingEnabled);
 
             ASSERT_TRUE(RenderGroupUtils::ContainsRenderGroup(renderGroup, rp));
             EXPECT_FALSE(RenderGroupUtils::ContainsRenderGroup(renderGroup2, rp));
@@ -57,6 +57,9 @@ namespace ramses_internal
 
         EFixedSemantics_Invalid,
 
+        // Instancing, added after invalid to keep values of existing semantics stable
+        EFixedSemantics_InstanceModelMatrices,  // array of model matrices indexed with gl_InstanceID
+
         EFixedSemantics_Count // must be last, used for checking for dynamic semantics
     };
 
@@ -116,6 +119,8 @@ namespace ramses_internal
             return "EFixedSemantics_TextTextureCoordinatesAttribute";
         case EFixedSemantics_TextTextureUniform:
             return "EFixedSemantics_TextTextureUniform";
+        case EFixedSemantics_InstanceModelMatrices:
+            return "EFixedSemantics_InstanceModelMatrices";
         default:
             return "UNKNOWN_SEMANTICS";
         }
@@ -133,6 +138,7 @@ namespace ramses_internal
         case EFixedSemantics_ModelViewMatrix:
         case EFixedSemantics_ModelViewProjectionMatrix:
         case EFixedSemantics_NormalMatrix:
+        case EFixedSemantics_InstanceModelMatrices:
             return dataType == EDataType_Matrix44F;
         case EFixedSemantics_ModelViewMatrix33:
             return dataType == EDataType_Matrix33F;
@@ -10,6 +10,8 @@
 #define RAMSES_TEXTURESAMPLERSTATES_H
 
 #include "SceneAPI/TextureEnums.h"
+#include "ramses-capu/container/Hash.h"
+#include <functional>
 
 namespace ramses_internal
 {
@@ -29,6 +31,20 @@ namespace ramses_internal
         {
         }
 
+        Bool operator==(const TextureSamplerStates& other) const
+        {
+            return m_addressModeU == other.m_addressModeU
+                && m_addressModeV == other.m_addressModeV
+                && m_addressModeR == other.m_addressModeR
+                && m_samplingMode == other.m_samplingMode
+                && m_anisotropyLevel == other.m_anisotropyLevel;
+        }
+
+        Bool operator!=(const TextureSamplerStates& other) const
+        {
+            return !operator==(other);
+        }
+
         EWrapMethod     m_addressModeU;
         EWrapMethod     m_addressModeV;
         EWrapMethod     m_addressModeR;
@@ -37,4 +53,35 @@ namespace ramses_internal
     };
 }
 
+namespace ramses_capu
+{
+    template<>
+    struct Hash<ramses_internal::TextureSamplerStates>
+    {
+        uint_t operator()(const ramses_internal::TextureSamplerStates& v)
+        {
+            const uint64_t packedStates =
+                (static_cast<uint64_t>(v.m_addressModeU) << 56u) |
+                (static_cast<uint64_t>(v.m_addressModeV) << 48u) |
+                (static_cast<uint64_t>(v.m_addressModeR) << 40u) |
+                (static_cast<uint64_t>(v.m_samplingMode) << 32u) |
+                v.m_anisotropyLevel;
+            return static_cast<uint_t>(packedStates ^ (packedStates >> 32u));
+        }
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<ramses_internal::TextureSamplerStates>
+    {
+    public:
+        size_t operator()(const ramses_internal::TextureSamplerStates& v) const
+        {
+            return ramses_capu::Hash<ramses_internal::TextureSamplerStates>()(v);
+        }
+    };
+}
+
 #endif
@@ -118,6 +118,20 @@ namespace ramses
         */
         void setMaximumTotalBytesAllowedForAsyncResourceLoading(uint32_t maximumTotalBytesForAsynResourceLoading);
 
+        /**
+        * @brief Sets the number of worker threads used by ramses for asynchronous tasks like resource loading
+        *
+        * More workers help only if the application issues many asynchronous operations in parallel.
+        * The value can also be set with the command line argument --workerThreads.
+        *
+        * The default value is 3.
+        *
+        * @param[in] workerThreadCount Number of worker threads, must be between 1 and 256
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setWorkerThreadCount(uint32_t workerThreadCount);
+
         /**
         * @brief Enables or disables the periodic log messages provided by the Ramses framework
         *
@@ -19,6 +19,8 @@
 namespace ramses
 {
     const uint32_t MAXIMUM_BYTES_FOR_ASYNC_RESOURCE_LOADING = 20 * 1024 * 1024;
+    const uint32_t DEFAULT_WORKER_THREAD_COUNT = 3u;
+    const uint32_t MAXIMUM_WORKER_THREAD_COUNT = 256u;
 
     class RamsesFrameworkConfigImpl : public StatusObjectImpl
     {
@@ -43,6 +45,8 @@ namespace ramses
 
         void setMaximumTotalBytesAllowedForAsyncResourceLoading(uint32_t maximumTotalBytesForAsynResourceLoading);
         uint32_t getMaximumTotalBytesForAsyncResourceLoading() const;
+        status_t setWorkerThreadCount(uint32_t workerThreadCount);
+        uint32_t getWorkerThreadCount() const;
         ramses_internal::EConnectionProtocol getUsedProtocol() const;
         uint32_t getWatchdogNotificationInterval(ERamsesThreadIdentifier thread) const;
         IThreadWatchdogNotification* getWatchdogNotificationCallback() const;
@@ -64,6 +68,7 @@ namespace ramses
         ramses_internal::String m_dltAppID;
         ramses_internal::String m_dltAppDescription;
         uint32_t m_maximumTotalBytesForAsyncResourceLoading;
+        uint32_t m_workerThreadCount;
         bool m_enableProtocolVersionOffset;
         ramses_internal::Guid m_userProvidedGuid;
     };
@@ -68,6 +68,11 @@ namespace ramses
         impl.setMaximumTotalBytesAllowedForAsyncResourceLoading(maximumTotalBytesForAsynResourceLoading);
     }
 
+    status_t RamsesFrameworkConfig::setWorkerThreadCount(uint32_t workerThreadCount)
+    {
+        return impl.setWorkerThreadCount(workerThreadCount);
+    }
+
     void RamsesFrameworkConfig::setPeriodicLogsEnabled(bool enabled)
     {
         impl.setPeriodicLogsEnabled(enabled);
@@ -33,6 +33,7 @@ namespace ramses
         , m_dltAppID("RAMS")
         , m_dltAppDescription("RAMS-DESC")
         , m_maximumTotalBytesForAsyncResourceLoading(MAXIMUM_BYTES_FOR_ASYNC_RESOURCE_LOADING)
+        , m_workerThreadCount(DEFAULT_WORKER_THREAD_COUNT)
         , m_enableProtocolVersionOffset(false)
     {
         parseCommandLine();
@@ -116,6 +117,7 @@ namespace ramses
         const ArgumentBool enableOffsetPlatformProtocolVersion(m_parser, "pvo", "protocolVersionOffset", false);
         const ArgumentBool disablePeriodicLogs(m_parser, "disablePeriodicLogs", "disablePeriodicLogs", false);
         const ArgumentString userProvidedGuid(m_parser, "guid", "guid", "");
+        const ArgumentUInt32 workerThreadCount(m_parser, "wt", "workerThreads", DEFAULT_WORKER_THREAD_COUNT);
 
         if (enableOffsetPlatformProtocolVersion)
         {
@@ -149,6 +151,11 @@ namespace ramses
             m_tcpConfig.setDaemonPort(ArgumentUInt16(m_parser, "p", "daemon-port", m_tcpConfig.getDaemonPort()));
         }
 
+        if (workerThreadCount.wasDefined())
+        {
+            setWorkerThreadCount(workerThreadCount);
+        }
+
         if (userProvidedGuid.hasValue())
         {
             m_userProvidedGuid = Guid(userProvidedGuid);
@@ -186,6 +193,22 @@ namespace ramses
         m_maximumTotalBytesForAsyncResourceLoading = maximumTotalBytesForAsyncResourceLoading;
     }
 
+    status_t RamsesFrameworkConfigImpl::setWorkerThreadCount(uint32_t workerThreadCount)
+    {
+        if (0u == workerThreadCount || workerThreadCount > MAXIMUM_WORKER_THREAD_COUNT)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Could not set worker thread count, count must be between 1 and " << MAXIMUM_WORKER_THREAD_COUNT);
+            return addErrorEntry("Could not set worker thread count, count is not valid");
+        }
+        m_workerThreadCount = workerThreadCount;
+        return StatusOK;
+    }
+
+    uint32_t RamsesFrameworkConfigImpl::getWorkerThreadCount() const
+    {
+        return m_workerThreadCount;
+    }
+
     void RamsesFrameworkConfigImpl::setPeriodicLogsEnabled(bool enabled)
     {
         m_periodicLogsEnabled = enabled;
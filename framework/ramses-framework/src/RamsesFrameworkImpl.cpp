@@ -19,6 +19,7 @@
 #include "Common/Cpp11Macros.h"
 #include "Ramsh/RamshFactory.h"
 #include "PlatformAbstraction/synchronized_clock.h"
+#include "PlatformAbstraction/PlatformTime.h"
 
 namespace ramses
 {
@@ -35,7 +36,7 @@ namespace ramses
         , m_connected(false)
         , m_threadWatchdogConfig(config.m_watchdogConfig)
         // NOTE: ThreadingSystem must always be constructed after CommunicationSystem
-        , m_threadStrategy(3, config.m_watchdogConfig)
+        , m_threadStrategy(static_cast<ramses_internal::UInt16>(config.getWorkerThreadCount()), config.m_watchdogConfig)
         , resourceComponent(m_threadStrategy.e, m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getConnectionStatusUpdateNotifier(),
             m_statisticCollection, m_frameworkLock, config.getMaximumTotalBytesForAsyncResourceLoading())
         , scenegraphComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getConnectionStatusUpdateNotifier(), m_frameworkLock)
@@ -60,3 +60,24 @@ TEST_F(ARamsesFrameworkConfig, TestSetandGetApplicationInformation)
     EXPECT_STREQ(application_id, frameworkConfig.getDLTApplicationID());
     EXPECT_STREQ(application_description, frameworkConfig.getDLTApplicationDescription());
 }
+
+TEST_F(ARamsesFrameworkConfig, CanSetWorkerThreadCount)
+{
+    EXPECT_EQ(DEFAULT_WORKER_THREAD_COUNT, frameworkConfig.impl.getWorkerThreadCount());
+    EXPECT_EQ(StatusOK, frameworkConfig.setWorkerThreadCount(8u));
+    EXPECT_EQ(8u, frameworkConfig.impl.getWorkerThreadCount());
+}
+
+TEST_F(ARamsesFrameworkConfig, FailsToSetInvalidWorkerThreadCount)
+{
+    EXPECT_NE(StatusOK, frameworkConfig.setWorkerThreadCount(0u));
+    EXPECT_NE(StatusOK, frameworkConfig.setWorkerThreadCount(MAXIMUM_WORKER_THREAD_COUNT + 1u));
+    EXPECT_EQ(DEFAULT_WORKER_THREAD_COUNT, frameworkConfig.impl.getWorkerThreadCount());
+}
+
+TEST_F(ARamsesFrameworkConfig, CanSetWorkerThreadCountFromCommandLine)
+{
+    const char* args[] = { "framework", "--workerThreads", "5" };
+    RamsesFrameworkConfig config(3, args);
+    EXPECT_EQ(5u, config.impl.getWorkerThreadCount());
+}
@@ -0,0 +1,153 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "HashMapPerfTest.h"
+#include "PerformanceTestUtils.h"
+
+namespace
+{
+    // deterministic well distributed 64 bit values, like content hashes of real resources
+    uint64_t MixBits(uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30u)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27u)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31u);
+    }
+}
+
+HashMapPerfTest::HashMapPerfTest(ramses_internal::String testName, uint32_t testState)
+    : PerformanceTestBase(testName, testState)
+    , m_checksum(0u)
+{
+    m_resourceHashes.reserve(NumberOfElements);
+    m_handles.reserve(NumberOfElements);
+    for (uint32_t i = 0u; i < NumberOfElements; ++i)
+    {
+        m_resourceHashes.push_back(ramses_internal::ResourceContentHash(MixBits(i), MixBits(i + NumberOfElements)));
+        // handles are allocated sequentially by the scene
+        m_handles.push_back(ramses_internal::NodeHandle(i));
+    }
+
+    // access in an order unrelated to insertion
+    PerformanceTestUtils::ShuffleObjectList(m_resourceHashes);
+    PerformanceTestUtils::ShuffleObjectList(m_handles);
+}
+
+void HashMapPerfTest::initTest(ramses::RamsesClient& client, ramses::Scene& scene)
+{
+    UNUSED(client);
+    UNUSED(scene);
+}
+
+HashMapPerfTest::EOperation HashMapPerfTest::getOperation() const
+{
+    switch (m_testState / 4u)
+    {
+    case 0u:
+        return EOperation::Insert;
+    case 1u:
+        return EOperation::Lookup;
+    case 2u:
+        return EOperation::Erase;
+    default:
+        return EOperation::Iterate;
+    }
+}
+
+template <typename TableType, typename KeyType>
+void HashMapPerfTest::prepareTable(TableType& table, const ramses_internal::Vector<KeyType>& keys)
+{
+    // insertion always starts with a default constructed table to include the cost of growing
+    table = TableType();
+    if (getOperation() != EOperation::Insert)
+    {
+        for (uint32_t i = 0u; i < NumberOfElements; ++i)
+        {
+            table.put(keys[i], i);
+        }
+    }
+}
+
+template <typename TableType, typename KeyType>
+void HashMapPerfTest::runOperation(TableType& table, const ramses_internal::Vector<KeyType>& keys)
+{
+    switch (getOperation())
+    {
+    case EOperation::Insert:
+        for (uint32_t i = 0u; i < NumberOfElements; ++i)
+        {
+            table.put(keys[i], i);
+        }
+        break;
+    case EOperation::Lookup:
+        // lookups in reverse insertion order
+        for (uint32_t i = NumberOfElements; i > 0u; --i)
+        {
+            auto it = table.find(keys[i - 1u]);
+            if (it != table.end())
+            {
+                m_checksum += it->value;
+            }
+        }
+        break;
+    case EOperation::Erase:
+        for (uint32_t i = NumberOfElements; i > 0u; --i)
+        {
+            table.remove(keys[i - 1u]);
+        }
+        break;
+    case EOperation::Iterate:
+        for (uint32_t repeat = 0u; repeat < IterationRepeats; ++repeat)
+        {
+            for (auto it = table.begin(); it != table.end(); ++it)
+            {
+                m_checksum += it->value;
+            }
+        }
+        break;
+    }
+}
+
+void HashMapPerfTest::preUpdate()
+{
+    switch (m_testState % 4u)
+    {
+    case 0u:
+        prepareTable(m_chainedResourceHashMap, m_resourceHashes);
+        break;
+    case 1u:
+        prepareTable(m_flatResourceHashMap, m_resourceHashes);
+        break;
+    case 2u:
+        prepareTable(m_chainedHandleMap, m_handles);
+        break;
+    default:
+        prepareTable(m_flatHandleMap, m_handles);
+        break;
+    }
+}
+
+void HashMapPerfTest::update()
+{
+    switch (m_testState % 4u)
+    {
+    case 0u:
+        runOperation(m_chainedResourceHashMap, m_resourceHashes);
+        break;
+    case 1u:
+        runOperation(m_flatResourceHashMap, m_resourceHashes);
+        break;
+    case 2u:
+        runOperation(m_chainedHandleMap, m_handles);
+        break;
+    default:
+        runOperation(m_flatHandleMap, m_handles);
+        break;
+    }
+}
@@ -0,0 +1,79 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_HASHMAPPERFTEST_H
+#define RAMSES_HASHMAPPERFTEST_H
+
+#include "PerformanceTestBase.h"
+#include "Collections/HashMap.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "SceneAPI/Handles.h"
+#include <ramses-capu/container/HashTable.h>
+
+// compares the chained capu hash table with the open addressing table behind HashMap
+class HashMapPerfTest : public PerformanceTestBase
+{
+public:
+    // for every operation the order is: chained/resource hash key, flat/resource hash key, chained/handle key, flat/handle key
+    enum
+    {
+        HashMapPerfTest_Insert_Chained_ResourceHash = 0,
+        HashMapPerfTest_Insert_Flat_ResourceHash,
+        HashMapPerfTest_Insert_Chained_Handle,
+        HashMapPerfTest_Insert_Flat_Handle,
+        HashMapPerfTest_Lookup_Chained_ResourceHash,
+        HashMapPerfTest_Lookup_Flat_ResourceHash,
+        HashMapPerfTest_Lookup_Chained_Handle,
+        HashMapPerfTest_Lookup_Flat_Handle,
+        HashMapPerfTest_Erase_Chained_ResourceHash,
+        HashMapPerfTest_Erase_Flat_ResourceHash,
+        HashMapPerfTest_Erase_Chained_Handle,
+        HashMapPerfTest_Erase_Flat_Handle,
+        HashMapPerfTest_Iterate_Chained_ResourceHash,
+        HashMapPerfTest_Iterate_Flat_ResourceHash,
+        HashMapPerfTest_Iterate_Chained_Handle,
+        HashMapPerfTest_Iterate_Flat_Handle
+    };
+
+    HashMapPerfTest(ramses_internal::String testName, uint32_t testState);
+
+    virtual void initTest(ramses::RamsesClient& client, ramses::Scene& scene) override;
+    virtual void preUpdate() override;
+    virtual void update() override;
+
+private:
+    static const uint32_t NumberOfElements = 20000u;
+    static const uint32_t IterationRepeats = 10u;
+
+    enum class EOperation
+    {
+        Insert,
+        Lookup,
+        Erase,
+        Iterate
+    };
+
+    EOperation getOperation() const;
+
+    template <typename TableType, typename KeyType>
+    void prepareTable(TableType& table, const ramses_internal::Vector<KeyType>& keys);
+    template <typename TableType, typename KeyType>
+    void runOperation(TableType& table, const ramses_internal::Vector<KeyType>& keys);
+
+    ramses_internal::Vector<ramses_internal::ResourceContentHash> m_resourceHashes;
+    ramses_internal::Vector<ramses_internal::NodeHandle> m_handles;
+
+    ramses_capu::HashTable<ramses_internal::ResourceContentHash, uint32_t> m_chainedResourceHashMap;
+    ramses_internal::HashMap<ramses_internal::ResourceContentHash, uint32_t> m_flatResourceHashMap;
+    ramses_capu::HashTable<ramses_internal::NodeHandle, uint32_t> m_chainedHandleMap;
+    ramses_internal::HashMap<ramses_internal::NodeHandle, uint32_t> m_flatHandleMap;
+
+    uint64_t m_checksum;
+};
+
+#endif
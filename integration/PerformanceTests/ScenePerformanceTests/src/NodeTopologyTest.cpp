@@ -10,6 +10,8 @@
 #include "PerformanceTestUtils.h"
 #include "ramses-client-api/Node.h"
 #include "ramses-client-api/MeshNode.h"
+#include "ramses-client-api/TransformationNode.h"
+#include "ramses-client-api/Scene.h"
 
 NodeTopologyTest::NodeTopologyTest(ramses_internal::String testName, uint32_t testState) : PerformanceTestBase(testName, testState) {};
 
@@ -28,16 +30,41 @@ void NodeTopologyTest::initTest(ramses::RamsesClient& client, ramses::Scene& sce
     m_childrenShuffled = m_children;
 
     PerformanceTestUtils::ShuffleObjectList(m_childrenShuffled);
+
+    // binary tree, parent always precedes its children
+    m_createdNodes.resize(NodeCount);
+    m_createdNodeParentIndices.reserve(NodeCount);
+    m_createdNodeTranslations.reserve(3 * NodeCount);
+    for (uint32_t i = 0; i < NodeCount; i++)
+    {
+        m_createdNodeParentIndices.push_back(i == 0 ? -1 : static_cast<int32_t>((i - 1) / 2));
+        m_createdNodeTranslations.push_back(static_cast<float>(i));
+        m_createdNodeTranslations.push_back(0.f);
+        m_createdNodeTranslations.push_back(0.f);
+    }
 }
 
 void NodeTopologyTest::preUpdate()
 {
-    if (!m_parent)
+    switch (m_testState)
+    {
+    case NodeTopologyTest_CreateNodesIndividually:
+    case NodeTopologyTest_CreateNodesInBulk:
     {
-        m_parent = m_scene->createMeshNode();
+        destroyCreatedNodes();
+        break;
     }
+    default:
+    {
+        if (!m_parent)
+        {
+            m_parent = m_scene->createMeshNode();
+        }
 
-    addChildren();
+        addChildren();
+        break;
+    }
+    }
 }
 
 void NodeTopologyTest::update()
@@ -54,6 +81,25 @@ void NodeTopologyTest::update()
         m_parent = NULL;
         break;
     }
+    case NodeTopologyTest_CreateNodesIndividually:
+    {
+        for (uint32_t i = 0; i < NodeCount; i++)
+        {
+            ramses::TransformationNode* node = m_scene->createTransformationNode();
+            node->setTranslation(m_createdNodeTranslations[3 * i], m_createdNodeTranslations[3 * i + 1], m_createdNodeTranslations[3 * i + 2]);
+            if (m_createdNodeParentIndices[i] >= 0)
+            {
+                node->setParent(*m_createdNodes[m_createdNodeParentIndices[i]]);
+            }
+            m_createdNodes[i] = node;
+        }
+        break;
+    }
+    case NodeTopologyTest_CreateNodesInBulk:
+    {
+        m_scene->createTransformationNodes(NodeCount, m_createdNodes.data(), m_createdNodeParentIndices.data(), m_createdNodeTranslations.data());
+        break;
+    }
     default:
     {
         assert(false);
@@ -78,3 +124,15 @@ void NodeTopologyTest::removeChildren()
     }
 }
 
+void NodeTopologyTest::destroyCreatedNodes()
+{
+    // children first, so that no node is unlinked from a destroyed parent
+    for (uint32_t i = NodeCount; i > 0; i--)
+    {
+        if (m_createdNodes[i - 1])
+        {
+            m_scene->destroy(*m_createdNodes[i - 1]);
+            m_createdNodes[i - 1] = NULL;
+        }
+    }
+}
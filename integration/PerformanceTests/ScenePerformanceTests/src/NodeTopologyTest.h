@@ -15,6 +15,7 @@
 namespace ramses
 {
     class Node;
+    class TransformationNode;
     class Scene;
 }
 
@@ -25,7 +26,9 @@ public:
     enum
     {
         NodeTopologyTest_RemoveNodesIndividually = 0,
-        NodeTopologyTest_RemoveNodesbyDestroyingParent
+        NodeTopologyTest_RemoveNodesbyDestroyingParent,
+        NodeTopologyTest_CreateNodesIndividually,
+        NodeTopologyTest_CreateNodesInBulk
     };
 
     NodeTopologyTest(ramses_internal::String testName, uint32_t testState);
@@ -38,6 +41,7 @@ private:
 
     void addChildren();
     void removeChildren();
+    void destroyCreatedNodes();
 
     static const uint32_t NodeCount = 1000;
 
@@ -45,6 +49,11 @@ private:
     ramses::Node* m_parent;
     ramses_internal::Vector<ramses::Node*> m_children;
     ramses_internal::Vector<ramses::Node*> m_childrenShuffled;
+
+    // tree of transformation nodes created in every update by the create tests
+    ramses_internal::Vector<ramses::TransformationNode*> m_createdNodes;
+    ramses_internal::Vector<int32_t> m_createdNodeParentIndices;
+    ramses_internal::Vector<float> m_createdNodeTranslations;
 };
 #endif
 
@@ -30,6 +30,15 @@ void ObjectRegistryTest::initTest(ramses::RamsesClient& client, ramses::Scene& s
 
     PerformanceTestUtils::ShuffleObjectList(m_objectsShuffled);
 
+    for (auto& count : m_objectCountPerType)
+    {
+        count = 0u;
+    }
+    for (auto it : m_objects)
+    {
+        ++m_objectCountPerType[it->getType()];
+    }
+
     switch (m_testState)
     {
     case ObjectRegistryTest_Add:
@@ -50,6 +59,7 @@ void ObjectRegistryTest::preUpdate()
     switch (m_testState)
     {
     case ObjectRegistryTest_Add:
+    case ObjectRegistryTest_AddWithReservedCapacity:
     {
         removeObjects(); // Clear items, so (re)adding can be tested
         break;
@@ -81,6 +91,13 @@ void ObjectRegistryTest::update()
         addObjects();
         break;
     }
+    case ObjectRegistryTest_AddWithReservedCapacity:
+    {
+        // like bulk creation in scene does
+        reserveObjectCapacity();
+        addObjects();
+        break;
+    }
     case ObjectRegistryTest_Delete:
     {
         removeObjects();
@@ -126,3 +143,15 @@ void ObjectRegistryTest::removeObjects()
         m_registry.removeObject(*it);
     }
 }
+
+void ObjectRegistryTest::reserveObjectCapacity()
+{
+    for (uint32_t type = 0u; type < ramses::ERamsesObjectType_NUMBER_OF_TYPES; ++type)
+    {
+        if (m_objectCountPerType[type] > 0u)
+        {
+            m_registry.reserveAdditionalObjectCapacity(static_cast<ramses::ERamsesObjectType>(type), m_objectCountPerType[type]);
+        }
+    }
+    m_registry.reserveAdditionalGeneralCapacity(static_cast<uint32_t>(m_objects.size()));
+}
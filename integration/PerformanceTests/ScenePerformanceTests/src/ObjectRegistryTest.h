@@ -28,6 +28,7 @@ public:
         ObjectRegistryTest_Add = 0,
         ObjectRegistryTest_Delete,
         ObjectRegistryTest_FindByName,
+        ObjectRegistryTest_AddWithReservedCapacity,
     };
 
     ObjectRegistryTest(ramses_internal::String testName, uint32_t testState);
@@ -39,10 +40,12 @@ public:
 private:
     void addObjects();
     void removeObjects();
+    void reserveObjectCapacity();
 
     ramses_internal::Vector<ramses::SceneObject*> m_objects;
     ramses_internal::Vector<ramses::SceneObject*> m_objectsShuffled;
     ramses::RamsesObjectRegistry m_registry;
+    uint32_t m_objectCountPerType[ramses::ERamsesObjectType_NUMBER_OF_TYPES];
 };
 #endif
 
@@ -20,6 +20,8 @@
 #include "MemoryPoolTest.h"
 #include "NodeTopologyTest.h"
 #include "StringLayoutingPerformanceTest.h"
+#include "ScenePersistationPerfTest.h"
+#include "HashMapPerfTest.h"
 
 namespace ramses_internal {
 
@@ -104,6 +106,7 @@ void PerformanceTestData::init()
         PerformanceTestBase* addTest = createTest<ObjectRegistryTest>("ObjectRegistryTest_Add", ObjectRegistryTest::ObjectRegistryTest_Add);
         PerformanceTestBase* containsTest = createTest<ObjectRegistryTest>("ObjectRegistryTest_FindByName", ObjectRegistryTest::ObjectRegistryTest_FindByName);
         PerformanceTestBase* deleteTest = createTest<ObjectRegistryTest>("ObjectRegistryTest_Delete", ObjectRegistryTest::ObjectRegistryTest_Delete);
+        createTest<ObjectRegistryTest>("ObjectRegistryTest_AddWithReservedCapacity", ObjectRegistryTest::ObjectRegistryTest_AddWithReservedCapacity);
 
         createAssert(containsTest).isFasterThan(addTest);
         createAssert(containsTest).isFasterThan(deleteTest);
@@ -136,6 +139,40 @@ void PerformanceTestData::init()
         PerformanceTestBase* removebyDestroyTest = createTest<NodeTopologyTest>("NodeTopologyTest_RemoveNodesbyDestroyingParent", NodeTopologyTest::NodeTopologyTest_RemoveNodesbyDestroyingParent);
 
         createAssert(removebyDestroyTest).isFasterThan(removeIndividuallyTest);
+
+        // bulk creation still produces one set of scene actions per node, so no speedup is asserted
+        createTest<NodeTopologyTest>("NodeTopologyTest_CreateNodesIndividually", NodeTopologyTest::NodeTopologyTest_CreateNodesIndividually);
+        createTest<NodeTopologyTest>("NodeTopologyTest_CreateNodesInBulk", NodeTopologyTest::NodeTopologyTest_CreateNodesInBulk);
+    }
+
+    {
+        PerformanceTestBase* saveActionStream = createTest<ScenePersistationPerfTest>("ScenePersistationPerfTest_Save_ActionStream", ScenePersistationPerfTest::ScenePersistationPerfTest_Save_ActionStream);
+        PerformanceTestBase* saveSnapshot = createTest<ScenePersistationPerfTest>("ScenePersistationPerfTest_Save_Snapshot", ScenePersistationPerfTest::ScenePersistationPerfTest_Save_Snapshot);
+        PerformanceTestBase* loadActionStream = createTest<ScenePersistationPerfTest>("ScenePersistationPerfTest_Load_ActionStream", ScenePersistationPerfTest::ScenePersistationPerfTest_Load_ActionStream);
+        PerformanceTestBase* loadSnapshot = createTest<ScenePersistationPerfTest>("ScenePersistationPerfTest_Load_Snapshot", ScenePersistationPerfTest::ScenePersistationPerfTest_Load_Snapshot);
+
+        createAssert(saveSnapshot).isFasterThan(saveActionStream);
+        createAssert(loadSnapshot).isFasterThan(loadActionStream);
+    }
+
+    {
+        // chained capu hash table compared with the open addressing table behind HashMap
+        createTest<HashMapPerfTest>("HashMapPerfTest_Insert_Chained_ResourceHash", HashMapPerfTest::HashMapPerfTest_Insert_Chained_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Insert_Flat_ResourceHash", HashMapPerfTest::HashMapPerfTest_Insert_Flat_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Insert_Chained_Handle", HashMapPerfTest::HashMapPerfTest_Insert_Chained_Handle);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Insert_Flat_Handle", HashMapPerfTest::HashMapPerfTest_Insert_Flat_Handle);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Lookup_Chained_ResourceHash", HashMapPerfTest::HashMapPerfTest_Lookup_Chained_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Lookup_Flat_ResourceHash", HashMapPerfTest::HashMapPerfTest_Lookup_Flat_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Lookup_Chained_Handle", HashMapPerfTest::HashMapPerfTest_Lookup_Chained_Handle);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Lookup_Flat_Handle", HashMapPerfTest::HashMapPerfTest_Lookup_Flat_Handle);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Erase_Chained_ResourceHash", HashMapPerfTest::HashMapPerfTest_Erase_Chained_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Erase_Flat_ResourceHash", HashMapPerfTest::HashMapPerfTest_Erase_Flat_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Erase_Chained_Handle", HashMapPerfTest::HashMapPerfTest_Erase_Chained_Handle);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Erase_Flat_Handle", HashMapPerfTest::HashMapPerfTest_Erase_Flat_Handle);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Iterate_Chained_ResourceHash", HashMapPerfTest::HashMapPerfTest_Iterate_Chained_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Iterate_Flat_ResourceHash", HashMapPerfTest::HashMapPerfTest_Iterate_Flat_ResourceHash);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Iterate_Chained_Handle", HashMapPerfTest::HashMapPerfTest_Iterate_Chained_Handle);
+        createTest<HashMapPerfTest>("HashMapPerfTest_Iterate_Flat_Handle", HashMapPerfTest::HashMapPerfTest_Iterate_Flat_Handle);
     }
 
     {
@@ -0,0 +1,81 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ScenePersistationPerfTest.h"
+#include "PerformanceTestUtils.h"
+#include "ramses-client-api/Scene.h"
+#include "SceneImpl.h"
+#include "Scene/ClientScene.h"
+#include "Scene/ScenePersistation.h"
+#include "Animation/AnimationSystemFactory.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include "TestScenes/MultipleTrianglesScene.h"
+#include "TestScenes/AnimatedTrianglesScene.h"
+#include "TestScenes/TextureBufferScene.h"
+#include "TestScenes/DataBufferScene.h"
+#include "TestScenes/RenderTargetScene.h"
+
+ScenePersistationPerfTest::ScenePersistationPerfTest(ramses_internal::String testName, uint32_t testState) : PerformanceTestBase(testName, testState) {};
+
+void ScenePersistationPerfTest::initTest(ramses::RamsesClient& client, ramses::Scene& scene)
+{
+    using namespace ramses_internal;
+    m_scene = &scene;
+
+    const Vector3 cameraPosition(0.f, 0.f, 5.f);
+    for (uint32_t i = 0; i < ContentCopies; i++)
+    {
+        MultipleTrianglesScene triangles(client, scene, MultipleTrianglesScene::THREE_TRIANGLES, cameraPosition);
+        AnimatedTrianglesScene animatedTriangles(client, scene, AnimatedTrianglesScene::ANIMATION_POINT0, cameraPosition);
+        TextureBufferScene textureBuffers(client, scene, TextureBufferScene::EState_RGBA8_OneMip, cameraPosition);
+        DataBufferScene dataBuffers(client, scene, DataBufferScene::INDEX_DATA_BUFFER_UINT16, cameraPosition);
+        RenderTargetScene renderTargets(client, scene, RenderTargetScene::PERSPECTIVE_PROJECTION, cameraPosition);
+    }
+
+    ramses_internal::Vector<ramses::SceneObject*> nodes;
+    PerformanceTestUtils::BuildNodesOfVariousTypes(nodes, scene, 10 * 1000);
+
+    const bool useSnapshot = (m_testState == ScenePersistationPerfTest_Save_Snapshot || m_testState == ScenePersistationPerfTest_Load_Snapshot);
+    BinaryOutputStream stream;
+    ScenePersistation::WriteSceneToStream(stream, scene.impl.getIScene(), useSnapshot ? ESceneFileFormat_Snapshot : ESceneFileFormat_ActionStream);
+    m_serializedScene.resize(stream.getSize());
+    PlatformMemory::Copy(m_serializedScene.data(), stream.getData(), stream.getSize());
+}
+
+void ScenePersistationPerfTest::update()
+{
+    using namespace ramses_internal;
+
+    switch (m_testState)
+    {
+    case ScenePersistationPerfTest_Save_ActionStream:
+    case ScenePersistationPerfTest_Save_Snapshot:
+    {
+        BinaryOutputStream stream(static_cast<UInt32>(m_serializedScene.size()));
+        const ESceneFileFormat format = (m_testState == ScenePersistationPerfTest_Save_Snapshot) ? ESceneFileFormat_Snapshot : ESceneFileFormat_ActionStream;
+        ScenePersistation::WriteSceneToStream(stream, m_scene->impl.getIScene(), format);
+        break;
+    }
+    case ScenePersistationPerfTest_Load_ActionStream:
+    case ScenePersistationPerfTest_Load_Snapshot:
+    {
+        // both formats store the scene size and preallocate the loaded scene while reading
+        ClientScene loadedScene(SceneInfo(SceneId(1u)));
+        AnimationSystemFactory animSystemFactory(EAnimationSystemOwner_Client, &loadedScene.getSceneActionCollection());
+        BinaryInputStream stream(m_serializedScene.data());
+        ScenePersistation::ReadSceneFromStream(stream, loadedScene, &animSystemFactory);
+        break;
+    }
+    default:
+    {
+        assert(false);
+        break;
+    }
+    }
+}
@@ -0,0 +1,39 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEPERSISTATIONPERFTEST_H
+#define RAMSES_SCENEPERSISTATIONPERFTEST_H
+
+#include "PerformanceTestBase.h"
+#include "Collections/Vector.h"
+
+class ScenePersistationPerfTest : public PerformanceTestBase
+{
+public:
+
+    enum
+    {
+        ScenePersistationPerfTest_Save_ActionStream = 0,
+        ScenePersistationPerfTest_Save_Snapshot,
+        ScenePersistationPerfTest_Load_ActionStream,
+        ScenePersistationPerfTest_Load_Snapshot
+    };
+
+    ScenePersistationPerfTest(ramses_internal::String testName, uint32_t testState);
+
+    virtual void initTest(ramses::RamsesClient& client, ramses::Scene& scene) override;
+    virtual void update() override;
+
+private:
+    // number of copies of the integration test content put into the scene to get a reasonably large scene
+    static const uint32_t ContentCopies = 20u;
+
+    ramses::Scene* m_scene;
+    ramses_internal::Vector<char> m_serializedScene;
+};
+#endif
@@ -0,0 +1,125 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "FlushStressTests.h"
+
+#include "ramses-client-api/RamsesClient.h"
+#include "ramses-client-api/Scene.h"
+#include "ramses-client-api/TranslateNode.h"
+#include "ramses-renderer-api/RamsesRenderer.h"
+#include "RamsesRendererUtils.h"
+#include "RamsesRendererImpl.h"
+#include "Utils/Argument.h"
+#include "Utils/LogMacros.h"
+#include <atomic>
+#include <thread>
+
+using namespace ramses_internal;
+
+MultiThreadedFlush::MultiThreadedFlush(int32_t argc, const char* argv[])
+    : StressTest(argc, argv, "ETest_multiThreadedFlush")
+    , m_numberOfThreads(ArgumentUInt32(CommandLineParser(argc, argv), "ft", "flush-threads", 4))
+    , m_numberOfFlushesPerLoop(ArgumentUInt32(CommandLineParser(argc, argv), "fl", "flushes-per-loop", 20))
+{
+}
+
+MultiThreadedFlush::~MultiThreadedFlush()
+{
+    if (runningTimeMs() > 0u)
+    {
+        LOG_INFO(CONTEXT_TEST, "MultiThreadedFlush: " << m_flushCount << " flushes of " << m_numberOfThreads << " scenes on " << m_numberOfThreads
+            << " threads in " << runningTimeMs() << " ms (" << m_flushCount * 1000u / runningTimeMs() << " flushes/s)");
+    }
+    destroyScene();
+}
+
+int32_t MultiThreadedFlush::run_pre()
+{
+    for (UInt32 i = 0u; i < m_numberOfThreads; ++i)
+    {
+        // scene id 1 is used by base test scene
+        const ramses::sceneId_t sceneId = 2u + i;
+
+        FlushedScene flushedScene;
+        flushedScene.scene = m_client->createScene(sceneId);
+        for (UInt32 node = 0u; node < m_numberOfNodesPerScene; ++node)
+        {
+            flushedScene.nodes.push_back(flushedScene.scene->createTranslateNode());
+        }
+        flushedScene.scene->flush();
+        flushedScene.scene->publish(ramses::EScenePublicationMode_LocalOnly);
+        showScene(sceneId);
+
+        m_flushedScenes.push_back(flushedScene);
+    }
+
+    return 0;
+}
+
+int32_t MultiThreadedFlush::run_loop()
+{
+    std::atomic<bool> success(true);
+    Vector<std::thread> threads;
+    for (auto& flushedScene : m_flushedScenes)
+    {
+        const UInt32 loop = runningLoops();
+        threads.push_back(std::thread([this, &flushedScene, &success, loop]()
+        {
+            if (!modifyAndFlushScene(flushedScene, loop))
+            {
+                success = false;
+            }
+        }));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    m_flushCount += m_flushedScenes.size() * m_numberOfFlushesPerLoop;
+
+    // let renderer consume the flushes so that its queues do not grow with test duration
+    ramses::RamsesRendererUtils::DoOneLoop(m_renderer->impl.getRenderer(), ramses_internal::ELoopMode_UpdateOnly, std::chrono::microseconds{ 0u });
+
+    if (!success)
+    {
+        LOG_ERROR(CONTEXT_TEST, "Test multiThreadedFlush: flush failed");
+        return -1;
+    }
+    return 0;
+}
+
+Bool MultiThreadedFlush::modifyAndFlushScene(FlushedScene& flushedScene, UInt32 loop)
+{
+    for (UInt32 flush = 0u; flush < m_numberOfFlushesPerLoop; ++flush)
+    {
+        const Float translation = static_cast<Float>(loop * m_numberOfFlushesPerLoop + flush);
+        for (auto node : flushedScene.nodes)
+        {
+            node->setTranslation(translation, 0.f, 0.f);
+        }
+        if (flushedScene.scene->flush() != ramses::StatusOK)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void MultiThreadedFlush::destroyScene()
+{
+    if (m_client)
+    {
+        for (auto& flushedScene : m_flushedScenes)
+        {
+            m_client->destroy(*flushedScene.scene);
+        }
+    }
+    m_flushedScenes.clear();
+
+    StressTest::destroyScene();
+}
@@ -0,0 +1,53 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_CLIENTSTRESSTESTS_FLUSHSTRESSTESTS_H
+#define RAMSES_CLIENTSTRESSTESTS_FLUSHSTRESSTESTS_H
+
+#include "StressTest.h"
+#include "Collections/Vector.h"
+
+namespace ramses
+{
+    class Scene;
+    class TranslateNode;
+}
+
+namespace ramses_internal
+{
+    // every thread modifies and flushes its own scene, all scenes are shown on renderer
+    class MultiThreadedFlush : public StressTest
+    {
+    public:
+        MultiThreadedFlush(int32_t argc, const char* argv[]);
+        virtual ~MultiThreadedFlush() override;
+
+        int32_t run_pre() override;
+        int32_t run_loop() override;
+
+    protected:
+        virtual void destroyScene() override;
+
+    private:
+        struct FlushedScene
+        {
+            ramses::Scene*                 scene = nullptr;
+            Vector<ramses::TranslateNode*> nodes;
+        };
+
+        Bool modifyAndFlushScene(FlushedScene& flushedScene, UInt32 loop);
+
+        const UInt32         m_numberOfThreads;
+        const UInt32         m_numberOfFlushesPerLoop;
+        const UInt32         m_numberOfNodesPerScene = 100u;
+        Vector<FlushedScene> m_flushedScenes;
+        UInt64               m_flushCount = 0u;
+    };
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include "StressTestFactory.h"
 #include "TextStressTests.h"
 #include "ResourceStressTests.h"
+#include "FlushStressTests.h"
 #include "Utils/LoggingUtils.h"
 
 using namespace ramses_internal;
@@ -78,6 +79,7 @@ enum ETest
     ETest_loadEffectAsync,
     ETest_saveLoadEffect,
     ETest_saveLoadEffectAsync,
+    ETest_multiThreadedFlush,
 
     //keep this at the end
     ETest_NUMBER_OF_TESTS
@@ -147,6 +149,7 @@ const char* StressTestNames[] =
     "ETest_loadEffectAsync",
     "ETest_saveLoadEffect",
     "ETest_saveLoadEffectAsync",
+    "ETest_multiThreadedFlush",
 };
 
 ENUM_TO_STRING(ETest, StressTestNames, ETest_NUMBER_OF_TESTS);
@@ -282,6 +285,8 @@ StressTestPtr StressTestFactory::CreateTest(uint32_t testIndex, int32_t argc, co
         return StressTestPtr(new SaveLoadEffect(argc, argv));
     case ETest_saveLoadEffectAsync:
         return StressTestPtr(new SaveLoadEffectAsync(argc, argv));
+    case ETest_multiThreadedFlush:
+        return StressTestPtr(new MultiThreadedFlush(argc, argv));
     default:
         assert(false);
         return nullptr;
@@ -88,6 +88,25 @@ namespace ramses_internal
     }
 
     void DynamicQuad_SceneResources::recreate()
+    {
+        updateDataBuffers();
+
+        std::unique_ptr<uint8_t[]> rawData(new uint8_t[DynamicTextureWidth * DynamicTextureHeight * 3]);
+
+        for (uint32_t x = 0; x < DynamicTextureWidth; ++x)
+        {
+            for (uint32_t y = 0; y < DynamicTextureHeight; ++y)
+            {
+                rawData[3 * (y * DynamicTextureWidth + x) + 0] = static_cast<uint8_t>(TestRandom::Get(128, 255));
+                rawData[3 * (y * DynamicTextureWidth + x) + 1] = 0u;
+                rawData[3 * (y * DynamicTextureWidth + x) + 2] = static_cast<uint8_t>(TestRandom::Get(0, 128));
+            }
+        }
+
+        m_textureBuffer->setData(reinterpret_cast<const char*>(rawData.get()), 0, 0, 0, DynamicTextureWidth, DynamicTextureHeight);
+    }
+
+    void DynamicQuad_SceneResources::updateDataBuffers()
     {
         static const uint16_t indicesData[] = { 0, 1, 3, 2 };
 
@@ -115,19 +134,5 @@ namespace ramses_internal
         m_indices->setData(reinterpret_cast<const char*>(indicesData), sizeof(indicesData), 0);
         m_vertexPos->setData(reinterpret_cast<const char*>(&vertexPositionsData[0].x), sizeof(vertexPositionsData), 0);
         m_texCoords->setData(reinterpret_cast<const char*>(vertexTexcoordsData), sizeof(vertexTexcoordsData), 0);
-
-        std::unique_ptr<uint8_t[]> rawData(new uint8_t[DynamicTextureWidth * DynamicTextureHeight * 3]);
-
-        for (uint32_t x = 0; x < DynamicTextureWidth; ++x)
-        {
-            for (uint32_t y = 0; y < DynamicTextureHeight; ++y)
-            {
-                rawData[3 * (y * DynamicTextureWidth + x) + 0] = static_cast<uint8_t>(TestRandom::Get(128, 255));
-                rawData[3 * (y * DynamicTextureWidth + x) + 1] = 0u;
-                rawData[3 * (y * DynamicTextureWidth + x) + 2] = static_cast<uint8_t>(TestRandom::Get(0, 128));
-            }
-        }
-
-        m_textureBuffer->setData(reinterpret_cast<const char*>(rawData.get()), 0, 0, 0, DynamicTextureWidth, DynamicTextureHeight);
     }
 }
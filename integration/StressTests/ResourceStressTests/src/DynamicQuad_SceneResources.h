@@ -28,6 +28,7 @@ namespace ramses_internal
         ~DynamicQuad_SceneResources();
 
         virtual void recreate() override final;
+        void updateDataBuffers();
 
         // Needed for proper clean-up upon destruction (destroy scene -> mark objects destroyed -> destroy client resources)
         void markSceneObjectsDestroyed();
@@ -46,6 +46,7 @@ namespace ramses_internal
         , m_quadWithSceneResources               (m_client, m_scene                       , screenspaceQuad.createSubQuad({0.1f, 0.5f, 0.4f, 0.8f}))
         , m_quadWithRenderTarget                 (m_client, m_scene, m_offscreenRenderPass, screenspaceQuad.createSubQuad({0.6f, 0.1f, 0.9f, 0.4f}))
         , m_quadsWithTextureConsumerLinks(texConsumerDataIds.size())
+        , m_quadsWithDynamicDataBuffers(DynamicDataBufferQuadCount)
     {
         const ScreenspaceQuad quadForAllTextureConsumers = screenspaceQuad.createSubQuad({ 0.6f, 0.5f, 0.9f, 0.8f });
         const ScreenspaceQuad subQuadsForTextureConsumers[4] =
@@ -62,6 +63,15 @@ namespace ramses_internal
             m_quadsWithTextureConsumerLinks[i]->createTextureDataConsumer(texConsumerDataIds[i]);
         }
 
+        // Row of small quads with scene resources, their data buffers are updated in every frame by some tests
+        const ScreenspaceQuad quadForAllDynamicDataBuffers = screenspaceQuad.createSubQuad({ 0.1f, 0.85f, 0.9f, 0.95f });
+        for (uint32_t i = 0; i < DynamicDataBufferQuadCount; ++i)
+        {
+            const float quadStart = static_cast<float>(i) / DynamicDataBufferQuadCount;
+            const float quadEnd = quadStart + 1.0f / DynamicDataBufferQuadCount;
+            m_quadsWithDynamicDataBuffers[i].reset(new DynamicQuad_SceneResources(m_client, m_scene, quadForAllDynamicDataBuffers.createSubQuad({ quadStart, 0.0f, quadEnd, 1.0f })));
+        }
+
         m_offscreenRenderPass.setRenderOrder(0);
         m_offscreenRenderPass.setClearFlags(ramses::EClearFlags_All);
         m_offscreenRenderPass.setClearColor(0.4f, 0.1f, 0.0f, 1.0f);
@@ -77,6 +87,8 @@ namespace ramses_internal
         m_finalRenderPass.addRenderGroup(m_quadWithRenderTarget.getRenderGroup());
         for(auto& linkedQuad : m_quadsWithTextureConsumerLinks)
             m_finalRenderPass.addRenderGroup(linkedQuad->getRenderGroup());
+        for(auto& dynamicQuad : m_quadsWithDynamicDataBuffers)
+            m_finalRenderPass.addRenderGroup(dynamicQuad->getRenderGroup());
 
         m_scene.flush();
         m_scene.publish(ramses::EScenePublicationMode_LocalOnly);
@@ -90,6 +102,8 @@ namespace ramses_internal
         for(auto& linkedQuad : m_quadsWithTextureConsumerLinks)
             linkedQuad->markSceneObjectsDestroyed();
         m_quadWithSceneResources.markSceneObjectsDestroyed();
+        for(auto& dynamicQuad : m_quadsWithDynamicDataBuffers)
+            dynamicQuad->markSceneObjectsDestroyed();
         m_quadWithRenderTarget.markSceneObjectsDestroyed();
     }
 
@@ -106,6 +120,12 @@ namespace ramses_internal
             m_quadWithRenderTarget.recreate();
     }
 
+    void ResourceStressTestScene::updateDataBuffers()
+    {
+        for(auto& dynamicQuad : m_quadsWithDynamicDataBuffers)
+            dynamicQuad->updateDataBuffers();
+    }
+
     void ResourceStressTestScene::flush(ramses::ESceneFlushMode flushMode, ramses::sceneVersionTag_t flushName)
     {
         m_scene.flush(flushMode, flushName);
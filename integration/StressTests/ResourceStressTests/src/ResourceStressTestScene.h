@@ -46,8 +46,11 @@ namespace ramses_internal
         ~ResourceStressTestScene();
 
         void recreateResources(bool recreateClientResources = true, bool recreateSceneResources = true, bool recreateSceneRenderTargets = true);
+        void updateDataBuffers();
         void flush(ramses::ESceneFlushMode flushMode, ramses::sceneVersionTag_t flushName);
 
+        static const uint32_t DynamicDataBufferQuadCount = 16u;
+
     private:
         static ramses::RenderPass& CreateRenderPass(ramses::Scene& scene, ramses::OrthographicCamera& camera);
 
@@ -63,6 +66,7 @@ namespace ramses_internal
         DynamicQuad_SceneResources                  m_quadWithSceneResources;
         DynamicQuad_OffscreenRenderTarget           m_quadWithRenderTarget;
         Vector<std::unique_ptr<DynamicQuad_ClientResources>>  m_quadsWithTextureConsumerLinks;
+        Vector<std::unique_ptr<DynamicQuad_SceneResources>>   m_quadsWithDynamicDataBuffers;
     };
 }
 
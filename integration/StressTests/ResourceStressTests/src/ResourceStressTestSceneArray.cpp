@@ -75,6 +75,15 @@ namespace ramses_internal
         }
     }
 
+    void ResourceStressTestSceneArray::updateDataBuffersAndFlushOnAll(ramses::sceneVersionTag_t flushName)
+    {
+        for (const auto& scene : m_scenes)
+        {
+            scene->updateDataBuffers();
+            scene->flush(ramses::ESceneFlushMode_SynchronizedWithResources, flushName);
+        }
+    }
+
     void ResourceStressTestSceneArray::waitForFlushOnAll(ramses::sceneVersionTag_t flushName)
     {
         for (const auto& sceneConfig : m_sceneConfigs)
@@ -40,6 +40,7 @@ namespace ramses_internal
         void hideAndUnmapAll();
 
         void doExpensiveFlushOnAll(ramses::sceneVersionTag_t flushName);
+        void updateDataBuffersAndFlushOnAll(ramses::sceneVersionTag_t flushName);
         void waitForFlushOnAll(ramses::sceneVersionTag_t flushName);
     private:
 
@@ -14,6 +14,10 @@
 #include "Utils/Argument.h"
 #include "ResourceStressTestSceneArray.h"
 #include "RenderExecutor.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include <limits>
+#include <algorithm>
+#include <cmath>
 
 namespace ramses_internal
 {
@@ -25,6 +29,7 @@ namespace ramses_internal
         "EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_MapSceneAfterAWhile_LowRendererFPS",
         "EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_MapSceneAfterAWhile_ExtremelyLowRendererFPS",
         "EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_RemapSceneAllTheTime",
+        "EStressTestCaseId_updateDataBuffersEveryFrame",
     };
     ENUM_TO_STRING(EStressTestCaseId, StressTestCaseNames, EStressTestCaseId_NUMBER_OF_ELEMENTS);
 
@@ -81,6 +86,7 @@ namespace ramses_internal
             3, //"EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_MapSceneAfterAWhile_LowRendererFPS",
             5, //"EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_MapSceneAfterAWhile_ExtremelyLowRendererFPS",
             15,//"EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_RemapSceneAllTheTime",
+            1, //"EStressTestCaseId_updateDataBuffersEveryFrame",
         };
         static_assert(static_cast<std::size_t>(EStressTestCaseId_NUMBER_OF_ELEMENTS) == sizeof(MinDurationPerTestSeconds)/sizeof(MinDurationPerTestSeconds[0]), "Size mismatch");
 
@@ -122,6 +128,9 @@ namespace ramses_internal
         case EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_RemapSceneAllTheTime:
             returnValue = recreateResourcesEveryFrame_RemapSceneAllTheTime(2000);
             break;
+        case EStressTestCaseId_updateDataBuffersEveryFrame:
+            returnValue = updateDataBuffersEveryFrame();
+            break;
         default:
             assert(false);
             break;
@@ -296,6 +305,56 @@ namespace ramses_internal
         return 0;
     }
 
+    Int32 ResourceStressTests::updateDataBuffersEveryFrame()
+    {
+        ResourceStressTestSceneArray scenes(m_client, m_testRenderer, generateStressSceneConfig());
+        scenes.subscribeAll();
+        scenes.mapAndShowAll();
+
+        const UInt64 startTimeMs = PlatformTime::GetMillisecondsMonotonic();
+        ramses::sceneVersionTag_t flushName = 0;
+
+        // Every update is waited for, so that the time until it is applied reflects the renderer frame time
+        // while it is busy updating data buffers still in use by previous frames
+        UInt64 numFrames = 0u;
+        UInt64 minFrameTimeUs = std::numeric_limits<UInt64>::max();
+        UInt64 maxFrameTimeUs = 0u;
+        double sumFrameTimeUs = 0.0;
+        double sumSquaredFrameTimeUs = 0.0;
+
+        while ((PlatformTime::GetMillisecondsMonotonic() - startTimeMs) / 1000 < m_testConfig.durationEachTestSeconds)
+        {
+            const UInt64 frameStartUs = PlatformTime::GetMicrosecondsMonotonic();
+            scenes.updateDataBuffersAndFlushOnAll(flushName);
+            scenes.waitForFlushOnAll(flushName);
+            ++flushName;
+            const UInt64 frameTimeUs = PlatformTime::GetMicrosecondsMonotonic() - frameStartUs;
+
+            ++numFrames;
+            minFrameTimeUs = std::min(minFrameTimeUs, frameTimeUs);
+            maxFrameTimeUs = std::max(maxFrameTimeUs, frameTimeUs);
+            sumFrameTimeUs += static_cast<double>(frameTimeUs);
+            sumSquaredFrameTimeUs += static_cast<double>(frameTimeUs) * static_cast<double>(frameTimeUs);
+
+            throttleSceneUpdatesAndConsumeRendererEvents(0u);
+        }
+
+        if (numFrames == 0u)
+        {
+            LOG_ERROR(CONTEXT_SMOKETEST, "Test " << EnumToString(EStressTestCaseId_updateDataBuffersEveryFrame) << " did not update any frame!");
+            return -1;
+        }
+
+        const double avgFrameTimeUs = sumFrameTimeUs / static_cast<double>(numFrames);
+        const double frameTimeVariance = std::max(0.0, sumSquaredFrameTimeUs / static_cast<double>(numFrames) - avgFrameTimeUs * avgFrameTimeUs);
+        LOG_INFO(CONTEXT_SMOKETEST, "Data buffer updates of " << numFrames << " frames, "
+            << ResourceStressTestScene::DynamicDataBufferQuadCount * 3u << " data buffers per scene, frame time [us]: min " << minFrameTimeUs
+            << ", max " << maxFrameTimeUs << ", avg " << static_cast<UInt64>(avgFrameTimeUs)
+            << ", stddev " << static_cast<UInt64>(std::sqrt(frameTimeVariance)));
+
+        return 0;
+    }
+
     void ResourceStressTests::throttleSceneUpdatesAndConsumeRendererEvents(uint32_t sceneFpsLimit)
     {
         if (0 != sceneFpsLimit)
@@ -43,6 +43,7 @@ namespace ramses_internal
         EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_MapSceneAfterAWhile_LowRendererFPS,
         EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_MapSceneAfterAWhile_ExtremelyLowRendererFPS,
         EStressTestCaseId_recreateResourcesEveryFrameWithSyncFlush_RemapSceneAllTheTime,
+        EStressTestCaseId_updateDataBuffersEveryFrame,
         /*
         TODO Violin Add these tests too
         EStressTestCaseId_createDestroySameClientTexture,
@@ -78,6 +79,7 @@ namespace ramses_internal
         Int32 recreateResourcesEveryFrame(uint32_t sceneFpsLimit);
         Int32 recreateResourcesEveryFrame_MapSceneAfterAWhile(uint32_t sceneFpsLimit, uint32_t mapSceneDelayMSec);
         Int32 recreateResourcesEveryFrame_RemapSceneAllTheTime(uint32_t remapCycleDurationMSec);
+        Int32 updateDataBuffersEveryFrame();
 
         SceneArrayConfig generateStressSceneConfig() const;
 
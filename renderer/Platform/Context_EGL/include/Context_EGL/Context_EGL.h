@@ -10,6 +10,7 @@
 #define RAMSES_CONTEXT_EGL_H
 
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
 #undef Bool // Xlib.h (included from EGL/egl.h) defines Bool as int - this collides with ramses_internal::Bool
 #undef Status
@@ -19,6 +20,8 @@
 
 namespace ramses_internal
 {
+    struct Viewport;
+
     struct EglSurfaceData
     {
         EglSurfaceData()
@@ -46,12 +49,16 @@ namespace ramses_internal
         Bool init();
 
         Bool swapBuffers();
+        Bool swapBuffersWithDamage(const Viewport& damagedRegion);
+        UInt32 getBufferAge() const;
         Bool enable();
         Bool disable();
 
         void* getProcAddress(const char* name) const override;
 
     private:
+        void loadPartialUpdateExtensions();
+
         EglSurfaceData m_eglSurfaceData;
         EGLNativeDisplayType m_nativeDisplay;
         EGLNativeWindowType m_nativeWindow;
@@ -59,6 +66,8 @@ namespace ramses_internal
         const EGLint* m_surfaceAttributes;
         const EGLint* m_windowSurfaceAttributes;
         const EGLint m_swapInterval;
+        Bool m_bufferAgeSupported = false;
+        PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC m_eglSwapBuffersWithDamage = nullptr;
     };
 
 }
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Context_EGL/Context_EGL.h"
+#include "SceneAPI/Viewport.h"
 #include "Utils/LogMacros.h"
 
 namespace ramses_internal
@@ -51,6 +52,7 @@ namespace ramses_internal
         {
             LOG_INFO(CONTEXT_RENDERER, "Context_EGL::init(): EGL extensions: " << contextExtensionsNativeString);
             parseContextExtensions(contextExtensionsNativeString);
+            loadPartialUpdateExtensions();
         }
         else
         {
@@ -159,6 +161,45 @@ namespace ramses_internal
         return true;
     }
 
+    Bool Context_EGL::swapBuffersWithDamage(const Viewport& damagedRegion)
+    {
+        if (m_eglSwapBuffersWithDamage == nullptr)
+            return swapBuffers();
+
+        LOG_TRACE(CONTEXT_RENDERER, "Context_EGL swapping buffers with damage");
+        EGLint damageRect[4] = {
+            static_cast<EGLint>(damagedRegion.posX),
+            static_cast<EGLint>(damagedRegion.posY),
+            static_cast<EGLint>(damagedRegion.width),
+            static_cast<EGLint>(damagedRegion.height) };
+        m_eglSwapBuffersWithDamage(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, damageRect, 1);
+        return true;
+    }
+
+    UInt32 Context_EGL::getBufferAge() const
+    {
+        if (!m_bufferAgeSupported)
+            return 0u;
+
+        EGLint bufferAge = 0;
+        if (!eglQuerySurface(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, EGL_BUFFER_AGE_EXT, &bufferAge))
+            return 0u;
+        return static_cast<UInt32>(bufferAge);
+    }
+
+    void Context_EGL::loadPartialUpdateExtensions()
+    {
+        m_bufferAgeSupported = isContextExtensionAvailable("buffer_age");
+
+        if (m_contextExtensions.hasElement("EGL_KHR_swap_buffers_with_damage"))
+            m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+        else if (isContextExtensionAvailable("swap_buffers_with_damage"))
+            m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+
+        LOG_INFO(CONTEXT_RENDERER, "Context_EGL::init(): buffer age " << (m_bufferAgeSupported ? "supported" : "not supported")
+            << ", swap buffers with damage " << (m_eglSwapBuffersWithDamage != nullptr ? "supported" : "not supported"));
+    }
+
     Bool Context_EGL::enable()
     {
         assert (m_eglSurfaceData.eglDisplay);
@@ -13,6 +13,7 @@
 #include "Platform_Base/DeviceResourceMapper.h"
 #include "Types_GL.h"
 #include "DebugOutput.h"
+#include "Collections/HashMap.h"
 
 namespace ramses_internal
 {
@@ -32,6 +33,7 @@ namespace ramses_internal
         Bool init();
 
         virtual EDeviceTypeId getDeviceTypeId() const override;
+        virtual String getDriverIdentification() const override;
 
         virtual void drawIndexedTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
         virtual void drawTriangles         (Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
@@ -67,14 +69,23 @@ namespace ramses_internal
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix44f*  value) override;
 
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual DeviceResourceHandle startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual Bool isReadPixelsFinished(DeviceResourceHandle handle) override;
+        virtual Bool finishReadPixels(DeviceResourceHandle handle, UInt8* buffer) override;
+        virtual DeviceResourceHandle writeGpuTimestamp() override;
+        virtual Bool isGpuTimestampAvailable(DeviceResourceHandle handle) override;
+        virtual UInt64 finishGpuTimestamp(DeviceResourceHandle handle) override;
+        virtual Bool isGpuTimerDisjoint() override;
 
         virtual DeviceResourceHandle    allocateVertexBuffer  (EDataType dataType, UInt32 sizeInBytes) override;
         virtual void                    uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void                    streamVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
         virtual void                    deleteVertexBuffer    (DeviceResourceHandle handle) override;
         virtual void                    activateVertexBuffer  (DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor) override;
 
         virtual DeviceResourceHandle    allocateIndexBuffer   (EDataType dataType, UInt32 sizeInBytes) override;
         virtual void                    uploadIndexBufferData (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void                    streamIndexBufferData (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
         virtual void                    deleteIndexBuffer     (DeviceResourceHandle handle) override;
         virtual void                    activateIndexBuffer   (DeviceResourceHandle handle) override;
 
@@ -89,8 +100,10 @@ namespace ramses_internal
         virtual DeviceResourceHandle    allocateTextureCube (UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
         virtual void                    bindTexture         (DeviceResourceHandle handle) override;
         virtual void                    generateMipmaps     (DeviceResourceHandle handle) override;
+        virtual void                    setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel) override;
         virtual void                    uploadTextureData   (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
         virtual DeviceResourceHandle    uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) override;
+        virtual UInt32                  updateStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion) override;
         virtual void                    deleteTexture       (DeviceResourceHandle handle) override;
         virtual void                    activateTexture     (DeviceResourceHandle handle, DataFieldHandle field) override;
         virtual int                     getTextureAddress   (DeviceResourceHandle handle) const override;
@@ -134,6 +147,33 @@ namespace ramses_internal
 
         Vector<RenderTargetPair> m_pairedRenderTargets;
 
+        // size and format of stream texture storage, it is only respecified when content size or format changes
+        struct StreamTextureStorage
+        {
+            UInt32 width;
+            UInt32 height;
+            ETextureFormat format;
+        };
+        HashMap<DeviceResourceHandle, StreamTextureStorage> m_streamTextureStorages;
+
+        // fences signaling that copy of asynchronous pixel read back is done, per read back buffer
+        HashMap<DeviceResourceHandle, GLsync> m_readPixelsFences;
+        // pixel pack buffers of finished read backs, oldest first, reused by read backs of same size (e.g. periodic ones)
+        Vector<DeviceResourceHandle> m_freeReadPixelsBuffers;
+        static const UInt32 MaxFreeReadPixelsBuffers = 3u;
+
+        // timer query procs are core in desktop GL, in GL ES they come with GL_EXT_disjoint_timer_query,
+        // they stay null if timer queries are not supported
+#if defined(__linux__) || defined(__ghs__)
+        PFNGLQUERYCOUNTEREXTPROC        m_glQueryCounter = nullptr;
+        PFNGLGETQUERYOBJECTUI64VEXTPROC m_glGetQueryObjectui64v = nullptr;
+#else
+        PFNGLQUERYCOUNTERPROC           m_glQueryCounter = nullptr;
+        PFNGLGETQUERYOBJECTUI64VPROC    m_glGetQueryObjectui64v = nullptr;
+#endif
+        // finished timestamp queries, reused for new timestamps instead of generating and deleting a query for each
+        Vector<DeviceResourceHandle> m_freeGpuTimestampQueries;
+
         // Active states for upcoming draw call(s)
         const ShaderGPUResource_GL* m_activeShader;
         EDrawMode                   m_activePrimitiveDrawMode;
@@ -142,6 +182,7 @@ namespace ramses_internal
         const UInt8                 m_majorApiVersion;
         const UInt8                 m_minorApiVersion;
         const bool                  m_isEmbedded;
+        String                      m_driverIdentification;
         DebugOutput                 m_debugOutput;
         StringSet                   m_apiExtensions;
 
@@ -155,6 +196,7 @@ namespace ramses_internal
         GLHandle createTexture(UInt32 width, UInt32 height, ETextureFormat storageFormat) const;
         GLHandle createRenderBuffer(UInt32 width, UInt32 height, ETextureFormat format, UInt32 sampleCount);
         void setDrawBuffers(const RenderTarget& renderTarget);
+        void deleteReadPixelsBuffer(DeviceResourceHandle handle);
 
         GLHandle generateAndBindTexture(GLenum target) const;
         void setTextureFiltering(GLenum target, EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod sampling, UInt32 anisotropyLevel);
@@ -167,6 +209,7 @@ namespace ramses_internal
         Bool isApiExtensionAvailable(const String& extensionName) const;
         void loadExtensionDependentFeatures();
         void loadOpenGLExtensions();
+        void loadTimerQueryProcs();
     };
 }
 
@@ -74,6 +74,7 @@
 #define glGenBuffers(...)               glGenBuffersNative(__VA_ARGS__)
 #define glBindBuffer(...)               glBindBufferNative(__VA_ARGS__)
 #define glBufferData(...)               glBufferDataNative(__VA_ARGS__)
+#define glBufferSubData(...)            glBufferSubDataNative(__VA_ARGS__)
 #define glVertexAttribPointer(...)      glVertexAttribPointerNative(__VA_ARGS__)
 #define glGenFramebuffers(...)          glGenFramebuffersNative(__VA_ARGS__)
 #define glBindFramebuffer(...)          glBindFramebufferNative(__VA_ARGS__)
@@ -109,6 +110,14 @@
 #define glTexSubImage3D(...)            glTexSubImage3DNative(__VA_ARGS__)
 #define glCompressedTexSubImage2D(...)  glCompressedTexSubImage2DNative(__VA_ARGS__)
 #define glCompressedTexSubImage3D(...)  glCompressedTexSubImage3DNative(__VA_ARGS__)
+#define glFenceSync(...)                glFenceSyncNative(__VA_ARGS__)
+#define glClientWaitSync(...)           glClientWaitSyncNative(__VA_ARGS__)
+#define glDeleteSync(...)               glDeleteSyncNative(__VA_ARGS__)
+#define glMapBufferRange(...)           glMapBufferRangeNative(__VA_ARGS__)
+#define glUnmapBuffer(...)              glUnmapBufferNative(__VA_ARGS__)
+#define glGenQueries(...)               glGenQueriesNative(__VA_ARGS__)
+#define glDeleteQueries(...)            glDeleteQueriesNative(__VA_ARGS__)
+#define glGetQueryObjectuiv(...)        glGetQueryObjectuivNative(__VA_ARGS__)
 
 #define DECLARE_ALL_API_PROCS                                                                   \
 DECLARE_API_PROC(PFNGLGETSTRINGIPROC, glGetStringi);                                            \
@@ -157,6 +166,7 @@ DECLARE_API_PROC(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);
 DECLARE_API_PROC(PFNGLGENBUFFERSPROC, glGenBuffers);                                            \
 DECLARE_API_PROC(PFNGLBINDBUFFERPROC, glBindBuffer);                                            \
 DECLARE_API_PROC(PFNGLBUFFERDATAPROC, glBufferData);                                            \
+DECLARE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
 DECLARE_API_PROC(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer);                          \
 DECLARE_API_PROC(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers);                                  \
 DECLARE_API_PROC(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer);                                  \
@@ -192,6 +202,14 @@ DECLARE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DECLARE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DECLARE_API_PROC(PFNGLFENCESYNCPROC, glFenceSync);                                              \
+DECLARE_API_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                    \
+DECLARE_API_PROC(PFNGLDELETESYNCPROC, glDeleteSync);                                            \
+DECLARE_API_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                    \
+DECLARE_API_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                          \
+DECLARE_API_PROC(PFNGLGENQUERIESPROC, glGenQueries);                                            \
+DECLARE_API_PROC(PFNGLDELETEQUERIESPROC, glDeleteQueries);                                      \
+DECLARE_API_PROC(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv);                              \
 
 #define LOAD_ALL_API_PROCS                                                                          \
 LOAD_API_PROC(m_context, PFNGLGETSTRINGIPROC, glGetStringi);                                        \
@@ -240,6 +258,7 @@ LOAD_API_PROC(m_context, PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);
 LOAD_API_PROC(m_context, PFNGLGENBUFFERSPROC, glGenBuffers);                                        \
 LOAD_API_PROC(m_context, PFNGLBINDBUFFERPROC, glBindBuffer);                                        \
 LOAD_API_PROC(m_context, PFNGLBUFFERDATAPROC, glBufferData);                                        \
+LOAD_API_PROC(m_context, PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                  \
 LOAD_API_PROC(m_context, PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer);                      \
 LOAD_API_PROC(m_context, PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers);                              \
 LOAD_API_PROC(m_context, PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer);                              \
@@ -276,6 +295,14 @@ LOAD_API_PROC(m_context, PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 LOAD_API_PROC(m_context, PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                  \
 LOAD_API_PROC(m_context, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);              \
 LOAD_API_PROC(m_context, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);              \
+LOAD_API_PROC(m_context, PFNGLFENCESYNCPROC, glFenceSync);                                          \
+LOAD_API_PROC(m_context, PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                \
+LOAD_API_PROC(m_context, PFNGLDELETESYNCPROC, glDeleteSync);                                        \
+LOAD_API_PROC(m_context, PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                \
+LOAD_API_PROC(m_context, PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                      \
+LOAD_API_PROC(m_context, PFNGLGENQUERIESPROC, glGenQueries);                                        \
+LOAD_API_PROC(m_context, PFNGLDELETEQUERIESPROC, glDeleteQueries);                                  \
+LOAD_API_PROC(m_context, PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv);                          \
 
 //In WGL (Windows), all api procs are static and need explicit definition in a source file
 #define DEFINE_ALL_API_PROCS                                                                   \
@@ -325,6 +352,7 @@ DEFINE_API_PROC(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);
 DEFINE_API_PROC(PFNGLGENBUFFERSPROC, glGenBuffers);                                            \
 DEFINE_API_PROC(PFNGLBINDBUFFERPROC, glBindBuffer);                                            \
 DEFINE_API_PROC(PFNGLBUFFERDATAPROC, glBufferData);                                            \
+DEFINE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
 DEFINE_API_PROC(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer);                          \
 DEFINE_API_PROC(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers);                                  \
 DEFINE_API_PROC(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer);                                  \
@@ -360,5 +388,13 @@ DEFINE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DEFINE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DEFINE_API_PROC(PFNGLFENCESYNCPROC, glFenceSync);                                              \
+DEFINE_API_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                    \
+DEFINE_API_PROC(PFNGLDELETESYNCPROC, glDeleteSync);                                            \
+DEFINE_API_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                    \
+DEFINE_API_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                          \
+DEFINE_API_PROC(PFNGLGENQUERIESPROC, glGenQueries);                                            \
+DEFINE_API_PROC(PFNGLDELETEQUERIESPROC, glDeleteQueries);                                      \
+DEFINE_API_PROC(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv);                              \
 
 #endif
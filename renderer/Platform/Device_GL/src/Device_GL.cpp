@@ -38,9 +38,11 @@
 #include "Utils/LogMacros.h"
 #include "Utils/TextureMathUtils.h"
 #include "PlatformAbstraction/PlatformStringUtils.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 #include "Platform_Base/GpuResource.h"
 #include "SceneAPI/TextureEnums.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -118,6 +120,16 @@ namespace ramses_internal
 
     Device_GL::~Device_GL()
     {
+        for (const auto handle : m_freeReadPixelsBuffers)
+            deleteReadPixelsBuffer(handle);
+
+        for (const auto handle : m_freeGpuTimestampQueries)
+        {
+            const GLHandle query = m_resourceMapper.getResource(handle).getGPUAddress();
+            glDeleteQueries(1, &query);
+            m_resourceMapper.deleteResource(handle);
+        }
+
         m_resourceMapper.deleteResource(m_framebufferRenderTarget);
     }
 
@@ -131,12 +143,15 @@ namespace ramses_internal
 
         tmp = reinterpret_cast<const Char*>(glGetString(GL_VENDOR));
         LOG_INFO(CONTEXT_RENDERER, "Device_GL::init:  OpenGL vendor is " << tmp);
+        m_driverIdentification = tmp;
 
         tmp = reinterpret_cast<const Char*>(glGetString(GL_RENDERER));
         LOG_INFO(CONTEXT_RENDERER, "    OpenGL renderer is " << tmp);
+        m_driverIdentification += String(" ") + tmp;
 
         tmp = reinterpret_cast<const Char*>(glGetString(GL_VERSION));
         LOG_INFO(CONTEXT_RENDERER, "     OpenGL version is " << tmp);
+        m_driverIdentification += String(" ") + tmp;
 
         tmp = reinterpret_cast<const Char*>(glGetString(GL_SHADING_LANGUAGE_VERSION));
         LOG_INFO(CONTEXT_RENDERER, "     GLSL version " << tmp);
@@ -173,6 +188,11 @@ namespace ramses_internal
             return EDeviceTypeId_INVALID;
     }
 
+    String Device_GL::getDriverIdentification() const
+    {
+        return m_driverIdentification;
+    }
+
     void Device_GL::drawIndexedTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
     {
         const UInt startOffsetAddressAsUInt = startOffset * m_activeIndexArrayElementSizeBytes;
@@ -567,6 +587,13 @@ namespace ramses_internal
         glGenerateMipmap(gpuResource.m_textureInfo.target);
     }
 
+    void Device_GL::setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel)
+    {
+        const TextureGPUResource_GL& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
+        glBindTexture(gpuResource.m_textureInfo.target, gpuResource.getGPUAddress());
+        glTexParameteri(gpuResource.m_textureInfo.target, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(baseMipLevel));
+    }
+
     void Device_GL::uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize)
     {
         const TextureGPUResource_GL& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
@@ -595,22 +622,55 @@ namespace ramses_internal
         }
         else
         {
-            // upload data to registered texture resource
-            const GLHandle texID = getTextureAddress(handle);
-            assert(texID != InvalidGLHandle);
-            assert(data != nullptr);
-            LOG_DEBUG(CONTEXT_RENDERER, "Device_GL::uploadStreamTexture2D:  texid: " << texID << " width: " << width << " height: " << height << " format: " << EnumToString(format));
+            // upload whole content to registered texture resource
+            const PixelRectangle fullRegion = { 0u, 0u, static_cast<Int32>(width), static_cast<Int32>(height) };
+            updateStreamTexture2D(handle, width, height, format, data, fullRegion);
+
+            return handle;
+        }
+    }
+
+    UInt32 Device_GL::updateStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion)
+    {
+        const GLHandle texID = getTextureAddress(handle);
+        assert(texID != InvalidGLHandle);
+        assert(data != nullptr);
 
-            glBindTexture(GL_TEXTURE_2D, texID);
+        glBindTexture(GL_TEXTURE_2D, texID);
+
+        GLTextureInfo texInfo;
+        fillGLInternalTextureInfo(GL_TEXTURE_2D, width, height, 1u, format, texInfo);
+        assert(!texInfo.uploadParams.compressed);
+        const UInt32 texelSize = GetTexelSizeFromFormat(format);
+
+        const StreamTextureStorage* storage = m_streamTextureStorages.get(handle);
+        if (storage == nullptr || storage->width != width || storage->height != height || storage->format != format)
+        {
+            LOG_DEBUG(CONTEXT_RENDERER, "Device_GL::updateStreamTexture2D: (re)specifying storage for texid: " << texID << " width: " << width << " height: " << height << " format: " << EnumToString(format));
 
-            GLTextureInfo texInfo;
-            fillGLInternalTextureInfo(GL_TEXTURE_2D, width, height, 1u, format, texInfo);
-            assert(!texInfo.uploadParams.compressed);
-            // For now stream texture upload is using glTexImage2D instead of glStore/glSubimage because its size/format cannot be immutable
+            // Stream texture storage cannot be immutable (glTexStorage) because size/format of content can change,
+            // it is respecified using glTexImage2D only when that happens, all other updates go to existing storage
             glTexImage2D(texInfo.target, 0, texInfo.uploadParams.sizedInternalFormat, texInfo.width, texInfo.height, 0, texInfo.uploadParams.baseInternalFormat, texInfo.uploadParams.type, data);
+            m_streamTextureStorages.put(handle, { width, height, format });
 
-            return handle;
+            return width * height * texelSize;
+        }
+
+        if (updatedRegion.width <= 0 || updatedRegion.height <= 0 || updatedRegion.x >= width || updatedRegion.y >= height)
+        {
+            return 0u;
         }
+
+        const UInt32 regionWidth = std::min(static_cast<UInt32>(updatedRegion.width), width - updatedRegion.x);
+        const UInt32 regionHeight = std::min(static_cast<UInt32>(updatedRegion.height), height - updatedRegion.y);
+        const UInt8* regionData = data + (updatedRegion.y * width + updatedRegion.x) * texelSize;
+
+        // region rows are read with stride of whole content
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(width));
+        glTexSubImage2D(texInfo.target, 0, updatedRegion.x, updatedRegion.y, regionWidth, regionHeight, texInfo.uploadParams.baseInternalFormat, texInfo.uploadParams.type, regionData);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+        return regionWidth * regionHeight * texelSize;
     }
 
     void Device_GL::fillGLInternalTextureInfo(GLenum target, UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, GLTextureInfo& glTexInfoOut) const
@@ -1030,6 +1090,17 @@ namespace ramses_internal
         glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
     }
 
+    void Device_GL::streamVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize)
+    {
+        const auto& vertexBuffer = m_resourceMapper.getResource(handle);
+        assert(dataSize <= vertexBuffer.getTotalSizeInBytes());
+
+        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.getGPUAddress());
+        // orphan the old storage, driver can hand out new memory while GPU still reads from the old one
+        glBufferData(GL_ARRAY_BUFFER, dataSize, nullptr, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+    }
+
     void Device_GL::deleteVertexBuffer(DeviceResourceHandle handle)
     {
         const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
@@ -1073,6 +1144,17 @@ namespace ramses_internal
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
     }
 
+    void Device_GL::streamIndexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize)
+    {
+        const auto& indexBuffer = m_resourceMapper.getResource(handle);
+        assert(dataSize <= indexBuffer.getTotalSizeInBytes());
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.getGPUAddress());
+        // orphan the old storage, driver can hand out new memory while GPU still reads from the old one
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, nullptr, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, dataSize, data);
+    }
+
     void Device_GL::deleteIndexBuffer(DeviceResourceHandle handle)
     {
         const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
@@ -1160,6 +1242,7 @@ namespace ramses_internal
         const GLHandle glAddress = resource.getGPUAddress();
         glDeleteTextures(1, &glAddress);
         m_resourceMapper.deleteResource(handle);
+        m_streamTextureStorages.remove(handle);
     }
 
     void Device_GL::activateTexture(DeviceResourceHandle textureResource, DataFieldHandle field)
@@ -1292,6 +1375,26 @@ namespace ramses_internal
         {
             LOG_WARN(CONTEXT_RENDERER, "Device_GL::loadExtensionDependentFeatures:  anisotropic filtering not available on this device");
         }
+
+        loadTimerQueryProcs();
+    }
+
+    void Device_GL::loadTimerQueryProcs()
+    {
+        if (m_isEmbedded && !isApiExtensionAvailable("GL_EXT_disjoint_timer_query"))
+        {
+            LOG_INFO(CONTEXT_RENDERER, "Device_GL::loadTimerQueryProcs:  GPU timer queries not available on this device");
+            return;
+        }
+
+        m_glQueryCounter = reinterpret_cast<decltype(m_glQueryCounter)>(m_context.getProcAddress(m_isEmbedded ? "glQueryCounterEXT" : "glQueryCounter"));
+        m_glGetQueryObjectui64v = reinterpret_cast<decltype(m_glGetQueryObjectui64v)>(m_context.getProcAddress(m_isEmbedded ? "glGetQueryObjectui64vEXT" : "glGetQueryObjectui64v"));
+        if (m_glQueryCounter == nullptr || m_glGetQueryObjectui64v == nullptr)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "Device_GL::loadTimerQueryProcs:  failed to load GPU timer query procs");
+            m_glQueryCounter = nullptr;
+            m_glGetQueryObjectui64v = nullptr;
+        }
     }
 
     void Device_GL::readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height)
@@ -1299,6 +1402,155 @@ namespace ramses_internal
         glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<void*>(buffer));
     }
 
+    DeviceResourceHandle Device_GL::startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        const UInt32 dataSize = width * height * 4u;
+
+        const auto freeBufferIt = std::find_if(m_freeReadPixelsBuffers.begin(), m_freeReadPixelsBuffers.end(),
+            [&](DeviceResourceHandle freeBuffer) { return m_resourceMapper.getResource(freeBuffer).getTotalSizeInBytes() == dataSize; });
+
+        DeviceResourceHandle handle;
+        if (freeBufferIt != m_freeReadPixelsBuffers.end())
+        {
+            handle = *freeBufferIt;
+            m_freeReadPixelsBuffers.erase(freeBufferIt);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, m_resourceMapper.getResource(handle).getGPUAddress());
+        }
+        else
+        {
+            GLHandle glAddress = InvalidGLHandle;
+            glGenBuffers(1, &glAddress);
+            assert(glAddress != InvalidGLHandle);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, glAddress);
+            glBufferData(GL_PIXEL_PACK_BUFFER, dataSize, nullptr, GL_STREAM_READ);
+            handle = m_resourceMapper.registerResource(*new GPUResource(glAddress, dataSize));
+        }
+
+        // reading into pixel pack buffer only queues the copy, it does not wait for rendering to finish
+        glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        m_readPixelsFences.put(handle, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+        return handle;
+    }
+
+    Bool Device_GL::isReadPixelsFinished(DeviceResourceHandle handle)
+    {
+        GLsync* fence = m_readPixelsFences.get(handle);
+        assert(fence != nullptr);
+
+        // zero timeout only polls the fence, flush makes sure it is submitted and will get signaled eventually
+        const GLenum waitStatus = glClientWaitSync(*fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0u);
+        return GL_ALREADY_SIGNALED == waitStatus || GL_CONDITION_SATISFIED == waitStatus;
+    }
+
+    Bool Device_GL::finishReadPixels(DeviceResourceHandle handle, UInt8* buffer)
+    {
+        GLsync fence = nullptr;
+        m_readPixelsFences.remove(handle, &fence);
+        glDeleteSync(fence);
+
+        const GPUResource& resource = m_resourceMapper.getResource(handle);
+        const GLHandle glAddress = resource.getGPUAddress();
+        const UInt32 dataSize = resource.getTotalSizeInBytes();
+
+        // mapping blocks only if the copy is not finished yet
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, glAddress);
+        const void* mappedData = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, dataSize, GL_MAP_READ_BIT);
+        const Bool mapped = (mappedData != nullptr);
+        if (mapped)
+        {
+            PlatformMemory::Copy(buffer, mappedData, dataSize);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::finishReadPixels: failed to map read back buffer of size " << dataSize);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        m_freeReadPixelsBuffers.push_back(handle);
+        if (m_freeReadPixelsBuffers.size() > MaxFreeReadPixelsBuffers)
+        {
+            deleteReadPixelsBuffer(m_freeReadPixelsBuffers.front());
+            m_freeReadPixelsBuffers.erase(m_freeReadPixelsBuffers.begin());
+        }
+
+        return mapped;
+    }
+
+    void Device_GL::deleteReadPixelsBuffer(DeviceResourceHandle handle)
+    {
+        const GLHandle glAddress = m_resourceMapper.getResource(handle).getGPUAddress();
+        glDeleteBuffers(1, &glAddress);
+        m_resourceMapper.deleteResource(handle);
+    }
+
+    DeviceResourceHandle Device_GL::writeGpuTimestamp()
+    {
+        if (m_glQueryCounter == nullptr)
+            return DeviceResourceHandle::Invalid();
+
+        DeviceResourceHandle handle;
+        if (m_freeGpuTimestampQueries.empty())
+        {
+            GLHandle newQuery = InvalidGLHandle;
+            glGenQueries(1, &newQuery);
+            assert(newQuery != InvalidGLHandle);
+            handle = m_resourceMapper.registerResource(*new GPUResource(newQuery, 0u));
+        }
+        else
+        {
+            handle = m_freeGpuTimestampQueries.back();
+            m_freeGpuTimestampQueries.pop_back();
+        }
+
+        const GLHandle query = m_resourceMapper.getResource(handle).getGPUAddress();
+#if defined(__linux__) || defined(__ghs__)
+        m_glQueryCounter(query, GL_TIMESTAMP_EXT);
+#else
+        m_glQueryCounter(query, GL_TIMESTAMP);
+#endif
+
+        return handle;
+    }
+
+    Bool Device_GL::isGpuTimestampAvailable(DeviceResourceHandle handle)
+    {
+        const GLHandle query = m_resourceMapper.getResource(handle).getGPUAddress();
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        return available != GL_FALSE;
+    }
+
+    UInt64 Device_GL::finishGpuTimestamp(DeviceResourceHandle handle)
+    {
+        const GLHandle query = m_resourceMapper.getResource(handle).getGPUAddress();
+
+        // blocks only if the timestamp is not available yet
+        GLuint64 timestamp = 0u;
+        m_glGetQueryObjectui64v(query, GL_QUERY_RESULT, &timestamp);
+
+        m_freeGpuTimestampQueries.push_back(handle);
+
+        return timestamp;
+    }
+
+    Bool Device_GL::isGpuTimerDisjoint()
+    {
+        // only GL_EXT_disjoint_timer_query reports disjoint operation, desktop GL timer queries have no such concept
+#if defined(__linux__) || defined(__ghs__)
+        if (m_isEmbedded && m_glQueryCounter != nullptr)
+        {
+            GLint disjoint = 0;
+            glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+            return disjoint != 0;
+        }
+#endif
+        return false;
+    }
+
     UInt32 Device_GL::getTotalGpuMemoryUsageInKB() const
     {
         return m_resourceMapper.getTotalGpuMemoryUsageInKB();
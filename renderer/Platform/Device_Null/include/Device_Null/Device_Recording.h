@@ -0,0 +1,179 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DEVICE_RECORDING_H
+#define RAMSES_DEVICE_RECORDING_H
+
+#include "Device_Null/Device_Null.h"
+#include "Utils/File.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Collections/Vector.h"
+#include <memory>
+
+namespace ramses_internal
+{
+    /*  Null device which additionally records the stream of device commands of every frame
+        (draw calls, state changes, resource activations and uploaded bytes). A frame ends when the renderer
+        resets the draw call counter, which it does once at the beginning of every render loop.
+
+        If a trace file name is given, every finished frame is appended to the file in a compact binary format:
+            header: UInt32 Marker, UInt32 Version
+            frame:  UInt32 frameIndex, UInt32 numCommands, UInt64 uploadedBytes, numCommands x Command
+            Command: UInt8 ECommand, UInt32 arg0, UInt32 arg1
+        Render state commands that set the same value as the previous command of the same type are counted
+        as redundant state changes, which allows regression checks on the renderer's state caching.
+    */
+    class Device_Recording final : public Device_Null
+    {
+    public:
+        static const UInt32 Marker = 0x52544452;  // {'R', 'D', 'T', 'R'}
+        static const UInt32 Version = 1u;
+
+        enum class ECommand : UInt8
+        {
+            // draw calls
+            Clear = 0,
+            DrawIndexedTriangles,
+            DrawTriangles,
+            BlitRenderTargets,
+            ReadPixels,
+
+            // render states
+            ColorMask,
+            ClearColor,
+            ClearDepth,
+            ClearStencil,
+            BlendFactors,
+            BlendOperations,
+            CullMode,
+            DepthFunc,
+            DepthWrite,
+            StencilFunc,
+            StencilOp,
+            DrawMode,
+            Viewport,
+            ScissorTest,
+            ScissorRegion,
+            ActivateShader,
+            ActivateIndexBuffer,
+            ActivateRenderTarget,
+
+            // per data field bindings
+            SetConstant,
+            ActivateVertexBuffer,
+            ActivateTexture,
+            ActivateTextureSampler,
+            SetTextureSampling,
+
+            // uploads
+            UploadVertexBufferData,
+            UploadIndexBufferData,
+            UploadTextureData,
+            UploadStreamTexture,
+            UploadShader,
+
+            NUMBER_OF_ELEMENTS
+        };
+
+        struct Command
+        {
+            ECommand type;
+            UInt32 arg0;
+            UInt32 arg1;
+        };
+
+        struct FrameStatistics
+        {
+            UInt32 drawCalls = 0u;
+            UInt32 stateChanges = 0u;
+            UInt32 redundantStateChanges = 0u;
+            UInt64 uploadedBytes = 0u;
+        };
+
+        Device_Recording(IContext& context, const String& traceFileName);
+        virtual ~Device_Recording() override;
+
+        Bool init();
+
+        UInt32 getNumberOfFinishedFrames() const;
+        const FrameStatistics& getLastFrameStatistics() const;
+        const Vector<Command>& getCurrentFrameCommands() const;
+
+        virtual void    resetDrawCallCount() override;
+
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Float*      value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector2*    value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector3*    value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector4*    value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Int32*      value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector2i*   value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector3i*   value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector4i*   value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix22f*  value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix33f*  value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix44f*  value) override;
+
+        virtual void clear                 (UInt32 clearFlags) override;
+        virtual void drawIndexedTriangles  (Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
+        virtual void drawTriangles         (Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
+
+        virtual void colorMask             (Bool r, Bool g, Bool b, Bool a) override;
+        virtual void clearColor            (const Vector4& clearColor) override;
+        virtual void clearDepth            (Float d) override;
+        virtual void clearStencil          (Int32 s) override;
+        virtual void blendFactors          (EBlendFactor sourceColor, EBlendFactor destinationColor, EBlendFactor sourceAlpha, EBlendFactor destinationAlpha) override;
+        virtual void blendOperations       (EBlendOperation operationColor, EBlendOperation operationAlpha) override;
+        virtual void cullMode              (ECullMode mode) override;
+        virtual void depthFunc             (EDepthFunc func) override;
+        virtual void depthWrite            (EDepthWrite flag) override;
+        virtual void stencilFunc           (EStencilFunc func, UInt32 ref, UInt8 mask) override;
+        virtual void stencilOp             (EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass) override;
+        virtual void drawMode              (EDrawMode mode) override;
+        virtual void setViewport           (UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual void enableScissorTest     (Bool flag) override;
+        virtual void setScissorRegion      (UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual void setTextureSampling    (DataFieldHandle field, EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod sampling, UInt32 anisotropyLevel) override;
+
+        virtual void uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void streamVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void activateVertexBuffer  (DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor) override;
+        virtual void uploadIndexBufferData (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void streamIndexBufferData (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void activateIndexBuffer   (DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle uploadShader(const EffectResource& effect) override;
+        virtual void activateShader        (DeviceResourceHandle handle) override;
+        virtual void uploadTextureData     (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
+        virtual DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) override;
+        virtual UInt32 updateStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion) override;
+        virtual void activateTexture       (DeviceResourceHandle handle, DataFieldHandle field) override;
+        virtual void activateTextureSampler(DeviceResourceHandle handle, DataFieldHandle field) override;
+        virtual void activateRenderTarget  (DeviceResourceHandle handle) override;
+        virtual void blitRenderTargets     (DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, Bool colorOnly) override;
+        virtual void readPixels            (UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual DeviceResourceHandle startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+
+    private:
+        void record(ECommand type, UInt32 arg0 = 0u, UInt32 arg1 = 0u);
+        void recordState(ECommand type, UInt32 arg0, UInt32 arg1 = 0u);
+        void recordUpload(ECommand type, DeviceResourceHandle handle, UInt32 dataSize);
+        void finishFrame();
+
+        Vector<Command> m_commands;
+        FrameStatistics m_currentFrame;
+        FrameStatistics m_lastFrame;
+        UInt32 m_frameIndex = 0u;
+
+        Command m_lastStates[static_cast<UInt32>(ECommand::NUMBER_OF_ELEMENTS)];
+        Bool m_lastStateValid[static_cast<UInt32>(ECommand::NUMBER_OF_ELEMENTS)];
+
+        File m_traceFile;
+        std::unique_ptr<BinaryFileOutputStream> m_traceStream;
+    };
+}
+
+#endif
@@ -0,0 +1,429 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Device_Null/Device_Null.h"
+#include "Platform_Base/DeviceResourceMapper.h"
+#include "RendererAPI/IContext.h"
+#include "SceneAPI/RenderBuffer.h"
+#include "SceneAPI/PixelRectangle.h"
+#include "Utils/LogMacros.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    Device_Null::Device_Null(IContext& context)
+        : m_resourceMapper(context.getResources())
+    {
+    }
+
+    Device_Null::~Device_Null()
+    {
+        if (m_framebufferRenderTarget.isValid())
+            deleteResource(m_framebufferRenderTarget);
+    }
+
+    Bool Device_Null::init()
+    {
+        m_limits.setMaximumTextureUnits(16u);
+        m_limits.setMaximumAnisotropy(16u);
+        for (UInt32 format = ETextureFormat_Invalid + 1u; format < ETextureFormat_NUMBER_OF_TYPES; ++format)
+            m_limits.addTextureFormat(static_cast<ETextureFormat>(format));
+
+        m_framebufferRenderTarget = registerResource(0u);
+
+        LOG_INFO(CONTEXT_RENDERER, "Device_Null::init: device without graphics API created, nothing will be rendered");
+        return true;
+    }
+
+    EDeviceTypeId Device_Null::getDeviceTypeId() const
+    {
+        return EDeviceTypeId_INVALID;
+    }
+
+    String Device_Null::getDriverIdentification() const
+    {
+        return "Device_Null";
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Float*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Vector2*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Vector3*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Vector4*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Int32*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Vector2i*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Vector3i*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Vector4i*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Matrix22f*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Matrix33f*)
+    {
+    }
+
+    void Device_Null::setConstant(DataFieldHandle, UInt32, const Matrix44f*)
+    {
+    }
+
+    void Device_Null::clear(UInt32)
+    {
+    }
+
+    void Device_Null::finish()
+    {
+    }
+
+    void Device_Null::colorMask(Bool, Bool, Bool, Bool)
+    {
+    }
+
+    void Device_Null::clearColor(const Vector4&)
+    {
+    }
+
+    void Device_Null::clearDepth(Float)
+    {
+    }
+
+    void Device_Null::clearStencil(Int32)
+    {
+    }
+
+    void Device_Null::blendFactors(EBlendFactor, EBlendFactor, EBlendFactor, EBlendFactor)
+    {
+    }
+
+    void Device_Null::blendOperations(EBlendOperation, EBlendOperation)
+    {
+    }
+
+    void Device_Null::cullMode(ECullMode)
+    {
+    }
+
+    void Device_Null::depthFunc(EDepthFunc)
+    {
+    }
+
+    void Device_Null::depthWrite(EDepthWrite)
+    {
+    }
+
+    void Device_Null::stencilFunc(EStencilFunc, UInt32, UInt8)
+    {
+    }
+
+    void Device_Null::stencilOp(EStencilOp, EStencilOp, EStencilOp)
+    {
+    }
+
+    void Device_Null::drawMode(EDrawMode)
+    {
+    }
+
+    void Device_Null::setViewport(UInt32, UInt32, UInt32, UInt32)
+    {
+    }
+
+    void Device_Null::enableScissorTest(Bool)
+    {
+    }
+
+    void Device_Null::setScissorRegion(UInt32, UInt32, UInt32, UInt32)
+    {
+    }
+
+    void Device_Null::setTextureSampling(DataFieldHandle, EWrapMethod, EWrapMethod, EWrapMethod, ESamplingMethod, UInt32)
+    {
+    }
+
+    DeviceResourceHandle Device_Null::allocateVertexBuffer(EDataType, UInt32 sizeInBytes)
+    {
+        return registerResource(sizeInBytes);
+    }
+
+    void Device_Null::uploadVertexBufferData(DeviceResourceHandle, const Byte*, UInt32)
+    {
+    }
+
+    void Device_Null::streamVertexBufferData(DeviceResourceHandle, const Byte*, UInt32)
+    {
+    }
+
+    void Device_Null::deleteVertexBuffer(DeviceResourceHandle handle)
+    {
+        deleteResource(handle);
+    }
+
+    void Device_Null::activateVertexBuffer(DeviceResourceHandle, DataFieldHandle, UInt32)
+    {
+    }
+
+    DeviceResourceHandle Device_Null::allocateIndexBuffer(EDataType, UInt32 sizeInBytes)
+    {
+        return registerResource(sizeInBytes);
+    }
+
+    void Device_Null::uploadIndexBufferData(DeviceResourceHandle, const Byte*, UInt32)
+    {
+    }
+
+    void Device_Null::streamIndexBufferData(DeviceResourceHandle, const Byte*, UInt32)
+    {
+    }
+
+    void Device_Null::deleteIndexBuffer(DeviceResourceHandle handle)
+    {
+        deleteResource(handle);
+    }
+
+    void Device_Null::activateIndexBuffer(DeviceResourceHandle)
+    {
+    }
+
+    DeviceResourceHandle Device_Null::uploadShader(const EffectResource&)
+    {
+        return registerResource(0u);
+    }
+
+    DeviceResourceHandle Device_Null::uploadBinaryShader(const EffectResource&, const UInt8*, UInt32 binaryShaderDataSize, UInt32)
+    {
+        return registerResource(binaryShaderDataSize);
+    }
+
+    Bool Device_Null::getBinaryShader(DeviceResourceHandle, UInt8Vector&, UInt32&)
+    {
+        return false;
+    }
+
+    void Device_Null::deleteShader(DeviceResourceHandle handle)
+    {
+        deleteResource(handle);
+    }
+
+    void Device_Null::activateShader(DeviceResourceHandle)
+    {
+    }
+
+    DeviceResourceHandle Device_Null::allocateTexture2D(UInt32, UInt32, ETextureFormat, UInt32, UInt32 totalSizeInBytes)
+    {
+        return registerResource(totalSizeInBytes);
+    }
+
+    DeviceResourceHandle Device_Null::allocateTexture3D(UInt32, UInt32, UInt32, ETextureFormat, UInt32, UInt32 totalSizeInBytes)
+    {
+        return registerResource(totalSizeInBytes);
+    }
+
+    DeviceResourceHandle Device_Null::allocateTextureCube(UInt32, ETextureFormat, UInt32, UInt32 totalSizeInBytes)
+    {
+        return registerResource(totalSizeInBytes);
+    }
+
+    void Device_Null::bindTexture(DeviceResourceHandle)
+    {
+    }
+
+    void Device_Null::generateMipmaps(DeviceResourceHandle)
+    {
+    }
+
+    void Device_Null::setTextureBaseMipLevel(DeviceResourceHandle, UInt32)
+    {
+    }
+
+    void Device_Null::uploadTextureData(DeviceResourceHandle, UInt32, UInt32, UInt32, UInt32, UInt32, UInt32, UInt32, const Byte*, UInt32)
+    {
+    }
+
+    DeviceResourceHandle Device_Null::uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8*)
+    {
+        if (handle.isValid())
+            return handle;
+
+        return registerResource(width * height * GetTexelSizeFromFormat(format));
+    }
+
+    UInt32 Device_Null::updateStreamTexture2D(DeviceResourceHandle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8*, const PixelRectangle& updatedRegion)
+    {
+        if (updatedRegion.width <= 0 || updatedRegion.height <= 0 || updatedRegion.x >= width || updatedRegion.y >= height)
+            return 0u;
+
+        const UInt32 regionWidth = std::min(static_cast<UInt32>(updatedRegion.width), width - updatedRegion.x);
+        const UInt32 regionHeight = std::min(static_cast<UInt32>(updatedRegion.height), height - updatedRegion.y);
+        return regionWidth * regionHeight * GetTexelSizeFromFormat(format);
+    }
+
+    void Device_Null::deleteTexture(DeviceResourceHandle handle)
+    {
+        deleteResource(handle);
+    }
+
+    void Device_Null::activateTexture(DeviceResourceHandle, DataFieldHandle)
+    {
+    }
+
+    DeviceResourceHandle Device_Null::uploadRenderBuffer(const RenderBuffer& renderBuffer)
+    {
+        const UInt32 sampleCount = std::max(renderBuffer.sampleCount, 1u);
+        return registerResource(renderBuffer.width * renderBuffer.height * GetTexelSizeFromFormat(renderBuffer.format) * sampleCount);
+    }
+
+    void Device_Null::deleteRenderBuffer(DeviceResourceHandle handle)
+    {
+        deleteResource(handle);
+    }
+
+    DeviceResourceHandle Device_Null::uploadTextureSampler(EWrapMethod, EWrapMethod, EWrapMethod, ESamplingMethod, UInt32)
+    {
+        return registerResource(0u);
+    }
+
+    void Device_Null::deleteTextureSampler(DeviceResourceHandle handle)
+    {
+        deleteResource(handle);
+    }
+
+    void Device_Null::activateTextureSampler(DeviceResourceHandle, DataFieldHandle)
+    {
+    }
+
+    DeviceResourceHandle Device_Null::getFramebufferRenderTarget() const
+    {
+        return m_framebufferRenderTarget;
+    }
+
+    DeviceResourceHandle Device_Null::uploadRenderTarget(const DeviceHandleVector&)
+    {
+        return registerResource(0u);
+    }
+
+    void Device_Null::activateRenderTarget(DeviceResourceHandle)
+    {
+    }
+
+    void Device_Null::deleteRenderTarget(DeviceResourceHandle handle)
+    {
+        deleteResource(handle);
+    }
+
+    void Device_Null::pairRenderTargetsForDoubleBuffering(DeviceResourceHandle[2], DeviceResourceHandle[2])
+    {
+    }
+
+    void Device_Null::unpairRenderTargets(DeviceResourceHandle)
+    {
+    }
+
+    void Device_Null::swapDoubleBufferedRenderTarget(DeviceResourceHandle)
+    {
+    }
+
+    void Device_Null::blitRenderTargets(DeviceResourceHandle, DeviceResourceHandle, const PixelRectangle&, const PixelRectangle&, Bool)
+    {
+    }
+
+    void Device_Null::readPixels(UInt8* buffer, UInt32, UInt32, UInt32 width, UInt32 height)
+    {
+        // nothing is rendered, report transparent black pixels so that screenshots stay deterministic
+        PlatformMemory::Set(buffer, 0, width * height * 4u);
+    }
+
+    DeviceResourceHandle Device_Null::startReadPixels(UInt32, UInt32, UInt32 width, UInt32 height)
+    {
+        return registerResource(width * height * 4u);
+    }
+
+    Bool Device_Null::isReadPixelsFinished(DeviceResourceHandle)
+    {
+        return true;
+    }
+
+    Bool Device_Null::finishReadPixels(DeviceResourceHandle handle, UInt8* buffer)
+    {
+        PlatformMemory::Set(buffer, 0, m_resourceMapper.getResource(handle).getTotalSizeInBytes());
+        deleteResource(handle);
+        return true;
+    }
+
+    DeviceResourceHandle Device_Null::writeGpuTimestamp()
+    {
+        // there is no GPU work to measure
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool Device_Null::isGpuTimestampAvailable(DeviceResourceHandle)
+    {
+        return true;
+    }
+
+    UInt64 Device_Null::finishGpuTimestamp(DeviceResourceHandle)
+    {
+        return 0u;
+    }
+
+    Bool Device_Null::isGpuTimerDisjoint()
+    {
+        return false;
+    }
+
+    UInt32 Device_Null::getTotalGpuMemoryUsageInKB() const
+    {
+        return m_resourceMapper.getTotalGpuMemoryUsageInKB();
+    }
+
+    void Device_Null::validateDeviceStatusHealthy() const
+    {
+    }
+
+    Bool Device_Null::isDeviceStatusHealthy() const
+    {
+        return true;
+    }
+
+    int Device_Null::getTextureAddress(DeviceResourceHandle handle) const
+    {
+        return static_cast<int>(handle.asMemoryHandle());
+    }
+
+    DeviceResourceHandle Device_Null::registerResource(UInt32 sizeInBytes)
+    {
+        return m_resourceMapper.registerResource(*new GPUResource(0u, sizeInBytes));
+    }
+
+    void Device_Null::deleteResource(DeviceResourceHandle handle)
+    {
+        if (m_resourceMapper.containsResource(handle))
+            m_resourceMapper.deleteResource(handle);
+    }
+}
@@ -0,0 +1,413 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Device_Null/Device_Recording.h"
+#include "Resource/EffectResource.h"
+#include "Math3d/Vector4.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    const UInt32 Device_Recording::Marker;
+    const UInt32 Device_Recording::Version;
+
+    namespace
+    {
+        UInt32 FloatBits(Float value)
+        {
+            UInt32 bits = 0u;
+            PlatformMemory::Copy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        UInt32 PackPair(UInt32 low, UInt32 high)
+        {
+            return (low & 0xffff) | (high << 16u);
+        }
+
+        UInt32 PackColor(const Vector4& color)
+        {
+            UInt32 packed = 0u;
+            for (UInt32 i = 0u; i < 4u; ++i)
+            {
+                const Float component = std::min(std::max(color[i], 0.f), 1.f);
+                packed |= static_cast<UInt32>(component * 255.f + 0.5f) << (8u * i);
+            }
+            return packed;
+        }
+    }
+
+    Device_Recording::Device_Recording(IContext& context, const String& traceFileName)
+        : Device_Null(context)
+        , m_traceFile(traceFileName)
+    {
+        for (auto& valid : m_lastStateValid)
+            valid = false;
+    }
+
+    Device_Recording::~Device_Recording()
+    {
+        if (!m_commands.empty())
+            finishFrame();
+    }
+
+    Bool Device_Recording::init()
+    {
+        if (!Device_Null::init())
+            return false;
+
+        if (!m_traceFile.getPath().empty())
+        {
+            m_traceStream.reset(new BinaryFileOutputStream(m_traceFile));
+            if (m_traceStream->getState() != EStatus_RAMSES_OK)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "Device_Recording::init: could not open trace file " << m_traceFile.getPath());
+                m_traceStream.reset();
+                return false;
+            }
+            *m_traceStream << Marker << Version;
+            LOG_INFO(CONTEXT_RENDERER, "Device_Recording::init: recording device commands to " << m_traceFile.getPath());
+        }
+
+        return true;
+    }
+
+    UInt32 Device_Recording::getNumberOfFinishedFrames() const
+    {
+        return m_frameIndex;
+    }
+
+    const Device_Recording::FrameStatistics& Device_Recording::getLastFrameStatistics() const
+    {
+        return m_lastFrame;
+    }
+
+    const Vector<Device_Recording::Command>& Device_Recording::getCurrentFrameCommands() const
+    {
+        return m_commands;
+    }
+
+    void Device_Recording::resetDrawCallCount()
+    {
+        Device_Null::resetDrawCallCount();
+        finishFrame();
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Float* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Vector2* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Vector3* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Vector4* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Int32* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Vector2i* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Vector3i* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Vector4i* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Matrix22f* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Matrix33f* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::setConstant(DataFieldHandle field, UInt32 count, const Matrix44f* value)
+    {
+        Device_Null::setConstant(field, count, value);
+        record(ECommand::SetConstant, field.asMemoryHandle(), count);
+    }
+
+    void Device_Recording::clear(UInt32 clearFlags)
+    {
+        record(ECommand::Clear, clearFlags);
+    }
+
+    void Device_Recording::drawIndexedTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
+    {
+        Device_Null::drawIndexedTriangles(startOffset, elementCount, instanceCount);
+        ++m_currentFrame.drawCalls;
+        record(ECommand::DrawIndexedTriangles, static_cast<UInt32>(elementCount), instanceCount);
+    }
+
+    void Device_Recording::drawTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
+    {
+        Device_Null::drawTriangles(startOffset, elementCount, instanceCount);
+        ++m_currentFrame.drawCalls;
+        record(ECommand::DrawTriangles, static_cast<UInt32>(elementCount), instanceCount);
+    }
+
+    void Device_Recording::colorMask(Bool r, Bool g, Bool b, Bool a)
+    {
+        recordState(ECommand::ColorMask, (r ? 1u : 0u) | (g ? 2u : 0u) | (b ? 4u : 0u) | (a ? 8u : 0u));
+    }
+
+    void Device_Recording::clearColor(const Vector4& clearColor)
+    {
+        recordState(ECommand::ClearColor, PackColor(clearColor));
+    }
+
+    void Device_Recording::clearDepth(Float d)
+    {
+        recordState(ECommand::ClearDepth, FloatBits(d));
+    }
+
+    void Device_Recording::clearStencil(Int32 s)
+    {
+        recordState(ECommand::ClearStencil, static_cast<UInt32>(s));
+    }
+
+    void Device_Recording::blendFactors(EBlendFactor sourceColor, EBlendFactor destinationColor, EBlendFactor sourceAlpha, EBlendFactor destinationAlpha)
+    {
+        recordState(ECommand::BlendFactors, PackPair(sourceColor, destinationColor), PackPair(sourceAlpha, destinationAlpha));
+    }
+
+    void Device_Recording::blendOperations(EBlendOperation operationColor, EBlendOperation operationAlpha)
+    {
+        recordState(ECommand::BlendOperations, operationColor, operationAlpha);
+    }
+
+    void Device_Recording::cullMode(ECullMode mode)
+    {
+        recordState(ECommand::CullMode, mode);
+    }
+
+    void Device_Recording::depthFunc(EDepthFunc func)
+    {
+        recordState(ECommand::DepthFunc, func);
+    }
+
+    void Device_Recording::depthWrite(EDepthWrite flag)
+    {
+        recordState(ECommand::DepthWrite, flag);
+    }
+
+    void Device_Recording::stencilFunc(EStencilFunc func, UInt32 ref, UInt8 mask)
+    {
+        recordState(ECommand::StencilFunc, PackPair(func, mask), ref);
+    }
+
+    void Device_Recording::stencilOp(EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass)
+    {
+        recordState(ECommand::StencilOp, PackPair(sfail, dpfail), dppass);
+    }
+
+    void Device_Recording::drawMode(EDrawMode mode)
+    {
+        recordState(ECommand::DrawMode, mode);
+    }
+
+    void Device_Recording::setViewport(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        recordState(ECommand::Viewport, PackPair(x, y), PackPair(width, height));
+    }
+
+    void Device_Recording::enableScissorTest(Bool flag)
+    {
+        recordState(ECommand::ScissorTest, flag ? 1u : 0u);
+    }
+
+    void Device_Recording::setScissorRegion(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        recordState(ECommand::ScissorRegion, PackPair(x, y), PackPair(width, height));
+    }
+
+    void Device_Recording::setTextureSampling(DataFieldHandle field, EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod sampling, UInt32 anisotropyLevel)
+    {
+        UNUSED(wrapU)
+        UNUSED(wrapV)
+        UNUSED(wrapR)
+        record(ECommand::SetTextureSampling, field.asMemoryHandle(), PackPair(sampling, anisotropyLevel));
+    }
+
+    void Device_Recording::uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize)
+    {
+        Device_Null::uploadVertexBufferData(handle, data, dataSize);
+        recordUpload(ECommand::UploadVertexBufferData, handle, dataSize);
+    }
+
+    void Device_Recording::streamVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize)
+    {
+        Device_Null::streamVertexBufferData(handle, data, dataSize);
+        recordUpload(ECommand::UploadVertexBufferData, handle, dataSize);
+    }
+
+    void Device_Recording::activateVertexBuffer(DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor)
+    {
+        UNUSED(instancingDivisor)
+        record(ECommand::ActivateVertexBuffer, handle.asMemoryHandle(), field.asMemoryHandle());
+    }
+
+    void Device_Recording::uploadIndexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize)
+    {
+        Device_Null::uploadIndexBufferData(handle, data, dataSize);
+        recordUpload(ECommand::UploadIndexBufferData, handle, dataSize);
+    }
+
+    void Device_Recording::streamIndexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize)
+    {
+        Device_Null::streamIndexBufferData(handle, data, dataSize);
+        recordUpload(ECommand::UploadIndexBufferData, handle, dataSize);
+    }
+
+    void Device_Recording::activateIndexBuffer(DeviceResourceHandle handle)
+    {
+        recordState(ECommand::ActivateIndexBuffer, handle.asMemoryHandle());
+    }
+
+    DeviceResourceHandle Device_Recording::uploadShader(const EffectResource& effect)
+    {
+        const DeviceResourceHandle handle = Device_Null::uploadShader(effect);
+        recordUpload(ECommand::UploadShader, handle, effect.getDecompressedDataSize());
+        return handle;
+    }
+
+    void Device_Recording::activateShader(DeviceResourceHandle handle)
+    {
+        recordState(ECommand::ActivateShader, handle.asMemoryHandle());
+    }
+
+    void Device_Recording::uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize)
+    {
+        Device_Null::uploadTextureData(handle, mipLevel, x, y, z, width, height, depth, data, dataSize);
+        recordUpload(ECommand::UploadTextureData, handle, dataSize);
+    }
+
+    DeviceResourceHandle Device_Recording::uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data)
+    {
+        const DeviceResourceHandle resultHandle = Device_Null::uploadStreamTexture2D(handle, width, height, format, data);
+        recordUpload(ECommand::UploadStreamTexture, resultHandle, width * height * GetTexelSizeFromFormat(format));
+        return resultHandle;
+    }
+
+    UInt32 Device_Recording::updateStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion)
+    {
+        const UInt32 uploadedBytes = Device_Null::updateStreamTexture2D(handle, width, height, format, data, updatedRegion);
+        recordUpload(ECommand::UploadStreamTexture, handle, uploadedBytes);
+        return uploadedBytes;
+    }
+
+    void Device_Recording::activateTexture(DeviceResourceHandle handle, DataFieldHandle field)
+    {
+        record(ECommand::ActivateTexture, handle.asMemoryHandle(), field.asMemoryHandle());
+    }
+
+    void Device_Recording::activateTextureSampler(DeviceResourceHandle handle, DataFieldHandle field)
+    {
+        record(ECommand::ActivateTextureSampler, handle.asMemoryHandle(), field.asMemoryHandle());
+    }
+
+    void Device_Recording::activateRenderTarget(DeviceResourceHandle handle)
+    {
+        recordState(ECommand::ActivateRenderTarget, handle.asMemoryHandle());
+    }
+
+    void Device_Recording::blitRenderTargets(DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, Bool colorOnly)
+    {
+        Device_Null::blitRenderTargets(rtSrc, rtDst, srcRect, dstRect, colorOnly);
+        record(ECommand::BlitRenderTargets, rtSrc.asMemoryHandle(), rtDst.asMemoryHandle());
+    }
+
+    void Device_Recording::readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        Device_Null::readPixels(buffer, x, y, width, height);
+        record(ECommand::ReadPixels, PackPair(x, y), PackPair(width, height));
+    }
+
+    DeviceResourceHandle Device_Recording::startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        // the copy into read back storage is what costs GPU time, finishing it is not recorded
+        record(ECommand::ReadPixels, PackPair(x, y), PackPair(width, height));
+        return Device_Null::startReadPixels(x, y, width, height);
+    }
+
+    void Device_Recording::record(ECommand type, UInt32 arg0, UInt32 arg1)
+    {
+        m_commands.push_back({ type, arg0, arg1 });
+    }
+
+    void Device_Recording::recordState(ECommand type, UInt32 arg0, UInt32 arg1)
+    {
+        const UInt32 stateIdx = static_cast<UInt32>(type);
+        Command& lastState = m_lastStates[stateIdx];
+        if (m_lastStateValid[stateIdx] && lastState.arg0 == arg0 && lastState.arg1 == arg1)
+            ++m_currentFrame.redundantStateChanges;
+
+        lastState = { type, arg0, arg1 };
+        m_lastStateValid[stateIdx] = true;
+        ++m_currentFrame.stateChanges;
+        record(type, arg0, arg1);
+    }
+
+    void Device_Recording::recordUpload(ECommand type, DeviceResourceHandle handle, UInt32 dataSize)
+    {
+        m_currentFrame.uploadedBytes += dataSize;
+        record(type, handle.asMemoryHandle(), dataSize);
+    }
+
+    void Device_Recording::finishFrame()
+    {
+        if (m_traceStream)
+        {
+            *m_traceStream << m_frameIndex << static_cast<UInt32>(m_commands.size()) << m_currentFrame.uploadedBytes;
+            for (const auto& command : m_commands)
+            {
+                const UInt8 type = static_cast<UInt8>(command.type);
+                m_traceStream->write(&type, sizeof(type));
+                *m_traceStream << command.arg0 << command.arg1;
+            }
+        }
+
+        m_lastFrame = m_currentFrame;
+        m_currentFrame = FrameStatistics();
+        m_commands.clear();
+        ++m_frameIndex;
+    }
+}
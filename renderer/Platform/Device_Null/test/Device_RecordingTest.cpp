@@ -0,0 +1,184 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "Device_Null/Device_Null.h"
+#include "Device_Null/Device_Recording.h"
+#include "Platform_Base/Context_Base.h"
+#include "Utils/BinaryFileInputStream.h"
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class TestContext_Null : public Context_Base
+    {
+    public:
+        void* getProcAddress(const Char*) const override
+        {
+            return nullptr;
+        }
+    };
+
+    class ADeviceNull : public ::testing::Test
+    {
+    protected:
+        TestContext_Null context;
+    };
+
+    TEST_F(ADeviceNull, tracksResourceMemoryWithoutGraphicsApi)
+    {
+        Device_Null device(context);
+        ASSERT_TRUE(device.init());
+        EXPECT_TRUE(device.getFramebufferRenderTarget().isValid());
+        EXPECT_TRUE(device.getRendererLimits().isTextureFormatAvailable(ETextureFormat_RGBA8));
+
+        const DeviceResourceHandle vertexBuffer = device.allocateVertexBuffer(EDataType_Vector3F, 2048u);
+        const DeviceResourceHandle texture = device.allocateTexture2D(32u, 32u, ETextureFormat_RGBA8, 1u, 4096u);
+        EXPECT_TRUE(vertexBuffer.isValid());
+        EXPECT_TRUE(texture.isValid());
+        EXPECT_NE(vertexBuffer, texture);
+        EXPECT_EQ(6u, device.getTotalGpuMemoryUsageInKB());
+
+        device.deleteVertexBuffer(vertexBuffer);
+        device.deleteTexture(texture);
+        EXPECT_EQ(0u, device.getTotalGpuMemoryUsageInKB());
+    }
+
+    TEST_F(ADeviceNull, countsDrawCalls)
+    {
+        Device_Null device(context);
+        ASSERT_TRUE(device.init());
+        device.drawIndexedTriangles(0, 3, 1u);
+        device.drawTriangles(0, 3, 1u);
+        EXPECT_EQ(2u, device.getDrawCallCount());
+        device.resetDrawCallCount();
+        EXPECT_EQ(0u, device.getDrawCallCount());
+    }
+
+    class ADeviceRecording : public ADeviceNull
+    {
+    };
+
+    TEST_F(ADeviceRecording, recordsCommandsOfCurrentFrame)
+    {
+        Device_Recording device(context, "");
+        ASSERT_TRUE(device.init());
+
+        const DeviceResourceHandle indexBuffer = device.allocateIndexBuffer(EDataType_UInt16, 6u);
+        device.uploadIndexBufferData(indexBuffer, nullptr, 6u);
+        device.depthFunc(EDepthFunc_Greater);
+        device.activateIndexBuffer(indexBuffer);
+        device.drawIndexedTriangles(0, 6, 1u);
+
+        const auto& commands = device.getCurrentFrameCommands();
+        ASSERT_EQ(4u, commands.size());
+        EXPECT_EQ(Device_Recording::ECommand::UploadIndexBufferData, commands[0].type);
+        EXPECT_EQ(indexBuffer.asMemoryHandle(), commands[0].arg0);
+        EXPECT_EQ(6u, commands[0].arg1);
+        EXPECT_EQ(Device_Recording::ECommand::DepthFunc, commands[1].type);
+        EXPECT_EQ(static_cast<UInt32>(EDepthFunc_Greater), commands[1].arg0);
+        EXPECT_EQ(Device_Recording::ECommand::ActivateIndexBuffer, commands[2].type);
+        EXPECT_EQ(Device_Recording::ECommand::DrawIndexedTriangles, commands[3].type);
+        EXPECT_EQ(6u, commands[3].arg0);
+        EXPECT_EQ(1u, commands[3].arg1);
+    }
+
+    TEST_F(ADeviceRecording, finishesFrameWhenDrawCallCountIsReset)
+    {
+        Device_Recording device(context, "");
+        ASSERT_TRUE(device.init());
+        EXPECT_EQ(0u, device.getNumberOfFinishedFrames());
+
+        const DeviceResourceHandle vertexBuffer = device.allocateVertexBuffer(EDataType_Vector3F, 36u);
+        device.uploadVertexBufferData(vertexBuffer, nullptr, 36u);
+        device.cullMode(ECullMode_BackFacing);
+        device.depthFunc(EDepthFunc_Greater);
+        device.drawTriangles(0, 3, 1u);
+        device.cullMode(ECullMode_BackFacing);
+        device.drawTriangles(0, 3, 1u);
+        device.resetDrawCallCount();
+
+        EXPECT_EQ(1u, device.getNumberOfFinishedFrames());
+        EXPECT_TRUE(device.getCurrentFrameCommands().empty());
+        EXPECT_EQ(0u, device.getDrawCallCount());
+
+        const Device_Recording::FrameStatistics& stats = device.getLastFrameStatistics();
+        EXPECT_EQ(2u, stats.drawCalls);
+        EXPECT_EQ(3u, stats.stateChanges);
+        EXPECT_EQ(1u, stats.redundantStateChanges);
+        EXPECT_EQ(36u, stats.uploadedBytes);
+    }
+
+    TEST_F(ADeviceRecording, countsStateSetAgainInNextFrameAsRedundant)
+    {
+        Device_Recording device(context, "");
+        ASSERT_TRUE(device.init());
+
+        device.setViewport(0u, 0u, 128u, 64u);
+        device.resetDrawCallCount();
+        device.setViewport(0u, 0u, 128u, 64u);
+        device.setViewport(0u, 0u, 64u, 64u);
+        device.resetDrawCallCount();
+
+        EXPECT_EQ(2u, device.getLastFrameStatistics().stateChanges);
+        EXPECT_EQ(1u, device.getLastFrameStatistics().redundantStateChanges);
+    }
+
+    TEST_F(ADeviceRecording, writesFramesToBinaryTraceFile)
+    {
+        const String traceFileName("deviceRecordingTest.trace");
+        {
+            Device_Recording device(context, traceFileName);
+            ASSERT_TRUE(device.init());
+            device.clear(1u);
+            device.drawTriangles(0, 3, 2u);
+            device.resetDrawCallCount();
+            device.enableScissorTest(true);
+        }
+
+        File traceFile(traceFileName);
+        ASSERT_TRUE(traceFile.exists());
+        {
+            BinaryFileInputStream stream(traceFile);
+            UInt32 marker = 0u;
+            UInt32 version = 0u;
+            stream >> marker >> version;
+            EXPECT_EQ(Device_Recording::Marker, marker);
+            EXPECT_EQ(Device_Recording::Version, version);
+
+            UInt32 frameIndex = 99u;
+            UInt32 numCommands = 0u;
+            UInt64 uploadedBytes = 99u;
+            stream >> frameIndex >> numCommands >> uploadedBytes;
+            EXPECT_EQ(0u, frameIndex);
+            EXPECT_EQ(2u, numCommands);
+            EXPECT_EQ(0u, uploadedBytes);
+
+            UInt8 type = 0u;
+            UInt32 arg0 = 0u;
+            UInt32 arg1 = 0u;
+            stream.read(reinterpret_cast<Char*>(&type), sizeof(type));
+            stream >> arg0 >> arg1;
+            EXPECT_EQ(static_cast<UInt8>(Device_Recording::ECommand::Clear), type);
+            EXPECT_EQ(1u, arg0);
+            stream.read(reinterpret_cast<Char*>(&type), sizeof(type));
+            stream >> arg0 >> arg1;
+            EXPECT_EQ(static_cast<UInt8>(Device_Recording::ECommand::DrawTriangles), type);
+            EXPECT_EQ(3u, arg0);
+            EXPECT_EQ(2u, arg1);
+
+            // last unfinished frame is written on destruction
+            stream >> frameIndex >> numCommands >> uploadedBytes;
+            EXPECT_EQ(1u, frameIndex);
+            EXPECT_EQ(1u, numCommands);
+            EXPECT_EQ(EStatus_RAMSES_OK, stream.getState());
+        }
+        traceFile.remove();
+    }
+}
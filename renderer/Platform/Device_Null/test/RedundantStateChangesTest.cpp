@@ -0,0 +1,152 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "Device_Null/Device_Recording.h"
+#include "Platform_Base/Context_Base.h"
+#include "RendererResourceManagerMock.h"
+#include "EmbeddedCompositingManagerMock.h"
+#include "ResourceProviderMock.h"
+#include "RenderExecutor.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererEventCollector.h"
+#include <algorithm>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    namespace
+    {
+        const UInt32 MaxRenderables = 16u;
+    }
+
+    // Renders a scene through the render executor into the recording device, so that CI catches
+    // regressions in the executor's state caching without a GPU
+    class ARenderExecutorOnRecordingDevice : public ::testing::Test
+    {
+    protected:
+        class TestContext_Null : public Context_Base
+        {
+        public:
+            void* getProcAddress(const Char*) const override
+            {
+                return nullptr;
+            }
+        };
+
+        ARenderExecutorOnRecordingDevice()
+            : device(context, "")
+            , rendererScenes(rendererEventCollector)
+            , scene(rendererScenes.createScene(SceneInfo(SceneId(1u))))
+        {
+            EXPECT_TRUE(device.init());
+            scene.preallocateSceneSize(SceneSizeInformation(MaxRenderables + 1u, 1u, 0u, MaxRenderables, MaxRenderables, 2u, MaxRenderables + 1u, 1u, 1u, 0u, 0u, 0u, MaxRenderables, 0u, 0u, 0u, 0u, 0u));
+
+            DataFieldInfoVector uniformFields(2u);
+            uniformFields[0] = DataFieldInfo(EDataType_Matrix44F, 1u, EFixedSemantics_ModelMatrix);
+            uniformFields[1] = DataFieldInfo(EDataType_TextureSampler, 1u, EFixedSemantics_Invalid);
+            uniformLayout = scene.allocateDataLayout(uniformFields, DataLayoutHandle(0u));
+
+            DataFieldInfoVector geometryFields(2u);
+            geometryFields[0] = DataFieldInfo(EDataType_Indices, 1u, EFixedSemantics_Indices);
+            geometryFields[1] = DataFieldInfo(EDataType_Vector3Buffer, 1u, EFixedSemantics_VertexPositionAttribute);
+            const DataLayoutHandle geometryLayout = scene.allocateDataLayout(geometryFields, DataLayoutHandle(1u));
+            geometry = scene.allocateDataInstance(geometryLayout, DataInstanceHandle(MaxRenderables));
+            scene.setDataResource(geometry, DataFieldHandle(0u), ResourceProviderMock::FakeIndexArrayHash, DataBufferHandle::Invalid(), 0u);
+            scene.setDataResource(geometry, DataFieldHandle(1u), ResourceProviderMock::FakeVertArrayHash, DataBufferHandle::Invalid(), 0u);
+
+            // scene pools of renderer use explicit handles, renderables occupy the handles below MaxRenderables
+            renderPass = scene.allocateRenderPass(0u, RenderPassHandle(0u));
+            scene.setRenderPassCamera(renderPass, scene.allocateCamera(ECameraProjectionType_Renderer, scene.allocateNode(0u, NodeHandle(MaxRenderables)), CameraHandle(0u)));
+            renderGroup = scene.allocateRenderGroup(0u, 0u, RenderGroupHandle(0u));
+            scene.addRenderGroupToRenderPass(renderPass, renderGroup, 0);
+        }
+
+        // renderables differ only in their model matrix, everything else is equal but allocated per renderable
+        void createRenderables(UInt32 count)
+        {
+            for (UInt32 i = renderableCount; i < renderableCount + count; ++i)
+            {
+                const RenderableHandle renderable = scene.allocateRenderable(scene.allocateNode(0u, NodeHandle(i)), RenderableHandle(i));
+                const DataInstanceHandle uniforms = scene.allocateDataInstance(uniformLayout, DataInstanceHandle(i));
+                const TextureSamplerHandle sampler = scene.allocateTextureSampler({ { EWrapMethod_Repeat, EWrapMethod_Clamp, EWrapMethod_Clamp, ESamplingMethod_Bilinear, 1u }, ResourceProviderMock::FakeTextureHash }, TextureSamplerHandle(i));
+                scene.setDataTextureSamplerHandle(uniforms, DataFieldHandle(1u), sampler);
+
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+                scene.setRenderableRenderState(renderable, scene.allocateRenderState(RenderStateHandle(i)));
+                scene.setRenderableEffect(renderable, ResourceProviderMock::FakeEffectHash);
+                scene.setRenderableIndexCount(renderable, 3u);
+                scene.addRenderableToRenderGroup(renderGroup, renderable, static_cast<Int32>(i));
+            }
+            renderableCount += count;
+
+            scene.updateRenderablesAndResourceCache(resourceManager, embeddedCompositingManager);
+            scene.updateRenderableWorldMatrices();
+        }
+
+        void renderFrame()
+        {
+            const Viewport viewport(0u, 0u, 64u, 64u);
+            const FrameBufferInfo frameBufferInfo(device.getFramebufferRenderTarget(), ProjectionParams::Frustum(ECameraProjectionType_Orthographic, -1.f, 1.f, -1.f, 1.f, 0.1f, 1.f), viewport);
+            RenderExecutor executor(device, frameBufferInfo);
+            executor.executeScene(scene, Matrix44f::Identity);
+        }
+
+        UInt32 countCommandsOfCurrentFrame(Device_Recording::ECommand type) const
+        {
+            const auto& commands = device.getCurrentFrameCommands();
+            return static_cast<UInt32>(std::count_if(commands.cbegin(), commands.cend(), [type](const Device_Recording::Command& command) { return command.type == type; }));
+        }
+
+        TestContext_Null context;
+        Device_Recording device;
+        NiceMock<RendererResourceManagerMock> resourceManager;
+        NiceMock<EmbeddedCompositingManagerMock> embeddedCompositingManager;
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes;
+        RendererCachedScene& scene;
+
+        DataLayoutHandle uniformLayout;
+        DataInstanceHandle geometry;
+        RenderPassHandle renderPass;
+        RenderGroupHandle renderGroup;
+        UInt32 renderableCount = 0u;
+    };
+
+    TEST_F(ARenderExecutorOnRecordingDevice, appliesStatesOfEqualRenderablesOnlyOnce)
+    {
+        createRenderables(1u);
+        renderFrame();
+        device.resetDrawCallCount();
+        const UInt32 stateChangesForSingleRenderable = device.getLastFrameStatistics().stateChanges;
+
+        createRenderables(MaxRenderables - 1u);
+        renderFrame();
+        EXPECT_EQ(1u, countCommandsOfCurrentFrame(Device_Recording::ECommand::ActivateShader));
+        EXPECT_EQ(1u, countCommandsOfCurrentFrame(Device_Recording::ECommand::SetTextureSampling));
+        EXPECT_EQ(MaxRenderables, countCommandsOfCurrentFrame(Device_Recording::ECommand::DrawIndexedTriangles));
+        device.resetDrawCallCount();
+
+        const Device_Recording::FrameStatistics& stats = device.getLastFrameStatistics();
+        EXPECT_EQ(MaxRenderables, stats.drawCalls);
+        EXPECT_EQ(stateChangesForSingleRenderable, stats.stateChanges);
+    }
+
+    TEST_F(ARenderExecutorOnRecordingDevice, doesNotSetAnyStateTwiceWithinFrame)
+    {
+        createRenderables(MaxRenderables);
+        renderFrame();
+        device.resetDrawCallCount();
+
+        EXPECT_LT(0u, device.getLastFrameStatistics().stateChanges);
+        EXPECT_EQ(0u, device.getLastFrameStatistics().redundantStateChanges);
+    }
+}
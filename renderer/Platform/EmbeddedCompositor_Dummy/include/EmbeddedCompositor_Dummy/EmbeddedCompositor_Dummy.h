@@ -27,7 +27,7 @@ namespace ramses_internal
         virtual StreamTextureSourceIdSet dispatchNewStreamTextureSourceIds() override;
         virtual StreamTextureSourceIdSet dispatchObsoleteStreamTextureSourceIds() override;
         virtual void endFrame(Bool notifyClients) override;
-        virtual UInt32 uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) override;
+        virtual StreamTextureBufferUpdate uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) override;
 
         virtual Bool isContentAvailableForStreamTexture(StreamTextureSourceId streamTextureSourceId) const override;
         virtual UInt64 getNumberOfCommitedFramesForWaylandIviSurfaceSinceBeginningOfTime(WaylandIviSurfaceId waylandSurfaceId) const override;
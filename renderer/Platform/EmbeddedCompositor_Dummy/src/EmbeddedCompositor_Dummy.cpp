@@ -35,12 +35,12 @@ namespace ramses_internal
         LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Dummy::endFrame");
     }
 
-    UInt32 EmbeddedCompositor_Dummy::uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
+    StreamTextureBufferUpdate EmbeddedCompositor_Dummy::uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
     {
         UNUSED(textureUploadingAdapter)
         UNUSED(textureHandle)
         LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Dummy::uploadCompositingContentForStreamTexture: " << streamTextureSourceId.getValue());
-        return 0;
+        return StreamTextureBufferUpdate();
     }
 
     StreamTextureSourceIdSet EmbeddedCompositor_Dummy::dispatchUpdatedStreamTextureSourceIds()
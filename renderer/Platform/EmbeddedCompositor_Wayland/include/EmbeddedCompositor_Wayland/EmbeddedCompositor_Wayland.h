@@ -43,7 +43,7 @@ namespace ramses_internal
         virtual StreamTextureSourceIdSet dispatchNewStreamTextureSourceIds() override;
         virtual StreamTextureSourceIdSet dispatchObsoleteStreamTextureSourceIds() override;
         virtual void endFrame(Bool notifyClients) override;
-        virtual UInt32 uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) override;
+        virtual StreamTextureBufferUpdate uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) override;
 
         virtual Bool isContentAvailableForStreamTexture(StreamTextureSourceId streamTextureSourceId) const override;
 
@@ -76,7 +76,7 @@ namespace ramses_internal
     private:
         IWaylandSurface* findWaylandSurfaceByIviSurfaceId(WaylandIviSurfaceId iviSurfaceId) const;
 
-        void uploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter);
+        UInt32 uploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter);
 
         Bool applyPermissionsGroupToEmbeddedCompositingSocket(const String& embeddedSocketName);
 
@@ -10,6 +10,7 @@
 #define RAMSES_IWAYLANDSURFACE_H
 
 #include "RendererAPI/Types.h"
+#include "SceneAPI/PixelRectangle.h"
 
 namespace ramses_internal
 {
@@ -51,6 +52,8 @@ namespace ramses_internal
         virtual void bufferDestroyed(IWaylandBuffer& buffer) = 0;
         virtual void setIviSurface(IWaylandIVISurface* iviSurface) = 0;
         virtual bool hasIviSurface() const = 0;
+        virtual PixelRectangle getBufferDamage() const = 0;
+        virtual void resetBufferDamage() = 0;
     };
 }
 
@@ -55,8 +55,11 @@ namespace ramses_internal
         virtual void surfaceSetBufferTransform(IWaylandClient& client, int32_t transform) override;
         virtual void surfaceSetBufferScale(IWaylandClient& client, int32_t scale) override;
         virtual void surfaceDamageBuffer(IWaylandClient& client, int32_t x, int32_t y, int32_t width, int32_t height) override;
+        virtual PixelRectangle getBufferDamage() const override;
+        virtual void resetBufferDamage() override;
 
     private:
+        static void AddDamage(PixelRectangle& damage, int32_t x, int32_t y, int32_t width, int32_t height);
         void setBufferToSurface(IWaylandBuffer& buffer);
         void unsetBufferFromSurface();
         void setWaylandBuffer(IWaylandBuffer* buffer);
@@ -85,6 +88,9 @@ namespace ramses_internal
         IEmbeddedCompositor_Wayland& m_compositor;
         UInt64 m_numberOfCommitedFrames = 0;
         UInt64 m_numberOfCommitedFramesSinceBeginningOfTime = 0;
+        // damage requested by client since last commit, and damage of committed buffer(s) since last texture upload
+        PixelRectangle m_pendingDamage = { 0u, 0u, 0, 0 };
+        PixelRectangle m_bufferDamage = { 0u, 0u, 0, 0 };
 
         const struct Surface_Interface : private wl_surface_interface
         {
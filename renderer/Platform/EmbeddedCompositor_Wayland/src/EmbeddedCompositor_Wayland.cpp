@@ -184,7 +184,7 @@ namespace ramses_internal
         m_serverDisplay.flushClients();
     }
 
-    UInt32 EmbeddedCompositor_Wayland::uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
+    StreamTextureBufferUpdate EmbeddedCompositor_Wayland::uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
     {
         assert(InvalidStreamTextureSourceId != streamTextureSourceId);
         IWaylandSurface* waylandClientSurface = findWaylandSurfaceByIviSurfaceId(streamTextureSourceId);
@@ -193,11 +193,13 @@ namespace ramses_internal
         LOG_DEBUG(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::uploadCompositingContentForStreamTexture(): Stream texture with source Id " << streamTextureSourceId.getValue());
         LOG_INFO(CONTEXT_SMOKETEST, "embedded-compositing client surface found for existing streamtexture: " << streamTextureSourceId.getValue());
 
-        uploadCompositingContentForWaylandSurface(waylandClientSurface, textureHandle, textureUploadingAdapter);
-        return waylandClientSurface->getNumberOfCommitedFrames();
+        StreamTextureBufferUpdate bufferUpdate;
+        bufferUpdate.uploadedBytes = uploadCompositingContentForWaylandSurface(waylandClientSurface, textureHandle, textureUploadingAdapter);
+        bufferUpdate.numberOfBufferUpdates = static_cast<UInt32>(waylandClientSurface->getNumberOfCommitedFrames());
+        return bufferUpdate;
     }
 
-    void EmbeddedCompositor_Wayland::uploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
+    UInt32 EmbeddedCompositor_Wayland::uploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
     {
         IWaylandBuffer* waylandBuffer = waylandSurface->getWaylandBuffer();
         assert(nullptr != waylandBuffer);
@@ -206,13 +208,18 @@ namespace ramses_internal
 
         const UInt8* sharedMemoryBufferData = static_cast<const UInt8*>(waylandBufferResource.bufferGetSharedMemoryData());
 
+        // only region damaged by client since last upload is updated, texture keeps the rest of the content
+        const PixelRectangle bufferDamage = waylandSurface->getBufferDamage();
+        waylandSurface->resetBufferDamage();
+
         if (nullptr != sharedMemoryBufferData)
         {
-            textureUploadingAdapter.uploadTexture2D(textureHandle, waylandBufferResource.bufferGetSharedMemoryWidth(), waylandBufferResource.bufferGetSharedMemoryHeight(), ETextureFormat_BGRA8, sharedMemoryBufferData);
+            return textureUploadingAdapter.uploadTexture2D(textureHandle, waylandBufferResource.bufferGetSharedMemoryWidth(), waylandBufferResource.bufferGetSharedMemoryHeight(), ETextureFormat_BGRA8, sharedMemoryBufferData, bufferDamage);
         }
         else
         {
             static_cast<TextureUploadingAdapter_Wayland&>(textureUploadingAdapter).uploadTextureFromWaylandResource(textureHandle, waylandBufferResource.getWaylandNativeResource());
+            return 0u;
         }
     }
 
@@ -17,6 +17,8 @@
 #include "EmbeddedCompositor_Wayland/WaylandBufferResource.h"
 #include "Utils/LogMacros.h"
 #include "Common/Cpp11Macros.h"
+#include <algorithm>
+#include <limits>
 
 namespace ramses_internal
 {
@@ -201,10 +203,9 @@ namespace ramses_internal
         LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamage");
 
         UNUSED(client)
-        UNUSED(x)
-        UNUSED(y)
-        UNUSED(width)
-        UNUSED(height)
+
+        // buffer scale and transform are not supported, surface coordinates are same as buffer coordinates
+        AddDamage(m_pendingDamage, x, y, width, height);
     }
 
     void WaylandSurface::surfaceFrame(IWaylandClient& client, uint32_t id)
@@ -264,6 +265,13 @@ namespace ramses_internal
             LOG_TRACE(CONTEXT_RENDERER,
                       "WaylandSurface::surfaceCommit: new texture data for surface with ivi surface id "
                           << getIviSurfaceId().getValue());
+
+            // first buffer of surface has no previous content to keep, so it is damaged as a whole,
+            // same for clients attaching buffer without any damage
+            if (m_buffer == nullptr || m_pendingDamage.width <= 0 || m_pendingDamage.height <= 0)
+            {
+                AddDamage(m_pendingDamage, 0, 0, std::numeric_limits<Int32>::max(), std::numeric_limits<Int32>::max());
+            }
             setBufferToSurface(*m_pendingBuffer);
             m_pendingBuffer = nullptr;
         }
@@ -279,6 +287,9 @@ namespace ramses_internal
                 unsetBufferFromSurface();
             }
         }
+
+        AddDamage(m_bufferDamage, m_pendingDamage.x, m_pendingDamage.y, m_pendingDamage.width, m_pendingDamage.height);
+        m_pendingDamage = { 0u, 0u, 0, 0 };
         m_removeBufferOnNextCommit = false;
         m_numberOfCommitedFrames++;
         m_numberOfCommitedFramesSinceBeginningOfTime++;
@@ -305,10 +316,43 @@ namespace ramses_internal
         LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamageBuffer");
 
         UNUSED(client)
-        UNUSED(x)
-        UNUSED(y)
-        UNUSED(width)
-        UNUSED(height)
+
+        AddDamage(m_pendingDamage, x, y, width, height);
+    }
+
+    PixelRectangle WaylandSurface::getBufferDamage() const
+    {
+        return m_bufferDamage;
+    }
+
+    void WaylandSurface::resetBufferDamage()
+    {
+        m_bufferDamage = { 0u, 0u, 0, 0 };
+    }
+
+    void WaylandSurface::AddDamage(PixelRectangle& damage, int32_t x, int32_t y, int32_t width, int32_t height)
+    {
+        // damage is tracked as bounding rectangle, parts outside of buffer are clipped when uploading
+        const Int64 left = std::max<Int64>(x, 0);
+        const Int64 top = std::max<Int64>(y, 0);
+        const Int64 right = std::min<Int64>(static_cast<Int64>(x) + width, std::numeric_limits<Int32>::max());
+        const Int64 bottom = std::min<Int64>(static_cast<Int64>(y) + height, std::numeric_limits<Int32>::max());
+        if (right <= left || bottom <= top)
+        {
+            return;
+        }
+
+        if (damage.width <= 0 || damage.height <= 0)
+        {
+            damage = { static_cast<UInt32>(left), static_cast<UInt32>(top), static_cast<Int32>(right - left), static_cast<Int32>(bottom - top) };
+            return;
+        }
+
+        const Int64 unitedLeft = std::min<Int64>(left, damage.x);
+        const Int64 unitedTop = std::min<Int64>(top, damage.y);
+        const Int64 unitedRight = std::max<Int64>(right, static_cast<Int64>(damage.x) + damage.width);
+        const Int64 unitedBottom = std::max<Int64>(bottom, static_cast<Int64>(damage.y) + damage.height);
+        damage = { static_cast<UInt32>(unitedLeft), static_cast<UInt32>(unitedTop), static_cast<Int32>(unitedRight - unitedLeft), static_cast<Int32>(unitedBottom - unitedTop) };
     }
 
     void WaylandSurface::SurfaceDestroyCallback(wl_client* client, wl_resource* surfaceResource)
@@ -47,6 +47,8 @@ namespace ramses_internal
         MOCK_METHOD1(bufferDestroyed, void(IWaylandBuffer& buffer));
         MOCK_METHOD1(setIviSurface, void(IWaylandIVISurface* iviSurface));
         MOCK_CONST_METHOD0(hasIviSurface, bool());
+        MOCK_CONST_METHOD0(getBufferDamage, PixelRectangle());
+        MOCK_METHOD0(resetBufferDamage, void());
     };
 }
 
@@ -17,6 +17,7 @@
 #include "WaylandIVISurfaceMock.h"
 #include "WaylandBufferMock.h"
 #include "EmbeddedCompositor_WaylandMock.h"
+#include <limits>
 
 
 namespace ramses_internal
@@ -621,4 +622,80 @@ namespace ramses_internal
         EXPECT_CALL(*m_surfaceResource, setImplementation(_, m_waylandSurface, nullptr));
         deleteWaylandSurface();
     }
+
+    TEST_F(AWaylandSurface, HasWholeBufferDamagedAfterFirstBufferCommitted)
+    {
+        createWaylandSurface();
+        EXPECT_EQ(0, m_waylandSurface->getBufferDamage().width);
+
+        attachCommitBuffer();
+
+        const PixelRectangle damage = m_waylandSurface->getBufferDamage();
+        EXPECT_EQ(0u, damage.x);
+        EXPECT_EQ(0u, damage.y);
+        EXPECT_EQ(std::numeric_limits<Int32>::max(), damage.width);
+        EXPECT_EQ(std::numeric_limits<Int32>::max(), damage.height);
+
+        m_waylandSurface->resetBufferDamage();
+        EXPECT_EQ(0, m_waylandSurface->getBufferDamage().width);
+        EXPECT_EQ(0, m_waylandSurface->getBufferDamage().height);
+
+        EXPECT_CALL(m_waylandBuffer1, release());
+        EXPECT_CALL(m_compositor, removeWaylandSurface(Ref(*m_waylandSurface)));
+        EXPECT_CALL(*m_surfaceResource, setImplementation(_, m_waylandSurface, nullptr));
+        deleteWaylandSurface();
+    }
+
+    TEST_F(AWaylandSurface, AccumulatesDamageOfCommitsUntilReset)
+    {
+        createWaylandSurface();
+        attachCommitBuffer();
+        m_waylandSurface->resetBufferDamage();
+
+        WaylandBufferResourceMock bufferResource;
+        EXPECT_CALL(m_compositor, getOrCreateBuffer(Ref(bufferResource))).WillOnce(ReturnRef(m_waylandBuffer2));
+        m_waylandSurface->surfaceAttach(m_client, bufferResource, 0, 0);
+        m_waylandSurface->surfaceDamage(m_client, 10, 10, 20, 20);
+        EXPECT_EQ(0, m_waylandSurface->getBufferDamage().width);
+
+        EXPECT_CALL(m_waylandBuffer2, reference());
+        EXPECT_CALL(m_waylandBuffer1, release());
+        m_waylandSurface->surfaceCommit(m_client);
+
+        m_waylandSurface->surfaceDamageBuffer(m_client, 5, 50, 10, 10);
+        m_waylandSurface->surfaceCommit(m_client);
+
+        const PixelRectangle damage = m_waylandSurface->getBufferDamage();
+        EXPECT_EQ(5u, damage.x);
+        EXPECT_EQ(10u, damage.y);
+        EXPECT_EQ(25, damage.width);
+        EXPECT_EQ(50, damage.height);
+
+        EXPECT_CALL(m_waylandBuffer2, release());
+        EXPECT_CALL(m_compositor, removeWaylandSurface(Ref(*m_waylandSurface)));
+        EXPECT_CALL(*m_surfaceResource, setImplementation(_, m_waylandSurface, nullptr));
+        deleteWaylandSurface();
+    }
+
+    TEST_F(AWaylandSurface, ClipsDamageWithNegativeOffset)
+    {
+        createWaylandSurface();
+        attachCommitBuffer();
+        m_waylandSurface->resetBufferDamage();
+
+        m_waylandSurface->surfaceDamage(m_client, -10, -20, 30, 40);
+        m_waylandSurface->surfaceDamage(m_client, 5, 5, -1, 10);
+        m_waylandSurface->surfaceCommit(m_client);
+
+        const PixelRectangle damage = m_waylandSurface->getBufferDamage();
+        EXPECT_EQ(0u, damage.x);
+        EXPECT_EQ(0u, damage.y);
+        EXPECT_EQ(20, damage.width);
+        EXPECT_EQ(20, damage.height);
+
+        EXPECT_CALL(m_waylandBuffer1, release());
+        EXPECT_CALL(m_compositor, removeWaylandSurface(Ref(*m_waylandSurface)));
+        EXPECT_CALL(*m_surfaceResource, setImplementation(_, m_waylandSurface, nullptr));
+        deleteWaylandSurface();
+    }
 }
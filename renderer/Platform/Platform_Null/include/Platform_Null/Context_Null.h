@@ -0,0 +1,25 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_CONTEXT_NULL_H
+#define RAMSES_CONTEXT_NULL_H
+
+#include "Platform_Base/Context_Base.h"
+
+namespace ramses_internal
+{
+    class Context_Null : public Context_Base
+    {
+    public:
+        Bool init();
+
+        void* getProcAddress(const Char* name) const override final;
+    };
+}
+
+#endif
@@ -0,0 +1,36 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PLATFORM_NULL_H
+#define RAMSES_PLATFORM_NULL_H
+
+#include "Platform_Base/PlatformFactory_Base.h"
+
+namespace ramses_internal
+{
+    // Headless platform without any window system or graphics API, creates Device_Null or Device_Recording
+    // if a device trace file is configured. Meant for CPU-side renderer benchmarks and tests on machines without GPU.
+    class Platform_Null : public PlatformFactory_Base
+    {
+    public:
+        explicit Platform_Null(const RendererConfig& rendererConfig);
+
+    protected:
+        ISystemCompositorController* createSystemCompositorController() override final;
+        IWindow*                createWindow(const DisplayConfig& displayConfig, IWindowEventHandler& windowEventHandler) override final;
+        IContext*               createContext(IWindow& window) override final;
+        ISurface*               createSurface(IWindow& window, IContext& context) override final;
+        IDevice*                createDevice(IContext& context) override final;
+        IEmbeddedCompositor*    createEmbeddedCompositor() override final;
+
+    private:
+        UInt32 m_deviceCounter = 0u;
+    };
+}
+
+#endif
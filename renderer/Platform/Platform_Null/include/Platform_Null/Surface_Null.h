@@ -0,0 +1,30 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SURFACE_NULL_H
+#define RAMSES_SURFACE_NULL_H
+
+#include "Platform_Base/Surface_Base.h"
+
+namespace ramses_internal
+{
+    class Window_Null;
+    class Context_Null;
+
+    class Surface_Null : public Surface_Base
+    {
+    public:
+        Surface_Null(Window_Null& window, Context_Null& context);
+
+        Bool enable() override final;
+        Bool disable() override final;
+        Bool swapBuffers() override final;
+    };
+}
+
+#endif
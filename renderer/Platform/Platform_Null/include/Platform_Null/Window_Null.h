@@ -0,0 +1,29 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_WINDOW_NULL_H
+#define RAMSES_WINDOW_NULL_H
+
+#include "Platform_Base/Window_Base.h"
+
+namespace ramses_internal
+{
+    class Window_Null : public Window_Base
+    {
+    public:
+        Window_Null(const DisplayConfig& displayConfig, IWindowEventHandler& windowEventHandler, UInt32 id);
+
+        Bool init();
+
+        Bool setFullscreen(Bool fullscreen) override final;
+        void handleEvents() override final;
+        bool hasTitle() const override final;
+    };
+}
+
+#endif
@@ -0,0 +1,23 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Platform_Null/Context_Null.h"
+
+namespace ramses_internal
+{
+    Bool Context_Null::init()
+    {
+        return true;
+    }
+
+    void* Context_Null::getProcAddress(const Char* name) const
+    {
+        UNUSED(name);
+        return nullptr;
+    }
+}
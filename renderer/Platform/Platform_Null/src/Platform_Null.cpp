@@ -0,0 +1,86 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Platform_Null/Platform_Null.h"
+#include "Platform_Null/Window_Null.h"
+#include "Platform_Null/Context_Null.h"
+#include "Platform_Null/Surface_Null.h"
+#include "Device_Null/Device_Null.h"
+#include "Device_Null/Device_Recording.h"
+#include "EmbeddedCompositor_Dummy/EmbeddedCompositor_Dummy.h"
+#include "RendererLib/RendererConfig.h"
+#include "Collections/StringOutputStream.h"
+
+namespace ramses_internal
+{
+    IPlatformFactory* PlatformFactory_Base::CreatePlatformFactory(const RendererConfig& rendererConfig)
+    {
+        return new Platform_Null(rendererConfig);
+    }
+
+    Platform_Null::Platform_Null(const RendererConfig& rendererConfig)
+        : PlatformFactory_Base(rendererConfig)
+    {
+    }
+
+    ISystemCompositorController* Platform_Null::createSystemCompositorController()
+    {
+        return nullptr;
+    }
+
+    IWindow* Platform_Null::createWindow(const DisplayConfig& displayConfig, IWindowEventHandler& windowEventHandler)
+    {
+        Window_Null* platformWindow = new Window_Null(displayConfig, windowEventHandler, m_windows.size());
+        return addPlatformWindow(platformWindow);
+    }
+
+    IContext* Platform_Null::createContext(IWindow& window)
+    {
+        UNUSED(window);
+        Context_Null* platformContext = new Context_Null();
+        return addPlatformContext(platformContext);
+    }
+
+    ISurface* Platform_Null::createSurface(IWindow& window, IContext& context)
+    {
+        Window_Null* platformWindow = getPlatformWindow<Window_Null>(window);
+        Context_Null* platformContext = getPlatformContext<Context_Null>(context);
+        assert(0 != platformWindow);
+        assert(0 != platformContext);
+        Surface_Null* platformSurface = new Surface_Null(*platformWindow, *platformContext);
+        return addPlatformSurface(platformSurface);
+    }
+
+    IDevice* Platform_Null::createDevice(IContext& context)
+    {
+        Context_Null* platformContext = getPlatformContext<Context_Null>(context);
+        assert(0 != platformContext);
+
+        const String& traceFileName = m_rendererConfig.getDeviceTraceFileName();
+        const UInt32 deviceIndex = m_deviceCounter++;
+        if (traceFileName.empty())
+        {
+            Device_Null* device = new Device_Null(*platformContext);
+            return addPlatformDevice(device);
+        }
+
+        // every further display records into its own trace file
+        StringOutputStream deviceTraceFileName;
+        deviceTraceFileName << traceFileName;
+        if (deviceIndex > 0u)
+            deviceTraceFileName << "_" << deviceIndex;
+        Device_Recording* device = new Device_Recording(*platformContext, deviceTraceFileName.release());
+        return addPlatformDevice(device);
+    }
+
+    IEmbeddedCompositor* Platform_Null::createEmbeddedCompositor()
+    {
+        EmbeddedCompositor_Dummy* compositor = new EmbeddedCompositor_Dummy();
+        return addEmbeddedCompositor(compositor);
+    }
+}
@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Platform_Null/Surface_Null.h"
+#include "Platform_Null/Window_Null.h"
+#include "Platform_Null/Context_Null.h"
+
+namespace ramses_internal
+{
+    Surface_Null::Surface_Null(Window_Null& window, Context_Null& context)
+        : Surface_Base(window, context)
+    {
+    }
+
+    Bool Surface_Null::enable()
+    {
+        return true;
+    }
+
+    Bool Surface_Null::disable()
+    {
+        return true;
+    }
+
+    Bool Surface_Null::swapBuffers()
+    {
+        return true;
+    }
+}
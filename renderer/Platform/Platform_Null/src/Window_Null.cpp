@@ -0,0 +1,37 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Platform_Null/Window_Null.h"
+
+namespace ramses_internal
+{
+    Window_Null::Window_Null(const DisplayConfig& displayConfig, IWindowEventHandler& windowEventHandler, UInt32 id)
+        : Window_Base(displayConfig, windowEventHandler, id)
+    {
+    }
+
+    Bool Window_Null::init()
+    {
+        return true;
+    }
+
+    Bool Window_Null::setFullscreen(Bool fullscreen)
+    {
+        UNUSED(fullscreen);
+        return true;
+    }
+
+    void Window_Null::handleEvents()
+    {
+    }
+
+    bool Window_Null::hasTitle() const
+    {
+        return false;
+    }
+}
@@ -23,6 +23,8 @@ namespace ramses_internal
         ~Surface_Android_EGL() final;
 
         Bool swapBuffers() override final;
+        Bool swapBuffersWithDamage(const Viewport& damagedRegion) override final;
+        UInt32 getBufferAge() const override final;
         Bool enable() override final;
         Bool disable() override final;
     private:
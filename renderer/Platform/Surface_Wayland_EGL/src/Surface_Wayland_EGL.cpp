@@ -31,6 +31,16 @@ namespace ramses_internal
         return m_context.swapBuffers();
     }
 
+    Bool Surface_Wayland_EGL::swapBuffersWithDamage(const Viewport& damagedRegion)
+    {
+        return m_context.swapBuffersWithDamage(damagedRegion);
+    }
+
+    UInt32 Surface_Wayland_EGL::getBufferAge() const
+    {
+        return m_context.getBufferAge();
+    }
+
     Bool Surface_Wayland_EGL::enable()
     {
         return m_context.enable();
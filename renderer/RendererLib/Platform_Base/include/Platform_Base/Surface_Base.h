@@ -22,6 +22,8 @@ namespace ramses_internal
     public:
         Surface_Base(Window_Base& window, Context_Base& context);
 
+        Bool swapBuffersWithDamage(const Viewport& damagedRegion) override;
+        UInt32 getBufferAge() const override;
         Bool canRenderNewFrame() const override;
         void frameRendered() override;
 
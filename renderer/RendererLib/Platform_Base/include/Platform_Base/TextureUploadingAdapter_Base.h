@@ -19,7 +19,7 @@ namespace ramses_internal
     {
     public:
         TextureUploadingAdapter_Base(IDevice& device);
-        virtual void uploadTexture2D(DeviceResourceHandle textureHandle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) override;
+        virtual UInt32 uploadTexture2D(DeviceResourceHandle textureHandle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion) override;
 
     protected:
         IDevice& m_device;
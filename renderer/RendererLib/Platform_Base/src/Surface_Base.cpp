@@ -18,6 +18,16 @@ namespace ramses_internal
     {
     }
 
+    Bool Surface_Base::swapBuffersWithDamage(const Viewport&)
+    {
+        return swapBuffers();
+    }
+
+    UInt32 Surface_Base::getBufferAge() const
+    {
+        return 0u;
+    }
+
     Bool Surface_Base::canRenderNewFrame() const
     {
         return m_window.canRenderNewFrame();
@@ -16,8 +16,8 @@ namespace ramses_internal
     {
     }
 
-    void TextureUploadingAdapter_Base::uploadTexture2D(DeviceResourceHandle textureHandle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data)
+    UInt32 TextureUploadingAdapter_Base::uploadTexture2D(DeviceResourceHandle textureHandle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion)
     {
-        m_device.uploadStreamTexture2D(textureHandle, width, height, format, data);
+        return m_device.updateStreamTexture2D(textureHandle, width, height, format, data, updatedRegion);
     }
 }
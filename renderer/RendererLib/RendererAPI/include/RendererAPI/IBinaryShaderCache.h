@@ -10,6 +10,7 @@
 #define RAMSES_IBINARYSHADERCACHE_H
 
 #include "SceneAPI/ResourceContentHash.h"
+#include "Collections/String.h"
 
 namespace ramses_internal
 {
@@ -27,6 +28,9 @@ namespace ramses_internal
 
         virtual void storeBinaryShader(ResourceContentHash effectHash, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat) = 0;
         virtual void binaryShaderUploaded(ResourceContentHash effectHash, Bool success) const = 0;
+
+        // called for every device created, before any shader is uploaded to it
+        virtual void deviceInitialized(const String& driverIdentification) = 0;
     };
 }
 
@@ -46,6 +46,8 @@ namespace ramses_internal
         virtual ~IDevice() {}
 
         virtual EDeviceTypeId                getDeviceTypeId() const = 0;
+        // identifies GPU and driver version, binary shaders of one driver cannot be used with another
+        virtual String                       getDriverIdentification() const = 0;
 
         // data
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Float*      value) = 0;
@@ -85,13 +87,17 @@ namespace ramses_internal
         virtual void setTextureSampling  (DataFieldHandle field, EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod sampling, UInt32 anisotropyLevel) = 0;
 
         // resources
+        // stream*BufferData variants are meant for frequently updated buffers, they upload into fresh buffer storage
+        // (orphaning the storage GPU might still read from) instead of synchronizing with pending draws
         virtual DeviceResourceHandle    allocateVertexBuffer        (EDataType dataType, UInt32 sizeInBytes) = 0;
         virtual void                    uploadVertexBufferData      (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) = 0;
+        virtual void                    streamVertexBufferData      (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) = 0;
         virtual void                    deleteVertexBuffer          (DeviceResourceHandle handle) = 0;
         virtual void                    activateVertexBuffer        (DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor) = 0;
 
         virtual DeviceResourceHandle    allocateIndexBuffer         (EDataType dataType, UInt32 sizeInBytes) = 0;
         virtual void                    uploadIndexBufferData       (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) = 0;
+        virtual void                    streamIndexBufferData       (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) = 0;
         virtual void                    deleteIndexBuffer           (DeviceResourceHandle handle) = 0;
         virtual void                    activateIndexBuffer         (DeviceResourceHandle handle) = 0;
 
@@ -106,8 +112,11 @@ namespace ramses_internal
         virtual DeviceResourceHandle    allocateTextureCube         (UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) = 0;
         virtual void                    bindTexture                 (DeviceResourceHandle handle) = 0;
         virtual void                    generateMipmaps             (DeviceResourceHandle handle) = 0;
+        virtual void                    setTextureBaseMipLevel      (DeviceResourceHandle handle, UInt32 baseMipLevel) = 0;
         virtual void                    uploadTextureData           (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) = 0;
         virtual DeviceResourceHandle    uploadStreamTexture2D       (DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) = 0;
+        // uploads only updated region of stream texture content if texture storage matches size and format, returns number of uploaded bytes
+        virtual UInt32                  updateStreamTexture2D       (DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion) = 0;
         virtual void                    deleteTexture               (DeviceResourceHandle handle) = 0;
         virtual void                    activateTexture             (DeviceResourceHandle handle, DataFieldHandle field) = 0;
 
@@ -134,6 +143,22 @@ namespace ramses_internal
         // read back data, statistics, info
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) = 0;
 
+        // asynchronous read back of RGBA8 pixels from currently active render target, started read back is copied
+        // into device owned storage without stalling, finishing it waits for copy if not done yet and releases the storage,
+        // returns false if pixels could not be read
+        virtual DeviceResourceHandle    startReadPixels             (UInt32 x, UInt32 y, UInt32 width, UInt32 height) = 0;
+        virtual Bool                    isReadPixelsFinished        (DeviceResourceHandle handle) = 0;
+        virtual Bool                    finishReadPixels            (DeviceResourceHandle handle, UInt8* buffer) = 0;
+
+        // GPU timestamp queries, timestamp is taken once GPU finished all previously issued commands, its value in nanoseconds
+        // can be read without stalling once available, reading it releases the query; invalid handle is returned if not supported.
+        // Disjoint means that timer results may be invalid (e.g. GPU frequency changed) since last check, results of timestamps
+        // written before must be discarded then; the check resets the disjoint state
+        virtual DeviceResourceHandle    writeGpuTimestamp           () = 0;
+        virtual Bool                    isGpuTimestampAvailable     (DeviceResourceHandle handle) = 0;
+        virtual UInt64                  finishGpuTimestamp          (DeviceResourceHandle handle) = 0;
+        virtual Bool                    isGpuTimerDisjoint          () = 0;
+
         virtual UInt32  getTotalGpuMemoryUsageInKB() const = 0;
         virtual UInt32  getDrawCallCount() const = 0;
         virtual void    resetDrawCallCount() = 0;
@@ -24,6 +24,7 @@ namespace ramses_internal
     class WarpingMeshData;
     class ProjectionParams;
     class FrameTimer;
+    class GpuTimerQueries;
 
     class IDisplayController
     {
@@ -33,8 +34,14 @@ namespace ramses_internal
         virtual void                    handleWindowEvents() = 0;
         virtual Bool                    canRenderNewFrame() const = 0;
         virtual void                    enableContext() = 0;
+        virtual void                    disableContext() = 0;
         virtual void                    swapBuffers() = 0;
-        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr) = 0;
+        virtual void                    swapBuffersWithDamage(const Viewport& damagedRegion) = 0;
+        // number of frames since display buffer content was rendered, 0 if its content is undefined
+        virtual UInt32                  getDisplayBufferAge() const = 0;
+        // while enabled, all rendering and clearing of display buffer is limited to the region, other buffers are not affected
+        virtual void                    setDisplayBufferScissorRegion(Bool enabled, const Viewport& region) = 0;
+        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, GpuTimerQueries* gpuTimerQueries = nullptr) = 0;
         virtual void                    executePostProcessing() = 0;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, const Vector4& clearColor) = 0;
 
@@ -54,6 +61,10 @@ namespace ramses_internal
         virtual void                    resetView() const = 0;
 
         virtual Bool                    readPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height, Vector<UInt8>& dataOut) = 0;
+        // asynchronous variant of readPixels, returns invalid handle if requested area is out of display boundaries
+        virtual DeviceResourceHandle    startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) = 0;
+        virtual Bool                    isReadPixelsFinished(DeviceResourceHandle readPixelsHandle) = 0;
+        virtual Bool                    finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, Vector<UInt8>& dataOut) = 0;
         virtual Bool                    isWarpingEnabled() const = 0;
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) = 0;
 
@@ -19,7 +19,7 @@ namespace ramses_internal
     using SceneStreamTextures = HashMap<SceneId, StreamTextureHandleVector>;
     using UpdatedSceneIdSet = HashSet<SceneId>;
 
-    using StreamTextureBufferUpdates = HashMap<StreamTextureSourceId, UInt32>;
+    using StreamTextureBufferUpdates = HashMap<StreamTextureSourceId, StreamTextureBufferUpdate>;
 
     class IEmbeddedCompositingManager
     {
@@ -31,7 +31,7 @@ namespace ramses_internal
         virtual StreamTextureSourceIdSet dispatchNewStreamTextureSourceIds() = 0;
         virtual StreamTextureSourceIdSet dispatchObsoleteStreamTextureSourceIds() = 0;
         virtual void endFrame(Bool notifyClients) = 0;
-        virtual UInt32 uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) = 0;
+        virtual StreamTextureBufferUpdate uploadCompositingContentForStreamTexture(StreamTextureSourceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) = 0;
 
         virtual Bool isContentAvailableForStreamTexture(StreamTextureSourceId streamTextureSourceId) const = 0;
         virtual UInt64 getNumberOfCommitedFramesForWaylandIviSurfaceSinceBeginningOfTime(WaylandIviSurfaceId waylandSurfaceId) const = 0;
@@ -15,6 +15,7 @@ namespace ramses_internal
 {
     class IWindow;
     class IContext;
+    struct Viewport;
 
     class ISurface
     {
@@ -24,6 +25,10 @@ namespace ramses_internal
         virtual Bool enable() = 0;
         virtual Bool disable() = 0;
         virtual Bool swapBuffers() = 0;
+        // only given region changed since previous frame, origin is bottom left corner
+        virtual Bool swapBuffersWithDamage(const Viewport& damagedRegion) = 0;
+        // number of frames since the current back buffer was rendered, 0 if its content is undefined
+        virtual UInt32 getBufferAge() const = 0;
         virtual Bool canRenderNewFrame() const = 0;
         virtual void frameRendered() = 0;
 
@@ -15,11 +15,14 @@
 
 namespace ramses_internal
 {
+    struct PixelRectangle;
+
     class ITextureUploadingAdapter
     {
     public:
         virtual ~ITextureUploadingAdapter() {}
-        virtual void uploadTexture2D(DeviceResourceHandle textureHandle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) = 0;
+        // returns number of uploaded bytes
+        virtual UInt32 uploadTexture2D(DeviceResourceHandle textureHandle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion) = 0;
     };
 }
 
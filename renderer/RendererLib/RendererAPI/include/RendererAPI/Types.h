@@ -27,6 +27,12 @@ namespace ramses_internal
         EAntiAliasingMethod_FXAA
     };
 
+    enum EGPUMemoryCachePolicy
+    {
+        EGPUMemoryCachePolicy_LeastRecentlyUsed = 0,
+        EGPUMemoryCachePolicy_CostAware
+    };
+
     enum EPostProcessingEffect
     {
         EPostProcessingEffect_None = 0,
@@ -60,6 +66,12 @@ namespace ramses_internal
     typedef HashSet<StreamTextureSourceId> StreamTextureSourceIdSet;
     typedef Vector<StreamTextureSourceId> StreamTextureSourceIdVector;
 
+    struct StreamTextureBufferUpdate
+    {
+        UInt32 numberOfBufferUpdates = 0u;
+        UInt32 uploadedBytes = 0u;
+    };
+
     // TODO Violin this needs removing - no need for two types for stream texture id...
     typedef StreamTextureSourceId WaylandIviSurfaceId;
     static const WaylandIviSurfaceId InvalidWaylandIviSurfaceId(0xFFFFFFFF);
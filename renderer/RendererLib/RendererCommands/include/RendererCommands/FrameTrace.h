@@ -0,0 +1,29 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMETRACE_H
+#define RAMSES_FRAMETRACE_H
+
+#include "Ramsh/RamshCommand.h"
+
+namespace ramses_internal
+{
+    class RendererCommandBuffer;
+
+    class FrameTrace : public RamshCommand
+    {
+    public:
+        explicit FrameTrace(RendererCommandBuffer& rendererCommandBuffer);
+        virtual Bool executeInput(const RamshInput& input) override;
+
+    private:
+        RendererCommandBuffer& m_rendererCommandBuffer;
+    };
+}
+
+#endif
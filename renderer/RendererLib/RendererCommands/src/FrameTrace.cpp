@@ -0,0 +1,112 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererCommands/FrameTrace.h"
+#include "RendererLib/RendererCommandBuffer.h"
+#include "Ramsh/RamshInput.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    FrameTrace::FrameTrace(RendererCommandBuffer& rendererCommandBuffer)
+        : m_rendererCommandBuffer(rendererCommandBuffer)
+    {
+        description = "Usage: [ -on (start capture), -off (stop capture), -spike (frame time threshold in us for automatic dump, uint64, optional, 0 = off), "
+            "-prefix (file prefix for automatic dumps, optional), -dump (file name, dump captured events now) ] - Capture frame profiler regions and renderer events as Chrome trace JSON";
+        registerKeyword("frameTrace");
+        registerKeyword("ft");
+    }
+
+    Bool FrameTrace::executeInput(const RamshInput& input)
+    {
+        enum EOption
+        {
+            EOption_None = 0,
+            EOption_SpikeThreshold,
+            EOption_FilePrefix,
+            EOption_DumpFileName
+        };
+
+        EOption lastOption = EOption_None;
+
+        Bool enable = false;
+        Bool disable = false;
+        UInt64 spikeThreshold = 0u;
+        String filePrefix = "frametrace";
+        String dumpFileName;
+
+        const UInt32 numArgs = static_cast<UInt32>(input.size());
+        for (UInt argStrIdx = 0u; argStrIdx < numArgs; ++argStrIdx)
+        {
+            const String argStr(input[argStrIdx]);
+
+            if (argStr == String("-on"))
+            {
+                enable = true;
+            }
+            else if (argStr == String("-off"))
+            {
+                disable = true;
+            }
+            else if (argStr == String("-spike"))
+            {
+                lastOption = EOption_SpikeThreshold;
+            }
+            else if (argStr == String("-prefix"))
+            {
+                lastOption = EOption_FilePrefix;
+            }
+            else if (argStr == String("-dump"))
+            {
+                lastOption = EOption_DumpFileName;
+            }
+            else
+            {
+                switch (lastOption)
+                {
+                case EOption_SpikeThreshold:
+                    spikeThreshold = static_cast<UInt64>(atoll(argStr.c_str()));
+                    enable = true;
+                    lastOption = EOption_None;
+                    break;
+                case EOption_FilePrefix:
+                    filePrefix = argStr;
+                    lastOption = EOption_None;
+                    break;
+                case EOption_DumpFileName:
+                    dumpFileName = argStr;
+                    lastOption = EOption_None;
+                    break;
+                case EOption_None:
+                    if (m_keywords.contains(argStr)) // check whether a keyword is the current argument
+                    {
+                        continue;
+                    }
+                    return false;
+                default:
+                    return false;
+                }
+            }
+        }
+
+        if (enable && disable)
+        {
+            LOG_WARN(CONTEXT_RAMSH, "FrameTrace: -on and -off can not be combined");
+            return false;
+        }
+
+        // dump before disabling so that '-dump file -off' stores the capture before it is discarded
+        if (dumpFileName.getLength() > 0u)
+            m_rendererCommandBuffer.dumpFrameProfilerTrace(dumpFileName);
+
+        if (enable || disable)
+            m_rendererCommandBuffer.setFrameProfilerTraceCapture(enable, spikeThreshold, filePrefix);
+
+        return true;
+    }
+}
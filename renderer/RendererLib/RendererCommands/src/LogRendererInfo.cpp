@@ -24,7 +24,7 @@ namespace ramses_internal
         getArgument<1>().setDefaultValue(false);
         getArgument<2>().setDefaultValue(NodeHandle::Invalid().asMemoryHandle());
 
-        getArgument<0>().setDescription("topic (display|scene|stream|res|queue|links|ec|events|all)");
+        getArgument<0>().setDescription("topic (display|scene|stream|res|queue|links|ec|events|latency|all)");
         getArgument<1>().setDescription("verbose mode");
         getArgument<2>().setDescription("node Id filter");
 
@@ -77,6 +77,10 @@ namespace ramses_internal
         {
             return ERendererLogTopic_EventQueue;
         }
+        if (topicName == String("latency"))
+        {
+            return ERendererLogTopic_SceneLatencies;
+        }
         if (topicName == String("all"))
         {
             return ERendererLogTopic_All;
@@ -41,7 +41,7 @@ namespace ramses_internal
         virtual ~RendererFrameworkLogic();
 
         // ISceneRendererServiceHandler
-        virtual void handleInitializeScene(const SceneInfo& sceneInfo, const Guid& providerID) override;
+        virtual void handleInitializeScene(const SceneInfo& sceneInfo, const Guid& providerID, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush) override;
         virtual void handleSceneNotAvailable(const SceneId& sceneId, const Guid& providerID) override;
         virtual void handleSceneActionList(const SceneId& sceneId, SceneActionCollection&& actions, const uint64_t& counter, const Guid& providerID) override;
         virtual void handleNewScenesAvailable(const SceneInfoVector& newScenes, const Guid& providerID) override;
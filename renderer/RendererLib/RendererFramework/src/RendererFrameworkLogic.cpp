@@ -80,16 +80,16 @@ namespace ramses_internal
         }
     }
 
-    void RendererFrameworkLogic::handleInitializeScene(const SceneInfo& sceneInfo, const Guid& providerID)
+    void RendererFrameworkLogic::handleInitializeScene(const SceneInfo& sceneInfo, const Guid& providerID, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush)
     {
         LOG_INFO(CONTEXT_RENDERER, "RendererFrameworkLogic::handleInitializeScene:  scene: from:" << providerID <<
-            " id:" << sceneInfo.sceneID.getValue() << " (" << sceneInfo.friendlyName << ")");
+            " id:" << sceneInfo.sceneID.getValue() << " (" << sceneInfo.friendlyName << ") epoch:" << sceneInstanceEpoch << " delta:" << deltaSinceLastAppliedFlush);
 
         // ensure clean state
         m_lastReceivedListCounter.erase(sceneInfo.sceneID);
         m_bufferedSceneActionsPerScene.erase(sceneInfo.sceneID);
 
-        m_rendererCommands.receiveScene(sceneInfo);
+        m_rendererCommands.receiveScene(sceneInfo, sceneInstanceEpoch, deltaSinceLastAppliedFlush);
     }
 
     void RendererFrameworkLogic::handleSceneNotAvailable(const SceneId& sceneId, const Guid& providerID)
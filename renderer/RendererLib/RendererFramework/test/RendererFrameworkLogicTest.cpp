@@ -76,7 +76,7 @@ namespace ramses_internal
 
     TEST_F(ARendererFrameworkLogic, generatesReceiveRendererCommand)
     {
-        fixture.handleInitializeScene(SceneInfo(sceneId, sceneName), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId, sceneName), providerID, Guid(), false);
         expectSceneCommand(ERendererCommand_ReceivedScene);
     }
 
@@ -261,7 +261,7 @@ namespace ramses_internal
         SceneInfoVector newScenes;
         newScenes.push_back(SceneInfo(sceneId, sceneName));
         fixture.handleNewScenesAvailable(newScenes, providerID);
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
         rendererCommandBuffer.clear();
 
         // send one correct/normal list
@@ -285,7 +285,7 @@ namespace ramses_internal
         SceneInfoVector newScenes;
         newScenes.push_back(SceneInfo(sceneId, sceneName));
         fixture.handleNewScenesAvailable(newScenes, providerID);
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
 
         rendererCommandBuffer.clear();
 
@@ -297,7 +297,7 @@ namespace ramses_internal
         ASSERT_EQ(1u, commandsAfterFirstList.getTotalCommandCount());
         EXPECT_EQ(ERendererCommand_SceneActions, commandsAfterFirstList.getCommandType(0u));
 
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
         rendererCommandBuffer.clear();
         fixture.handleSceneActionList(sceneId, actions.copy(), 1u, providerID);
 
@@ -311,7 +311,7 @@ namespace ramses_internal
         SceneInfoVector newScenes;
         newScenes.push_back(SceneInfo(sceneId, sceneName));
         fixture.handleNewScenesAvailable(newScenes, providerID);
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
 
         rendererCommandBuffer.clear();
 
@@ -325,7 +325,7 @@ namespace ramses_internal
 
         fixture.handleScenesBecameUnavailable({ SceneInfo(sceneId) }, providerID);
         fixture.handleNewScenesAvailable(newScenes, providerID);
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
 
         rendererCommandBuffer.clear();
         fixture.handleSceneActionList(sceneId, actions.copy(), 1u, providerID);
@@ -341,7 +341,7 @@ namespace ramses_internal
         SceneInfoVector newScenes;
         newScenes.push_back(SceneInfo(sceneId, sceneName));
         fixture.handleNewScenesAvailable(newScenes, providerID);
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
         rendererCommandBuffer.clear();
 
         // send one correct/normal list
@@ -352,7 +352,7 @@ namespace ramses_internal
         ASSERT_EQ(1u, commandsAfterNormalList.getTotalCommandCount());
         EXPECT_EQ(ERendererCommand_SceneActions, commandsAfterNormalList.getCommandType(0u));
 
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
         rendererCommandBuffer.clear();
 
         // send list with mismatched counter value
@@ -370,7 +370,7 @@ namespace ramses_internal
         SceneInfoVector newScenes;
         newScenes.push_back(SceneInfo(sceneId, sceneName));
         fixture.handleNewScenesAvailable(newScenes, providerID);
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
         rendererCommandBuffer.clear();
 
         // send one correct/normal list
@@ -389,7 +389,7 @@ namespace ramses_internal
 
         fixture.newParticipantHasConnected(providerID);
         fixture.handleNewScenesAvailable(newScenes, providerID);
-        fixture.handleInitializeScene(SceneInfo(sceneId), providerID);
+        fixture.handleInitializeScene(SceneInfo(sceneId), providerID, Guid(), false);
         rendererCommandBuffer.clear();
 
         fixture.handleSceneActionList(sceneId, actions.copy(), 1u, providerID);
@@ -17,16 +17,19 @@ namespace ramses_internal
 {
     struct FrameBufferInfo
     {
-        FrameBufferInfo(DeviceResourceHandle devHandle, const ProjectionParams& projParams, const Viewport& vport)
+        FrameBufferInfo(DeviceResourceHandle devHandle, const ProjectionParams& projParams, const Viewport& vport, Bool scissor = false)
             : deviceHandle(devHandle)
             , projectionParams(projParams)
             , viewport(vport)
+            , scissorEnabled(scissor)
         {
         }
 
         DeviceResourceHandle deviceHandle;
         ProjectionParams     projectionParams;
         Viewport             viewport;
+        // scissor region is set on device, test must be enabled only while rendering to this buffer
+        Bool                 scissorEnabled;
     };
 }
 
@@ -12,17 +12,20 @@
 #include "RenderExecutorInternalState.h"
 #include "SceneAPI/EDataType.h"
 #include "SceneAPI/EFixedSemantics.h"
+#include "SceneAPI/SceneTypes.h"
+#include <vector>
 
 namespace ramses_internal
 {
     class IDevice;
     class RendererLogContext;
     class FrameTimer;
+    class GpuTimerQueries;
 
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr);
+        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, GpuTimerQueries* gpuTimerQueries = nullptr);
 
         SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const;
 
@@ -33,12 +36,12 @@ namespace ramses_internal
     protected:
         mutable RenderExecutorInternalState m_state;
 
-        void executeRenderable      () const;
+        void executeRenderable      (UInt32 batchedRenderableCount = 1u) const;
         void executeRenderTarget    (RenderTargetHandle renderTarget) const;
         void executeRenderStates    () const;
         void executeEffectAndInputs () const;
         void executeConstant        (EDataType dataType, UInt32 elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const;
-        void executeDrawCall        () const;
+        void executeDrawCall        (UInt32 batchedRenderableCount = 1u) const;
 
         void setGlobalInternalStates    (const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const;
         void setRenderableInternalStates(RenderableHandle renderableHandle) const;
@@ -47,11 +50,19 @@ namespace ramses_internal
 
         void resolveAndSetSemanticDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle) const;
         void setSemanticDataFields  () const;
+        void setInstanceModelMatrices(const RenderableHandle* renderables, UInt32 renderableCount) const;
         void executeCamera(CameraHandle camera) const;
 
     private:
         Bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
+        UInt32 batchFollowingRenderables(const RenderableVector& orderedRenderables) const;
+
+        // model matrices of the renderables drawn by the current draw call, uploaded instead of the scene data
+        // of the instance model matrices field, so only as many matrices as instances drawn are uploaded
+        mutable std::vector<Matrix44f> m_instanceModelMatrices;
+        // GPU time of scene and its passes is measured if set
+        GpuTimerQueries* const m_gpuTimerQueries;
     };
 
 }
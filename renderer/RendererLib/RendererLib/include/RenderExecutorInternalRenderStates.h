@@ -11,6 +11,7 @@
 
 #include "SceneAPI/RenderState.h"
 #include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 namespace ramses_internal
 {
@@ -15,6 +15,8 @@
 #include "RendererAPI/SceneRenderExecutionIterator.h"
 #include "RendererLib/FrameTimer.h"
 #include "RenderExecutorInternalRenderStates.h"
+#include "RendererLib/RenderStateCache.h"
+#include "Collections/HashMap.h"
 #include "FrameBufferInfo.h"
 
 namespace ramses_internal
@@ -92,6 +94,7 @@ namespace ramses_internal
 
         CachedState < DeviceResourceHandle >    shaderDeviceHandle;
         CachedState < DeviceResourceHandle >    indexBufferDeviceHandle;
+        CachedState < UInt32 >                  renderStateId;
         CachedState < DepthStencilState >       depthStencilState;
         CachedState < BlendState >              blendState;
         CachedState < RasterizerState >         rasterizerState;
@@ -99,6 +102,9 @@ namespace ramses_internal
         CachedState < RenderPassHandle >        renderPassState;
         CachedState < Viewport >                viewportState;
 
+        // sampling is a state of the texture object, so it is only set again if a texture is used with other sampler states
+        HashMap < DeviceResourceHandle, UInt32 > textureSamplerStatesIds;
+
         SceneRenderExecutionIterator            m_currentRenderIterator;
 
     private:
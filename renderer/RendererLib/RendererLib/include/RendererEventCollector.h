@@ -19,6 +19,7 @@
 #include "RendererLib/EKeyEventType.h"
 #include "RendererLib/EKeyModifier.h"
 #include "RendererLib/EKeyCode.h"
+#include "RendererLib/LatencyHistogram.h"
 #include "Math3d/Vector2i.h"
 #include "Utils/LoggingUtils.h"
 #include "Utils/LogMacros.h"
@@ -67,6 +68,8 @@ namespace ramses_internal
         ERendererEventType_SceneHideFailed,
         ERendererEventType_SceneUpdateLatencyExceededLimit,
         ERendererEventType_SceneUpdateLatencyBackBelowLimit,
+        ERendererEventType_SceneLatencyStatistics,
+        ERendererEventType_SceneLatencyStatisticsFailed,
         ERendererEventType_SceneDataLinked,
         ERendererEventType_SceneDataLinkFailed,
         ERendererEventType_SceneDataBufferLinked,
@@ -126,6 +129,8 @@ namespace ramses_internal
         "ERendererEventType_SceneHideFailed",
         "ERendererEventType_SceneUpdateLatencyExceededLimit",
         "ERendererEventType_SceneUpdateLatencyBackBelowLimit",
+        "ERendererEventType_SceneLatencyStatistics",
+        "ERendererEventType_SceneLatencyStatisticsFailed",
         "ERendererEventType_SceneDataLinked",
         "ERendererEventType_SceneDataLinkFailed",
         "ERendererEventType_SceneDataBufferLinked",
@@ -181,6 +186,9 @@ namespace ramses_internal
         MouseEvent                  mouseEvent;
         KeyEvent                    keyEvent;
         StreamTextureSourceId       streamSourceId;
+        LatencySummary              flushToApplyLatency;
+        LatencySummary              applyToRenderLatency;
+        LatencySummary              renderToSwapLatency;
     };
 
     using RendererEventVector = Vector<RendererEvent>;
@@ -301,6 +309,18 @@ namespace ramses_internal
             pushEventToQueue(event);
         }
 
+        void addEvent(ERendererEventType eventType, SceneId sceneId, const LatencySummary& flushToApply, const LatencySummary& applyToRender, const LatencySummary& renderToSwap)
+        {
+            LOG_INFO(CONTEXT_RENDERER, EnumToString(eventType) << " sceneId=" << sceneId.getValue());
+
+            RendererEvent event(eventType);
+            event.sceneId = sceneId;
+            event.flushToApplyLatency = flushToApply;
+            event.applyToRenderLatency = applyToRender;
+            event.renderToSwapLatency = renderToSwap;
+            pushEventToQueue(event);
+        }
+
         void addEvent(ERendererEventType eventType, DisplayHandle display, MouseEvent mouseEvent)
         {
             RendererEvent event(eventType);
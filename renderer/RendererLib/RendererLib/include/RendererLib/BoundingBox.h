@@ -0,0 +1,39 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BOUNDINGBOX_H
+#define RAMSES_BOUNDINGBOX_H
+
+#include "Math3d/Vector3.h"
+
+namespace ramses_internal
+{
+    // Axis aligned box enclosing vertex positions in their local space, invalid if bounds are not known
+    struct BoundingBox
+    {
+        BoundingBox()
+            : minCorner(0.f)
+            , maxCorner(0.f)
+            , isValid(false)
+        {
+        }
+
+        BoundingBox(const Vector3& minimum, const Vector3& maximum)
+            : minCorner(minimum)
+            , maxCorner(maximum)
+            , isValid(true)
+        {
+        }
+
+        Vector3 minCorner;
+        Vector3 maxCorner;
+        Bool isValid;
+    };
+}
+
+#endif
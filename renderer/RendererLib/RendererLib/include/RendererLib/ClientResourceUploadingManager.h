@@ -11,7 +11,9 @@
 
 #include "RendererLib/ResourceDescriptor.h"
 #include "Transfer/ResourceTypes.h"
+#include "RendererAPI/Types.h"
 #include "Collections/HashMap.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -30,23 +32,47 @@ namespace ramses_internal
             IRenderBackend& renderBackend,
             Bool keepEffects,
             const FrameTimer& frameTimer,
-            UInt64 clientResourceCacheSize);
+            UInt64 clientResourceCacheSize,
+            EGPUMemoryCachePolicy cachePolicy = EGPUMemoryCachePolicy_LeastRecentlyUsed,
+            Bool progressiveTextureUpload = false,
+            Bool computeVertexPositionBounds = false);
         ~ClientResourceUploadingManager();
 
         Bool hasAnythingToUpload() const;
         void uploadAndUnloadPendingResources();
 
+        struct CacheStatistics
+        {
+            UInt64 hits = 0u;
+            UInt64 misses = 0u;
+            UInt64 evictedResources = 0u;
+            UInt64 evictedBytes = 0u;
+        };
+
+        // to be called before a scene references the resource, counts a hit if the resource is kept uploaded
+        // while not used by any scene and a miss if it is not known yet and has to be requested and uploaded
+        void trackResourceReferenced(const ResourceContentHash& hash);
+        const CacheStatistics& getCacheStatistics() const;
+
         static const UInt32 NumResourcesToUploadInBetweenTimeBudgetChecks = 10u;
         static const UInt32 LargeResourceByteSizeThreshold = 250000u;
+        // cost aware cache keeps a resource as if it was used this many frames later per millisecond of its re-upload cost
+        static const UInt32 CostAwareRetentionFramesPerMillisecond = 10u;
+        // progressive texture upload first uploads only the smallest mip levels up to this size, the rest is streamed in over following frames
+        static const UInt32 ProgressiveTextureMipTailSize = 65536u;
 
     private:
         void unloadClientResources(const ResourceContentHashVector& resourcesToUnload);
-        void uploadClientResources(const ResourceContentHashVector& resourcesToUpload);
-        void uploadClientResource(const ResourceDescriptor& rd);
+        void uploadClientResources(const ResourceContentHashVector& resourcesToUpload, const Vector<UInt32>& decompressionTimes);
+        void uploadClientResource(const ResourceDescriptor& rd, UInt32 decompressionTime);
         void unloadClientResource(const ResourceDescriptor& rd);
+        void uploadPendingTextureMipLevels();
+        Bool shouldUploadProgressively(const ResourceDescriptor& rd) const;
         void getClientResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, Bool keepEffects, UInt64 sizeToBeFreed) const;
-        void getAndPrepareClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const;
+        void getUnusedResourcesInCostAwareOrder(ResourceContentHashVector& resources) const;
+        void getAndPrepareClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, Vector<UInt32>& decompressionTimes, UInt64& totalSize) const;
         UInt64 getAmountOfMemoryToBeFreedForNewResources(UInt64 sizeToUpload) const;
+        static BoundingBox ComputeVertexPositionBounds(const IResource& resource);
 
         RendererClientResourceRegistry& m_clientResources;
         IResourceUploader&              m_uploader;
@@ -55,10 +81,33 @@ namespace ramses_internal
         const Bool   m_keepEffects;
         const FrameTimer& m_frameTimer;
 
-        using SizeMap = HashMap<ResourceContentHash, UInt32>;
-        SizeMap       m_clientResourceSizes;
+        struct UploadedResourceInfo
+        {
+            UInt32 size;
+            // time in microseconds it took to decompress and upload the resource (incl. shader compilation)
+            UInt32 uploadCost;
+        };
+        using UploadedResourceInfoMap = HashMap<ResourceContentHash, UploadedResourceInfo>;
+        UploadedResourceInfoMap m_uploadedResourceInfos;
         UInt64        m_clientResourceTotalUploadedSize = 0u;
         const UInt64  m_clientResourceCacheSize = 0u;
+        const EGPUMemoryCachePolicy m_cachePolicy;
+
+        CacheStatistics m_cacheStatistics;
+
+        const Bool m_progressiveTextureUpload;
+        struct TextureWithPendingMipLevels
+        {
+            ResourceContentHash hash;
+            // resource data is kept until all mip levels are uploaded
+            ManagedResource resource;
+            UInt32 lowestUploadedMipLevel;
+        };
+        // in order of upload of their mip tail
+        std::vector<TextureWithPendingMipLevels> m_texturesWithPendingMipLevels;
+
+        // bounds of vertex arrays which can hold positions, needed for framebuffer damage of renderables
+        const Bool m_computeVertexPositionBounds;
     };
 }
 
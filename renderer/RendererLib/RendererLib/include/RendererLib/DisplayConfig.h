@@ -83,6 +83,26 @@ namespace ramses_internal
         UInt64 getGPUMemoryCacheSize() const;
         void setGPUMemoryCacheSize(UInt64 size);
 
+        EGPUMemoryCachePolicy getGPUMemoryCachePolicy() const;
+        void setGPUMemoryCachePolicy(EGPUMemoryCachePolicy policy);
+
+        UInt64 getRenderBufferPoolSize() const;
+        void setRenderBufferPoolSize(UInt64 size);
+
+        Bool isSceneLayerCacheEnabled() const;
+        void setSceneLayerCacheEnabled(Bool enabled);
+        UInt64 getSceneLayerCacheMemoryBudget() const;
+        void setSceneLayerCacheMemoryBudget(UInt64 budget);
+
+        Bool isPartialFramebufferRedrawEnabled() const;
+        void setPartialFramebufferRedrawEnabled(Bool enabled);
+
+        Bool isProgressiveTextureUploadEnabled() const;
+        void setProgressiveTextureUploadEnabled(Bool enabled);
+
+        Bool isGpuTimerQueriesEnabled() const;
+        void setGpuTimerQueriesEnabled(Bool enabled);
+
         void setClearColor(const Vector4& clearColor);
         const Vector4& getClearColor() const;
 
@@ -118,6 +138,13 @@ namespace ramses_internal
 
         Bool m_effectDeletionDisabled = false;
         UInt64 m_gpuMemoryCacheSize = 0u;
+        EGPUMemoryCachePolicy m_gpuMemoryCachePolicy = EGPUMemoryCachePolicy_LeastRecentlyUsed;
+        UInt64 m_renderBufferPoolSize = 0u;
+        Bool m_sceneLayerCacheEnabled = false;
+        UInt64 m_sceneLayerCacheMemoryBudget = 32u * 1024u * 1024u;
+        Bool m_partialFramebufferRedrawEnabled = false;
+        Bool m_progressiveTextureUploadEnabled = false;
+        Bool m_gpuTimerQueriesEnabled = false;
         Vector4 m_clearColor{ 0.f, 0.f, 0.f, 1.0f };
 
         Bool m_offscreen = false;
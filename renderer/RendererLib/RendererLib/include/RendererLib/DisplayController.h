@@ -36,8 +36,12 @@ namespace ramses_internal
         virtual void                    handleWindowEvents() override;
         virtual Bool                    canRenderNewFrame() const override;
         virtual void                    enableContext() override;
+        virtual void                    disableContext() override;
         virtual void                    swapBuffers() override;
-        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr) override;
+        virtual void                    swapBuffersWithDamage(const Viewport& damagedRegion) override;
+        virtual UInt32                  getDisplayBufferAge() const override;
+        virtual void                    setDisplayBufferScissorRegion(Bool enabled, const Viewport& region) override;
+        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, GpuTimerQueries* gpuTimerQueries = nullptr) override;
         virtual void                    executePostProcessing() override;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, const Vector4& clearColor) override;
 
@@ -57,6 +61,9 @@ namespace ramses_internal
         virtual void                    resetView() const override;
 
         virtual Bool                    readPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height, Vector<UInt8>& dataOut) override;
+        virtual DeviceResourceHandle    startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual Bool                    isReadPixelsFinished(DeviceResourceHandle readPixelsHandle) override;
+        virtual Bool                    finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, Vector<UInt8>& dataOut) override;
         virtual Bool                    isWarpingEnabled() const override;
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) override;
 
@@ -78,6 +85,7 @@ namespace ramses_internal
         const UInt32            m_displayHeight;
 
         std::unique_ptr<Postprocessing> m_postProcessing;
+        Bool                    m_displayBufferScissorEnabled = false;
     };
 }
 
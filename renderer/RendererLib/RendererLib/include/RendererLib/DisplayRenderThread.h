@@ -0,0 +1,47 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DISPLAYRENDERTHREAD_H
+#define RAMSES_DISPLAYRENDERTHREAD_H
+
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
+#include <functional>
+
+namespace ramses_internal
+{
+    // Renders frames of a single display on its own thread.
+    // A frame is started by the renderer loop once all scene updates for that frame are done,
+    // the renderer loop waits for the frame to finish before it modifies any scene again.
+    class DisplayRenderThread : public Runnable
+    {
+    public:
+        using RenderFrameFunction = std::function<void()>;
+
+        explicit DisplayRenderThread(RenderFrameFunction renderFrame);
+        virtual ~DisplayRenderThread();
+
+        void startFrame();
+        // returns duration of the finished frame in microseconds
+        UInt32 waitForFrameFinished();
+
+    private:
+        virtual void run() override;
+
+        RenderFrameFunction m_renderFrame;
+        PlatformThread m_thread;
+        PlatformLightweightLock m_lock;
+        PlatformConditionVariable m_frameStartedConditionVar;
+        PlatformConditionVariable m_frameFinishedConditionVar;
+        Bool m_frameStarted = false;
+        Bool m_frameFinished = false;
+        UInt32 m_frameDuration = 0u;
+    };
+}
+
+#endif
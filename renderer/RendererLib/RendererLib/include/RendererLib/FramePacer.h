@@ -0,0 +1,50 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEPACER_H
+#define RAMSES_FRAMEPACER_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "Collections/Vector.h"
+#include <chrono>
+
+namespace ramses_internal
+{
+    // Delays start of a frame so that it finishes just before the next swap deadline instead of right after the previous one,
+    // scene updates arriving in the meantime are then picked up by that frame and shown with less latency.
+    // Render cost of a frame is predicted from the most expensive of the recent frames (excluding time blocked in swap buffers)
+    // plus a safety margin. Deadlines follow each other in intervals of the target frame duration, they follow the end of frames
+    // if these are later (e.g. swap buffers blocked until vsync) and start over from the end of a frame that missed its deadline.
+    class FramePacer
+    {
+    public:
+        explicit FramePacer(std::chrono::microseconds targetFrameDuration);
+
+        void setTargetFrameDuration(std::chrono::microseconds targetFrameDuration);
+
+        // time to wait from given time on before starting next frame
+        std::chrono::microseconds getDelayBeforeNextFrame(UInt64 currentTimeMicroseconds) const;
+        // to be called after each frame with its start and end time (after swap buffers) and time spent in swap buffers,
+        // returns true if frame finished too late to make its deadline
+        Bool frameFinished(UInt64 frameStartTimeMicroseconds, UInt64 frameEndTimeMicroseconds, std::chrono::microseconds swapBuffersDuration);
+        std::chrono::microseconds getPredictedRenderTime() const;
+        void reset();
+
+        static const UInt32 NumFramesForPrediction = 16u;
+        static const UInt32 MinimumSafetyMarginMicroseconds = 500u;
+
+    private:
+        std::chrono::microseconds m_targetFrameDuration;
+        // recent render times in a circular buffer
+        Vector<UInt32> m_renderTimes;
+        UInt32 m_nextRenderTimeIdx = 0u;
+        UInt64 m_nextDeadline = 0u;
+    };
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include "Collections/Vector.h"
 #include "Collections/String.h"
 #include "Utils/LoggingUtils.h"
+#include "RendererLib/FrameTraceRecorder.h"
 
 namespace ramses_internal
 {
@@ -106,6 +107,9 @@ namespace ramses_internal
         void writeLongestFrameTimingsToStream(StringOutputStream& str) const;
         void resetFrameTimings();
 
+        // records region timings and renderer events for trace export when enabled, disabled by default
+        FrameTraceRecorder& getTraceRecorder();
+
     private:
         UInt getEntryIdForCurrentRegion() const;
         void initNextFrameTimings();
@@ -129,6 +133,8 @@ namespace ramses_internal
         UInt m_currentRegionId;
 
         UInt32 m_filteredRegionFlags = ~0u;
+
+        FrameTraceRecorder m_traceRecorder;
     };
 
     class ScopedFrameProfilerRegion
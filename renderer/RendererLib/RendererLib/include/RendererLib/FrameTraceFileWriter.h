@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMETRACEFILEWRITER_H
+#define RAMSES_FRAMETRACEFILEWRITER_H
+
+#include "RendererLib/FrameTraceRecorder.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    // Formats recorded trace events as Chrome trace JSON and writes them to files on a background thread,
+    // so that dumping a trace (e.g. on a frame time spike) does not add file I/O to the frame it was triggered in.
+    // Number of pending dumps is limited, dumps requested while the writer is busy with that many are dropped.
+    class FrameTraceFileWriter final : public Runnable
+    {
+    public:
+        FrameTraceFileWriter();
+        virtual ~FrameTraceFileWriter() override;
+
+        // events must be ordered from oldest to newest, returns false if dump was dropped
+        Bool writeToFile(const String& fileName, Vector<FrameTraceRecorder::Event>&& events);
+
+        // blocks until all pending dumps are written
+        void flush();
+
+        UInt32 getNumberOfWrittenFiles() const;
+
+        static const UInt32 MaxNumberOfPendingDumps = 4u;
+
+    private:
+        struct Dump
+        {
+            String fileName;
+            Vector<FrameTraceRecorder::Event> events;
+        };
+
+        virtual void run() override;
+        static Bool WriteDump(const Dump& dump);
+
+        mutable PlatformLightweightLock m_lock;
+        std::deque<Dump> m_dumps;
+        Bool m_writingDump = false;
+        UInt32 m_numWrittenFiles = 0u;
+        PlatformConditionVariable m_dumpsAvailable;
+        PlatformConditionVariable m_dumpsWritten;
+        PlatformThread m_thread;
+    };
+}
+
+#endif
@@ -0,0 +1,102 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMETRACERECORDER_H
+#define RAMSES_FRAMETRACERECORDER_H
+
+#include "Collections/Vector.h"
+#include "Collections/String.h"
+#include "SceneAPI/SceneId.h"
+#include <memory>
+
+namespace ramses_internal
+{
+    class StringOutputStream;
+    class FrameTraceFileWriter;
+
+    /*  Records frame profiler regions and selected renderer events (flush application, client resource upload)
+        into a fixed size ring buffer, so that the last N events can be exported as Chrome trace event JSON
+        (loadable in chrome://tracing or Perfetto UI) without any display attached.
+
+        Optionally the recorded events are dumped automatically to a file whenever the work time of a frame
+        (first region start to last region end, excluding framerate limiting sleep) exceeds a threshold.
+        The ring buffer is cleared after each dump so consecutive dumps do not overlap.
+        Dumps are formatted and written to file by a background writer, the render thread only copies the recorded events.
+    */
+    class FrameTraceRecorder
+    {
+    public:
+        enum class EEventType : UInt8
+        {
+            Region = 0,
+            SceneFlushApplied,
+            ClientResourcesUploaded
+        };
+
+        struct Event
+        {
+            EEventType type;
+            UInt32 region;      // FrameProfilerStatistics::ERegion for EEventType::Region
+            UInt32 frameId;
+            UInt64 startTime;   // monotonic microseconds
+            UInt64 duration;    // microseconds
+            UInt64 id;          // scene id or display handle
+            UInt64 value;       // flush index
+            UInt64 count;       // number of applied scene actions
+        };
+
+        static const UInt32 DefaultCapacity = 16384u;
+
+        FrameTraceRecorder();
+        ~FrameTraceRecorder();
+
+        void enable(UInt32 capacity = DefaultCapacity);
+        void disable();
+        Bool isEnabled() const;
+
+        // threshold of 0 disables dumping on spikes, dump files are named <filePrefix>_<frameId>.json
+        void setSpikeDump(UInt64 frameTimeThresholdMicrosec, const String& filePrefix);
+
+        void recordRegion(UInt32 region, UInt64 startTime, UInt64 duration);
+        void recordSceneFlushApplied(SceneId sceneId, UInt64 flushIndex, UInt32 numActions, UInt64 startTime, UInt64 duration);
+        void recordClientResourcesUploaded(UInt32 displayHandle, UInt64 startTime, UInt64 duration);
+        void markFrameFinished();
+
+        UInt32 getNumberOfEvents() const;
+        const Event& getEvent(UInt32 index) const;   // 0 is the oldest event
+        UInt32 getNumberOfDumpedTraces() const;
+
+        void writeChromeTrace(StringOutputStream& str) const;
+        static void WriteChromeTrace(const Event* events, UInt32 numEvents, StringOutputStream& str);
+
+        // hands copy of recorded events to background writer, returns false if dump was dropped because writer is busy
+        Bool dumpToFile(const String& fileName);
+        // blocks until all requested dumps are written
+        void flushDumps();
+        void clear();
+
+    private:
+        void addEvent(const Event& event);
+        void getEventsInOrder(Vector<Event>& events) const;
+
+        Bool m_enabled = false;
+        Vector<Event> m_events;
+        UInt32 m_nextEventIdx = 0u;
+        UInt32 m_numEvents = 0u;
+
+        UInt32 m_frameId = 0u;
+        UInt64 m_frameStartTime = 0u;
+        UInt64 m_frameEndTime = 0u;
+
+        UInt64 m_spikeThreshold = 0u;
+        String m_spikeDumpFilePrefix;
+        std::unique_ptr<FrameTraceFileWriter> m_fileWriter;
+    };
+}
+
+#endif
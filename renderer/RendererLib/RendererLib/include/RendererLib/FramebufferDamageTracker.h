@@ -0,0 +1,65 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEBUFFERDAMAGETRACKER_H
+#define RAMSES_FRAMEBUFFERDAMAGETRACKER_H
+
+#include "SceneAPI/SceneId.h"
+#include "SceneAPI/Viewport.h"
+#include "RendererLib/BoundingBox.h"
+#include "Math3d/Matrix44f.h"
+#include "Collections/HashSet.h"
+#include "Collections/Vector.h"
+#include <utility>
+
+namespace ramses_internal
+{
+    // Tracks which region of a display framebuffer changed from frame to frame, so that only that region
+    // needs to be redrawn. A scene is expected to draw into the framebuffer only within its region (the projected bounds
+    // of its renderables rendering to framebuffer), a modified scene damages its previous and its current region.
+    // Any other change (scene shown, hidden or reordered, unknown reason for re-render) damages the whole framebuffer.
+    class FramebufferDamageTracker
+    {
+    public:
+        using SceneRegions = Vector<std::pair<SceneId, Viewport>>;
+
+        explicit FramebufferDamageTracker(const Viewport& framebufferRegion);
+
+        void markSceneModified(SceneId sceneId);
+        void markFullRedraw();
+
+        // to be called once per framebuffer frame with region of every shown scene in render order,
+        // returns region that has to be redrawn in back buffer with given age so that it shows the whole new frame
+        Viewport startFrame(const SceneRegions& shownScenes, UInt32 bufferAge);
+        // region that changed compared to previous frame
+        const Viewport& getFrameDamage() const;
+
+        // region covered by bounds projected to viewport, whole viewport if bounds are unknown or reach behind camera
+        static Viewport ProjectBoundsToRegion(const BoundingBox& bounds, const Matrix44f& modelViewProjectionMatrix, const Viewport& viewport);
+
+        static Viewport UniteRegions(const Viewport& region1, const Viewport& region2);
+        static Viewport IntersectRegions(const Viewport& region1, const Viewport& region2);
+        static Bool IsEmptyRegion(const Viewport& region);
+
+        // damage of older frames is not kept, back buffers older than that are redrawn completely
+        static const UInt32 MaxBufferAge = 4u;
+
+    private:
+        Viewport computeFrameDamage(const SceneRegions& shownScenes) const;
+
+        const Viewport m_framebufferRegion;
+        HashSet<SceneId> m_modifiedScenes;
+        Bool m_fullRedraw = true;
+        SceneRegions m_previousSceneRegions;
+        Viewport m_frameDamage;
+        // damage of previous frames, most recent first
+        Vector<Viewport> m_damageHistory;
+    };
+}
+
+#endif
@@ -0,0 +1,91 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_GPUTIMERQUERIES_H
+#define RAMSES_GPUTIMERQUERIES_H
+
+#include "RendererLib/RenderingPassInfo.h"
+#include "RendererAPI/Types.h"
+#include "SceneAPI/SceneId.h"
+#include "Collections/Vector.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    class IDevice;
+    class RendererStatistics;
+
+    // Measures GPU time of scenes rendered on a display and of each of their rendering passes using device timestamp queries.
+    // A timestamp is written when rendering of a scene starts and after each of its passes, GPU time of a pass is the difference
+    // to the preceding timestamp. Queries are resolved in later frames once available so that rendering does not wait for the GPU,
+    // queries still not available after MaxFramesToResolve frames are resolved even if that blocks.
+    // If the device reports disjoint timer operation (e.g. GPU frequency change), all frames pending at that point are dropped unreported.
+    class GpuTimerQueries
+    {
+    public:
+        explicit GpuTimerQueries(IDevice& device);
+
+        void sceneStarted(SceneId sceneId);
+        void passFinished(const RenderingPassInfo& pass);
+
+        // to be called once per display frame, queries written since last call form one frame,
+        // GPU time of all resolved frames is reported per scene and per pass
+        void resolveQueries(RendererStatistics& statistics);
+        // releases all queries without reporting them
+        void discardQueries();
+        Bool hasPendingQueries() const;
+
+        static const UInt32 MaxFramesToResolve = 3u;
+
+    private:
+        struct Timestamp
+        {
+            SceneId sceneId;
+            RenderingPassInfo pass;
+            Bool sceneStart;
+            DeviceResourceHandle query;
+        };
+        using Timestamps = Vector<Timestamp>;
+
+        struct PendingFrame
+        {
+            Timestamps timestamps;
+            UInt32 framesPending;
+            Bool disjoint;
+        };
+
+        struct SceneGpuTime
+        {
+            SceneId sceneId;
+            UInt64 gpuTime;
+        };
+
+        struct PassGpuTime
+        {
+            SceneId sceneId;
+            RenderingPassInfo pass;
+            UInt64 gpuTime;
+        };
+
+        void writeTimestamp(SceneId sceneId, const RenderingPassInfo& pass, Bool sceneStart);
+        void reportFrame(const Timestamps& timestamps, RendererStatistics& statistics);
+        void finishQueries(const Timestamps& timestamps);
+
+        IDevice& m_device;
+        Bool m_supported = true;
+        SceneId m_currentScene;
+        Timestamps m_currentFrame;
+        std::deque<PendingFrame> m_pendingFrames;
+
+        // temporary containers kept to avoid re-allocations
+        Vector<SceneGpuTime> m_sceneGpuTimes;
+        Vector<PassGpuTime> m_passGpuTimes;
+    };
+}
+
+#endif
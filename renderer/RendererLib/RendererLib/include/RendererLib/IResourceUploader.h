@@ -24,8 +24,16 @@ namespace ramses_internal
     public:
         virtual ~IResourceUploader() {}
 
+        // called once for every display created, before any resource is uploaded to its device
+        virtual void                 deviceInitialized(IRenderBackend& renderBackend) = 0;
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, ManagedResource resourceObject) = 0;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) = 0;
+
+        // Progressive texture upload: allocates all mip levels of the texture but uploads only its smallest levels (at most mipTailMaxSize bytes,
+        // but always at least the smallest level) and restricts sampling to them. Lowest uploaded mip level is returned in lowestUploadedMipLevel.
+        // Remaining levels are to be uploaded one by one in decreasing order using uploadTextureMipLevel, each extends sampling to the uploaded level.
+        virtual DeviceResourceHandle uploadTextureMipTail(IRenderBackend& renderBackend, ManagedResource resourceObject, UInt32 mipTailMaxSize, UInt32& lowestUploadedMipLevel) = 0;
+        virtual void                 uploadTextureMipLevel(IRenderBackend& renderBackend, ManagedResource resourceObject, DeviceResourceHandle handle, UInt32 mipLevel) = 0;
     };
 }
 
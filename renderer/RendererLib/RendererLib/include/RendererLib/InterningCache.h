@@ -0,0 +1,133 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_INTERNINGCACHE_H
+#define RAMSES_INTERNINGCACHE_H
+
+#include "Collections/HashMap.h"
+#include "Collections/Vector.h"
+#include <limits>
+
+namespace ramses_internal
+{
+    // Keeps a single copy of every distinct value and identifies it by a small id,
+    // equal values get the same id so that a change of value can be detected by comparing ids.
+    // Every acquire is a reference to the value, the id becomes free for reuse when the last reference is released.
+    // Value type needs equality operator and ramses_capu::Hash specialization.
+    template <typename T>
+    class InterningCache
+    {
+    public:
+        static const UInt32 InvalidId = std::numeric_limits<UInt32>::max();
+
+        // isNewValue (optional) is set to true if the value was not referenced before the call
+        UInt32   acquire(const T& value, Bool* isNewValue = nullptr);
+        // returns true if the last reference to the value was released
+        Bool     release(UInt32 id);
+
+        const T& getValue(UInt32 id) const;
+        UInt32   getReferenceCount(UInt32 id) const;
+
+        // number of distinct values vs. number of references to them
+        UInt32   getUniqueCount() const;
+        UInt32   getRequestedCount() const;
+
+    private:
+        struct Entry
+        {
+            T value;
+            UInt32 referenceCount;
+        };
+
+        HashMap<T, UInt32> m_idsByValue;
+        Vector<Entry>      m_entries;
+        Vector<UInt32>     m_freeIds;
+        UInt32             m_requestedCount = 0u;
+    };
+
+    template <typename T>
+    const UInt32 InterningCache<T>::InvalidId;
+
+    template <typename T>
+    UInt32 InterningCache<T>::acquire(const T& value, Bool* isNewValue)
+    {
+        ++m_requestedCount;
+
+        const UInt32* existingId = m_idsByValue.get(value);
+        if (existingId != nullptr)
+        {
+            ++m_entries[*existingId].referenceCount;
+            if (isNewValue != nullptr)
+                *isNewValue = false;
+            return *existingId;
+        }
+
+        UInt32 id = InvalidId;
+        if (m_freeIds.empty())
+        {
+            id = static_cast<UInt32>(m_entries.size());
+            m_entries.push_back({ value, 1u });
+        }
+        else
+        {
+            id = m_freeIds.back();
+            m_freeIds.pop_back();
+            m_entries[id] = { value, 1u };
+        }
+        m_idsByValue.put(value, id);
+
+        if (isNewValue != nullptr)
+            *isNewValue = true;
+        return id;
+    }
+
+    template <typename T>
+    Bool InterningCache<T>::release(UInt32 id)
+    {
+        assert(id < m_entries.size());
+        Entry& entry = m_entries[id];
+        assert(entry.referenceCount > 0u);
+        assert(m_requestedCount > 0u);
+
+        --m_requestedCount;
+        if (--entry.referenceCount > 0u)
+            return false;
+
+        m_idsByValue.remove(entry.value);
+        m_freeIds.push_back(id);
+        return true;
+    }
+
+    template <typename T>
+    const T& InterningCache<T>::getValue(UInt32 id) const
+    {
+        assert(id < m_entries.size());
+        assert(m_entries[id].referenceCount > 0u);
+        return m_entries[id].value;
+    }
+
+    template <typename T>
+    UInt32 InterningCache<T>::getReferenceCount(UInt32 id) const
+    {
+        return (id < m_entries.size() ? m_entries[id].referenceCount : 0u);
+    }
+
+    template <typename T>
+    UInt32 InterningCache<T>::getUniqueCount() const
+    {
+        return static_cast<UInt32>(m_idsByValue.count());
+    }
+
+    template <typename T>
+    UInt32 InterningCache<T>::getRequestedCount() const
+    {
+        return m_requestedCount;
+    }
+}
+
+#endif
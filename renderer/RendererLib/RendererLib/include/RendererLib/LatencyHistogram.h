@@ -0,0 +1,68 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_LATENCYHISTOGRAM_H
+#define RAMSES_LATENCYHISTOGRAM_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <array>
+
+namespace ramses_internal
+{
+    class StringOutputStream;
+
+    struct LatencySummary
+    {
+        UInt64 numSamples = 0u;
+        UInt64 minimum = 0u;
+        UInt64 maximum = 0u;
+        UInt64 mean = 0u;
+        UInt64 percentile50 = 0u;
+        UInt64 percentile90 = 0u;
+        UInt64 percentile99 = 0u;
+        UInt64 percentile999 = 0u;
+    };
+
+    // Histogram of latencies in microseconds with logarithmically growing buckets (HDR histogram style).
+    // Values are exact up to 32us, above that every power of two range is split into 16 buckets,
+    // i.e. any recorded value is reported with a relative error below 1/16.
+    // Recording does not allocate and costs only a few integer operations.
+    class LatencyHistogram
+    {
+    public:
+        static const UInt32 SubBucketCount = 32u;
+        static const UInt32 HalfSubBucketCount = SubBucketCount / 2u;
+        static const UInt32 BucketCount = SubBucketCount + 27u * HalfSubBucketCount;
+        static const UInt64 MaxTrackableValue = 0xFFFFFFFFu;
+
+        void record(UInt64 valueMicrosec);
+        void reset();
+
+        UInt64 getNumSamples() const;
+        UInt64 getMinimum() const;
+        UInt64 getMaximum() const;
+        UInt64 getMean() const;
+        UInt64 getValueAtPercentile(Float percentile) const;
+        LatencySummary getSummary() const;
+
+        void writeSummaryToStream(StringOutputStream& str) const;
+
+        static UInt32 GetBucketIndex(UInt64 valueMicrosec);
+        static UInt64 GetBucketLowerBound(UInt32 bucketIndex);
+        static UInt64 GetBucketUpperBound(UInt32 bucketIndex);
+
+    private:
+        std::array<UInt32, BucketCount> m_buckets = {};
+        UInt64 m_numSamples = 0u;
+        UInt64 m_sum = 0u;
+        UInt64 m_minimum = 0u;
+        UInt64 m_maximum = 0u;
+    };
+}
+
+#endif
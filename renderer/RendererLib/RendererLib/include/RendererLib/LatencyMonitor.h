@@ -10,6 +10,8 @@
 #define RAMSES_LATENCYMONITOR_H
 
 #include "SceneAPI/SceneId.h"
+#include "RendererAPI/Types.h"
+#include "RendererLib/LatencyHistogram.h"
 #include "Components/FlushTimeInformation.h"
 #include "Collections/HashMap.h"
 #include <chrono>
@@ -17,6 +19,14 @@
 namespace ramses_internal
 {
     class RendererEventCollector;
+    class StringOutputStream;
+
+    struct SceneLatencyHistograms
+    {
+        LatencyHistogram flushToApply;
+        LatencyHistogram applyToRender;
+        LatencyHistogram renderToSwap;
+    };
 
     class LatencyMonitor
     {
@@ -33,6 +43,16 @@ namespace ramses_internal
         bool isMonitoringScene(SceneId sceneId);
         void stopMonitoringScene(SceneId sceneId);
 
+        // latency distributions, tracked for every scene regardless of its latency limit
+        void recordFlushApplied(SceneId sceneId, Clock::time_point flushTimeStamp, Clock::time_point appliedTime, bool needsRendering);
+        void recordFlushNotRendered(SceneId sceneId);
+        void recordSceneRendered(SceneId sceneId, DisplayHandle display, Clock::time_point renderedTime);
+        void recordFramebufferSwapped(DisplayHandle display, Clock::time_point swappedTime);
+
+        const SceneLatencyHistograms* getLatencyHistograms(SceneId sceneId) const;
+        void resetLatencyHistograms();
+        void writeLatencyHistogramsToStream(StringOutputStream& str) const;
+
     private:
         struct SceneLatencyInfo
         {
@@ -43,6 +63,18 @@ namespace ramses_internal
         };
         HashMap<SceneId, SceneLatencyInfo> m_sceneLatencyInfos;
 
+        struct SceneLatencyTracking
+        {
+            SceneLatencyHistograms histograms;
+            Clock::time_point firstNotRenderedApplyTimeStamp;
+            Clock::time_point notSwappedRenderTimeStamp;
+            DisplayHandle notSwappedRenderDisplay;
+            bool hasNotRenderedApply = false;
+        };
+        HashMap<SceneId, SceneLatencyTracking> m_sceneLatencyTrackings;
+
+        static UInt64 GetElapsedMicroseconds(Clock::time_point from, Clock::time_point to);
+
         RendererEventCollector& m_eventCollector;
     };
 }
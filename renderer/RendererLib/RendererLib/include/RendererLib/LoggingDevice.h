@@ -22,6 +22,7 @@ namespace ramses_internal
         LoggingDevice(const IDevice& deviceDelegate, RendererLogContext& context);
 
         virtual EDeviceTypeId getDeviceTypeId() const override final;
+        virtual String getDriverIdentification() const override final;
 
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Float* value) override;
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector2* value) override;
@@ -52,10 +53,12 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle allocateVertexBuffer(EDataType dataType, UInt32 sizeInBytes) override;
         virtual void uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void streamVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
         virtual void deleteVertexBuffer(DeviceResourceHandle handle) override;
         virtual void activateVertexBuffer(DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor) override;
         virtual DeviceResourceHandle allocateIndexBuffer(EDataType dataType, UInt32 sizeInBytes) override;
         virtual void uploadIndexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void streamIndexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
         virtual void deleteIndexBuffer(DeviceResourceHandle handle) override;
         virtual void activateIndexBuffer(DeviceResourceHandle handle) override;
         virtual DeviceResourceHandle uploadShader(const EffectResource& effect) override;
@@ -68,8 +71,10 @@ namespace ramses_internal
         virtual DeviceResourceHandle allocateTextureCube(UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 dataSize) override;
         virtual void                 bindTexture(DeviceResourceHandle handle) override;
         virtual void                 generateMipmaps(DeviceResourceHandle handle) override;
+        virtual void                 setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel) override;
         virtual void                 uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
         virtual DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) override;
+        virtual UInt32 updateStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion) override;
         virtual void deleteTexture(DeviceResourceHandle handle) override;
         virtual void activateTexture(DeviceResourceHandle handle, DataFieldHandle field) override;
         virtual DeviceResourceHandle    uploadRenderBuffer(const RenderBuffer& renderBuffer) override;
@@ -93,6 +98,13 @@ namespace ramses_internal
         virtual void                    swapDoubleBufferedRenderTarget(DeviceResourceHandle renderTarget) override;
 
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual DeviceResourceHandle startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual Bool isReadPixelsFinished(DeviceResourceHandle handle) override;
+        virtual Bool finishReadPixels(DeviceResourceHandle handle, UInt8* buffer) override;
+        virtual DeviceResourceHandle writeGpuTimestamp() override;
+        virtual Bool isGpuTimestampAvailable(DeviceResourceHandle handle) override;
+        virtual UInt64 finishGpuTimestamp(DeviceResourceHandle handle) override;
+        virtual Bool isGpuTimerDisjoint() override;
 
         virtual UInt32 getTotalGpuMemoryUsageInKB() const override;
         virtual UInt32 getDrawCallCount() const override;
@@ -0,0 +1,122 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PERSISTENTBINARYSHADERCACHE_H
+#define RAMSES_PERSISTENTBINARYSHADERCACHE_H
+
+#include "RendererAPI/IBinaryShaderCache.h"
+#include "RendererAPI/Types.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
+#include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
+#include "Collections/Vector.h"
+#include <deque>
+#include <memory>
+
+namespace ramses_internal
+{
+    // Binary shader cache persisted automatically in a directory, every binary shader is stored in its own file named
+    // after the effect hash and a hash of the driver identification, so binaries of another GPU or driver version are never used.
+    // Binaries are written to disk on a background thread after they were stored, file I/O never delays rendering.
+    // The startup manifest in the same directory lists effects in the order they were first used during the previous run,
+    // once the device is initialized their binaries are loaded on the background thread ahead of time, so that uploading
+    // these effects when scenes request them costs only the binary upload instead of a shader compilation.
+    // Binaries kept in memory are limited to a total size, the oldest ones are evicted first. Binaries not in memory are
+    // reported as not cached, they are never read from disk on lookup.
+    class PersistentBinaryShaderCache final : public IBinaryShaderCache, public Runnable
+    {
+    public:
+        explicit PersistentBinaryShaderCache(const String& directory, UInt32 maxMemorySize = DefaultMaxMemorySize);
+        virtual ~PersistentBinaryShaderCache() override;
+
+        virtual Bool hasBinaryShader(ResourceContentHash effectHash) const override;
+        virtual UInt32 getBinaryShaderSize(ResourceContentHash effectHash) const override;
+        virtual UInt32 getBinaryShaderFormat(ResourceContentHash effectHash) const override;
+        virtual void getBinaryShaderData(ResourceContentHash effectHash, UInt8* buffer, UInt32 bufferSize) const override;
+        virtual bool shouldBinaryShaderBeCached(ResourceContentHash effectHash) const override;
+        virtual void storeBinaryShader(ResourceContentHash effectHash, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat) override;
+        virtual void binaryShaderUploaded(ResourceContentHash effectHash, Bool success) const override;
+        virtual void deviceInitialized(const String& driverIdentification) override;
+
+        // blocks until loading ahead of time and all pending writes are finished
+        void flush();
+
+        String getEntryFilePath(ResourceContentHash effectHash) const;
+        String getManifestFilePath() const;
+
+        static const UInt32 FileVersion = 1u;
+        static const UInt32 DefaultMaxMemorySize = 32u * 1024u * 1024u;
+
+    private:
+        struct BinaryShader
+        {
+            UInt8Vector data;
+            UInt32 format;
+        };
+        using BinaryShaderPtr = std::shared_ptr<const BinaryShader>;
+
+        enum class EJobType
+        {
+            WarmUp,
+            WriteEntry,
+            RemoveEntry,
+            WriteManifest
+        };
+
+        struct Job
+        {
+            EJobType type;
+            ResourceContentHash effectHash;
+            // binary to be written, held by the job so that it can be evicted from memory before written
+            BinaryShaderPtr binaryShader;
+        };
+
+        virtual void run() override;
+        void executeJob(const Job& job);
+        void enqueueJob(EJobType type, ResourceContentHash effectHash, const BinaryShaderPtr& binaryShader = nullptr) const;
+
+        BinaryShaderPtr getBinaryShader(ResourceContentHash effectHash) const;
+        void effectUsed(ResourceContentHash effectHash) const;
+        UInt64 getDriverHash() const;
+
+        // to be called with m_lock held
+        void putBinaryShader(ResourceContentHash effectHash, const BinaryShaderPtr& binaryShader);
+        void removeBinaryShader(ResourceContentHash effectHash) const;
+
+        void warmUp();
+        BinaryShaderPtr readEntry(ResourceContentHash effectHash) const;
+        void writeEntry(ResourceContentHash effectHash, const BinaryShader& binaryShader);
+        void removeEntry(ResourceContentHash effectHash);
+        Bool readManifest(Vector<ResourceContentHash>& effects) const;
+        void writeManifest();
+
+        const String m_directory;
+        const UInt32 m_maxMemorySize;
+
+        // driver is set once by render thread and read by background thread, binaries in memory are ordered from oldest to newest,
+        // effects are recorded in the order of their first use to be written into the manifest
+        mutable PlatformLightweightLock m_lock;
+        String m_driverIdentification;
+        UInt64 m_driverHash = 0u;
+        mutable HashMap<ResourceContentHash, BinaryShaderPtr> m_binaryShaders;
+        mutable std::deque<ResourceContentHash> m_binaryShadersOrder;
+        mutable UInt32 m_binaryShadersSize = 0u;
+        mutable Vector<ResourceContentHash> m_usedEffects;
+        mutable HashSet<ResourceContentHash> m_usedEffectsSet;
+        mutable Bool m_manifestWritePending = false;
+
+        mutable std::deque<Job> m_jobs;
+        Bool m_executingJob = false;
+        mutable PlatformConditionVariable m_jobsAvailable;
+        PlatformConditionVariable m_jobsFinished;
+        PlatformThread m_thread;
+    };
+}
+
+#endif
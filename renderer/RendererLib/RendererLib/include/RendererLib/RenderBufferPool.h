@@ -0,0 +1,67 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RENDERBUFFERPOOL_H
+#define RAMSES_RENDERBUFFERPOOL_H
+
+#include "RendererAPI/Types.h"
+#include "SceneAPI/RenderBuffer.h"
+#include "Collections/HashMap.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class IDevice;
+
+    // Recycles device render buffers of one display (device) across scenes and their map/unmap cycles.
+    // Released buffers are kept up to the retention size and handed out again when a buffer
+    // of equal description (size, format, type, access mode, sample count) is acquired.
+    // Pool with zero retention size allocates and deletes buffers directly on device.
+    class RenderBufferPool
+    {
+    public:
+        explicit RenderBufferPool(UInt64 retentionSize);
+        ~RenderBufferPool();
+
+        DeviceResourceHandle acquire(IDevice& device, const RenderBuffer& renderBuffer);
+        void release(IDevice& device, DeviceResourceHandle deviceHandle);
+        void deleteRetainedBuffers(IDevice& device);
+
+        struct Statistics
+        {
+            UInt64 hits = 0u;
+            UInt64 misses = 0u;
+            UInt64 evictedBuffers = 0u;
+            UInt64 evictedBytes = 0u;
+        };
+
+        const Statistics& getStatistics() const;
+        UInt32 getRetainedBufferCount() const;
+        UInt64 getRetainedSize() const;
+
+        static UInt32 GetRenderBufferByteSize(const RenderBuffer& renderBuffer);
+
+    private:
+        void evictOldestRetainedBuffer(IDevice& device);
+
+        struct RetainedBuffer
+        {
+            DeviceResourceHandle deviceHandle;
+            RenderBuffer renderBuffer;
+        };
+
+        const UInt64 m_retentionSize;
+        HashMap<DeviceResourceHandle, RenderBuffer> m_acquiredBuffers;
+        // in order of release, oldest first
+        std::vector<RetainedBuffer> m_retainedBuffers;
+        UInt64 m_retainedSize = 0u;
+        Statistics m_statistics;
+    };
+}
+
+#endif
@@ -0,0 +1,118 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RENDERSTATECACHE_H
+#define RAMSES_RENDERSTATECACHE_H
+
+#include "RendererLib/InterningCache.h"
+#include "RenderExecutorInternalRenderStates.h"
+#include "SceneAPI/TextureSamplerStates.h"
+#include "ramses-capu/container/Hash.h"
+#include <functional>
+
+namespace ramses_internal
+{
+    // Scene render state split into the blocks which render executor applies to device
+    struct RenderStateBlock
+    {
+        RenderStateBlock() = default;
+
+        explicit RenderStateBlock(const RenderState& renderState)
+        {
+            depthStencilState.m_depthFunc          = renderState.depthFunc;
+            depthStencilState.m_depthWrite         = renderState.depthWrite;
+            depthStencilState.m_stencilFunc        = renderState.stencilFunc;
+            depthStencilState.m_stencilMask        = renderState.stencilMask;
+            depthStencilState.m_stencilOpDepthFail = renderState.stencilOpDepthFail;
+            depthStencilState.m_stencilOpDepthPass = renderState.stencilOpDepthPass;
+            depthStencilState.m_stencilOpFail      = renderState.stencilOpFail;
+            depthStencilState.m_stencilRefValue    = renderState.stencilRefValue;
+
+            blendState.m_blendFactorSrcColor = renderState.blendFactorSrcColor;
+            blendState.m_blendFactorDstColor = renderState.blendFactorDstColor;
+            blendState.m_blendFactorSrcAlpha = renderState.blendFactorSrcAlpha;
+            blendState.m_blendFactorDstAlpha = renderState.blendFactorDstAlpha;
+            blendState.m_blendOperationColor = renderState.blendOperationColor;
+            blendState.m_blendOperationAlpha = renderState.blendOperationAlpha;
+            blendState.m_colorWriteMask      = renderState.colorWriteMask;
+
+            rasterizerState.m_cullMode = renderState.cullMode;
+            rasterizerState.m_drawMode = renderState.drawMode;
+        }
+
+        Bool operator==(const RenderStateBlock& other) const
+        {
+            return !(depthStencilState != other.depthStencilState)
+                && !(blendState != other.blendState)
+                && !(rasterizerState != other.rasterizerState);
+        }
+
+        DepthStencilState depthStencilState;
+        BlendState        blendState;
+        RasterizerState   rasterizerState;
+    };
+
+    // Render state blocks of all renderer scenes, equal render states share one id
+    using RenderStateCache = InterningCache<RenderStateBlock>;
+
+    // Texture sampler states of all renderer scenes, equal sampler states share one id
+    using TextureSamplerStatesCache = InterningCache<TextureSamplerStates>;
+}
+
+namespace ramses_capu
+{
+    template<>
+    struct Hash<ramses_internal::RenderStateBlock>
+    {
+        uint_t operator()(const ramses_internal::RenderStateBlock& v)
+        {
+            const ramses_internal::DepthStencilState& ds = v.depthStencilState;
+            const ramses_internal::BlendState& bs = v.blendState;
+            const ramses_internal::RasterizerState& rs = v.rasterizerState;
+
+            // all enum values fit in 4 bits, so every field gets its own bits in one of the two packed words
+            const uint64_t packedDepthStencil =
+                (static_cast<uint64_t>(ds.m_depthFunc) << 60u) |
+                (static_cast<uint64_t>(ds.m_depthWrite) << 56u) |
+                (static_cast<uint64_t>(ds.m_stencilFunc) << 52u) |
+                (static_cast<uint64_t>(ds.m_stencilOpFail) << 48u) |
+                (static_cast<uint64_t>(ds.m_stencilOpDepthFail) << 44u) |
+                (static_cast<uint64_t>(ds.m_stencilOpDepthPass) << 40u) |
+                (static_cast<uint64_t>(ds.m_stencilMask) << 32u) |
+                ds.m_stencilRefValue;
+            const uint64_t packedBlendAndRasterizer =
+                (static_cast<uint64_t>(bs.m_blendFactorSrcColor) << 36u) |
+                (static_cast<uint64_t>(bs.m_blendFactorDstColor) << 32u) |
+                (static_cast<uint64_t>(bs.m_blendFactorSrcAlpha) << 28u) |
+                (static_cast<uint64_t>(bs.m_blendFactorDstAlpha) << 24u) |
+                (static_cast<uint64_t>(bs.m_blendOperationColor) << 20u) |
+                (static_cast<uint64_t>(bs.m_blendOperationAlpha) << 16u) |
+                (static_cast<uint64_t>(bs.m_colorWriteMask) << 8u) |
+                (static_cast<uint64_t>(rs.m_cullMode) << 4u) |
+                static_cast<uint64_t>(rs.m_drawMode);
+
+            const uint64_t hashValue = packedDepthStencil ^ (packedBlendAndRasterizer * 0x9E3779B97F4A7C15ull);
+            return static_cast<uint_t>(hashValue ^ (hashValue >> 32u));
+        }
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<ramses_internal::RenderStateBlock>
+    {
+    public:
+        size_t operator()(const ramses_internal::RenderStateBlock& v) const
+        {
+            return ramses_capu::Hash<ramses_internal::RenderStateBlock>()(v);
+        }
+    };
+}
+
+#endif
@@ -17,11 +17,18 @@
 #include "RendererLib/DisplayEventHandlerManager.h"
 #include "RendererLib/RendererInterruptState.h"
 #include "RendererLib/DisplaySetup.h"
+#include "RendererLib/DisplayRenderThread.h"
+#include "RendererLib/SceneLayerCache.h"
+#include "RendererLib/FramebufferDamageTracker.h"
+#include "RendererLib/GpuTimerQueries.h"
 #include "FrameProfileRenderer.h"
 #include "MemoryStatistics.h"
 #include "Collections/Vector.h"
 #include "Collections/HashMap.h"
+#include "PlatformAbstraction/PlatformLock.h"
 #include <map>
+#include <memory>
+#include <chrono>
 
 namespace ramses_internal
 {
@@ -38,13 +45,14 @@ namespace ramses_internal
     class FrameTimer;
     class LatencyMonitor;
     class WarpingMeshData;
+    class ProjectionParams;
 
     class Renderer
     {
         friend class RendererLogger;
 
     public:
-        Renderer(IPlatformFactory& platformFactory, const RendererScenes& rendererScenes, RendererEventCollector& eventCollector, const FrameTimer& frameTimer, LatencyMonitor& latencyMonitor);
+        Renderer(IPlatformFactory& platformFactory, const RendererScenes& rendererScenes, RendererEventCollector& eventCollector, const FrameTimer& frameTimer, LatencyMonitor& latencyMonitor, Bool renderThreadPerDisplay = false);
         virtual ~Renderer();
 
         void                        registerOffscreenBuffer    (DisplayHandle display, DeviceResourceHandle bufferDeviceHandle, UInt32 width, UInt32 height, Bool isInterruptible);
@@ -69,12 +77,16 @@ namespace ramses_internal
         IDisplayController&         getDisplayController(DisplayHandle display);
         UInt32                      getDisplayControllerCount() const;
         Bool                        hasDisplayController(DisplayHandle display) const;
+        Bool                        hasRenderThreadPerDisplay() const;
 
         DisplayEventHandler&        getDisplayEventHandler(DisplayHandle display);
         void                        setWarpingMeshData(DisplayHandle display, const WarpingMeshData& meshData);
 
         void                        setClearColor(DisplayHandle displayHandle, const Vector4& clearColor);
+        // to be called after view position or rotation of display changed, framebuffer is fully rerendered including cached scene layers
+        void                        markDisplayViewModified(DisplayHandle displayHandle);
         void                        scheduleScreenshot(const ScreenshotInfo& screenshot);
+        void                        setPeriodicScreenshot(const ScreenshotInfo& screenshot, UInt32 frameInterval);
         void                        dispatchProcessedScreenshots(ScreenshotInfoVector& screenshots);
 
         Bool                        hasAnyBufferWithInterruptedRendering() const;
@@ -96,6 +108,9 @@ namespace ramses_internal
         RendererStatistics&         getStatistics();
         FrameProfilerStatistics&    getProfilerStatistics();
         MemoryStatistics&           getMemoryStatistics();
+        LatencyMonitor&             getLatencyMonitor();
+        // time blocked in swap buffers during last render loop, longest of all displays if rendered in parallel
+        std::chrono::microseconds   getSwapBuffersDuration() const;
 
         static const Vector4 DefaultClearColor;
 
@@ -105,16 +120,31 @@ namespace ramses_internal
 
     private:
         void handleDisplayEvents(DisplayHandle displayHandle);
-        void renderToFramebuffer(DisplayHandle displayHandle, DisplayHandle& activeDisplay);
+        Bool renderToFramebuffer(DisplayHandle displayHandle, DisplayHandle& activeDisplay);
+        void renderSceneToFramebufferUsingLayerCache(DisplayHandle displayHandle, const RendererCachedScene& scene, const Viewport& viewport);
         void renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay);
         void renderToInterruptibleOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay, Bool& interrupted);
+        void renderDisplaysOnRenderThreads(DisplayHandle& activeDisplay);
+        void renderDisplayFrame(DisplayHandle displayHandle);
         IDisplayController* createDisplayControllerFromConfig(const DisplayConfig& config, DisplayEventHandler& displayEventHandler);
         void processScheduledScreenshots(DisplayHandle display, IDisplayController& controller, DisplayHandle& activeDisplay);
+        void startScreenshot(DisplayHandle display, const ScreenshotInfo& screenshot);
+        void finishPendingScreenshots(DisplayHandle display);
         Bool hasAnyOffscreenBufferToRerender(DisplayHandle display, Bool interruptible) const;
-        void onSceneWasRendered(const RendererCachedScene& scene);
+        void onSceneWasRendered(DisplayHandle displayHandle, const RendererCachedScene& scene);
 
         static void ActivateDisplayContext(DisplayHandle displayToActivate, DisplayHandle& activeDisplay, IDisplayController& dispController);
         static void ReorderDisplaysToStartWith(Vector<DisplayHandle>& displays, DisplayHandle displayToStartWith);
+        static Viewport GetSceneFramebufferRegion(const RendererCachedScene& scene, const Viewport& framebufferViewport, const ProjectionParams& framebufferProjectionParams, const Matrix44f& rendererViewMatrix);
+
+        // screenshot read back asynchronously, it is finished at latest MaxFramesToFinishScreenshot frames after it was started
+        struct PendingScreenshot
+        {
+            ScreenshotInfo       screenshot;
+            DeviceResourceHandle readPixelsHandle;
+            UInt32               framesPending;
+        };
+        static const UInt32 MaxFramesToFinishScreenshot = 2u;
 
         struct DisplayInfo
         {
@@ -122,6 +152,18 @@ namespace ramses_internal
             Bool                 couldRenderLastFrame;
             DeviceResourceHandle frameBufferDeviceHandle;
             DisplaySetup         buffersSetup;
+            UInt32               frameDuration = 0u;
+            std::unique_ptr<DisplayRenderThread> renderThread;
+            std::unique_ptr<SceneLayerCache> sceneLayerCache;
+            std::unique_ptr<FramebufferDamageTracker> damageTracker;
+            std::unique_ptr<GpuTimerQueries> gpuTimerQueries;
+            Vector<SceneId>      tempScenesRendered;
+            FramebufferDamageTracker::SceneRegions tempSceneRegions;
+            Vector<PendingScreenshot> pendingScreenshots;
+            // screenshot taken every periodicScreenshotInterval-th frame rendered to framebuffer, 0 disables it
+            ScreenshotInfo       periodicScreenshot;
+            UInt32               periodicScreenshotInterval = 0u;
+            UInt32               framesSincePeriodicScreenshot = 0u;
         };
         using Displays = std::map<DisplayHandle, DisplayInfo>;
 
@@ -142,6 +184,12 @@ namespace ramses_internal
         RendererInterruptState                 m_rendererInterruptState;
         const FrameTimer&                      m_frameTimer;
         LatencyMonitor&                        m_latencyMonitor;
+        std::chrono::microseconds              m_swapBuffersDuration{ 0 };
+
+        // with a render thread per display, display threads render frames in parallel while the renderer loop waits for them,
+        // scenes are not modified until all displays finished, this lock guards state shared between display threads
+        const Bool                             m_renderThreadPerDisplay;
+        PlatformLightweightLock                m_displayThreadsLock;
 
         HashMap<DisplayHandle, ScreenshotInfoVector> m_scheduledScreenshots;
         ScreenshotInfoVector m_processedScreenshots;
@@ -152,7 +200,6 @@ namespace ramses_internal
         // temporary containers kept to avoid re-allocations
         Vector<DisplayHandle> m_tempDisplaysToRender; // used in RendererLogger - adapt if changing behavior
         Vector<DisplayHandle> m_tempDisplaysToSwapBuffers;
-        Vector<SceneId> m_tempScenesRendered;
     };
 }
 
@@ -23,13 +23,14 @@ namespace ramses_internal
         Bool                       containsResource     (const ResourceContentHash& hash) const;
 
         void                       addResourceRef       (const ResourceContentHash& hash, SceneId sceneId);
-        void                       removeResourceRef    (const ResourceContentHash& hash, SceneId sceneId);
+        void                       removeResourceRef    (const ResourceContentHash& hash, SceneId sceneId, UInt64 frameCounter = 0);
 
         void                       setResourceStatus    (const ResourceContentHash& hash, EResourceStatus status, UInt64 updateFrameCounter = 0);
         EResourceStatus            getResourceStatus    (const ResourceContentHash& hash) const;
         const ResourceDescriptor&  getResourceDescriptor(const ResourceContentHash& hash) const;
 
         void                       setResourceData      (const ResourceContentHash& hash, ManagedResource resourceObject, DeviceResourceHandle deviceHandle, EResourceType resourceType);
+        void                       setResourcePositionBounds(const ResourceContentHash& hash, const BoundingBox& bounds);
 
         const ResourceDescriptors& getAllResourceDescriptors() const;
 
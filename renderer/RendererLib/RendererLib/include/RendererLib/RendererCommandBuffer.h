@@ -29,7 +29,7 @@ namespace ramses_internal
         // overwrite methods from RendererCommands
         void publishScene(SceneId sceneId, const Guid& clientID);
         void unpublishScene(SceneId sceneId);
-        void receiveScene(const SceneInfo& sceneInfo);
+        void receiveScene(const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush);
         void subscribeScene(SceneId sceneId);
         void unsubscribeScene(SceneId sceneId, bool indirect);
         void enqueueActionsForScene(SceneId sceneId, SceneActionCollection&& newActions);
@@ -42,6 +42,7 @@ namespace ramses_internal
 
         void updateWarpingData(DisplayHandle displayHandle, const WarpingMeshData& warpingData);
         void readPixels(DisplayHandle displayHandle, const String& filename, Bool fullScreen, UInt32 x, UInt32 y, UInt32 width, UInt32 height, Bool sendViaDLT = false);
+        void readPixelsPeriodically(DisplayHandle displayHandle, UInt32 x, UInt32 y, UInt32 width, UInt32 height, UInt32 frameInterval);
         void setClearColor(DisplayHandle displayHandle, const Vector4& color);
 
         void linkSceneData(SceneId providerSceneId, DataSlotId providerDataSlotId, SceneId consumerSceneId, DataSlotId consumerDataSlotId);
@@ -55,6 +56,7 @@ namespace ramses_internal
 
         void logStatistics      ();
         void logRendererInfo    (ERendererLogTopic topic, Bool verbose, NodeHandle nodeHandleFilter);
+        void querySceneLatencyStatistics(SceneId sceneId);
 
         void systemCompositorControllerListIviSurfaces();
         void systemCompositorControllerSetIviSurfaceVisibility(WaylandIviSurfaceId surfaceId, Bool visibility);
@@ -71,6 +73,8 @@ namespace ramses_internal
         void setFrameProfilerTimingGraphHeight(UInt32 height);
         void setFrameProfilerCounterGraphHeight(UInt32 height);
         void setFrameProfilerFilteredRegionFlags(UInt32 flags);
+        void setFrameProfilerTraceCapture(Bool enable, UInt64 spikeThresholdMicrosec, const String& spikeDumpFilePrefix);
+        void dumpFrameProfilerTrace(const String& fileName);
 
         void setFrameTimerLimits(UInt64 limitForClientResourcesUploadMicrosec, UInt64 limitForSceneActionsApplyMicrosec, UInt64 limitForOffscreenBufferRenderMicrosec);
         void setSkippingOfUnmodifiedBuffers(Bool enable);
@@ -68,6 +68,7 @@ namespace ramses_internal
         ERendererCommand_ResetRenderView,
         ERendererCommand_UpdateWarpingData,
         ERendererCommand_ReadPixels,
+        ERendererCommand_ReadPixelsPeriodically,
         ERendererCommand_SetClearColor,
         ERendererCommand_SceneActions,
         // Data linking
@@ -81,6 +82,7 @@ namespace ramses_internal
         // Logging
         ERendererCommand_LogRendererStatistics,
         ERendererCommand_LogRendererInfo,
+        ERendererCommand_QuerySceneLatencyStatistics,
         // Compositing
         ERendererCommand_SystemCompositorControllerListIviSurfaces,
         ERendererCommand_SystemCompositorControllerSetIviSurfaceVisibility,
@@ -101,6 +103,8 @@ namespace ramses_internal
         ERendererCommand_FrameProfiler_TimingGraphHeight,
         ERendererCommand_FrameProfiler_CounterGraphHeight,
         ERendererCommand_FrameProfiler_RegionFilterFlags,
+        ERendererCommand_FrameProfiler_TraceCapture,
+        ERendererCommand_FrameProfiler_DumpTrace,
 
         ERendererCommand_COUNT
     };
@@ -117,6 +121,8 @@ namespace ramses_internal
         SceneInfo sceneInformation;
         Guid clientID;
         Bool indirect = false;
+        Guid sceneInstanceEpoch;
+        Bool deltaSinceLastAppliedFlush = false;
     };
 
     struct SceneActionsCommand : public RendererCommand
@@ -173,6 +179,7 @@ namespace ramses_internal
         Bool                    fullScreen;
         Bool                    sendViaDLT;
         String                  filename;
+        UInt32                  frameInterval;
     };
 
     struct SetClearColorCommand : public RendererCommand
@@ -267,6 +274,9 @@ namespace ramses_internal
         UInt32 newCounterGraphHeight = 0;
         UInt32 newTimingGraphHeight = 0;
         UInt32 newRegionFilterFlags = 0;
+        Bool enableTraceCapture = false;
+        UInt64 traceSpikeThreshold = 0;
+        String traceFileName;
     };
 
 
@@ -306,6 +316,7 @@ namespace ramses_internal
         "ERendererCommand_ResetRenderView",
         "ERendererCommand_UpdateWarpingData",
         "ERendererCommand_ReadPixels",
+        "ERendererCommand_ReadPixelsPeriodically",
         "ERendererCommand_SetClearColor",
         "ERendererCommand_SceneActions",
         "ERendererCommand_LinkSceneData",
@@ -317,6 +328,7 @@ namespace ramses_internal
         "ERendererCommand_AssignSceneToFramebuffer",
         "ERendererCommand_LogRendererStatistics",
         "ERendererCommand_LogRendererInfo",
+        "ERendererCommand_QuerySceneLatencyStatistics",
         "ERendererCommand_SystemCompositorControllerListIviSurfaces",
         "ERendererCommand_SystemCompositorControllerSetIviSurfaceVisibility",
         "ERendererCommand_SystemCompositorControllerSetIviSurfaceOpacity",
@@ -331,7 +343,9 @@ namespace ramses_internal
         "ERendererCommand_FrameProfiler_Toggle",
         "ERendererCommand_FrameProfiler_TimingGraphHeight",
         "ERendererCommand_FrameProfiler_CounterGraphHeight",
-        "ERendererCommand_FrameProfiler_RegionFilterFlags"
+        "ERendererCommand_FrameProfiler_RegionFilterFlags",
+        "ERendererCommand_FrameProfiler_TraceCapture",
+        "ERendererCommand_FrameProfiler_DumpTrace"
     };
 
     ENUM_TO_STRING(ERendererCommand, RendererCommandNames, ERendererCommand_COUNT);
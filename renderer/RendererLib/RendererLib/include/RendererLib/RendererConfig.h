@@ -30,9 +30,18 @@ namespace ramses_internal
         const String& getKPIFileName() const;
         void setKPIFileName(const String& filename);
 
+        const String& getDeviceTraceFileName() const;
+        void setDeviceTraceFileName(const String& filename);
+
+        const String& getBinaryShaderCacheDirectory() const;
+        void setBinaryShaderCacheDirectory(const String& directory);
+
         void enableSystemCompositorControl();
         Bool getSystemCompositorControlEnabled() const;
 
+        void enableRenderThreadPerDisplay();
+        Bool getRenderThreadPerDisplayEnabled() const;
+
         std::chrono::microseconds getFrameCallbackMaxPollTime() const;
         void setFrameCallbackMaxPollTime(std::chrono::microseconds pollTime);
 
@@ -41,7 +50,10 @@ namespace ramses_internal
         String m_waylandSocketEmbeddedGroupName;
         int m_waylandSocketEmbeddedFD = -1;
         String m_kpiFilename;
+        String m_deviceTraceFilename;
+        String m_binaryShaderCacheDirectory;
         Bool m_systemCompositorEnabled = false;
+        Bool m_renderThreadPerDisplayEnabled = false;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
     };
 }
@@ -40,6 +40,7 @@ namespace ramses_internal
         ERendererLogTopic_Links,
         ERendererLogTopic_EmbeddedCompositor,
         ERendererLogTopic_EventQueue,
+        ERendererLogTopic_SceneLatencies,
         ERendererLogTopic_All,
         ERendererLogTopic_PeriodicLog,
         ERendererLogTopic_NUMBER_OF_ELEMENTS
@@ -56,6 +57,7 @@ namespace ramses_internal
         "ERendererLogTopic_Links",
         "ERendererLogTopic_EmbeddedCompositor",
         "ERendererLogTopic_EventQueue",
+        "ERendererLogTopic_SceneLatencies",
         "ERendererLogTopic_All",
         "ERendererLogTopic_PeriodicLog"
     };
@@ -80,6 +82,7 @@ namespace ramses_internal
         static void LogLinks(const RendererScenes& scenes, RendererLogContext& context);
         static void LogEmbeddedCompositor(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogEventQueue(const RendererSceneUpdater& updater, RendererLogContext& context);
+        static void LogSceneLatencies(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogPeriodicInfo(const RendererSceneUpdater& updater);
         static void LogStreamTextures(const RendererSceneUpdater& updater, RendererLogContext& context);
 
@@ -14,6 +14,7 @@
 #include "RendererLib/RendererSceneResourceRegistry.h"
 #include "RendererLib/ClientResourceUploadingManager.h"
 #include "RendererResourceManagerUtils.h"
+#include "RendererLib/RenderBufferPool.h"
 #include "Collections/HashMap.h"
 #include "Collections/Vector.h"
 #include "Utils/MemoryPool.h"
@@ -38,7 +39,11 @@ namespace ramses_internal
             RequesterID requesterId,
             Bool keepEffects,
             const FrameTimer& frameTimer,
-            UInt64 clientResourceCacheSize = 0u);
+            UInt64 clientResourceCacheSize = 0u,
+            EGPUMemoryCachePolicy clientResourceCachePolicy = EGPUMemoryCachePolicy_LeastRecentlyUsed,
+            Bool progressiveTextureUpload = false,
+            UInt64 renderBufferPoolSize = 0u,
+            Bool computeVertexPositionBounds = false);
         virtual ~RendererResourceManager();
 
         // Client resources
@@ -52,6 +57,7 @@ namespace ramses_internal
         virtual void                 uploadAndUnloadPendingClientResources() override;
 
         virtual DeviceResourceHandle getClientResourceDeviceHandle(const ResourceContentHash& hash) const override;
+        virtual BoundingBox          getClientResourcePositionBounds(const ResourceContentHash& hash) const override;
         virtual EResourceStatus      getClientResourceStatus(const ResourceContentHash& hash) const override;
         virtual EResourceType        getClientResourceType(const ResourceContentHash& hash) const override;
 
@@ -128,7 +134,11 @@ namespace ramses_internal
         SceneResourceRegistryMap       m_sceneResourceRegistryMap;
         ClientResourceUploadingManager m_resourceUploadingManager;
 
+        // render buffers of scenes and offscreen buffers are recycled through the pool
+        RenderBufferPool               m_renderBufferPool;
+
         const UInt64 m_numberOfFramesToRerequestResource = 60u;
+        static const UInt32 NumberOfSubsequentUpdatesToStreamDataBuffer = 3u;
         UInt64 m_frameCounter = 0u;
         UInt64 m_numberOfArrivedResourcesInWrongStatus = 0u;
         UInt64 m_sizeOfArrivedResourcesInWrongStatus = 0u;
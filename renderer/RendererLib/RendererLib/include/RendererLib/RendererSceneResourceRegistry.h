@@ -59,6 +59,8 @@ namespace ramses_internal
         DeviceResourceHandle            getDataBufferDeviceHandle   (DataBufferHandle handle) const;
         EDataBufferType                 getDataBufferType           (DataBufferHandle handle) const;
         void                            getAllDataBuffers           (DataBufferHandleVector& dataBuffers) const;
+        // returns number of subsequent frames in which data buffer was updated, including given frame
+        UInt32                          markDataBufferUpdated       (DataBufferHandle handle, UInt64 frameIndex);
 
         void                            addTextureBuffer(TextureBufferHandle handle, DeviceResourceHandle deviceHandle, UInt32 size);
         void                            removeTextureBuffer(TextureBufferHandle handle);
@@ -114,8 +116,13 @@ namespace ramses_internal
             DeviceResourceHandle deviceHandle;
             UInt32 size;
             EDataBufferType dataBufferType;
+            UInt64 lastUpdateFrame;
+            UInt32 subsequentUpdateFrames;
         };
 
+        // updates with this many frames or less in between are still considered subsequent
+        static const UInt64 MaxFramesBetweenSubsequentDataBufferUpdates = 2u;
+
         using StreamTextureSourceMap = HashMap<StreamTextureHandle,  StreamTextureEntry>;
         using RenderBufferMap        = HashMap<RenderBufferHandle,   RenderBufferEntry>;
         using RenderTargetMap        = HashMap<RenderTargetHandle,   RenderTargetEntry>;
@@ -62,7 +62,7 @@ namespace ramses_internal
         void handleSceneUnmappingRequest        (SceneId sceneId);
         void handleSceneShowRequest             (SceneId sceneId);
         void handleSceneHideRequest             (SceneId sceneId);
-        void handleSceneReceived                (const SceneInfo& sceneInfo);
+        void handleSceneReceived                (const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush);
         Bool handleBufferCreateRequest          (OffscreenBufferHandle buffer, DisplayHandle display, UInt32 width, UInt32 height, Bool isDoubleBuffered);
         Bool handleBufferDestroyRequest         (OffscreenBufferHandle buffer, DisplayHandle display);
         Bool handleSceneOffscreenBufferAssignmentRequest(SceneId sceneId, OffscreenBufferHandle buffer);
@@ -78,7 +78,8 @@ namespace ramses_internal
         static const UInt MaximumPendingFlushes = 20u;
 
     private:
-        void destroyScene(SceneId sceneID);
+        void destroyScene(SceneId sceneID, Bool retainSceneCopy = false);
+        Bool canRetainScene(SceneId sceneID) const;
         void unloadSceneResourcesAndUnrefSceneResources(SceneId sceneId);
         void markClientAndSceneResourcesForReupload(SceneId sceneId);
         void appendPendingSceneActions(SceneId sceneId, SceneActionCollection& actionsForScene);
@@ -105,6 +106,7 @@ namespace ramses_internal
         void updateScenesTransformationCache();
         void updateScenesDataLinks();
         void updateScenesStates();
+        void updateInternedStatesStatistics();
 
         void activateDisplayContext(DisplayHandle& activeDisplay, DisplayHandle displayToActivate);
 
@@ -12,6 +12,7 @@
 #include "RendererLib/StagingInfo.h"
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/SceneLinksManager.h"
+#include "RendererLib/RenderStateCache.h"
 #include "Utils/ScopedPointer.h"
 
 namespace ramses_internal
@@ -41,9 +42,22 @@ namespace ramses_internal
         const StagingInfo&         getStagingInfo(SceneId sceneID) const;
         StagingInfo&               getStagingInfo(SceneId sceneID);
 
+        // retained scene is removed from renderer scenes but kept so that it can be restored on re-subscription
+        void                       retainScene(SceneId sceneID);
+        Bool                       hasRetainedScene(SceneId sceneID) const;
+        const StagingInfo&         getRetainedStagingInfo(SceneId sceneID) const;
+        void                       restoreRetainedScene(SceneId sceneID);
+        void                       destroyRetainedScene(SceneId sceneID);
+
         const SceneLinksManager&     getSceneLinksManager() const;
         SceneLinksManager&           getSceneLinksManager();
 
+        const RenderStateCache&      getRenderStateCache() const;
+        RenderStateCache&            getRenderStateCache();
+
+        const TextureSamplerStatesCache& getTextureSamplerStatesCache() const;
+        TextureSamplerStatesCache&       getTextureSamplerStatesCache();
+
         using RendererSceneInfoMap::begin;
         using RendererSceneInfoMap::end;
         using RendererSceneInfoMap::count;
@@ -51,6 +65,11 @@ namespace ramses_internal
     private:
         // Scoped ptr due to dependency on *this which cannot be passed in member initialization list
         ScopedPointer<SceneLinksManager> m_sceneLinksManager;
+        // shared by all scenes, so that equal render states or sampler states of different scenes have same id
+        RenderStateCache          m_renderStateCache;
+        TextureSamplerStatesCache m_textureSamplerStatesCache;
+
+        RendererSceneInfoMap      m_retainedScenes;
     };
 }
 
@@ -34,8 +34,21 @@ namespace ramses_internal
         void offscreenBufferSwapped(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer, bool isInterruptible);
         void offscreenBufferInterrupted(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer);
         void framebufferSwapped(DisplayHandle display);
+        void displayFrameRendered(DisplayHandle display, UInt32 frameDurationMicroseconds);
+        void sceneLayerComposited(DisplayHandle display, UInt32 savedRenderCpuTimeMicroseconds);
+        void sceneLayersMemoryUsed(DisplayHandle display, UInt64 sizeInBytes);
+        void renderStatesInterned(UInt32 uniqueCount, UInt32 requestedCount);
+        void textureSamplerStatesInterned(UInt32 uniqueCount, UInt32 requestedCount);
 
-        void streamTextureUpdated(StreamTextureSourceId sourceId, UInt numUpdates);
+        void streamTextureUpdated(StreamTextureSourceId sourceId, UInt numUpdates, UInt uploadedBytes);
+
+        // GPU time spent on scene and its rendering passes within one frame
+        void sceneGpuTimeMeasured(SceneId sceneId, UInt32 gpuTimeMicroseconds);
+        void renderPassGpuTimeMeasured(SceneId sceneId, RenderPassHandle renderPass, UInt32 gpuTimeMicroseconds);
+        void blitPassGpuTimeMeasured(SceneId sceneId, BlitPassHandle blitPass, UInt32 gpuTimeMicroseconds);
+
+        // frame start delayed by frame pacing, deadline missed if frame was not finished in time for its swap
+        void framePaced(UInt32 delayMicroseconds, Bool deadlineMissed);
 
         void untrackScene(SceneId sceneId);
         void untrackOffscreenBuffer(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer);
@@ -53,6 +66,19 @@ namespace ramses_internal
         UInt64 m_lastFrameTick = 0u;
         UInt32 m_frameDurationMin = std::numeric_limits<UInt32>::max();
         UInt32 m_frameDurationMax = 0u;
+        UInt32 m_numUniqueRenderStates = 0u;
+        UInt32 m_numRequestedRenderStates = 0u;
+        UInt32 m_numUniqueTextureSamplerStates = 0u;
+        UInt32 m_numRequestedTextureSamplerStates = 0u;
+        UInt32 m_numFramesPaced = 0u;
+        UInt32 m_numPacingDeadlinesMissed = 0u;
+        SummaryEntry<UInt32> m_framePacingDelay;
+
+        struct GpuTimeStatistics
+        {
+            UInt numMeasured = 0u;
+            SummaryEntry<UInt32> gpuTime;
+        };
 
         struct SceneStatistics
         {
@@ -75,6 +101,10 @@ namespace ramses_internal
             SummaryEntry<UInt> numSceneResourceActionsPerFlush;
 
             UInt numRendered = 0u;
+
+            GpuTimeStatistics gpuTime;
+            std::map<RenderPassHandle, GpuTimeStatistics> renderPassGpuTime;
+            std::map<BlitPassHandle, GpuTimeStatistics> blitPassGpuTime;
         };
 
         struct OffscreenBufferStatistics
@@ -87,18 +117,27 @@ namespace ramses_internal
         struct DisplayStatistics
         {
             UInt numFrameBufferSwapped = 0;
+            UInt numFramesRendered = 0u;
+            SummaryEntry<UInt64> frameDuration;
+            UInt numSceneLayersComposited = 0u;
+            UInt64 sceneLayersSavedRenderCpuTime = 0u;
+            UInt64 sceneLayersMemory = 0u;
             std::map<DeviceResourceHandle, OffscreenBufferStatistics> offscreenBufferStatistics;
         };
 
         struct StreamTextureStatistics
         {
             UInt numUpdates = 0u;
+            UInt64 uploadedBytes = 0u;
             UInt numFramesWhereUpdated = 0u;
             UInt maxUpdatesPerFrame = 0u;
             UInt maxFramesWithNoUpdate = 0u;
             Int32 lastFrameUpdated = -1;
         };
 
+        static void UpdateGpuTime(GpuTimeStatistics& gpuTimeStats, UInt32 gpuTimeMicroseconds);
+        static void WriteGpuTimeToStream(StringOutputStream& str, const GpuTimeStatistics& gpuTimeStats);
+
         template <typename T>
         struct StronglyTypedValueComparator
         {
@@ -50,6 +50,11 @@ namespace ramses_internal
             return BlitPassHandle(m_handle);
         }
 
+        Bool operator==(const RenderingPassInfo& other) const
+        {
+            return m_type == other.m_type && m_handle == other.m_handle;
+        }
+
     private:
         ERenderingPassType      m_type;
         MemoryHandle            m_handle;
@@ -11,6 +11,8 @@
 
 #include "RendererAPI/Types.h"
 #include "RendererLib/DataReferenceLinkCachedScene.h"
+#include "RendererLib/RenderStateCache.h"
+#include "RendererLib/BoundingBox.h"
 
 namespace ramses_internal
 {
@@ -22,7 +24,8 @@ namespace ramses_internal
     class ResourceCachedScene : public DataReferenceLinkCachedScene
     {
     public:
-        ResourceCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& creationInfo = SceneInfo());
+        ResourceCachedScene(SceneLinksManager& sceneLinksManager, RenderStateCache& renderStateCache, TextureSamplerStatesCache& textureSamplerStatesCache, const SceneInfo& creationInfo = SceneInfo());
+        virtual ~ResourceCachedScene();
 
         virtual void                        preallocateSceneSize(const SceneSizeInformation& sizeInfo) override;
         // Renderable allocation
@@ -34,6 +37,19 @@ namespace ramses_internal
         virtual void                        releaseTextureSampler       (TextureSamplerHandle handle) override;
         virtual void                        releaseStreamTexture        (StreamTextureHandle handle) override;
 
+        // Render states are interned in renderer wide cache
+        virtual RenderStateHandle           allocateRenderState             (RenderStateHandle stateHandle = RenderStateHandle::Invalid()) override;
+        virtual void                        releaseRenderState              (RenderStateHandle stateHandle) override;
+        virtual void                        setRenderStateBlendFactors      (RenderStateHandle stateHandle, EBlendFactor srcColor, EBlendFactor destColor, EBlendFactor srcAlpha, EBlendFactor destAlpha) override;
+        virtual void                        setRenderStateBlendOperations   (RenderStateHandle stateHandle, EBlendOperation operationColor, EBlendOperation operationAlpha) override;
+        virtual void                        setRenderStateCullMode          (RenderStateHandle stateHandle, ECullMode cullMode) override;
+        virtual void                        setRenderStateDrawMode          (RenderStateHandle stateHandle, EDrawMode drawMode) override;
+        virtual void                        setRenderStateDepthFunc         (RenderStateHandle stateHandle, EDepthFunc func) override;
+        virtual void                        setRenderStateDepthWrite        (RenderStateHandle stateHandle, EDepthWrite flag) override;
+        virtual void                        setRenderStateStencilFunc       (RenderStateHandle stateHandle, EStencilFunc func, UInt32 ref, UInt8 mask) override;
+        virtual void                        setRenderStateStencilOps        (RenderStateHandle stateHandle, EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass) override;
+        virtual void                        setRenderStateColorWriteMask    (RenderStateHandle stateHandle, ColorWriteMask colorMask) override;
+
         // Renderable data (stuff required for rendering)
         virtual void                        setRenderableEffect         (RenderableHandle renderableHandle, const ResourceContentHash& effectHash) override;
 
@@ -56,6 +72,14 @@ namespace ramses_internal
         const DeviceHandleVector&           getCachedHandlesForTextureSamplers() const;
         const DeviceHandleVector&           getCachedHandlesForRenderTargets() const;
         const DeviceHandleVector&           getCachedHandlesForBlitPassRenderTargets() const;
+        // bounds of positions in geometry of renderable, invalid if not known
+        const BoundingBox&                  getRenderablePositionBounds(RenderableHandle renderable) const;
+
+        // equal render states have equal id, also across scenes
+        UInt32                              getInternedRenderStateId    (RenderStateHandle stateHandle) const;
+        const RenderStateBlock&             getInternedRenderState      (UInt32 renderStateId) const;
+        // equal sampler states have equal id, also across scenes
+        UInt32                              getInternedTextureSamplerStatesId(TextureSamplerHandle samplerHandle) const;
 
         void updateRenderableResources(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager);
         void updateRenderablesResourcesDirtiness();
@@ -74,6 +98,7 @@ namespace ramses_internal
         Bool isDataInstanceDirty(DataInstanceHandle handle) const;
         Bool isTextureSamplerDirty(TextureSamplerHandle handle) const;
         Bool isGeometryDataLayout(const DataLayout& layout) const;
+        void updateInternedRenderState(RenderStateHandle stateHandle);
         static Bool CheckAndUpdateDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash);
         static Bool CheckAndUpdateBufferDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash, SceneId sceneId, DataBufferHandle dataBufferHandle);
 
@@ -90,10 +115,16 @@ namespace ramses_internal
 
         DeviceHandleVector         m_effectDeviceHandleCache;
         DeviceHandleCache          m_deviceHandleCacheForVertexAttributes;
+        Vector<BoundingBox>        m_positionBoundsCache;
         mutable DeviceHandleVector m_deviceHandleCacheForTextures;
         DeviceHandleVector         m_renderTargetCache;
         DeviceHandleVector         m_blitPassCache;
 
+        RenderStateCache&          m_renderStateCache;
+        Vector<UInt32>             m_internedRenderStateIds;
+        TextureSamplerStatesCache& m_textureSamplerStatesCache;
+        Vector<UInt32>             m_internedTextureSamplerStatesIds;
+
         mutable Bool       m_renderableResourcesDirtinessNeedsUpdate;
         mutable BoolVector m_renderableResourcesDirty;
         mutable BoolVector m_dataInstancesDirty;
@@ -10,6 +10,7 @@
 #define RAMSES_RESOURCEDESCRIPTOR_H
 
 #include "RendererLib/EResourceStatus.h"
+#include "RendererLib/BoundingBox.h"
 #include "Resource/EResourceType.h"
 #include "RendererAPI/Types.h"
 #include "SceneAPI/SceneId.h"
@@ -28,7 +29,9 @@ namespace ramses_internal
         SceneIdVector sceneUsage;
         ManagedResource resource;
         UInt64 lastUpdateFrameCounter;
+        UInt64 lastUsedFrameCounter;
         UInt32 expectedVRAMUsage;
+        BoundingBox positionBounds;
     };
 
     typedef HashMap<ResourceContentHash, ResourceDescriptor> ResourceDescriptors;
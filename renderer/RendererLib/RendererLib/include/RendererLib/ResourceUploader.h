@@ -24,13 +24,19 @@ namespace ramses_internal
     public:
         ResourceUploader(IBinaryShaderCache* binaryShaderCache = NULL);
 
+        virtual void                 deviceInitialized(IRenderBackend& renderBackend) override;
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, ManagedResource resourceObject) override;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle uploadTextureMipTail(IRenderBackend& renderBackend, ManagedResource resourceObject, UInt32 mipTailMaxSize, UInt32& lowestUploadedMipLevel) override;
+        virtual void                 uploadTextureMipLevel(IRenderBackend& renderBackend, ManagedResource resourceObject, DeviceResourceHandle handle, UInt32 mipLevel) override;
 
     private:
         DeviceResourceHandle uploadTexture(IDevice& device, const TextureResource& texture);
         DeviceResourceHandle queryBinaryShaderCacheAndUploadEffect(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash);
 
+        static DeviceResourceHandle AllocateTexture(IDevice& device, const TextureResource& texture);
+        static void UploadTextureMipLevelData(IDevice& device, const TextureResource& texture, DeviceResourceHandle textureDeviceHandle, UInt32 mipLevel, UInt32 face);
+        static UInt32 GetNumberOfFaces(const TextureResource& texture);
         static UInt32 EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, UInt32 numMipLevelsToAllocate);
 
         IBinaryShaderCache* const m_binaryShaderCache;
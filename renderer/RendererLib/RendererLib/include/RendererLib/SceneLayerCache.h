@@ -0,0 +1,85 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENELAYERCACHE_H
+#define RAMSES_SCENELAYERCACHE_H
+
+#include "RendererLib/WarpingPass.h"
+#include "SceneAPI/SceneId.h"
+#include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
+#include "Collections/Vector.h"
+
+namespace ramses_internal
+{
+    class IDevice;
+    class RendererCachedScene;
+
+    // Keeps scenes shown on the framebuffer of a display rendered in offscreen color layers of display size.
+    // A scene which was not modified since its layer was rendered is composited from the layer with a single
+    // textured quad instead of rendering it again when another scene of the display changes.
+    // Layers are cleared to transparent black and composited with premultiplied alpha blending, which gives
+    // the same framebuffer content as rendering the scene directly only if the scene itself blends that way
+    // and does not use depth or stencil shared with other scenes, see CanCompositeScene.
+    // Layers are only created as long as their total size stays within the memory budget.
+    class SceneLayerCache
+    {
+    public:
+        SceneLayerCache(IDevice& device, UInt32 width, UInt32 height, UInt64 memoryBudget);
+        ~SceneLayerCache();
+
+        // true if all renderables the scene renders to the framebuffer use premultiplied alpha blending
+        // (One, OneMinusSrcAlpha for color and alpha), write all color channels and neither depth nor stencil test or write
+        static Bool CanCompositeScene(const RendererCachedScene& scene);
+
+        void markSceneModified(SceneId sceneId);
+        void markAllScenesModified();
+        // to be called after every framebuffer frame with the scenes shown in it, layers of other scenes are deleted
+        // and scenes not modified since then get rendered into layers
+        void finishFrame(const Vector<SceneId>& shownScenes);
+
+        Bool hasValidLayer(SceneId sceneId) const;
+        Bool wasSceneModified(SceneId sceneId) const;
+
+        // layer is created if needed, render target must be cleared and scene rendered into it after this call,
+        // returns invalid handle if there is no layer and a new one would exceed the memory budget
+        DeviceResourceHandle getLayerRenderTarget(SceneId sceneId);
+        void setLayerRendered(SceneId sceneId, UInt32 renderCpuDurationMicroseconds);
+        void removeLayer(SceneId sceneId);
+        // returns last measured CPU time of rendering the scene into its layer, which was saved by compositing it,
+        // scissor state of the target is kept
+        UInt32 compositeLayer(SceneId sceneId, DeviceResourceHandle targetBuffer);
+
+        UInt32 getLayerCount() const;
+        UInt64 getLayersMemorySize() const;
+        UInt64 getLayerMemorySize() const;
+
+    private:
+        struct Layer
+        {
+            DeviceResourceHandle colorBuffer;
+            DeviceResourceHandle renderTarget;
+            Bool valid = false;
+            UInt32 renderCpuDuration = 0u;
+        };
+
+        void deleteLayer(const Layer& layer);
+
+        IDevice& m_device;
+        const UInt32 m_width;
+        const UInt32 m_height;
+        const UInt64 m_memoryBudget;
+        WarpingPass m_compositingPass;
+
+        HashMap<SceneId, Layer> m_layers;
+        HashSet<SceneId> m_modifiedScenes;
+        Bool m_allScenesModified = false;
+    };
+}
+
+#endif
@@ -29,6 +29,7 @@ namespace ramses_internal
         void removeDataLink(SceneId consumerSceneId, DataSlotId consumerId);
 
         void handleSceneRemoved(SceneId sceneId);
+        void handleSceneRetained(SceneId sceneId);
         void handleSceneUnmapped(SceneId sceneId);
         void handleDataSlotCreated(SceneId sceneId, DataSlotHandle dataSlotHandle);
         void handleDataSlotDestroyed(SceneId sceneId, DataSlotHandle dataSlotHandle);
@@ -41,6 +42,8 @@ namespace ramses_internal
     private:
         template <typename LINKMANAGER>
         void removeLinksToProvider(SceneId sceneId, DataSlotHandle providerSlotHandle, LINKMANAGER& manager) const;
+        template <typename LINKMANAGER>
+        void removeLinksOfConsumerScene(SceneId sceneId, LINKMANAGER& manager) const;
 
         const RendererScenes&     m_rendererScenes;
         RendererEventCollector&   m_rendererEventCollector;
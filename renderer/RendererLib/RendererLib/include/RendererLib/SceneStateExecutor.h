@@ -25,7 +25,7 @@ namespace ramses_internal
 
         void setPublished                     (SceneId sceneId, const Guid& clientWhereSceneIsAvailable);
         void setUnpublished                   (SceneId sceneId);
-        void setSubscriptionRequested         (SceneId sceneId);
+        void setSubscriptionRequested         (SceneId sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex);
         void setSubscriptionPending           (SceneId sceneId);
         void setSubscribed                    (SceneId sceneId);
         void setUnsubscribed                  (SceneId sceneId, bool indirect);
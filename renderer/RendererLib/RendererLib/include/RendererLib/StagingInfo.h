@@ -14,6 +14,7 @@
 #include "Scene/SceneResourceChanges.h"
 #include "Transfer/ResourceTypes.h"
 #include "Components/FlushTimeInformation.h"
+#include "Collections/Guid.h"
 #include <deque>
 
 namespace ramses_internal
@@ -50,6 +51,11 @@ namespace ramses_internal
 
         // client resources referenced by renderer scene (without pending flushes)
         ResourceContentHashVector clientResourcesInUse;
+
+        // client's instance of the scene and last flush whose changes incl. resources are fully applied to renderer scene,
+        // a retained scene copy is resynchronized from there (flush indices start at 1, 0 if no consistent state)
+        Guid                      sceneInstanceEpoch;
+        UInt64                    lastAppliedFlushIndex = 0u;
     };
 }
 
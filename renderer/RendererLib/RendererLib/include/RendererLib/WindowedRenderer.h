@@ -23,6 +23,7 @@
 #include "RendererCommands/SetClearColor.h"
 #include "RendererCommands/SetSkippingOfUnmodifiedBuffers.h"
 #include "RendererCommands/ShowFrameProfiler.h"
+#include "RendererCommands/FrameTrace.h"
 #include "RendererCommands/ShowSceneCommand.h"
 #include "RendererCommands/LinkSceneData.h"
 #include "RendererCommands/UnlinkSceneData.h"
@@ -52,7 +53,8 @@ namespace ramses_internal
             RendererCommandBuffer& commandBuffer,
             ISceneGraphConsumerComponent& sceneGraphConsumerComponent,
             IPlatformFactory& platformFactory,
-            const String& monitorFilename = String());
+            const String& monitorFilename = String(),
+            Bool renderThreadPerDisplay = false);
         ~WindowedRenderer();
 
         void update();
@@ -85,6 +87,7 @@ namespace ramses_internal
         Screenshot                                        m_cmdScreenshot;
         LogRendererInfo                                   m_cmdLogRendererInfo;
         ShowFrameProfiler                                 m_cmdShowFrameProfiler;
+        FrameTrace                                        m_cmdFrameTrace;
         PrintStatistics                                   m_cmdPrintStatistics;
         SetClearColor                                     m_cmdSetClearColor;
         SetSkippingOfUnmodifiedBuffers                    m_cmdSkippingOfUnmodifiedBuffers;
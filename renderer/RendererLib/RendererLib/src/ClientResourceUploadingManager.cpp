@@ -16,6 +16,10 @@
 #include "Common/Cpp11Macros.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "RendererLib/FrameTimer.h"
+#include "Resource/TextureResource.h"
+#include "Resource/ArrayResource.h"
+#include <algorithm>
+#include <vector>
 
 namespace ramses_internal
 {
@@ -25,13 +29,19 @@ namespace ramses_internal
         IRenderBackend& renderBackend,
         Bool keepEffects,
         const FrameTimer& frameTimer,
-        UInt64 clientResourceCacheSize)
+        UInt64 clientResourceCacheSize,
+        EGPUMemoryCachePolicy cachePolicy,
+        Bool progressiveTextureUpload,
+        Bool computeVertexPositionBounds)
         : m_clientResources(resources)
         , m_uploader(uploader)
         , m_renderBackend(renderBackend)
         , m_keepEffects(keepEffects)
         , m_frameTimer(frameTimer)
         , m_clientResourceCacheSize(clientResourceCacheSize)
+        , m_cachePolicy(cachePolicy)
+        , m_progressiveTextureUpload(progressiveTextureUpload)
+        , m_computeVertexPositionBounds(computeVertexPositionBounds)
     {
     }
 
@@ -52,21 +62,43 @@ namespace ramses_internal
 
     Bool ClientResourceUploadingManager::hasAnythingToUpload() const
     {
-        return !m_clientResources.getAllProvidedResources().empty();
+        return !m_clientResources.getAllProvidedResources().empty() || !m_texturesWithPendingMipLevels.empty();
     }
 
     void ClientResourceUploadingManager::uploadAndUnloadPendingResources()
     {
         ResourceContentHashVector resourcesToUpload;
+        Vector<UInt32> decompressionTimes;
         UInt64 sizeToUpload = 0u;
-        getAndPrepareClientResourcesToUploadNext(resourcesToUpload, sizeToUpload);
+        getAndPrepareClientResourcesToUploadNext(resourcesToUpload, decompressionTimes, sizeToUpload);
         const UInt64 sizeToBeFreed = getAmountOfMemoryToBeFreedForNewResources(sizeToUpload);
 
         ResourceContentHashVector resourcesToUnload;
         getClientResourcesToUnloadNext(resourcesToUnload, m_keepEffects, sizeToBeFreed);
 
         unloadClientResources(resourcesToUnload);
-        uploadClientResources(resourcesToUpload);
+        uploadClientResources(resourcesToUpload, decompressionTimes);
+        uploadPendingTextureMipLevels();
+    }
+
+    void ClientResourceUploadingManager::trackResourceReferenced(const ResourceContentHash& hash)
+    {
+        if (!m_clientResources.containsResource(hash))
+        {
+            ++m_cacheStatistics.misses;
+            return;
+        }
+
+        const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(hash);
+        if (rd.sceneUsage.empty() && rd.status == EResourceStatus_Uploaded)
+        {
+            ++m_cacheStatistics.hits;
+        }
+    }
+
+    const ClientResourceUploadingManager::CacheStatistics& ClientResourceUploadingManager::getCacheStatistics() const
+    {
+        return m_cacheStatistics;
     }
 
     void ClientResourceUploadingManager::unloadClientResources(const ResourceContentHashVector& resourcesToUnload)
@@ -78,13 +110,14 @@ namespace ramses_internal
         }
     }
 
-    void ClientResourceUploadingManager::uploadClientResources(const ResourceContentHashVector& resourcesToUpload)
+    void ClientResourceUploadingManager::uploadClientResources(const ResourceContentHashVector& resourcesToUpload, const Vector<UInt32>& decompressionTimes)
     {
+        assert(resourcesToUpload.size() == decompressionTimes.size());
         for (UInt32 i = 0; i < resourcesToUpload.size(); ++i)
         {
             const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(resourcesToUpload[i]);
             const UInt32 resourceSize = rd.resource.getResourceObject()->getDecompressedDataSize();
-            uploadClientResource(rd);
+            uploadClientResource(rd, decompressionTimes[i]);
 
             const Bool checkTimeLimit = (i % NumResourcesToUploadInBetweenTimeBudgetChecks == 0) || rd.type == EResourceType_Effect || resourceSize > LargeResourceByteSizeThreshold;
             if (checkTimeLimit && m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ClientResourcesUpload))
@@ -95,7 +128,7 @@ namespace ramses_internal
         }
     }
 
-    void ClientResourceUploadingManager::uploadClientResource(const ResourceDescriptor& rd)
+    void ClientResourceUploadingManager::uploadClientResource(const ResourceDescriptor& rd, UInt32 decompressionTime)
     {
         assert(rd.resource.getResourceObject() != NULL);
         assert(!rd.deviceHandle.isValid());
@@ -105,11 +138,25 @@ namespace ramses_internal
         assert(pResource->isDeCompressedAvailable());
 
         const UInt32 resourceSize = pResource->getDecompressedDataSize();
-        const DeviceResourceHandle deviceHandle = m_uploader.uploadResource(m_renderBackend, rd.resource);
+        const UInt64 uploadStartTime = PlatformTime::GetMicrosecondsMonotonic();
+        UInt32 lowestUploadedMipLevel = 0u;
+        const DeviceResourceHandle deviceHandle = shouldUploadProgressively(rd) ?
+            m_uploader.uploadTextureMipTail(m_renderBackend, rd.resource, ProgressiveTextureMipTailSize, lowestUploadedMipLevel) :
+            m_uploader.uploadResource(m_renderBackend, rd.resource);
+        const UInt32 uploadTime = static_cast<UInt32>(std::min<UInt64>(PlatformTime::GetMicrosecondsMonotonic() - uploadStartTime, std::numeric_limits<UInt32>::max() - decompressionTime));
+        if (deviceHandle.isValid() && lowestUploadedMipLevel > 0u)
+        {
+            m_texturesWithPendingMipLevels.push_back({ rd.hash, rd.resource, lowestUploadedMipLevel });
+        }
+        if (deviceHandle.isValid() && m_computeVertexPositionBounds && pResource->getTypeID() == EResourceType_VertexArray)
+        {
+            // resource data is released below
+            m_clientResources.setResourcePositionBounds(rd.hash, ComputeVertexPositionBounds(*pResource));
+        }
         m_clientResources.setResourceData(rd.hash, ManagedResource(), deviceHandle, pResource->getTypeID());
         if (deviceHandle.isValid())
         {
-            m_clientResourceSizes.put(rd.hash, resourceSize);
+            m_uploadedResourceInfos.put(rd.hash, { resourceSize, decompressionTime + uploadTime });
             m_clientResourceTotalUploadedSize += resourceSize;
             m_clientResources.setResourceStatus(rd.hash, EResourceStatus_Uploaded);
         }
@@ -124,25 +171,109 @@ namespace ramses_internal
     {
         assert(rd.sceneUsage.empty());
         assert(rd.status == EResourceStatus_Uploaded);
-        assert(m_clientResourceSizes.contains(rd.hash));
+        assert(m_uploadedResourceInfos.contains(rd.hash));
 
         LOG_TRACE(CONTEXT_PROFILING, "        ResourceUploadingManager::unloadResource delete resource of type " << EnumToString(rd.type));
         LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::unloadResource Unloading resource #" << rd.hash);
         m_uploader.unloadResource(m_renderBackend, rd.type, rd.hash, rd.deviceHandle);
 
-        auto resSizeIt = m_clientResourceSizes.find(rd.hash);
-        assert(m_clientResourceTotalUploadedSize >= resSizeIt->value);
-        m_clientResourceTotalUploadedSize -= resSizeIt->value;
-        m_clientResourceSizes.remove(resSizeIt);
+        const auto pendingIt = std::find_if(m_texturesWithPendingMipLevels.begin(), m_texturesWithPendingMipLevels.end(), [&rd](const TextureWithPendingMipLevels& texture)
+        {
+            return texture.hash == rd.hash;
+        });
+        if (pendingIt != m_texturesWithPendingMipLevels.end())
+        {
+            m_texturesWithPendingMipLevels.erase(pendingIt);
+        }
+
+        auto resInfoIt = m_uploadedResourceInfos.find(rd.hash);
+        const UInt32 resourceSize = resInfoIt->value.size;
+        assert(m_clientResourceTotalUploadedSize >= resourceSize);
+        m_clientResourceTotalUploadedSize -= resourceSize;
+        m_uploadedResourceInfos.remove(resInfoIt);
+        ++m_cacheStatistics.evictedResources;
+        m_cacheStatistics.evictedBytes += resourceSize;
 
         LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::unloadResource Removing resource descriptor for resource #" << rd.hash);
         m_clientResources.unregisterResource(rd.hash);
     }
 
+    void ClientResourceUploadingManager::uploadPendingTextureMipLevels()
+    {
+        // next higher mip levels are uploaded as long as time budget allows, oldest texture first,
+        // at least one mip level per frame is uploaded so that textures get to full detail even when rendering is under pressure
+        Bool timeBudgetExceeded = false;
+        UInt32 numFinishedTextures = 0u;
+        for (auto& texture : m_texturesWithPendingMipLevels)
+        {
+            assert(texture.lowestUploadedMipLevel > 0u);
+            const DeviceResourceHandle deviceHandle = m_clientResources.getResourceDescriptor(texture.hash).deviceHandle;
+            while (texture.lowestUploadedMipLevel > 0u && !timeBudgetExceeded)
+            {
+                const UInt64 uploadStartTime = PlatformTime::GetMicrosecondsMonotonic();
+                --texture.lowestUploadedMipLevel;
+                LOG_TRACE(CONTEXT_RENDERER, "ClientResourceUploadingManager::uploadPendingTextureMipLevels: uploading mip level " << texture.lowestUploadedMipLevel << " of texture #" << StringUtils::HexFromResourceContentHash(texture.hash));
+                m_uploader.uploadTextureMipLevel(m_renderBackend, texture.resource, deviceHandle, texture.lowestUploadedMipLevel);
+
+                UploadedResourceInfo* resourceInfo = m_uploadedResourceInfos.get(texture.hash);
+                assert(resourceInfo != nullptr);
+                const UInt64 uploadTime = PlatformTime::GetMicrosecondsMonotonic() - uploadStartTime;
+                resourceInfo->uploadCost = static_cast<UInt32>(std::min<UInt64>(resourceInfo->uploadCost + uploadTime, std::numeric_limits<UInt32>::max()));
+
+                timeBudgetExceeded = m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ClientResourcesUpload);
+            }
+
+            if (texture.lowestUploadedMipLevel > 0u)
+            {
+                break;
+            }
+            ++numFinishedTextures;
+        }
+
+        // textures are finished in order, so finished ones are at the front
+        if (numFinishedTextures > 0u)
+        {
+            m_texturesWithPendingMipLevels.erase(m_texturesWithPendingMipLevels.begin(), m_texturesWithPendingMipLevels.begin() + numFinishedTextures);
+        }
+    }
+
+    Bool ClientResourceUploadingManager::shouldUploadProgressively(const ResourceDescriptor& rd) const
+    {
+        if (!m_progressiveTextureUpload)
+        {
+            return false;
+        }
+
+        switch (rd.type)
+        {
+        case EResourceType_Texture2D:
+        case EResourceType_Texture3D:
+        case EResourceType_TextureCube:
+        {
+            // only worth for textures which come with whole mip chain provided and do not fit into mip tail
+            const TextureResource& texture = *rd.resource.getResourceObject()->convertTo<TextureResource>();
+            return !texture.getGenerateMipChainFlag() && texture.getMipDataSizes().size() > 1u && texture.getDecompressedDataSize() > ProgressiveTextureMipTailSize;
+        }
+        default:
+            return false;
+        }
+    }
+
     void ClientResourceUploadingManager::getClientResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, Bool keepEffects, UInt64 sizeToBeFreed) const
     {
         assert(resourcesToUnload.empty());
-        const ResourceContentHashVector& unusedResources = m_clientResources.getAllResourcesNotInUseByScenes();
+        if (sizeToBeFreed == 0u)
+        {
+            return;
+        }
+
+        ResourceContentHashVector resourcesInCostAwareOrder;
+        if (m_cachePolicy == EGPUMemoryCachePolicy_CostAware)
+        {
+            getUnusedResourcesInCostAwareOrder(resourcesInCostAwareOrder);
+        }
+        // registry keeps unused resources in the order they stopped being used by scenes, i.e. least recently used first
+        const ResourceContentHashVector& unusedResources = (m_cachePolicy == EGPUMemoryCachePolicy_CostAware) ? resourcesInCostAwareOrder : m_clientResources.getAllResourcesNotInUseByScenes();
         UInt64 sizeToUnload = 0u;
 
         // collect unused resources to be unloaded
@@ -162,16 +293,50 @@ namespace ramses_internal
                 if (!keepEffectCached)
                 {
                     resourcesToUnload.push_back(hash);
-                    assert(m_clientResourceSizes.contains(hash));
-                    sizeToUnload += *m_clientResourceSizes.get(hash);
+                    assert(m_uploadedResourceInfos.contains(hash));
+                    sizeToUnload += m_uploadedResourceInfos.get(hash)->size;
                 }
             }
         }
     }
 
-    void ClientResourceUploadingManager::getAndPrepareClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const
+    void ClientResourceUploadingManager::getUnusedResourcesInCostAwareOrder(ResourceContentHashVector& resources) const
+    {
+        assert(resources.empty());
+
+        // resources expensive to upload again are treated as if they were used later than they actually were
+        struct EvictionCandidate
+        {
+            UInt64 retainedUntilFrame;
+            ResourceContentHash hash;
+        };
+        const ResourceContentHashVector& unusedResources = m_clientResources.getAllResourcesNotInUseByScenes();
+        std::vector<EvictionCandidate> candidates;
+        candidates.reserve(unusedResources.size());
+        for (const auto& hash : unusedResources)
+        {
+            const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(hash);
+            const UploadedResourceInfo* info = m_uploadedResourceInfos.get(hash);
+            const UInt64 uploadCost = (info != nullptr) ? info->uploadCost : 0u;
+            candidates.push_back({ rd.lastUsedFrameCounter + uploadCost * CostAwareRetentionFramesPerMillisecond / 1000u, hash });
+        }
+
+        std::stable_sort(candidates.begin(), candidates.end(), [](const EvictionCandidate& a, const EvictionCandidate& b)
+        {
+            return a.retainedUntilFrame < b.retainedUntilFrame;
+        });
+
+        resources.reserve(candidates.size());
+        for (const auto& candidate : candidates)
+        {
+            resources.push_back(candidate.hash);
+        }
+    }
+
+    void ClientResourceUploadingManager::getAndPrepareClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, Vector<UInt32>& decompressionTimes, UInt64& totalSize) const
     {
         assert(resourcesToUpload.empty());
+        assert(decompressionTimes.empty());
 
         totalSize = 0u;
         const ResourceContentHashVector& providedResources = m_clientResources.getAllProvidedResources();
@@ -182,7 +347,9 @@ namespace ramses_internal
             assert(rd.status == EResourceStatus_Provided);
             assert(rd.resource.getResourceObject() != NULL);
             const IResource* resource = rd.resource.getResourceObject();
+            const UInt64 decompressStartTime = PlatformTime::GetMicrosecondsMonotonic();
             resource->decompress();
+            decompressionTimes.push_back(static_cast<UInt32>(std::min<UInt64>(PlatformTime::GetMicrosecondsMonotonic() - decompressStartTime, std::numeric_limits<UInt32>::max())));
             totalSize += resource->getDecompressedDataSize();
 
             resourcesToUpload.push_back(hash);
@@ -215,4 +382,28 @@ namespace ramses_internal
             return sizeToUpload + m_clientResourceTotalUploadedSize - m_clientResourceCacheSize;
         }
     }
+
+    BoundingBox ClientResourceUploadingManager::ComputeVertexPositionBounds(const IResource& resource)
+    {
+        const ArrayResource* vertArray = resource.convertTo<ArrayResource>();
+        const EDataType elementType = vertArray->getElementType();
+        const UInt32 elementCount = vertArray->getElementCount();
+        // only 2D and 3D positions are taken as they are, 4th component might scale the position
+        if (elementCount == 0u || (elementType != EDataType_Vector2F && elementType != EDataType_Vector3F))
+            return BoundingBox();
+
+        const UInt32 numComponents = EnumToNumComponents(elementType);
+        const Float* data = reinterpret_cast<const Float*>(vertArray->getResourceData()->getRawData());
+        Vector3 minCorner(std::numeric_limits<Float>::max());
+        Vector3 maxCorner(std::numeric_limits<Float>::lowest());
+        for (UInt32 i = 0u; i < elementCount; ++i)
+        {
+            const Float* position = data + i * numComponents;
+            const Vector3 vertex(position[0], position[1], numComponents == 3u ? position[2] : 0.f);
+            minCorner.set(std::min(minCorner.x, vertex.x), std::min(minCorner.y, vertex.y), std::min(minCorner.z, vertex.z));
+            maxCorner.set(std::max(maxCorner.x, vertex.x), std::max(maxCorner.y, vertex.y), std::max(maxCorner.z, vertex.z));
+        }
+
+        return BoundingBox(minCorner, maxCorner);
+    }
 }
@@ -214,6 +214,76 @@ namespace ramses_internal
         m_gpuMemoryCacheSize = size;
     }
 
+    EGPUMemoryCachePolicy DisplayConfig::getGPUMemoryCachePolicy() const
+    {
+        return m_gpuMemoryCachePolicy;
+    }
+
+    void DisplayConfig::setGPUMemoryCachePolicy(EGPUMemoryCachePolicy policy)
+    {
+        m_gpuMemoryCachePolicy = policy;
+    }
+
+    UInt64 DisplayConfig::getRenderBufferPoolSize() const
+    {
+        return m_renderBufferPoolSize;
+    }
+
+    void DisplayConfig::setRenderBufferPoolSize(UInt64 size)
+    {
+        m_renderBufferPoolSize = size;
+    }
+
+    Bool DisplayConfig::isSceneLayerCacheEnabled() const
+    {
+        return m_sceneLayerCacheEnabled;
+    }
+
+    void DisplayConfig::setSceneLayerCacheEnabled(Bool enabled)
+    {
+        m_sceneLayerCacheEnabled = enabled;
+    }
+
+    UInt64 DisplayConfig::getSceneLayerCacheMemoryBudget() const
+    {
+        return m_sceneLayerCacheMemoryBudget;
+    }
+
+    void DisplayConfig::setSceneLayerCacheMemoryBudget(UInt64 budget)
+    {
+        m_sceneLayerCacheMemoryBudget = budget;
+    }
+
+    Bool DisplayConfig::isPartialFramebufferRedrawEnabled() const
+    {
+        return m_partialFramebufferRedrawEnabled;
+    }
+
+    void DisplayConfig::setPartialFramebufferRedrawEnabled(Bool enabled)
+    {
+        m_partialFramebufferRedrawEnabled = enabled;
+    }
+
+    Bool DisplayConfig::isProgressiveTextureUploadEnabled() const
+    {
+        return m_progressiveTextureUploadEnabled;
+    }
+
+    void DisplayConfig::setProgressiveTextureUploadEnabled(Bool enabled)
+    {
+        m_progressiveTextureUploadEnabled = enabled;
+    }
+
+    Bool DisplayConfig::isGpuTimerQueriesEnabled() const
+    {
+        return m_gpuTimerQueriesEnabled;
+    }
+
+    void DisplayConfig::setGpuTimerQueriesEnabled(Bool enabled)
+    {
+        m_gpuTimerQueriesEnabled = enabled;
+    }
+
     void DisplayConfig::setClearColor(const Vector4& clearColor)
     {
         m_clearColor = clearColor;
@@ -266,6 +336,13 @@ namespace ramses_internal
             m_startVisibleIvi            == other.m_startVisibleIvi &&
             m_resizable                  == other.m_resizable &&
             m_gpuMemoryCacheSize         == other.m_gpuMemoryCacheSize &&
+            m_gpuMemoryCachePolicy       == other.m_gpuMemoryCachePolicy &&
+            m_renderBufferPoolSize       == other.m_renderBufferPoolSize &&
+            m_sceneLayerCacheEnabled     == other.m_sceneLayerCacheEnabled &&
+            m_sceneLayerCacheMemoryBudget == other.m_sceneLayerCacheMemoryBudget &&
+            m_partialFramebufferRedrawEnabled == other.m_partialFramebufferRedrawEnabled &&
+            m_progressiveTextureUploadEnabled == other.m_progressiveTextureUploadEnabled &&
+            m_gpuTimerQueriesEnabled == other.m_gpuTimerQueriesEnabled &&
             m_clearColor                 == other.m_clearColor &&
             m_offscreen                  == other.m_offscreen &&
             m_windowsWindowHandle        == other.m_windowsWindowHandle;
@@ -47,6 +47,11 @@ namespace ramses_internal
         m_renderBackend.getSurface().enable();
     }
 
+    void DisplayController::disableContext()
+    {
+        m_renderBackend.getSurface().disable();
+    }
+
     void DisplayController::swapBuffers()
     {
         ISurface& surface = m_renderBackend.getSurface();
@@ -56,12 +61,49 @@ namespace ramses_internal
         validateRenderingStatusHealthy();
     }
 
-    SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
+    void DisplayController::swapBuffersWithDamage(const Viewport& damagedRegion)
+    {
+        ISurface& surface = m_renderBackend.getSurface();
+        // post processing redraws whole framebuffer from offscreen display buffer
+        if (getDisplayBuffer() == m_postProcessing->getFramebuffer())
+            surface.swapBuffersWithDamage(damagedRegion);
+        else
+            surface.swapBuffers();
+        surface.frameRendered();
+
+        validateRenderingStatusHealthy();
+    }
+
+    UInt32 DisplayController::getDisplayBufferAge() const
     {
-        const FrameBufferInfo fbInfo(buffer, m_projectionParams, viewport);
-        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer);
+        // offscreen display buffer is never swapped, it always holds the previous frame
+        if (getDisplayBuffer() != m_postProcessing->getFramebuffer())
+            return 1u;
+        return m_renderBackend.getSurface().getBufferAge();
+    }
+
+    void DisplayController::setDisplayBufferScissorRegion(Bool enabled, const Viewport& region)
+    {
+        m_displayBufferScissorEnabled = enabled;
+        if (enabled)
+            m_device.setScissorRegion(region.posX, region.posY, region.width, region.height);
+        m_device.enableScissorTest(enabled);
+    }
+
+    SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, GpuTimerQueries* gpuTimerQueries)
+    {
+        const Bool scissorBuffer = m_displayBufferScissorEnabled && buffer == getDisplayBuffer();
+        if (m_displayBufferScissorEnabled && !scissorBuffer)
+            m_device.enableScissorTest(false);
+
+        const FrameBufferInfo fbInfo(buffer, m_projectionParams, viewport, scissorBuffer);
+        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer, gpuTimerQueries);
+        const SceneRenderExecutionIterator renderState = executor.executeScene(scene, getViewMatrix());
+
+        if (m_displayBufferScissorEnabled)
+            m_device.enableScissorTest(true);
 
-        return executor.executeScene(scene, getViewMatrix());
+        return renderState;
     }
 
     void DisplayController::executePostProcessing()
@@ -71,11 +113,18 @@ namespace ramses_internal
 
     void DisplayController::clearBuffer(DeviceResourceHandle buffer, const Vector4& clearColor)
     {
+        const Bool scissorBuffer = m_displayBufferScissorEnabled && buffer == getDisplayBuffer();
+        if (m_displayBufferScissorEnabled && !scissorBuffer)
+            m_device.enableScissorTest(false);
+
         m_device.activateRenderTarget(buffer);
         m_device.colorMask(true, true, true, true);
         m_device.clearColor(clearColor);
         m_device.depthWrite(EDepthWrite_Enabled);
         m_device.clear(EClearFlags_All);
+
+        if (m_displayBufferScissorEnabled && !scissorBuffer)
+            m_device.enableScissorTest(true);
     }
 
     Bool DisplayController::readPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height, Vector<UInt8>& dataOut)
@@ -96,6 +145,30 @@ namespace ramses_internal
         return true;
     }
 
+    DeviceResourceHandle DisplayController::startReadPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        if (x + width > getDisplayWidth() ||
+            y + height > getDisplayHeight())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "DisplayController::startReadPixels failed: requested area is out of display size boundaries!")
+            return DeviceResourceHandle::Invalid();
+        }
+
+        m_device.activateRenderTarget(m_postProcessing->getFramebuffer());
+        return m_device.startReadPixels(x, y, width, height);
+    }
+
+    Bool DisplayController::isReadPixelsFinished(DeviceResourceHandle readPixelsHandle)
+    {
+        return m_device.isReadPixelsFinished(readPixelsHandle);
+    }
+
+    Bool DisplayController::finishReadPixels(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, Vector<UInt8>& dataOut)
+    {
+        dataOut.resize(width * height * 4u); // Assuming RGBA8 non multisampled
+        return m_device.finishReadPixels(readPixelsHandle, &dataOut[0]);
+    }
+
     void DisplayController::setProjectionParams(const ProjectionParams& params)
     {
         m_projectionParams = params;
@@ -0,0 +1,82 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/DisplayRenderThread.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+
+namespace ramses_internal
+{
+    DisplayRenderThread::DisplayRenderThread(RenderFrameFunction renderFrame)
+        : m_renderFrame(std::move(renderFrame))
+        , m_thread("R_DisplayThrd")
+    {
+        m_thread.start(*this);
+    }
+
+    DisplayRenderThread::~DisplayRenderThread()
+    {
+        {
+            PlatformLightweightGuard guard(m_lock);
+            m_thread.cancel();
+        }
+        m_frameStartedConditionVar.signal();
+        m_thread.join();
+    }
+
+    void DisplayRenderThread::startFrame()
+    {
+        {
+            PlatformLightweightGuard guard(m_lock);
+            assert(!m_frameStarted);
+            m_frameStarted = true;
+            m_frameFinished = false;
+        }
+        m_frameStartedConditionVar.signal();
+    }
+
+    UInt32 DisplayRenderThread::waitForFrameFinished()
+    {
+        PlatformLightweightGuard guard(m_lock);
+        while (!m_frameFinished)
+        {
+            m_frameFinishedConditionVar.wait(&m_lock);
+        }
+        return m_frameDuration;
+    }
+
+    void DisplayRenderThread::run()
+    {
+        for (;;)
+        {
+            {
+                PlatformLightweightGuard guard(m_lock);
+                while (!m_frameStarted && !isCancelRequested())
+                {
+                    m_frameStartedConditionVar.wait(&m_lock);
+                }
+                if (isCancelRequested())
+                {
+                    return;
+                }
+            }
+
+            const UInt64 frameStartTime = PlatformTime::GetMicrosecondsMonotonic();
+            m_renderFrame();
+            const UInt64 frameEndTime = PlatformTime::GetMicrosecondsMonotonic();
+
+            {
+                PlatformLightweightGuard guard(m_lock);
+                m_frameDuration = static_cast<UInt32>(frameEndTime - frameStartTime);
+                m_frameStarted = false;
+                m_frameFinished = true;
+            }
+            m_frameFinishedConditionVar.signal();
+        }
+    }
+}
@@ -141,8 +141,7 @@ namespace ramses_internal
             const StreamTextureSourceInfo* streamTextureSourceInfo = m_streamTextureSourceInfoMap.get(streamTextureSourceId);
             if(nullptr != streamTextureSourceInfo)
             {
-                const UInt32 bufferUpdateCount = m_embeddedCompositor.uploadCompositingContentForStreamTexture(streamTextureSourceId, streamTextureSourceInfo->compositedTextureHandle, m_textureUploadingAdapter);
-                bufferUpdates[streamTextureSourceId] = bufferUpdateCount;
+                bufferUpdates[streamTextureSourceId] = m_embeddedCompositor.uploadCompositingContentForStreamTexture(streamTextureSourceId, streamTextureSourceInfo->compositedTextureHandle, m_textureUploadingAdapter);
 
                 for(const auto& it : streamTextureSourceInfo->sceneUsage)
                 {
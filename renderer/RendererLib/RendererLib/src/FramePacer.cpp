@@ -0,0 +1,89 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FramePacer.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    const UInt32 FramePacer::NumFramesForPrediction;
+    const UInt32 FramePacer::MinimumSafetyMarginMicroseconds;
+
+    FramePacer::FramePacer(std::chrono::microseconds targetFrameDuration)
+        : m_targetFrameDuration(targetFrameDuration)
+    {
+        m_renderTimes.reserve(NumFramesForPrediction);
+    }
+
+    void FramePacer::setTargetFrameDuration(std::chrono::microseconds targetFrameDuration)
+    {
+        if (targetFrameDuration != m_targetFrameDuration)
+        {
+            m_targetFrameDuration = targetFrameDuration;
+            m_nextDeadline = 0u;
+        }
+    }
+
+    std::chrono::microseconds FramePacer::getDelayBeforeNextFrame(UInt64 currentTimeMicroseconds) const
+    {
+        // no deadline known before first frame finished
+        if (m_nextDeadline == 0u)
+            return std::chrono::microseconds{ 0 };
+
+        const UInt64 predictedRenderTime = static_cast<UInt64>(getPredictedRenderTime().count());
+        if (m_nextDeadline <= currentTimeMicroseconds + predictedRenderTime)
+            return std::chrono::microseconds{ 0 };
+
+        return std::chrono::microseconds{ m_nextDeadline - currentTimeMicroseconds - predictedRenderTime };
+    }
+
+    Bool FramePacer::frameFinished(UInt64 frameStartTimeMicroseconds, UInt64 frameEndTimeMicroseconds, std::chrono::microseconds swapBuffersDuration)
+    {
+        assert(frameEndTimeMicroseconds >= frameStartTimeMicroseconds);
+        const UInt64 frameDuration = frameEndTimeMicroseconds - frameStartTimeMicroseconds;
+        const UInt64 swapDuration = std::min<UInt64>(frameDuration, swapBuffersDuration.count());
+        const UInt32 renderTime = static_cast<UInt32>(frameDuration - swapDuration);
+        if (m_renderTimes.size() < NumFramesForPrediction)
+            m_renderTimes.push_back(renderTime);
+        else
+            m_renderTimes[m_nextRenderTimeIdx] = renderTime;
+        m_nextRenderTimeIdx = (m_nextRenderTimeIdx + 1u) % NumFramesForPrediction;
+
+        const UInt64 targetFrameDuration = static_cast<UInt64>(m_targetFrameDuration.count());
+        if (m_nextDeadline == 0u)
+        {
+            m_nextDeadline = frameEndTimeMicroseconds + targetFrameDuration;
+            return false;
+        }
+
+        // finishing within first half of the frame interval after deadline is treated as swap blocked until vsync
+        // that is slightly off the expected deadline, anything later missed it
+        const Bool deadlineMissed = frameEndTimeMicroseconds > m_nextDeadline + targetFrameDuration / 2u;
+        m_nextDeadline = std::max(m_nextDeadline, frameEndTimeMicroseconds) + targetFrameDuration;
+
+        return deadlineMissed;
+    }
+
+    std::chrono::microseconds FramePacer::getPredictedRenderTime() const
+    {
+        if (m_renderTimes.empty())
+            return m_targetFrameDuration;
+
+        const UInt32 maxRenderTime = *std::max_element(m_renderTimes.cbegin(), m_renderTimes.cend());
+        const UInt32 safetyMargin = std::max(MinimumSafetyMarginMicroseconds, maxRenderTime / 10u);
+        return std::chrono::microseconds{ maxRenderTime + safetyMargin };
+    }
+
+    void FramePacer::reset()
+    {
+        m_renderTimes.clear();
+        m_nextRenderTimeIdx = 0u;
+        m_nextDeadline = 0u;
+    }
+}
@@ -50,6 +50,7 @@ namespace ramses_internal
         assert(region != ERegion::MaxFramerateSleep && "Do not call endRegion() with MaxFramerateSleep, it is handled internally.");
 
         const UInt totalRegionTime = static_cast<UInt>(PlatformTime::GetMicrosecondsMonotonic() - m_regionStartTimes[regionId]);
+        m_traceRecorder.recordRegion(static_cast<UInt32>(regionId), m_regionStartTimes[regionId], totalRegionTime);
         m_frameTimings[m_frameTimings.size() - NumberOfRegions + regionId] = totalRegionTime;
 
         // add previous region time to current region to get stacked accumulated values which can be used directly by the FrameProfileRenderer
@@ -113,6 +114,7 @@ namespace ramses_internal
         }
 
         setSleepTimeForLastFrame(sleepTime);
+        m_traceRecorder.markFrameFinished();
 
         m_currentRegionId = 0;
 
@@ -166,6 +168,11 @@ namespace ramses_internal
         initNextFrameTimings();
     }
 
+    FrameTraceRecorder& FrameProfilerStatistics::getTraceRecorder()
+    {
+        return m_traceRecorder;
+    }
+
     void FrameProfilerStatistics::setSleepTimeForLastFrame(std::chrono::microseconds sleepTime)
     {
         assert(m_currentRegionId == static_cast<UInt>(ERegion::MaxFramerateSleep));
@@ -0,0 +1,119 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FrameTraceFileWriter.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "Collections/StringOutputStream.h"
+#include "Utils/File.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    const UInt32 FrameTraceFileWriter::MaxNumberOfPendingDumps;
+
+    FrameTraceFileWriter::FrameTraceFileWriter()
+        : m_thread("R_TraceWriter")
+    {
+        m_thread.start(*this);
+    }
+
+    FrameTraceFileWriter::~FrameTraceFileWriter()
+    {
+        {
+            PlatformLightweightGuard guard(m_lock);
+            m_thread.cancel();
+        }
+        m_dumpsAvailable.signal();
+        m_thread.join();
+    }
+
+    Bool FrameTraceFileWriter::writeToFile(const String& fileName, Vector<FrameTraceRecorder::Event>&& events)
+    {
+        {
+            PlatformLightweightGuard guard(m_lock);
+            if (m_dumps.size() >= MaxNumberOfPendingDumps)
+            {
+                LOG_WARN(CONTEXT_RENDERER, "FrameTraceFileWriter::writeToFile: " << m_dumps.size() << " dumps still pending, dropping dump to " << fileName);
+                return false;
+            }
+            m_dumps.push_back({ fileName, std::move(events) });
+        }
+        m_dumpsAvailable.signal();
+        return true;
+    }
+
+    void FrameTraceFileWriter::flush()
+    {
+        PlatformLightweightGuard guard(m_lock);
+        while (!m_dumps.empty() || m_writingDump)
+        {
+            m_dumpsWritten.wait(&m_lock);
+        }
+    }
+
+    UInt32 FrameTraceFileWriter::getNumberOfWrittenFiles() const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        return m_numWrittenFiles;
+    }
+
+    void FrameTraceFileWriter::run()
+    {
+        for (;;)
+        {
+            Dump dump;
+            {
+                PlatformLightweightGuard guard(m_lock);
+                while (m_dumps.empty() && !isCancelRequested())
+                {
+                    m_dumpsAvailable.wait(&m_lock);
+                }
+                // pending dumps are written before shutting down
+                if (m_dumps.empty())
+                {
+                    return;
+                }
+                dump = std::move(m_dumps.front());
+                m_dumps.pop_front();
+                m_writingDump = true;
+            }
+
+            const Bool written = WriteDump(dump);
+
+            {
+                PlatformLightweightGuard guard(m_lock);
+                m_writingDump = false;
+                if (written)
+                {
+                    ++m_numWrittenFiles;
+                }
+            }
+            m_dumpsWritten.broadcast();
+        }
+    }
+
+    Bool FrameTraceFileWriter::WriteDump(const Dump& dump)
+    {
+        const UInt32 numEvents = static_cast<UInt32>(dump.events.size());
+        StringOutputStream str(numEvents * 128u);
+        FrameTraceRecorder::WriteChromeTrace(dump.events.data(), numEvents, str);
+
+        File file(dump.fileName);
+        BinaryFileOutputStream outputStream(file);
+        if (outputStream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "FrameTraceFileWriter::writeDump: failed to open " << dump.fileName);
+            return false;
+        }
+
+        outputStream.write(str.c_str(), str.length());
+        LOG_INFO(CONTEXT_RENDERER, "FrameTraceFileWriter::writeDump: written " << numEvents << " trace events to " << dump.fileName);
+        return outputStream.getState() == EStatus_RAMSES_OK;
+    }
+}
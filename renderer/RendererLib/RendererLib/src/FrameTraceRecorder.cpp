@@ -0,0 +1,195 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FrameTraceRecorder.h"
+#include "RendererLib/FrameTraceFileWriter.h"
+#include "RendererLib/FrameProfilerStatistics.h"
+#include "Collections/StringOutputStream.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // trace viewer lanes, one per event type
+        const UInt32 RegionsThreadId = 0u;
+        const UInt32 ScenesThreadId = 1u;
+        const UInt32 ResourcesThreadId = 2u;
+    }
+
+    FrameTraceRecorder::FrameTraceRecorder() = default;
+
+    // pending dumps are finished by writer before it is destroyed
+    FrameTraceRecorder::~FrameTraceRecorder() = default;
+
+    void FrameTraceRecorder::enable(UInt32 capacity)
+    {
+        assert(capacity > 0u);
+        m_events.resize(capacity);
+        m_enabled = true;
+        clear();
+    }
+
+    void FrameTraceRecorder::disable()
+    {
+        m_enabled = false;
+        m_events.clear();
+        clear();
+    }
+
+    Bool FrameTraceRecorder::isEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void FrameTraceRecorder::setSpikeDump(UInt64 frameTimeThresholdMicrosec, const String& filePrefix)
+    {
+        m_spikeThreshold = frameTimeThresholdMicrosec;
+        m_spikeDumpFilePrefix = filePrefix;
+    }
+
+    void FrameTraceRecorder::recordRegion(UInt32 region, UInt64 startTime, UInt64 duration)
+    {
+        if (!m_enabled)
+            return;
+
+        if (m_frameStartTime == 0u)
+            m_frameStartTime = startTime;
+        m_frameEndTime = std::max(m_frameEndTime, startTime + duration);
+
+        addEvent({ EEventType::Region, region, m_frameId, startTime, duration, 0u, 0u, 0u });
+    }
+
+    void FrameTraceRecorder::recordSceneFlushApplied(SceneId sceneId, UInt64 flushIndex, UInt32 numActions, UInt64 startTime, UInt64 duration)
+    {
+        if (!m_enabled)
+            return;
+
+        addEvent({ EEventType::SceneFlushApplied, 0u, m_frameId, startTime, duration, sceneId.getValue(), flushIndex, numActions });
+    }
+
+    void FrameTraceRecorder::recordClientResourcesUploaded(UInt32 displayHandle, UInt64 startTime, UInt64 duration)
+    {
+        if (!m_enabled)
+            return;
+
+        addEvent({ EEventType::ClientResourcesUploaded, 0u, m_frameId, startTime, duration, displayHandle, 0u, 0u });
+    }
+
+    void FrameTraceRecorder::markFrameFinished()
+    {
+        if (!m_enabled)
+            return;
+
+        const UInt64 frameTime = m_frameEndTime - m_frameStartTime;
+        if (m_spikeThreshold > 0u && frameTime > m_spikeThreshold)
+        {
+            StringOutputStream fileName;
+            fileName << m_spikeDumpFilePrefix << "_" << m_frameId << ".json";
+            LOG_WARN(CONTEXT_RENDERER, "FrameTraceRecorder::markFrameFinished: frame " << m_frameId << " took " << frameTime << "us (threshold " << m_spikeThreshold
+                << "us), dumping " << m_numEvents << " trace events to " << fileName.c_str());
+            dumpToFile(fileName.c_str());
+            clear();
+        }
+
+        ++m_frameId;
+        m_frameStartTime = 0u;
+        m_frameEndTime = 0u;
+    }
+
+    UInt32 FrameTraceRecorder::getNumberOfEvents() const
+    {
+        return m_numEvents;
+    }
+
+    const FrameTraceRecorder::Event& FrameTraceRecorder::getEvent(UInt32 index) const
+    {
+        assert(index < m_numEvents);
+        const UInt32 capacity = static_cast<UInt32>(m_events.size());
+        return m_events[(m_nextEventIdx + capacity - m_numEvents + index) % capacity];
+    }
+
+    UInt32 FrameTraceRecorder::getNumberOfDumpedTraces() const
+    {
+        return m_fileWriter ? m_fileWriter->getNumberOfWrittenFiles() : 0u;
+    }
+
+    void FrameTraceRecorder::writeChromeTrace(StringOutputStream& str) const
+    {
+        Vector<Event> events;
+        getEventsInOrder(events);
+        WriteChromeTrace(events.data(), m_numEvents, str);
+    }
+
+    void FrameTraceRecorder::WriteChromeTrace(const Event* events, UInt32 numEvents, StringOutputStream& str)
+    {
+        str << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        str << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << RegionsThreadId << ",\"args\":{\"name\":\"FrameProfilerRegions\"}},";
+        str << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << ScenesThreadId << ",\"args\":{\"name\":\"SceneFlushes\"}},";
+        str << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << ResourcesThreadId << ",\"args\":{\"name\":\"ClientResourceUploads\"}}";
+
+        for (UInt32 i = 0u; i < numEvents; ++i)
+        {
+            const Event& event = events[i];
+            str << ",{\"ph\":\"X\",\"pid\":0,\"ts\":" << event.startTime << ",\"dur\":" << event.duration;
+            switch (event.type)
+            {
+            case EEventType::Region:
+                str << ",\"tid\":" << RegionsThreadId << ",\"cat\":\"region\",\"name\":\"" << EnumToString(static_cast<FrameProfilerStatistics::ERegion>(event.region))
+                    << "\",\"args\":{\"frame\":" << event.frameId << "}}";
+                break;
+            case EEventType::SceneFlushApplied:
+                str << ",\"tid\":" << ScenesThreadId << ",\"cat\":\"scene\",\"name\":\"ApplyFlush scene " << event.id
+                    << "\",\"args\":{\"frame\":" << event.frameId << ",\"scene\":" << event.id << ",\"flushIndex\":" << event.value << ",\"numActions\":" << event.count << "}}";
+                break;
+            case EEventType::ClientResourcesUploaded:
+                str << ",\"tid\":" << ResourcesThreadId << ",\"cat\":\"resource\",\"name\":\"UploadClientResources display " << event.id
+                    << "\",\"args\":{\"frame\":" << event.frameId << ",\"display\":" << event.id << "}}";
+                break;
+            }
+        }
+        str << "]}";
+    }
+
+    Bool FrameTraceRecorder::dumpToFile(const String& fileName)
+    {
+        if (!m_fileWriter)
+            m_fileWriter.reset(new FrameTraceFileWriter);
+
+        Vector<Event> events;
+        getEventsInOrder(events);
+        return m_fileWriter->writeToFile(fileName, std::move(events));
+    }
+
+    void FrameTraceRecorder::flushDumps()
+    {
+        if (m_fileWriter)
+            m_fileWriter->flush();
+    }
+
+    void FrameTraceRecorder::clear()
+    {
+        m_nextEventIdx = 0u;
+        m_numEvents = 0u;
+    }
+
+    void FrameTraceRecorder::addEvent(const Event& event)
+    {
+        const UInt32 capacity = static_cast<UInt32>(m_events.size());
+        m_events[m_nextEventIdx] = event;
+        m_nextEventIdx = (m_nextEventIdx + 1u) % capacity;
+        m_numEvents = std::min(m_numEvents + 1u, capacity);
+    }
+
+    void FrameTraceRecorder::getEventsInOrder(Vector<Event>& events) const
+    {
+        events.reserve(m_numEvents);
+        for (UInt32 i = 0u; i < m_numEvents; ++i)
+            events.push_back(getEvent(i));
+    }
+}
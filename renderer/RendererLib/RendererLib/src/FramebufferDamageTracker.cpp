@@ -0,0 +1,164 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FramebufferDamageTracker.h"
+#include "Math3d/Vector4.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ramses_internal
+{
+    const UInt32 FramebufferDamageTracker::MaxBufferAge;
+
+    FramebufferDamageTracker::FramebufferDamageTracker(const Viewport& framebufferRegion)
+        : m_framebufferRegion(framebufferRegion)
+    {
+    }
+
+    void FramebufferDamageTracker::markSceneModified(SceneId sceneId)
+    {
+        m_modifiedScenes.put(sceneId);
+    }
+
+    void FramebufferDamageTracker::markFullRedraw()
+    {
+        m_fullRedraw = true;
+    }
+
+    Viewport FramebufferDamageTracker::startFrame(const SceneRegions& shownScenes, UInt32 bufferAge)
+    {
+        m_frameDamage = computeFrameDamage(shownScenes);
+
+        Viewport redrawRegion = m_frameDamage;
+        if (bufferAge == 0u || bufferAge > m_damageHistory.size() + 1u)
+        {
+            redrawRegion = m_framebufferRegion;
+        }
+        else
+        {
+            for (UInt32 i = 0u; i + 1u < bufferAge; ++i)
+                redrawRegion = UniteRegions(redrawRegion, m_damageHistory[i]);
+        }
+
+        m_damageHistory.insert(m_damageHistory.begin(), m_frameDamage);
+        if (m_damageHistory.size() > MaxBufferAge - 1u)
+            m_damageHistory.pop_back();
+
+        m_previousSceneRegions = shownScenes;
+        m_modifiedScenes.clear();
+        m_fullRedraw = false;
+
+        return redrawRegion;
+    }
+
+    const Viewport& FramebufferDamageTracker::getFrameDamage() const
+    {
+        return m_frameDamage;
+    }
+
+    Viewport FramebufferDamageTracker::ProjectBoundsToRegion(const BoundingBox& bounds, const Matrix44f& modelViewProjectionMatrix, const Viewport& viewport)
+    {
+        if (!bounds.isValid)
+            return viewport;
+
+        Float minX = std::numeric_limits<Float>::max();
+        Float minY = std::numeric_limits<Float>::max();
+        Float maxX = std::numeric_limits<Float>::lowest();
+        Float maxY = std::numeric_limits<Float>::lowest();
+        for (UInt32 corner = 0u; corner < 8u; ++corner)
+        {
+            const Vector4 position(
+                (corner & 1u) ? bounds.maxCorner.x : bounds.minCorner.x,
+                (corner & 2u) ? bounds.maxCorner.y : bounds.minCorner.y,
+                (corner & 4u) ? bounds.maxCorner.z : bounds.minCorner.z,
+                1.f);
+            const Vector4 clipPosition = modelViewProjectionMatrix * position;
+            // perspective division does not give bounds of geometry crossing the camera plane
+            if (clipPosition.w <= std::numeric_limits<Float>::epsilon())
+                return viewport;
+
+            minX = std::min(minX, clipPosition.x / clipPosition.w);
+            minY = std::min(minY, clipPosition.y / clipPosition.w);
+            maxX = std::max(maxX, clipPosition.x / clipPosition.w);
+            maxY = std::max(maxY, clipPosition.y / clipPosition.w);
+        }
+
+        // one pixel border covers rasterization rounding
+        const Float viewportLeft = static_cast<Float>(viewport.posX);
+        const Float viewportBottom = static_cast<Float>(viewport.posY);
+        const Float viewportWidth = static_cast<Float>(viewport.width);
+        const Float viewportHeight = static_cast<Float>(viewport.height);
+        const Float left = std::max(viewportLeft, std::floor(viewportLeft + (minX + 1.f) * 0.5f * viewportWidth) - 1.f);
+        const Float bottom = std::max(viewportBottom, std::floor(viewportBottom + (minY + 1.f) * 0.5f * viewportHeight) - 1.f);
+        const Float right = std::min(viewportLeft + viewportWidth, std::ceil(viewportLeft + (maxX + 1.f) * 0.5f * viewportWidth) + 1.f);
+        const Float top = std::min(viewportBottom + viewportHeight, std::ceil(viewportBottom + (maxY + 1.f) * 0.5f * viewportHeight) + 1.f);
+        if (right <= left || top <= bottom)
+            return Viewport(0u, 0u, 0u, 0u);
+
+        return Viewport(static_cast<UInt32>(left), static_cast<UInt32>(bottom), static_cast<UInt32>(right - left), static_cast<UInt32>(top - bottom));
+    }
+
+    Viewport FramebufferDamageTracker::computeFrameDamage(const SceneRegions& shownScenes) const
+    {
+        if (m_fullRedraw || shownScenes.size() != m_previousSceneRegions.size())
+            return m_framebufferRegion;
+
+        Viewport damage(0u, 0u, 0u, 0u);
+        for (UInt i = 0u; i < shownScenes.size(); ++i)
+        {
+            const auto& sceneRegion = shownScenes[i];
+            const auto& previousSceneRegion = m_previousSceneRegions[i];
+            if (sceneRegion.first != previousSceneRegion.first)
+                return m_framebufferRegion;
+
+            if (m_modifiedScenes.hasElement(sceneRegion.first) || !(sceneRegion.second == previousSceneRegion.second))
+            {
+                damage = UniteRegions(damage, sceneRegion.second);
+                damage = UniteRegions(damage, previousSceneRegion.second);
+            }
+        }
+
+        damage = IntersectRegions(damage, m_framebufferRegion);
+        // re-render without any known change, e.g. to take a screenshot or after clear color change
+        if (IsEmptyRegion(damage))
+            return m_framebufferRegion;
+
+        return damage;
+    }
+
+    Viewport FramebufferDamageTracker::UniteRegions(const Viewport& region1, const Viewport& region2)
+    {
+        if (IsEmptyRegion(region1))
+            return region2;
+        if (IsEmptyRegion(region2))
+            return region1;
+
+        const UInt32 left = std::min(region1.posX, region2.posX);
+        const UInt32 bottom = std::min(region1.posY, region2.posY);
+        const UInt32 right = std::max(region1.posX + region1.width, region2.posX + region2.width);
+        const UInt32 top = std::max(region1.posY + region1.height, region2.posY + region2.height);
+        return Viewport(left, bottom, right - left, top - bottom);
+    }
+
+    Viewport FramebufferDamageTracker::IntersectRegions(const Viewport& region1, const Viewport& region2)
+    {
+        const UInt32 left = std::max(region1.posX, region2.posX);
+        const UInt32 bottom = std::max(region1.posY, region2.posY);
+        const UInt32 right = std::min(region1.posX + region1.width, region2.posX + region2.width);
+        const UInt32 top = std::min(region1.posY + region1.height, region2.posY + region2.height);
+        if (right <= left || top <= bottom)
+            return Viewport(0u, 0u, 0u, 0u);
+        return Viewport(left, bottom, right - left, top - bottom);
+    }
+
+    Bool FramebufferDamageTracker::IsEmptyRegion(const Viewport& region)
+    {
+        return region.width == 0u || region.height == 0u;
+    }
+}
@@ -0,0 +1,146 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/GpuTimerQueries.h"
+#include "RendererLib/RendererStatistics.h"
+#include "RendererAPI/IDevice.h"
+#include "Utils/LogMacros.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    GpuTimerQueries::GpuTimerQueries(IDevice& device)
+        : m_device(device)
+    {
+    }
+
+    void GpuTimerQueries::sceneStarted(SceneId sceneId)
+    {
+        m_currentScene = sceneId;
+        writeTimestamp(sceneId, RenderPassHandle::Invalid(), true);
+    }
+
+    void GpuTimerQueries::passFinished(const RenderingPassInfo& pass)
+    {
+        writeTimestamp(m_currentScene, pass, false);
+    }
+
+    void GpuTimerQueries::writeTimestamp(SceneId sceneId, const RenderingPassInfo& pass, Bool sceneStart)
+    {
+        if (!m_supported)
+            return;
+
+        const DeviceResourceHandle query = m_device.writeGpuTimestamp();
+        if (!query.isValid())
+        {
+            LOG_WARN(CONTEXT_RENDERER, "GpuTimerQueries: device does not support GPU timer queries, GPU time of scenes will not be measured");
+            m_supported = false;
+            return;
+        }
+
+        m_currentFrame.push_back({ sceneId, pass, sceneStart, query });
+    }
+
+    void GpuTimerQueries::resolveQueries(RendererStatistics& statistics)
+    {
+        for (auto& pendingFrame : m_pendingFrames)
+            ++pendingFrame.framesPending;
+
+        if (!m_currentFrame.empty())
+        {
+            m_pendingFrames.push_back({ std::move(m_currentFrame), 0u, false });
+            m_currentFrame.clear();
+        }
+
+        // disjoint state covers everything since the last check, timestamps of any pending frame may be invalid
+        if (!m_pendingFrames.empty() && m_device.isGpuTimerDisjoint())
+        {
+            for (auto& pendingFrame : m_pendingFrames)
+                pendingFrame.disjoint = true;
+        }
+
+        // timestamps become available in the order they were written, so the last one of a frame tells about the whole frame
+        while (!m_pendingFrames.empty() &&
+            (m_pendingFrames.front().framesPending >= MaxFramesToResolve || m_device.isGpuTimestampAvailable(m_pendingFrames.front().timestamps.back().query)))
+        {
+            if (m_pendingFrames.front().disjoint)
+                finishQueries(m_pendingFrames.front().timestamps);
+            else
+                reportFrame(m_pendingFrames.front().timestamps, statistics);
+            m_pendingFrames.pop_front();
+        }
+    }
+
+    void GpuTimerQueries::reportFrame(const Timestamps& timestamps, RendererStatistics& statistics)
+    {
+        // scene can be rendered in several parts within a frame (interrupted rendering), times are summed up
+        m_sceneGpuTimes.clear();
+        m_passGpuTimes.clear();
+
+        UInt64 previousTimestamp = 0u;
+        for (const auto& timestamp : timestamps)
+        {
+            const UInt64 gpuTimestamp = m_device.finishGpuTimestamp(timestamp.query);
+            if (!timestamp.sceneStart)
+            {
+                const UInt64 gpuTime = (gpuTimestamp > previousTimestamp ? gpuTimestamp - previousTimestamp : 0u);
+
+                auto sceneIt = std::find_if(m_sceneGpuTimes.begin(), m_sceneGpuTimes.end(), [&](const SceneGpuTime& t) { return t.sceneId == timestamp.sceneId; });
+                if (sceneIt == m_sceneGpuTimes.end())
+                    m_sceneGpuTimes.push_back({ timestamp.sceneId, gpuTime });
+                else
+                    sceneIt->gpuTime += gpuTime;
+
+                auto passIt = std::find_if(m_passGpuTimes.begin(), m_passGpuTimes.end(), [&](const PassGpuTime& t) { return t.sceneId == timestamp.sceneId && t.pass == timestamp.pass; });
+                if (passIt == m_passGpuTimes.end())
+                    m_passGpuTimes.push_back({ timestamp.sceneId, timestamp.pass, gpuTime });
+                else
+                    passIt->gpuTime += gpuTime;
+            }
+            previousTimestamp = gpuTimestamp;
+        }
+
+        for (const auto& sceneGpuTime : m_sceneGpuTimes)
+            statistics.sceneGpuTimeMeasured(sceneGpuTime.sceneId, static_cast<UInt32>(sceneGpuTime.gpuTime / 1000u));
+
+        for (const auto& passGpuTime : m_passGpuTimes)
+        {
+            const UInt32 gpuTimeMicroseconds = static_cast<UInt32>(passGpuTime.gpuTime / 1000u);
+            switch (passGpuTime.pass.getType())
+            {
+            case ERenderingPassType::RenderPass:
+                statistics.renderPassGpuTimeMeasured(passGpuTime.sceneId, passGpuTime.pass.getRenderPassHandle(), gpuTimeMicroseconds);
+                break;
+            case ERenderingPassType::BlitPass:
+                statistics.blitPassGpuTimeMeasured(passGpuTime.sceneId, passGpuTime.pass.getBlitPassHandle(), gpuTimeMicroseconds);
+                break;
+            }
+        }
+    }
+
+    void GpuTimerQueries::finishQueries(const Timestamps& timestamps)
+    {
+        for (const auto& timestamp : timestamps)
+            m_device.finishGpuTimestamp(timestamp.query);
+    }
+
+    void GpuTimerQueries::discardQueries()
+    {
+        for (const auto& pendingFrame : m_pendingFrames)
+            finishQueries(pendingFrame.timestamps);
+        m_pendingFrames.clear();
+
+        finishQueries(m_currentFrame);
+        m_currentFrame.clear();
+    }
+
+    Bool GpuTimerQueries::hasPendingQueries() const
+    {
+        return !m_pendingFrames.empty() || !m_currentFrame.empty();
+    }
+}
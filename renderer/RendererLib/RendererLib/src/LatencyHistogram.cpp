@@ -0,0 +1,154 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/LatencyHistogram.h"
+#include "Collections/StringOutputStream.h"
+#include <cmath>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    const UInt32 LatencyHistogram::SubBucketCount;
+    const UInt32 LatencyHistogram::HalfSubBucketCount;
+    const UInt32 LatencyHistogram::BucketCount;
+    const UInt64 LatencyHistogram::MaxTrackableValue;
+
+    void LatencyHistogram::record(UInt64 valueMicrosec)
+    {
+        const UInt64 value = std::min(valueMicrosec, MaxTrackableValue);
+        ++m_buckets[GetBucketIndex(value)];
+
+        if (m_numSamples == 0u)
+        {
+            m_minimum = value;
+            m_maximum = value;
+        }
+        else
+        {
+            m_minimum = std::min(m_minimum, value);
+            m_maximum = std::max(m_maximum, value);
+        }
+        ++m_numSamples;
+        m_sum += value;
+    }
+
+    void LatencyHistogram::reset()
+    {
+        m_buckets.fill(0u);
+        m_numSamples = 0u;
+        m_sum = 0u;
+        m_minimum = 0u;
+        m_maximum = 0u;
+    }
+
+    UInt64 LatencyHistogram::getNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    UInt64 LatencyHistogram::getMinimum() const
+    {
+        return m_minimum;
+    }
+
+    UInt64 LatencyHistogram::getMaximum() const
+    {
+        return m_maximum;
+    }
+
+    UInt64 LatencyHistogram::getMean() const
+    {
+        return (m_numSamples > 0u ? m_sum / m_numSamples : 0u);
+    }
+
+    UInt64 LatencyHistogram::getValueAtPercentile(Float percentile) const
+    {
+        if (m_numSamples == 0u)
+            return 0u;
+
+        const Float clampedPercentile = std::max(0.f, std::min(percentile, 100.f));
+        const UInt64 rank = std::max<UInt64>(1u, static_cast<UInt64>(std::ceil(static_cast<Double>(clampedPercentile) / 100.0 * static_cast<Double>(m_numSamples))));
+
+        UInt64 numSamplesBelow = 0u;
+        for (UInt32 i = 0u; i < BucketCount; ++i)
+        {
+            numSamplesBelow += m_buckets[i];
+            if (numSamplesBelow >= rank)
+            {
+                // report bucket upper bound, but never outside of the actually recorded range
+                return std::max(m_minimum, std::min(GetBucketUpperBound(i), m_maximum));
+            }
+        }
+
+        return m_maximum;
+    }
+
+    LatencySummary LatencyHistogram::getSummary() const
+    {
+        LatencySummary summary;
+        summary.numSamples = m_numSamples;
+        summary.minimum = m_minimum;
+        summary.maximum = m_maximum;
+        summary.mean = getMean();
+        summary.percentile50 = getValueAtPercentile(50.f);
+        summary.percentile90 = getValueAtPercentile(90.f);
+        summary.percentile99 = getValueAtPercentile(99.f);
+        summary.percentile999 = getValueAtPercentile(99.9f);
+        return summary;
+    }
+
+    void LatencyHistogram::writeSummaryToStream(StringOutputStream& str) const
+    {
+        const LatencySummary summary = getSummary();
+        str << "n:" << summary.numSamples;
+        if (summary.numSamples > 0u)
+        {
+            str << " min:" << summary.minimum
+                << " mean:" << summary.mean
+                << " p50:" << summary.percentile50
+                << " p90:" << summary.percentile90
+                << " p99:" << summary.percentile99
+                << " p99.9:" << summary.percentile999
+                << " max:" << summary.maximum;
+        }
+    }
+
+    UInt32 LatencyHistogram::GetBucketIndex(UInt64 valueMicrosec)
+    {
+        const UInt64 value = std::min(valueMicrosec, MaxTrackableValue);
+        if (value < SubBucketCount)
+            return static_cast<UInt32>(value);
+
+        UInt32 mostSignificantBit = 0u;
+        for (UInt64 v = value >> 1u; v != 0u; v >>= 1u)
+            ++mostSignificantBit;
+
+        // keep 5 significant bits, the highest one is implicit for all buckets above the linear range
+        const UInt32 shift = mostSignificantBit - 4u;
+        return SubBucketCount + (shift - 1u) * HalfSubBucketCount + static_cast<UInt32>((value >> shift) - HalfSubBucketCount);
+    }
+
+    UInt64 LatencyHistogram::GetBucketLowerBound(UInt32 bucketIndex)
+    {
+        if (bucketIndex < SubBucketCount)
+            return bucketIndex;
+
+        const UInt32 shift = (bucketIndex - SubBucketCount) / HalfSubBucketCount + 1u;
+        const UInt64 subBucket = (bucketIndex - SubBucketCount) % HalfSubBucketCount + HalfSubBucketCount;
+        return subBucket << shift;
+    }
+
+    UInt64 LatencyHistogram::GetBucketUpperBound(UInt32 bucketIndex)
+    {
+        if (bucketIndex < SubBucketCount)
+            return bucketIndex;
+
+        const UInt32 shift = (bucketIndex - SubBucketCount) / HalfSubBucketCount + 1u;
+        return GetBucketLowerBound(bucketIndex) + (UInt64(1u) << shift) - 1u;
+    }
+}
@@ -9,6 +9,7 @@
 #include "RendererLib/LatencyMonitor.h"
 #include "RendererEventCollector.h"
 #include "PlatformAbstraction/PlatformTime.h"
+#include "Collections/StringOutputStream.h"
 
 namespace ramses_internal
 {
@@ -20,6 +21,7 @@ namespace ramses_internal
     LatencyMonitor::~LatencyMonitor()
     {
         assert(m_sceneLatencyInfos.count() == 0u);
+        assert(m_sceneLatencyTrackings.count() == 0u);
     }
 
     void LatencyMonitor::onFlushApplied(SceneId sceneId, Clock::time_point flushTimeStamp, Clock::duration latencyLimit)
@@ -71,5 +73,104 @@ namespace ramses_internal
     void LatencyMonitor::stopMonitoringScene(SceneId sceneId)
     {
         m_sceneLatencyInfos.remove(sceneId);
+        m_sceneLatencyTrackings.remove(sceneId);
+    }
+
+    void LatencyMonitor::recordFlushApplied(SceneId sceneId, Clock::time_point flushTimeStamp, Clock::time_point appliedTime, bool needsRendering)
+    {
+        auto it = m_sceneLatencyTrackings.find(sceneId);
+        if (it == m_sceneLatencyTrackings.end())
+        {
+            m_sceneLatencyTrackings.put(sceneId, SceneLatencyTracking());
+            it = m_sceneLatencyTrackings.find(sceneId);
+        }
+
+        auto& tracking = it->value;
+        tracking.histograms.flushToApply.record(GetElapsedMicroseconds(flushTimeStamp, appliedTime));
+
+        // several flushes applied before next rendering are all shown with that rendering, track the longest waiting one
+        if (needsRendering && !tracking.hasNotRenderedApply)
+        {
+            tracking.firstNotRenderedApplyTimeStamp = appliedTime;
+            tracking.hasNotRenderedApply = true;
+        }
+    }
+
+    void LatencyMonitor::recordFlushNotRendered(SceneId sceneId)
+    {
+        auto it = m_sceneLatencyTrackings.find(sceneId);
+        if (it != m_sceneLatencyTrackings.end())
+            it->value.hasNotRenderedApply = false;
+    }
+
+    void LatencyMonitor::recordSceneRendered(SceneId sceneId, DisplayHandle display, Clock::time_point renderedTime)
+    {
+        auto it = m_sceneLatencyTrackings.find(sceneId);
+        if (it == m_sceneLatencyTrackings.end() || !it->value.hasNotRenderedApply)
+            return;
+
+        auto& tracking = it->value;
+        tracking.histograms.applyToRender.record(GetElapsedMicroseconds(tracking.firstNotRenderedApplyTimeStamp, renderedTime));
+        tracking.hasNotRenderedApply = false;
+
+        // scene can be rendered more times before swap (e.g. interrupted offscreen buffer), track the first rendering
+        if (!tracking.notSwappedRenderDisplay.isValid())
+        {
+            tracking.notSwappedRenderTimeStamp = renderedTime;
+            tracking.notSwappedRenderDisplay = display;
+        }
+    }
+
+    void LatencyMonitor::recordFramebufferSwapped(DisplayHandle display, Clock::time_point swappedTime)
+    {
+        for (auto& trackingIt : m_sceneLatencyTrackings)
+        {
+            auto& tracking = trackingIt.value;
+            if (tracking.notSwappedRenderDisplay == display)
+            {
+                tracking.histograms.renderToSwap.record(GetElapsedMicroseconds(tracking.notSwappedRenderTimeStamp, swappedTime));
+                tracking.notSwappedRenderDisplay = DisplayHandle::Invalid();
+            }
+        }
+    }
+
+    const SceneLatencyHistograms* LatencyMonitor::getLatencyHistograms(SceneId sceneId) const
+    {
+        const auto it = m_sceneLatencyTrackings.find(sceneId);
+        return (it != m_sceneLatencyTrackings.end() ? &it->value.histograms : nullptr);
+    }
+
+    void LatencyMonitor::resetLatencyHistograms()
+    {
+        for (auto& trackingIt : m_sceneLatencyTrackings)
+        {
+            trackingIt.value.histograms.flushToApply.reset();
+            trackingIt.value.histograms.applyToRender.reset();
+            trackingIt.value.histograms.renderToSwap.reset();
+        }
+    }
+
+    void LatencyMonitor::writeLatencyHistogramsToStream(StringOutputStream& str) const
+    {
+        str << "Scene latencies (us):";
+        for (const auto& trackingIt : m_sceneLatencyTrackings)
+        {
+            const auto& histograms = trackingIt.value.histograms;
+            str << "\n  scene " << trackingIt.key.getValue() << ": flushToApply [";
+            histograms.flushToApply.writeSummaryToStream(str);
+            str << "] applyToRender [";
+            histograms.applyToRender.writeSummaryToStream(str);
+            str << "] renderToSwap [";
+            histograms.renderToSwap.writeSummaryToStream(str);
+            str << "]";
+        }
+    }
+
+    UInt64 LatencyMonitor::GetElapsedMicroseconds(Clock::time_point from, Clock::time_point to)
+    {
+        // flush time stamp comes from client and its clock might not be exactly in sync with the renderer one
+        if (to <= from)
+            return 0u;
+        return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
     }
 }
@@ -9,6 +9,7 @@
 #include "RendererLib/LoggingDevice.h"
 #include "RendererLib/ConstantLogger.h"
 #include "SceneAPI/RenderBuffer.h"
+#include "SceneAPI/PixelRectangle.h"
 #include "Resource/EffectResource.h"
 
 namespace ramses_internal
@@ -24,6 +25,11 @@ namespace ramses_internal
         return EDeviceTypeId_INVALID;
     }
 
+    String LoggingDevice::getDriverIdentification() const
+    {
+        return String();
+    }
+
     void LoggingDevice::setConstant(DataFieldHandle field, UInt32 count, const Matrix22f* value)
     {
         ConstantLogger::LogValueArray(field, value, count, m_logContext);
@@ -188,6 +194,11 @@ namespace ramses_internal
         m_logContext << "upload vertex buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::streamVertexBufferData(DeviceResourceHandle handle, const Byte*, UInt32 dataSize)
+    {
+        m_logContext << "stream vertex buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteVertexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete vertex buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -221,6 +232,11 @@ namespace ramses_internal
         m_logContext << "upload index buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::streamIndexBufferData(DeviceResourceHandle handle, const Byte*, UInt32 dataSize)
+    {
+        m_logContext << "stream index buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteIndexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete index buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -292,6 +308,11 @@ namespace ramses_internal
         m_logContext << "generate mipmaps for texture [handle:" << handle << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel)
+    {
+        m_logContext << "set texture base mip level [handle:" << handle << " baseMipLevel:" << baseMipLevel << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte*, UInt32 dataSize)
     {
         m_logContext << "update texture data [handle:" << handle << " mipLevel:" << mipLevel << " (x,y,z):(" << x << "," << y << "," << z << ") (w,h,d):(" << width << "," << height << "," << depth << ") dataSize:" << dataSize << "]" << RendererLogContext::NewLine;
@@ -303,6 +324,13 @@ namespace ramses_internal
         return DeviceResourceHandle::Invalid();
     }
 
+    UInt32 LoggingDevice::updateStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat, const UInt8*, const PixelRectangle& updatedRegion)
+    {
+        m_logContext << "update stream texture2d [textureHandle: " << handle << " (w,h):(" << width << "," << height << ") region (x,y,w,h):("
+            << updatedRegion.x << "," << updatedRegion.y << "," << updatedRegion.width << "," << updatedRegion.height << ")]" << RendererLogContext::NewLine;
+        return 0u;
+    }
+
     void LoggingDevice::deleteTexture(DeviceResourceHandle handle)
     {
         m_logContext << "delete texture [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -400,6 +428,41 @@ namespace ramses_internal
     {
     }
 
+    DeviceResourceHandle LoggingDevice::startReadPixels(UInt32 /*x*/, UInt32 /*y*/, UInt32 /*width*/, UInt32 /*height*/)
+    {
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool LoggingDevice::isReadPixelsFinished(DeviceResourceHandle /*handle*/)
+    {
+        return true;
+    }
+
+    Bool LoggingDevice::finishReadPixels(DeviceResourceHandle /*handle*/, UInt8* /*buffer*/)
+    {
+        return true;
+    }
+
+    DeviceResourceHandle LoggingDevice::writeGpuTimestamp()
+    {
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool LoggingDevice::isGpuTimestampAvailable(DeviceResourceHandle /*handle*/)
+    {
+        return true;
+    }
+
+    UInt64 LoggingDevice::finishGpuTimestamp(DeviceResourceHandle /*handle*/)
+    {
+        return 0u;
+    }
+
+    Bool LoggingDevice::isGpuTimerDisjoint()
+    {
+        return false;
+    }
+
     UInt32 LoggingDevice::getTotalGpuMemoryUsageInKB() const
     {
         return m_deviceDelegate.getTotalGpuMemoryUsageInKB();
@@ -0,0 +1,502 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/PersistentBinaryShaderCache.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include "Collections/StringOutputStream.h"
+#include "Utils/File.h"
+#include "Utils/FileUtils.h"
+#include "Utils/BinaryFileInputStream.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/LogMacros.h"
+#include "city.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // version, format, data size, driver hash, checksum and effect hash
+        const UInt32 EntryHeaderSize = 3u * sizeof(UInt32) + 2u * sizeof(UInt64) + sizeof(ResourceContentHash);
+    }
+
+    const UInt32 PersistentBinaryShaderCache::FileVersion;
+    const UInt32 PersistentBinaryShaderCache::DefaultMaxMemorySize;
+
+    PersistentBinaryShaderCache::PersistentBinaryShaderCache(const String& directory, UInt32 maxMemorySize)
+        : m_directory(directory)
+        , m_maxMemorySize(maxMemorySize)
+        , m_thread("R_ShaderCache")
+    {
+        File directoryFile(m_directory);
+        if (!directoryFile.exists() && FileUtils::CreateDirectories(directoryFile) != EStatus_RAMSES_OK)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to create directory " << m_directory << ", binary shaders will not be persisted");
+        }
+
+        m_thread.start(*this);
+    }
+
+    PersistentBinaryShaderCache::~PersistentBinaryShaderCache()
+    {
+        {
+            PlatformLightweightGuard guard(m_lock);
+            m_thread.cancel();
+        }
+        m_jobsAvailable.signal();
+        m_thread.join();
+    }
+
+    Bool PersistentBinaryShaderCache::hasBinaryShader(ResourceContentHash effectHash) const
+    {
+        return getBinaryShader(effectHash) != nullptr;
+    }
+
+    UInt32 PersistentBinaryShaderCache::getBinaryShaderSize(ResourceContentHash effectHash) const
+    {
+        const BinaryShaderPtr binaryShader = getBinaryShader(effectHash);
+        return binaryShader ? static_cast<UInt32>(binaryShader->data.size()) : 0u;
+    }
+
+    UInt32 PersistentBinaryShaderCache::getBinaryShaderFormat(ResourceContentHash effectHash) const
+    {
+        const BinaryShaderPtr binaryShader = getBinaryShader(effectHash);
+        return binaryShader ? binaryShader->format : 0u;
+    }
+
+    void PersistentBinaryShaderCache::getBinaryShaderData(ResourceContentHash effectHash, UInt8* buffer, UInt32 bufferSize) const
+    {
+        const BinaryShaderPtr binaryShader = getBinaryShader(effectHash);
+        if (binaryShader)
+        {
+            assert(bufferSize >= binaryShader->data.size());
+            PlatformMemory::Copy(buffer, binaryShader->data.data(), std::min<UInt32>(bufferSize, static_cast<UInt32>(binaryShader->data.size())));
+        }
+    }
+
+    bool PersistentBinaryShaderCache::shouldBinaryShaderBeCached(ResourceContentHash effectHash) const
+    {
+        UNUSED(effectHash);
+        // entries cannot be keyed before driver is known
+        PlatformLightweightGuard guard(m_lock);
+        return !m_driverIdentification.empty();
+    }
+
+    void PersistentBinaryShaderCache::storeBinaryShader(ResourceContentHash effectHash, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat)
+    {
+        assert(binaryShaderData != nullptr);
+        assert(binaryShaderDataSize > 0u);
+
+        std::shared_ptr<BinaryShader> binaryShader = std::make_shared<BinaryShader>();
+        binaryShader->data.resize(binaryShaderDataSize);
+        PlatformMemory::Copy(binaryShader->data.data(), binaryShaderData, binaryShaderDataSize);
+        binaryShader->format = binaryShaderFormat;
+        {
+            PlatformLightweightGuard guard(m_lock);
+            putBinaryShader(effectHash, binaryShader);
+        }
+
+        enqueueJob(EJobType::WriteEntry, effectHash, binaryShader);
+        effectUsed(effectHash);
+    }
+
+    void PersistentBinaryShaderCache::binaryShaderUploaded(ResourceContentHash effectHash, Bool success) const
+    {
+        if (success)
+        {
+            effectUsed(effectHash);
+        }
+        else
+        {
+            // binary is recompiled by renderer and stored again, until then the broken one must not be loaded again from disk
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to upload binary shader from cache for effect " << effectHash);
+            {
+                PlatformLightweightGuard guard(m_lock);
+                removeBinaryShader(effectHash);
+            }
+            enqueueJob(EJobType::RemoveEntry, effectHash);
+        }
+    }
+
+    void PersistentBinaryShaderCache::deviceInitialized(const String& driverIdentification)
+    {
+        {
+            PlatformLightweightGuard guard(m_lock);
+            if (!m_driverIdentification.empty())
+            {
+                if (driverIdentification != m_driverIdentification)
+                {
+                    LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: device with different driver '" << driverIdentification
+                        << "' initialized, binary shaders are kept for first driver '" << m_driverIdentification << "'");
+                }
+                return;
+            }
+
+            m_driverIdentification = driverIdentification;
+            m_driverHash = CityHash64(driverIdentification.c_str(), driverIdentification.getLength());
+        }
+        LOG_INFO(CONTEXT_RENDERER, "PersistentBinaryShaderCache: using binary shaders of driver '" << driverIdentification << "' from " << m_directory);
+
+        enqueueJob(EJobType::WarmUp, ResourceContentHash::Invalid());
+    }
+
+    void PersistentBinaryShaderCache::flush()
+    {
+        PlatformLightweightGuard guard(m_lock);
+        while (!m_jobs.empty() || m_executingJob)
+        {
+            m_jobsFinished.wait(&m_lock);
+        }
+    }
+
+    String PersistentBinaryShaderCache::getEntryFilePath(ResourceContentHash effectHash) const
+    {
+        StringOutputStream filePath;
+        filePath << m_directory << "/" << effectHash << "_";
+        filePath.setHexadecimalOutputFormat(StringOutputStream::EHexadecimalType_HexLeadingZeros);
+        filePath << getDriverHash();
+        filePath.setHexadecimalOutputFormat(StringOutputStream::EHexadecimalType_NoHex);
+        filePath << ".bin";
+        return filePath.release();
+    }
+
+    String PersistentBinaryShaderCache::getManifestFilePath() const
+    {
+        return m_directory + "/startup_manifest.bin";
+    }
+
+    void PersistentBinaryShaderCache::run()
+    {
+        for (;;)
+        {
+            Job job;
+            {
+                PlatformLightweightGuard guard(m_lock);
+                while (m_jobs.empty() && !isCancelRequested())
+                {
+                    m_jobsAvailable.wait(&m_lock);
+                }
+                // pending writes are finished before shutting down
+                if (m_jobs.empty())
+                {
+                    return;
+                }
+                job = m_jobs.front();
+                m_jobs.pop_front();
+                m_executingJob = true;
+            }
+
+            executeJob(job);
+
+            {
+                PlatformLightweightGuard guard(m_lock);
+                m_executingJob = false;
+            }
+            m_jobsFinished.broadcast();
+        }
+    }
+
+    void PersistentBinaryShaderCache::executeJob(const Job& job)
+    {
+        switch (job.type)
+        {
+        case EJobType::WarmUp:
+            warmUp();
+            break;
+        case EJobType::WriteEntry:
+            writeEntry(job.effectHash, *job.binaryShader);
+            break;
+        case EJobType::RemoveEntry:
+            removeEntry(job.effectHash);
+            break;
+        case EJobType::WriteManifest:
+            writeManifest();
+            break;
+        }
+    }
+
+    void PersistentBinaryShaderCache::enqueueJob(EJobType type, ResourceContentHash effectHash, const BinaryShaderPtr& binaryShader) const
+    {
+        {
+            PlatformLightweightGuard guard(m_lock);
+            m_jobs.push_back({ type, effectHash, binaryShader });
+        }
+        m_jobsAvailable.signal();
+    }
+
+    PersistentBinaryShaderCache::BinaryShaderPtr PersistentBinaryShaderCache::getBinaryShader(ResourceContentHash effectHash) const
+    {
+        // effects not loaded ahead of time are compiled, reading their files here would stall rendering
+        PlatformLightweightGuard guard(m_lock);
+        if (m_driverIdentification.empty())
+        {
+            return nullptr;
+        }
+
+        const auto it = m_binaryShaders.find(effectHash);
+        return it != m_binaryShaders.end() ? it->value : nullptr;
+    }
+
+    UInt64 PersistentBinaryShaderCache::getDriverHash() const
+    {
+        PlatformLightweightGuard guard(m_lock);
+        return m_driverHash;
+    }
+
+    void PersistentBinaryShaderCache::putBinaryShader(ResourceContentHash effectHash, const BinaryShaderPtr& binaryShader)
+    {
+        removeBinaryShader(effectHash);
+        m_binaryShaders.put(effectHash, binaryShader);
+        m_binaryShadersOrder.push_back(effectHash);
+        m_binaryShadersSize += static_cast<UInt32>(binaryShader->data.size());
+
+        // oldest binaries were most likely uploaded already
+        while (m_binaryShadersSize > m_maxMemorySize)
+        {
+            removeBinaryShader(m_binaryShadersOrder.front());
+        }
+    }
+
+    void PersistentBinaryShaderCache::removeBinaryShader(ResourceContentHash effectHash) const
+    {
+        const auto it = m_binaryShaders.find(effectHash);
+        if (it == m_binaryShaders.end())
+        {
+            return;
+        }
+
+        m_binaryShadersSize -= static_cast<UInt32>(it->value->data.size());
+        m_binaryShaders.remove(effectHash);
+        m_binaryShadersOrder.erase(std::find(m_binaryShadersOrder.begin(), m_binaryShadersOrder.end(), effectHash));
+    }
+
+    void PersistentBinaryShaderCache::effectUsed(ResourceContentHash effectHash) const
+    {
+        Bool writeManifest = false;
+        {
+            PlatformLightweightGuard guard(m_lock);
+            if (m_usedEffectsSet.hasElement(effectHash))
+            {
+                return;
+            }
+            m_usedEffectsSet.put(effectHash);
+            m_usedEffects.push_back(effectHash);
+
+            // one pending write covers all effects used until it is executed
+            writeManifest = !m_manifestWritePending;
+            m_manifestWritePending = true;
+        }
+
+        if (writeManifest)
+        {
+            enqueueJob(EJobType::WriteManifest, ResourceContentHash::Invalid());
+        }
+    }
+
+    void PersistentBinaryShaderCache::warmUp()
+    {
+        Vector<ResourceContentHash> effects;
+        if (!readManifest(effects))
+        {
+            return;
+        }
+
+        UInt32 loadedCount = 0u;
+        for (const auto& effectHash : effects)
+        {
+            // loading ahead of time is pointless when shutting down
+            if (isCancelRequested())
+            {
+                return;
+            }
+
+            {
+                PlatformLightweightGuard guard(m_lock);
+                if (m_binaryShaders.contains(effectHash))
+                {
+                    continue;
+                }
+            }
+
+            const BinaryShaderPtr binaryShader = readEntry(effectHash);
+            if (binaryShader)
+            {
+                PlatformLightweightGuard guard(m_lock);
+                if (m_binaryShaders.contains(effectHash))
+                {
+                    continue;
+                }
+                // effects used first in previous run are loaded, the rest would evict them again
+                if (m_binaryShadersSize + binaryShader->data.size() > m_maxMemorySize)
+                {
+                    LOG_INFO(CONTEXT_RENDERER, "PersistentBinaryShaderCache: memory limit of " << m_maxMemorySize << " bytes reached, remaining effects of startup manifest are not loaded ahead of time");
+                    break;
+                }
+                putBinaryShader(effectHash, binaryShader);
+                ++loadedCount;
+            }
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "PersistentBinaryShaderCache: loaded " << loadedCount << " binary shaders of " << effects.size() << " effects listed in startup manifest ahead of time");
+    }
+
+    PersistentBinaryShaderCache::BinaryShaderPtr PersistentBinaryShaderCache::readEntry(ResourceContentHash effectHash) const
+    {
+        File file(getEntryFilePath(effectHash));
+        if (!file.exists())
+        {
+            return nullptr;
+        }
+
+        UInt fileSize = 0u;
+        if (file.getSizeInBytes(fileSize) != EStatus_RAMSES_OK || fileSize < EntryHeaderSize)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: invalid size of " << file.getPath() << ", binary shader will be recompiled");
+            return nullptr;
+        }
+
+        BinaryFileInputStream inputStream(file);
+        if (inputStream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to open " << file.getPath() << ", binary shader will be recompiled");
+            return nullptr;
+        }
+
+        UInt32 fileVersion = 0u;
+        UInt64 driverHash = 0u;
+        ResourceContentHash storedEffectHash;
+        UInt32 dataSize = 0u;
+        UInt64 checksum = 0u;
+        std::shared_ptr<BinaryShader> binaryShader = std::make_shared<BinaryShader>();
+        inputStream >> fileVersion >> driverHash >> storedEffectHash >> binaryShader->format >> dataSize >> checksum;
+
+        if (fileVersion != FileVersion || driverHash != getDriverHash() || storedEffectHash != effectHash || dataSize == 0u || fileSize != EntryHeaderSize + dataSize)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: header of " << file.getPath() << " does not match, binary shader will be recompiled");
+            return nullptr;
+        }
+
+        binaryShader->data.resize(dataSize);
+        inputStream.read(reinterpret_cast<Char*>(binaryShader->data.data()), dataSize);
+        if (inputStream.getState() != EStatus_RAMSES_OK || CityHash64(reinterpret_cast<const Char*>(binaryShader->data.data()), dataSize) != checksum)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: " << file.getPath() << " is corrupt, binary shader will be recompiled");
+            return nullptr;
+        }
+
+        return binaryShader;
+    }
+
+    void PersistentBinaryShaderCache::writeEntry(ResourceContentHash effectHash, const BinaryShader& binaryShader)
+    {
+        const String filePath = getEntryFilePath(effectHash);
+        File temporaryFile(filePath + ".tmp");
+        {
+            BinaryFileOutputStream outputStream(temporaryFile);
+            if (outputStream.getState() != EStatus_RAMSES_OK)
+            {
+                LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to open " << temporaryFile.getPath() << " for writing");
+                return;
+            }
+
+            const UInt32 dataSize = static_cast<UInt32>(binaryShader.data.size());
+            const UInt64 checksum = CityHash64(reinterpret_cast<const Char*>(binaryShader.data.data()), dataSize);
+            outputStream << FileVersion << getDriverHash() << effectHash << binaryShader.format << dataSize << checksum;
+            outputStream.write(binaryShader.data.data(), dataSize);
+        }
+
+        // file is written under a temporary name and renamed over the previous one when complete,
+        // so that an interrupted write never leaves a truncated or missing file behind
+        if (temporaryFile.renameTo(filePath) != EStatus_RAMSES_OK)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to write " << filePath);
+        }
+    }
+
+    void PersistentBinaryShaderCache::removeEntry(ResourceContentHash effectHash)
+    {
+        File file(getEntryFilePath(effectHash));
+        if (file.exists() && file.remove() != EStatus_RAMSES_OK)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to remove " << file.getPath());
+        }
+    }
+
+    Bool PersistentBinaryShaderCache::readManifest(Vector<ResourceContentHash>& effects) const
+    {
+        File file(getManifestFilePath());
+        if (!file.exists())
+        {
+            LOG_INFO(CONTEXT_RENDERER, "PersistentBinaryShaderCache: no startup manifest in " << m_directory << ", no binary shaders loaded ahead of time");
+            return false;
+        }
+
+        UInt fileSize = 0u;
+        BinaryFileInputStream inputStream(file);
+        if (file.getSizeInBytes(fileSize) != EStatus_RAMSES_OK || inputStream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to open " << file.getPath());
+            return false;
+        }
+
+        UInt32 fileVersion = 0u;
+        UInt64 driverHash = 0u;
+        UInt32 effectCount = 0u;
+        inputStream >> fileVersion >> driverHash >> effectCount;
+        if (fileVersion != FileVersion || fileSize != 2u * sizeof(UInt32) + sizeof(UInt64) + effectCount * sizeof(ResourceContentHash))
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: startup manifest " << file.getPath() << " is invalid");
+            return false;
+        }
+        if (driverHash != getDriverHash())
+        {
+            LOG_INFO(CONTEXT_RENDERER, "PersistentBinaryShaderCache: startup manifest was written with another driver, no binary shaders loaded ahead of time");
+            return false;
+        }
+
+        effects.resize(effectCount);
+        for (auto& effectHash : effects)
+        {
+            inputStream >> effectHash;
+        }
+        return inputStream.getState() == EStatus_RAMSES_OK;
+    }
+
+    void PersistentBinaryShaderCache::writeManifest()
+    {
+        Vector<ResourceContentHash> effects;
+        {
+            PlatformLightweightGuard guard(m_lock);
+            effects = m_usedEffects;
+            m_manifestWritePending = false;
+        }
+
+        const String filePath = getManifestFilePath();
+        File temporaryFile(filePath + ".tmp");
+        {
+            BinaryFileOutputStream outputStream(temporaryFile);
+            if (outputStream.getState() != EStatus_RAMSES_OK)
+            {
+                LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to open " << temporaryFile.getPath() << " for writing");
+                return;
+            }
+
+            outputStream << FileVersion << getDriverHash() << static_cast<UInt32>(effects.size());
+            for (const auto& effectHash : effects)
+            {
+                outputStream << effectHash;
+            }
+        }
+
+        if (temporaryFile.renameTo(filePath) != EStatus_RAMSES_OK)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "PersistentBinaryShaderCache: failed to write " << filePath);
+        }
+    }
+}
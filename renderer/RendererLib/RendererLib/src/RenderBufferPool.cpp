@@ -0,0 +1,125 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/RenderBufferPool.h"
+#include "RendererAPI/IDevice.h"
+
+namespace ramses_internal
+{
+    RenderBufferPool::RenderBufferPool(UInt64 retentionSize)
+        : m_retentionSize(retentionSize)
+    {
+    }
+
+    RenderBufferPool::~RenderBufferPool()
+    {
+        assert(m_retainedBuffers.empty());
+    }
+
+    DeviceResourceHandle RenderBufferPool::acquire(IDevice& device, const RenderBuffer& renderBuffer)
+    {
+        if (m_retentionSize == 0u)
+        {
+            ++m_statistics.misses;
+            return device.uploadRenderBuffer(renderBuffer);
+        }
+
+        // most recently released buffer first, it is most likely still resident
+        for (auto it = m_retainedBuffers.rbegin(); it != m_retainedBuffers.rend(); ++it)
+        {
+            if (it->renderBuffer == renderBuffer)
+            {
+                const DeviceResourceHandle deviceHandle = it->deviceHandle;
+                m_retainedSize -= GetRenderBufferByteSize(renderBuffer);
+                m_retainedBuffers.erase(std::next(it).base());
+                m_acquiredBuffers.put(deviceHandle, renderBuffer);
+                ++m_statistics.hits;
+                return deviceHandle;
+            }
+        }
+
+        ++m_statistics.misses;
+        const DeviceResourceHandle deviceHandle = device.uploadRenderBuffer(renderBuffer);
+        m_acquiredBuffers.put(deviceHandle, renderBuffer);
+        return deviceHandle;
+    }
+
+    void RenderBufferPool::release(IDevice& device, DeviceResourceHandle deviceHandle)
+    {
+        if (m_retentionSize == 0u)
+        {
+            device.deleteRenderBuffer(deviceHandle);
+            return;
+        }
+
+        RenderBuffer renderBuffer;
+        const Bool wasAcquired = (EStatus_RAMSES_OK == m_acquiredBuffers.remove(deviceHandle, &renderBuffer));
+        assert(wasAcquired);
+        UNUSED(wasAcquired);
+
+        const UInt32 byteSize = GetRenderBufferByteSize(renderBuffer);
+        if (byteSize > m_retentionSize)
+        {
+            device.deleteRenderBuffer(deviceHandle);
+            return;
+        }
+
+        m_retainedBuffers.push_back({ deviceHandle, renderBuffer });
+        m_retainedSize += byteSize;
+        while (m_retainedSize > m_retentionSize)
+            evictOldestRetainedBuffer(device);
+    }
+
+    void RenderBufferPool::deleteRetainedBuffers(IDevice& device)
+    {
+        for (const auto& retainedBuffer : m_retainedBuffers)
+            device.deleteRenderBuffer(retainedBuffer.deviceHandle);
+        m_retainedBuffers.clear();
+        m_retainedSize = 0u;
+    }
+
+    const RenderBufferPool::Statistics& RenderBufferPool::getStatistics() const
+    {
+        return m_statistics;
+    }
+
+    UInt32 RenderBufferPool::getRetainedBufferCount() const
+    {
+        return static_cast<UInt32>(m_retainedBuffers.size());
+    }
+
+    UInt64 RenderBufferPool::getRetainedSize() const
+    {
+        return m_retainedSize;
+    }
+
+    UInt32 RenderBufferPool::GetRenderBufferByteSize(const RenderBuffer& renderBuffer)
+    {
+        UInt32 memSize = renderBuffer.width * renderBuffer.height * GetTexelSizeFromFormat(renderBuffer.format);
+        const UInt32 sampleCount = renderBuffer.sampleCount;
+        if (0 != sampleCount)
+        {
+            memSize *= sampleCount;
+        }
+
+        return memSize;
+    }
+
+    void RenderBufferPool::evictOldestRetainedBuffer(IDevice& device)
+    {
+        assert(!m_retainedBuffers.empty());
+        const RetainedBuffer& oldestBuffer = m_retainedBuffers.front();
+        const UInt32 byteSize = GetRenderBufferByteSize(oldestBuffer.renderBuffer);
+        device.deleteRenderBuffer(oldestBuffer.deviceHandle);
+
+        m_retainedSize -= byteSize;
+        ++m_statistics.evictedBuffers;
+        m_statistics.evictedBytes += byteSize;
+        m_retainedBuffers.erase(m_retainedBuffers.begin());
+    }
+}
@@ -8,16 +8,135 @@
 
 #include "RenderExecutor.h"
 #include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/GpuTimerQueries.h"
 #include "RendererAPI/IDevice.h"
 #include "SceneAPI/BlitPass.h"
 #include "Common/Cpp11Macros.h"
+#include "SceneUtils/ISceneDataArrayAccessor.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // Returns the field receiving model matrices of batched renderables, invalid if the layout has no such field
+        // or uses any other semantic which differs per renderable and therefore cannot be shared by a batch
+        DataFieldHandle GetInstanceModelMatricesField(const DataLayout& uniformLayout)
+        {
+            DataFieldHandle instanceModelMatricesField;
+            const UInt32 fieldCount = uniformLayout.getFieldCount();
+            for (DataFieldHandle field(0u); field < fieldCount; ++field)
+            {
+                switch (uniformLayout.getField(field).semantics)
+                {
+                case EFixedSemantics_InstanceModelMatrices:
+                    instanceModelMatricesField = field;
+                    break;
+                case EFixedSemantics_ModelMatrix:
+                case EFixedSemantics_ModelViewMatrix:
+                case EFixedSemantics_ModelViewMatrix33:
+                case EFixedSemantics_ModelViewProjectionMatrix:
+                case EFixedSemantics_NormalMatrix:
+                    return DataFieldHandle::Invalid();
+                default:
+                    break;
+                }
+            }
+
+            return instanceModelMatricesField;
+        }
+
+        template <typename T>
+        Bool DataArraysEqual(const IScene& scene, UInt32 elementCount, DataInstanceHandle dataInstA, DataFieldHandle fieldA, DataInstanceHandle dataInstB, DataFieldHandle fieldB)
+        {
+            const T* dataA = ISceneDataArrayAccessor::GetDataArray<T>(&scene, dataInstA, fieldA);
+            const T* dataB = ISceneDataArrayAccessor::GetDataArray<T>(&scene, dataInstB, fieldB);
+            return std::equal(dataA, dataA + elementCount, dataB);
+        }
+
+        Bool DataFieldsEqual(const ResourceCachedScene& scene, EDataType dataType, UInt32 elementCount, DataInstanceHandle dataInstA, DataFieldHandle fieldA, DataInstanceHandle dataInstB, DataFieldHandle fieldB)
+        {
+            switch (dataType)
+            {
+            case EDataType_Float:
+                return DataArraysEqual<Float>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Vector2F:
+                return DataArraysEqual<Vector2>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Vector3F:
+                return DataArraysEqual<Vector3>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Vector4F:
+                return DataArraysEqual<Vector4>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Matrix22F:
+                return DataArraysEqual<Matrix22f>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Matrix33F:
+                return DataArraysEqual<Matrix33f>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Matrix44F:
+                return DataArraysEqual<Matrix44f>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Int32:
+                return DataArraysEqual<Int32>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Vector2I:
+                return DataArraysEqual<Vector2i>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Vector3I:
+                return DataArraysEqual<Vector3i>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_Vector4I:
+                return DataArraysEqual<Vector4i>(scene, elementCount, dataInstA, fieldA, dataInstB, fieldB);
+            case EDataType_DataReference:
+            {
+                const DataInstanceHandle dataRefA = scene.getDataReference(dataInstA, fieldA);
+                const DataInstanceHandle dataRefB = scene.getDataReference(dataInstB, fieldB);
+                if (dataRefA == dataRefB)
+                    return true;
+                const EDataType dataTypeRef = scene.getDataLayout(scene.getLayoutOfDataInstance(dataRefA)).getField(DataFieldHandle(0u)).dataType;
+                return DataFieldsEqual(scene, dataTypeRef, 1u, dataRefA, DataFieldHandle(0u), dataRefB, DataFieldHandle(0u));
+            }
+            case EDataType_TextureSampler:
+            {
+                const TextureSamplerHandle samplerA = scene.getDataTextureSamplerHandle(dataInstA, fieldA);
+                const TextureSamplerHandle samplerB = scene.getDataTextureSamplerHandle(dataInstB, fieldB);
+                if (samplerA == samplerB)
+                    return true;
+                const DeviceHandleVector& textureDeviceHandles = scene.getCachedHandlesForTextureSamplers();
+                return textureDeviceHandles[samplerA.asMemoryHandle()] == textureDeviceHandles[samplerB.asMemoryHandle()]
+                    && scene.getTextureSampler(samplerA).states == scene.getTextureSampler(samplerB).states;
+            }
+            default:
+                return false;
+            }
+        }
+
+        Bool UniformsEqualForBatching(const ResourceCachedScene& scene, DataInstanceHandle uniformsA, DataInstanceHandle uniformsB, DataFieldHandle instanceModelMatricesField)
+        {
+            if (uniformsA == uniformsB)
+                return true;
+
+            const DataLayoutHandle layoutHandle = scene.getLayoutOfDataInstance(uniformsA);
+            if (layoutHandle != scene.getLayoutOfDataInstance(uniformsB))
+                return false;
+
+            const DataLayout& layout = scene.getDataLayout(layoutHandle);
+            const UInt32 fieldCount = layout.getFieldCount();
+            for (DataFieldHandle field(0u); field < fieldCount; ++field)
+            {
+                const DataFieldInfo& fieldInfo = layout.getField(field);
+                // fields resolved by renderer are equal for all renderables of a batch (model dependent ones prevent batching),
+                // text texture is the only semantic input provided by client
+                const Bool resolvedByRenderer = fieldInfo.semantics != EFixedSemantics_Invalid && fieldInfo.semantics != EFixedSemantics_TextTextureUniform;
+                if (field == instanceModelMatricesField || resolvedByRenderer)
+                    continue;
+
+                if (!DataFieldsEqual(scene, fieldInfo.dataType, fieldInfo.elementCount, uniformsA, field, uniformsB, field))
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
     UInt32 RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, GpuTimerQueries* gpuTimerQueries)
         : m_state(device, frameBuffer, renderFrom, frameTimer)
+        , m_gpuTimerQueries(gpuTimerQueries)
     {
     }
 
@@ -25,18 +144,18 @@ namespace ramses_internal
     {
         setGlobalInternalStates(scene, rendererViewMatrix);
 
+        if (m_gpuTimerQueries)
+            m_gpuTimerQueries->sceneStarted(scene.getSceneId());
+
         const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
         for ( ; m_state.m_currentRenderIterator.getRenderPassIdx() < orderedPasses.size(); m_state.m_currentRenderIterator.incrementRenderPassIdx())
         {
             const auto& passInfo = orderedPasses[m_state.m_currentRenderIterator.getRenderPassIdx()];
+            Bool passCompleted = true;
             switch (passInfo.getType())
             {
             case ERenderingPassType::RenderPass:
-                if (!executeRenderPass(scene, passInfo.getRenderPassHandle()))
-                {
-                    assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
-                    return m_state.m_currentRenderIterator;
-                }
+                passCompleted = executeRenderPass(scene, passInfo.getRenderPassHandle());
                 break;
             case ERenderingPassType::BlitPass:
                 executeBlitPass(scene, passInfo.getBlitPassHandle());
@@ -44,6 +163,16 @@ namespace ramses_internal
             default:
                 assert(false);
             }
+
+            // interrupted pass is measured as well, its rest is measured when rendering is resumed
+            if (m_gpuTimerQueries)
+                m_gpuTimerQueries->passFinished(passInfo);
+
+            if (!passCompleted)
+            {
+                assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
+                return m_state.m_currentRenderIterator;
+            }
         }
 
         return {};
@@ -83,28 +212,92 @@ namespace ramses_internal
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
+            UInt32 batchedRenderableCount = 1u;
             if (!scene.renderableResourcesDirty(renderableHandle))
             {
                 setRenderableInternalStates(renderableHandle);
                 setSemanticDataFields();
-                executeRenderable();
+                if (renderPass.isInstanceBatchingEnabled)
+                    batchedRenderableCount = batchFollowingRenderables(orderedRenderables);
+                executeRenderable(batchedRenderableCount);
+            }
+
+            Bool checkTimeBudget = false;
+            for (UInt32 i = 0u; i < batchedRenderableCount; ++i)
+            {
+                m_state.m_currentRenderIterator.incrementRenderableIdx();
+                checkTimeBudget |= (m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u);
             }
-            m_state.m_currentRenderIterator.incrementRenderableIdx();
 
-            if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+            if (checkTimeBudget && m_state.hasExceededTimeBudgetForRendering())
                 return false;
         }
 
         return true;
     }
 
-    void RenderExecutor::executeRenderable() const
+    UInt32 RenderExecutor::batchFollowingRenderables(const RenderableVector& orderedRenderables) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        const RenderableHandle firstHandle = m_state.getRenderable();
+        const Renderable& first = scene.getRenderable(firstHandle);
+        if (first.instanceCount != 1u)
+            return 1u;
+
+        const DataInstanceHandle uniformData = first.dataInstances[ERenderableDataSlotType_Uniforms];
+        const DataInstanceHandle vertexData = first.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataLayout& uniformLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(uniformData));
+        const DataFieldHandle instanceModelMatricesField = GetInstanceModelMatricesField(uniformLayout);
+        if (!instanceModelMatricesField.isValid())
+            return 1u;
+
+        // per instance vertex attributes would be stepped through by the batched instances
+        const UInt32 vertexFieldCount = scene.getDataLayout(scene.getLayoutOfDataInstance(vertexData)).getFieldCount();
+        for (DataFieldHandle vertexField(1u); vertexField < vertexFieldCount; ++vertexField)
+        {
+            if (scene.getDataResource(vertexData, vertexField).instancingDivisor != 0u)
+                return 1u;
+        }
+
+        const UInt32 maxBatchSize = uniformLayout.getField(instanceModelMatricesField).elementCount;
+        const DeviceResourceHandle effectDeviceHandle = scene.getRenderableEffectDeviceHandle(firstHandle);
+        const UInt32 renderStateId = scene.getInternedRenderStateId(first.renderState);
+        const UInt firstIdx = m_state.m_currentRenderIterator.getRenderableIdx();
+
+        UInt32 batchSize = 1u;
+        while (batchSize < maxBatchSize && firstIdx + batchSize < orderedRenderables.size())
+        {
+            const RenderableHandle candidateHandle = orderedRenderables[firstIdx + batchSize];
+            if (scene.renderableResourcesDirty(candidateHandle))
+                break;
+
+            const Renderable& candidate = scene.getRenderable(candidateHandle);
+            const Bool canBeBatched = candidate.instanceCount == 1u
+                && candidate.startIndex == first.startIndex
+                && candidate.indexCount == first.indexCount
+                && candidate.dataInstances[ERenderableDataSlotType_Geometry] == vertexData
+                && scene.getRenderableEffectDeviceHandle(candidateHandle) == effectDeviceHandle
+                && scene.getInternedRenderStateId(candidate.renderState) == renderStateId
+                && UniformsEqualForBatching(scene, uniformData, candidate.dataInstances[ERenderableDataSlotType_Uniforms], instanceModelMatricesField);
+            if (!canBeBatched)
+                break;
+
+            ++batchSize;
+        }
+
+        if (batchSize > 1u)
+            setInstanceModelMatrices(&orderedRenderables[firstIdx], batchSize);
+
+        return batchSize;
+    }
+
+    void RenderExecutor::executeRenderable(UInt32 batchedRenderableCount) const
     {
         executeRenderStates();
 
         executeEffectAndInputs();
 
-        executeDrawCall();
+        executeDrawCall(batchedRenderableCount);
     }
 
     void RenderExecutor::executeRenderTarget(RenderTargetHandle renderTarget) const
@@ -129,6 +322,10 @@ namespace ramses_internal
 
     void RenderExecutor::executeRenderStates() const
     {
+        // renderables with equal render state have equal id, nothing to apply until the id changes
+        if (!m_state.renderStateId.hasChanged())
+            return;
+
         IDevice& device = m_state.getDevice();
         if (m_state.depthStencilState.hasChanged())
         {
@@ -199,6 +396,10 @@ namespace ramses_internal
                 const EDataType dataTypeRef = renderScene.getDataLayout(dataRefLayout).getField(DataFieldHandle(0u)).dataType;
                 executeConstant(dataTypeRef, 1u, dataRef, DataFieldHandle(0u), constantField);
             }
+            else if (field.semantics == EFixedSemantics_InstanceModelMatrices)
+            {
+                device.setConstant(constantField, static_cast<UInt32>(m_instanceModelMatrices.size()), m_instanceModelMatrices.data());
+            }
             else
             {
                 executeConstant(field.dataType, field.elementCount, uniformData, constantField, constantField);
@@ -304,13 +505,19 @@ namespace ramses_internal
 
             device.activateTexture(textureDeviceHandle, uniformInputField);
 
-            const TextureSamplerStates& samplerStates = renderScene.getTextureSampler(samplerHandle).states;
-            device.setTextureSampling(uniformInputField,
-                samplerStates.m_addressModeU,
-                samplerStates.m_addressModeV,
-                samplerStates.m_addressModeR,
-                samplerStates.m_samplingMode,
-                samplerStates.m_anisotropyLevel);
+            const UInt32 samplerStatesId = renderScene.getInternedTextureSamplerStatesId(samplerHandle);
+            const UInt32* appliedSamplerStatesId = m_state.textureSamplerStatesIds.get(textureDeviceHandle);
+            if (appliedSamplerStatesId == nullptr || *appliedSamplerStatesId != samplerStatesId)
+            {
+                const TextureSamplerStates& samplerStates = renderScene.getTextureSampler(samplerHandle).states;
+                device.setTextureSampling(uniformInputField,
+                    samplerStates.m_addressModeU,
+                    samplerStates.m_addressModeV,
+                    samplerStates.m_addressModeR,
+                    samplerStates.m_samplingMode,
+                    samplerStates.m_anisotropyLevel);
+                m_state.textureSamplerStatesIds.put(textureDeviceHandle, samplerStatesId);
+            }
             break;
         }
 
@@ -319,7 +526,7 @@ namespace ramses_internal
         }
     }
 
-    void RenderExecutor::executeDrawCall() const
+    void RenderExecutor::executeDrawCall(UInt32 batchedRenderableCount) const
     {
         IDevice& device = m_state.getDevice();
         const IScene& renderScene = m_state.getScene();
@@ -332,13 +539,15 @@ namespace ramses_internal
             device.activateIndexBuffer(m_state.indexBufferDeviceHandle.getState());
         }
 
+        // batched renderables are drawn as instances, batching is only done for renderables with single instance
+        const UInt32 instanceCount = renderable.instanceCount * batchedRenderableCount;
         if (hasIndexArray)
         {
-            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, instanceCount);
         }
         else
         {
-            device.drawTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawTriangles(renderable.startIndex, renderable.indexCount, instanceCount);
         }
     }
 
@@ -362,33 +571,15 @@ namespace ramses_internal
         const DeviceHandleVector& geometryDeviceHandles = renderScene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()];
         m_state.indexBufferDeviceHandle.setState(geometryDeviceHandles.front());
 
-        const RenderState& renderState = renderScene.getRenderState(renderable.renderState);
-
-        DepthStencilState depthStencilState;
-        depthStencilState.m_depthFunc          = renderState.depthFunc;
-        depthStencilState.m_depthWrite         = renderState.depthWrite;
-        depthStencilState.m_stencilFunc        = renderState.stencilFunc;
-        depthStencilState.m_stencilMask        = renderState.stencilMask;
-        depthStencilState.m_stencilOpDepthFail = renderState.stencilOpDepthFail;
-        depthStencilState.m_stencilOpDepthPass = renderState.stencilOpDepthPass;
-        depthStencilState.m_stencilOpFail      = renderState.stencilOpFail;
-        depthStencilState.m_stencilRefValue    = renderState.stencilRefValue;
-        m_state.depthStencilState.setState(depthStencilState);
-
-        BlendState blendState;
-        blendState.m_blendFactorSrcColor = renderState.blendFactorSrcColor;
-        blendState.m_blendFactorDstColor = renderState.blendFactorDstColor;
-        blendState.m_blendFactorSrcAlpha = renderState.blendFactorSrcAlpha;
-        blendState.m_blendFactorDstAlpha = renderState.blendFactorDstAlpha;
-        blendState.m_blendOperationColor = renderState.blendOperationColor;
-        blendState.m_blendOperationAlpha = renderState.blendOperationAlpha;
-        blendState.m_colorWriteMask      = renderState.colorWriteMask;
-        m_state.blendState.setState(blendState);
-
-        RasterizerState rasterizerState;
-        rasterizerState.m_cullMode = renderState.cullMode;
-        rasterizerState.m_drawMode = renderState.drawMode;
-        m_state.rasterizerState.setState(rasterizerState);
+        m_state.renderStateId.setState(renderScene.getInternedRenderStateId(renderable.renderState));
+        if (m_state.renderStateId.hasChanged())
+        {
+            // only parts of render state which differ from previous one are applied to device
+            const RenderStateBlock& renderState = renderScene.getInternedRenderState(m_state.renderStateId.getState());
+            m_state.depthStencilState.setState(renderState.depthStencilState);
+            m_state.blendState.setState(renderState.blendState);
+            m_state.rasterizerState.setState(renderState.rasterizerState);
+        }
     }
 
     void RenderExecutor::activateRenderTarget(RenderTargetHandle renderTarget) const
@@ -409,6 +600,8 @@ namespace ramses_internal
 
         IDevice& device = m_state.getDevice();
         device.activateRenderTarget(renderTargetDeviceResource);
+        if (m_state.getFrameBufferInfo().scissorEnabled)
+            device.enableScissorTest(!renderTarget.isValid());
     }
 
     void RenderExecutor::resolveAndSetSemanticDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle) const
@@ -483,6 +676,13 @@ namespace ramses_internal
             scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
             break;
         }
+        case EFixedSemantics_InstanceModelMatrices:
+        {
+            // matrix of renderable itself, replaced by matrices of all batched renderables if following ones are batched
+            const RenderableHandle renderable = m_state.getRenderable();
+            setInstanceModelMatrices(&renderable, 1u);
+            break;
+        }
         case EFixedSemantics_TextTextureUniform:
             // not used to fill in data on renderer
             break;
@@ -511,10 +711,22 @@ namespace ramses_internal
         }
     }
 
+    void RenderExecutor::setInstanceModelMatrices(const RenderableHandle* renderables, UInt32 renderableCount) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        m_instanceModelMatrices.resize(renderableCount);
+        for (UInt32 i = 0u; i < renderableCount; ++i)
+        {
+            m_instanceModelMatrices[i] = scene.getRenderableWorldMatrix(renderables[i]);
+        }
+    }
+
     void RenderExecutor::executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const
     {
         //set invalid render target to state
         m_state.renderTargetState.setState(RenderTargetHandle::Invalid() - 1);
+        if (m_state.getFrameBufferInfo().scissorEnabled)
+            m_state.getDevice().enableScissorTest(false);
 
         const BlitPass& blitPass = scene.getBlitPass(pass);
         const UInt indexToCache = pass.asMemoryHandle() * 2u;
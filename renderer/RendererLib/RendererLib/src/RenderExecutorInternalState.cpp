@@ -12,7 +12,8 @@
 namespace ramses_internal
 {
     RenderExecutorInternalState::RenderExecutorInternalState(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
-        : viewportState(Viewport(std::numeric_limits<UInt32>::max(), std::numeric_limits<UInt32>::max(), std::numeric_limits<UInt32>::max(), std::numeric_limits<UInt32>::max()))
+        : renderStateId(RenderStateCache::InvalidId)
+        , viewportState(Viewport(std::numeric_limits<UInt32>::max(), std::numeric_limits<UInt32>::max(), std::numeric_limits<UInt32>::max(), std::numeric_limits<UInt32>::max()))
         , m_currentRenderIterator(renderFrom)
         , m_device(device)
         , m_scene(0)
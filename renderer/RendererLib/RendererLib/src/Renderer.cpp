@@ -25,18 +25,23 @@
 #include "Platform_Base/PlatformFactory_Base.h"
 #include "Utils/LogMacros.h"
 #include "Common/Cpp11Macros.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
     const Vector4 Renderer::DefaultClearColor = { 0.f, 0.f, 0.f, 1.f };
 
-    Renderer::Renderer(IPlatformFactory& platformFactory, const RendererScenes& rendererScenes, RendererEventCollector& eventCollector, const FrameTimer& frameTimer, LatencyMonitor& latencyMonitor)
+    Renderer::Renderer(IPlatformFactory& platformFactory, const RendererScenes& rendererScenes, RendererEventCollector& eventCollector, const FrameTimer& frameTimer, LatencyMonitor& latencyMonitor, Bool renderThreadPerDisplay)
         : m_platformFactory(platformFactory)
         , m_systemCompositorController(nullptr)
         , m_rendererScenes(rendererScenes)
         , m_displayHandlerManager(eventCollector)
         , m_frameTimer(frameTimer)
         , m_latencyMonitor(latencyMonitor)
+        , m_renderThreadPerDisplay(renderThreadPerDisplay)
     {
         m_platformFactory.createPerRendererComponents();
         m_systemCompositorController = platformFactory.getSystemCompositorController();
@@ -110,6 +115,10 @@ namespace ramses_internal
         displayInfo.frameBufferDeviceHandle = display.getDisplayBuffer();
         displayInfo.buffersSetup.registerDisplayBuffer(displayInfo.frameBufferDeviceHandle, { 0, 0, display.getDisplayWidth(), display.getDisplayHeight() }, DefaultClearColor, false, false);
         displayInfo.couldRenderLastFrame = true;
+        if (m_renderThreadPerDisplay)
+        {
+            displayInfo.renderThread.reset(new DisplayRenderThread([this, displayHandle]() { renderDisplayFrame(displayHandle); }));
+        }
 
         m_scheduledScreenshots.put(displayHandle, ScreenshotInfoVector());
         auto profileRenderer = new FrameProfileRenderer(display.getRenderBackend().getDevice(), display.getDisplayWidth(), display.getDisplayHeight());
@@ -131,6 +140,32 @@ namespace ramses_internal
         addDisplayController(*displayController, display);
         setClearColor(display, displayConfig.getClearColor());
 
+        if (displayConfig.isSceneLayerCacheEnabled())
+        {
+            auto& displayInfo = m_displays.find(display)->second;
+            displayInfo.sceneLayerCache.reset(new SceneLayerCache(displayController->getRenderBackend().getDevice(), displayController->getDisplayWidth(), displayController->getDisplayHeight(),
+                displayConfig.getSceneLayerCacheMemoryBudget()));
+        }
+
+        if (displayConfig.isPartialFramebufferRedrawEnabled())
+        {
+            if (displayConfig.isStereoDisplay())
+            {
+                LOG_WARN(CONTEXT_RENDERER, "Renderer::createDisplayContext: partial framebuffer redraw is not supported for stereo display, will redraw full framebuffer");
+            }
+            else
+            {
+                auto& displayInfo = m_displays.find(display)->second;
+                displayInfo.damageTracker.reset(new FramebufferDamageTracker({ 0u, 0u, displayController->getDisplayWidth(), displayController->getDisplayHeight() }));
+            }
+        }
+
+        if (displayConfig.isGpuTimerQueriesEnabled())
+        {
+            auto& displayInfo = m_displays.find(display)->second;
+            displayInfo.gpuTimerQueries.reset(new GpuTimerQueries(displayController->getRenderBackend().getDevice()));
+        }
+
         LOG_TRACE(CONTEXT_PROFILING, "RamsesRenderer::createDisplayContext finished creating display");
     }
 
@@ -162,6 +197,13 @@ namespace ramses_internal
         IDisplayController& displayController = *displayInfo.displayController;
         displayController.validateRenderingStatusHealthy();
 
+        // release read back storage, screenshots still pending on removed display are not reported
+        UInt8Vector discardedPixelData;
+        for (const auto& pendingScreenshot : displayInfo.pendingScreenshots)
+            displayController.finishReadPixels(pendingScreenshot.readPixelsHandle, pendingScreenshot.screenshot.rectangle.width, pendingScreenshot.screenshot.rectangle.height, discardedPixelData);
+        if (displayInfo.gpuTimerQueries)
+            displayInfo.gpuTimerQueries->discardQueries();
+
         m_displays.erase(display);
         m_scheduledScreenshots.remove(display);
 
@@ -176,6 +218,11 @@ namespace ramses_internal
         return m_displays.find(display) != m_displays.cend();
     }
 
+    Bool Renderer::hasRenderThreadPerDisplay() const
+    {
+        return m_renderThreadPerDisplay;
+    }
+
     void Renderer::systemCompositorListIviSurfaces() const
     {
         if(0 != m_systemCompositorController)
@@ -306,51 +353,153 @@ namespace ramses_internal
         }
     }
 
-    void Renderer::renderToFramebuffer(DisplayHandle displayHandle, DisplayHandle& activeDisplay)
+    Bool Renderer::renderToFramebuffer(DisplayHandle displayHandle, DisplayHandle& activeDisplay)
     {
         auto& displayInfo = m_displays.find(displayHandle)->second;
         assert(displayInfo.couldRenderLastFrame);
         IDisplayController& display = *displayInfo.displayController;
         const DisplayBufferInfo& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayInfo.frameBufferDeviceHandle);
+
+        // screenshots started in previous frames are collected regardless of whether this frame is rendered
+        if (!displayInfo.pendingScreenshots.empty())
+        {
+            ActivateDisplayContext(displayHandle, activeDisplay, display);
+            finishPendingScreenshots(displayHandle);
+        }
+
+        // GPU time measured in previous frames is collected once per frame, same as screenshots
+        if (displayInfo.gpuTimerQueries && displayInfo.gpuTimerQueries->hasPendingQueries())
+        {
+            ActivateDisplayContext(displayHandle, activeDisplay, display);
+            PlatformLightweightGuard guard(m_displayThreadsLock);
+            displayInfo.gpuTimerQueries->resolveQueries(m_statistics);
+        }
+
         if (!displayBufferInfo.needsRerender)
         {
             // notify clients even if nothing rendered but frame was consumed
             display.getEmbeddedCompositingManager().notifyClients();
-            return;
+            return false;
         }
 
         ActivateDisplayContext(displayHandle, activeDisplay, display);
 
+        auto profileRenderer = *m_frameProfileRenderer.get(displayHandle);
+        Bool scissorDisplayBuffer = false;
+        if (displayInfo.damageTracker)
+        {
+            displayInfo.tempSceneRegions.clear();
+            for (const auto& sceneInfo : displayBufferInfo.mappedScenes)
+            {
+                if (sceneInfo.shown)
+                {
+                    const Viewport sceneRegion = GetSceneFramebufferRegion(m_rendererScenes.getScene(sceneInfo.sceneId), displayBufferInfo.viewport, display.getProjectionParams(), display.getViewMatrix());
+                    displayInfo.tempSceneRegions.push_back({ sceneInfo.sceneId, sceneRegion });
+                }
+            }
+
+            // profiler overlay is drawn over whole framebuffer
+            if (profileRenderer->isEnabled())
+                displayInfo.damageTracker->markFullRedraw();
+
+            const Viewport redrawRegion = displayInfo.damageTracker->startFrame(displayInfo.tempSceneRegions, display.getDisplayBufferAge());
+            scissorDisplayBuffer = (redrawRegion != displayBufferInfo.viewport);
+            if (scissorDisplayBuffer)
+            {
+                display.setDisplayBufferScissorRegion(true, redrawRegion);
+                LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToFramebuffer (display " << displayHandle.asMemoryHandle() << ") redraw region " << redrawRegion.posX << " " << redrawRegion.posY << " " << redrawRegion.width << " " << redrawRegion.height);
+            }
+        }
+
         display.clearBuffer(displayInfo.frameBufferDeviceHandle, displayBufferInfo.clearColor);
 
-        m_tempScenesRendered.clear();
+        displayInfo.tempScenesRendered.clear();
         const MappedScenes& mappedScenes = displayBufferInfo.mappedScenes;
         for (const auto& sceneInfo : mappedScenes)
         {
             if (sceneInfo.shown)
             {
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
-                display.renderScene(scene, displayInfo.frameBufferDeviceHandle, displayBufferInfo.viewport);
-                onSceneWasRendered(scene);
-                m_tempScenesRendered.push_back(sceneInfo.sceneId);
+                if (displayInfo.sceneLayerCache)
+                {
+                    renderSceneToFramebufferUsingLayerCache(displayHandle, scene, displayBufferInfo.viewport);
+                }
+                else
+                {
+                    display.renderScene(scene, displayInfo.frameBufferDeviceHandle, displayBufferInfo.viewport, {}, nullptr, displayInfo.gpuTimerQueries.get());
+                    onSceneWasRendered(displayHandle, scene);
+                }
+                displayInfo.tempScenesRendered.push_back(sceneInfo.sceneId);
             }
         }
         LOG_TRACE_F(CONTEXT_PROFILING, ([&](StringOutputStream& logStream)
         {
             logStream << "Renderer::renderToFramebuffer (display " << displayHandle.asMemoryHandle() << ") rendered scenes:";
-            for (auto sceneId : m_tempScenesRendered)
+            for (auto sceneId : displayInfo.tempScenesRendered)
                 logStream << " " << sceneId;
         }));
 
+        if (displayInfo.sceneLayerCache)
+        {
+            displayInfo.sceneLayerCache->finishFrame(displayInfo.tempScenesRendered);
+            PlatformLightweightGuard guard(m_displayThreadsLock);
+            m_statistics.sceneLayersMemoryUsed(displayHandle, displayInfo.sceneLayerCache->getLayersMemorySize());
+        }
+
+        // post processing redraws whole framebuffer from offscreen display buffer
+        if (scissorDisplayBuffer)
+            display.setDisplayBufferScissorRegion(false, {});
+
         display.executePostProcessing();
 
-        auto profileRenderer = *m_frameProfileRenderer.get(displayHandle);
         profileRenderer->renderStatistics(m_profilerStatistics);
 
         processScheduledScreenshots(displayHandle, display, activeDisplay);
 
-        m_tempDisplaysToSwapBuffers.push_back(displayHandle);
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, false);
+        return true;
+    }
+
+    void Renderer::renderSceneToFramebufferUsingLayerCache(DisplayHandle displayHandle, const RendererCachedScene& scene, const Viewport& viewport)
+    {
+        auto& displayInfo = m_displays.find(displayHandle)->second;
+        IDisplayController& display = *displayInfo.displayController;
+        SceneLayerCache& layerCache = *displayInfo.sceneLayerCache;
+        const SceneId sceneId = scene.getSceneId();
+
+        if (layerCache.hasValidLayer(sceneId))
+        {
+            const UInt32 savedRenderCpuTime = layerCache.compositeLayer(sceneId, displayInfo.frameBufferDeviceHandle);
+            PlatformLightweightGuard guard(m_displayThreadsLock);
+            m_statistics.sceneLayerComposited(displayHandle, savedRenderCpuTime);
+            return;
+        }
+
+        // scene likely to change again soon would only add the cost of compositing, scene which does not blend
+        // like its layer is composited would look different, layer is only created if it fits in memory budget
+        DeviceResourceHandle layerRenderTarget;
+        if (!layerCache.wasSceneModified(sceneId))
+        {
+            if (SceneLayerCache::CanCompositeScene(scene))
+                layerRenderTarget = layerCache.getLayerRenderTarget(sceneId);
+            else
+                layerCache.removeLayer(sceneId);
+        }
+
+        if (layerRenderTarget.isValid())
+        {
+            display.clearBuffer(layerRenderTarget, Vector4(0.f, 0.f, 0.f, 0.f));
+            const UInt64 renderStartTime = PlatformTime::GetMicrosecondsMonotonic();
+            display.renderScene(scene, layerRenderTarget, viewport, {}, nullptr, displayInfo.gpuTimerQueries.get());
+            layerCache.setLayerRendered(sceneId, static_cast<UInt32>(PlatformTime::GetMicrosecondsMonotonic() - renderStartTime));
+            layerCache.compositeLayer(sceneId, displayInfo.frameBufferDeviceHandle);
+            LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToFramebuffer (display " << displayHandle.asMemoryHandle() << ") scene " << sceneId << " rendered to cached layer");
+        }
+        else
+        {
+            display.renderScene(scene, displayInfo.frameBufferDeviceHandle, viewport, {}, nullptr, displayInfo.gpuTimerQueries.get());
+        }
+        onSceneWasRendered(displayHandle, scene);
     }
 
     void Renderer::renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay)
@@ -370,26 +519,29 @@ namespace ramses_internal
             const auto& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayBuffer);
             display.clearBuffer(displayBuffer, displayBufferInfo.clearColor);
 
-            m_tempScenesRendered.clear();
+            displayInfo.tempScenesRendered.clear();
             const MappedScenes& mappedScenes = displayBufferInfo.mappedScenes;
             for (const auto& sceneInfo : mappedScenes)
             {
                 if (sceneInfo.shown)
                 {
                     const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
-                    display.renderScene(scene, displayBuffer, displayBufferInfo.viewport);
-                    onSceneWasRendered(scene);
-                    m_tempScenesRendered.push_back(sceneInfo.sceneId);
+                    display.renderScene(scene, displayBuffer, displayBufferInfo.viewport, {}, nullptr, displayInfo.gpuTimerQueries.get());
+                    onSceneWasRendered(displayHandle, scene);
+                    displayInfo.tempScenesRendered.push_back(sceneInfo.sceneId);
                 }
             }
             LOG_TRACE_F(CONTEXT_PROFILING, ([&](StringOutputStream& logStream)
             {
                 logStream << "Renderer::renderToOffscreenBuffers (display " << displayHandle.asMemoryHandle() << ") OB" << displayBuffer.asMemoryHandle() << " rendered scenes:";
-                for (auto sceneId : m_tempScenesRendered)
+                for (auto sceneId : displayInfo.tempScenesRendered)
                     logStream << " " << sceneId;
             }));
 
-            m_statistics.offscreenBufferSwapped(displayHandle, displayBuffer, false);
+            {
+                PlatformLightweightGuard guard(m_displayThreadsLock);
+                m_statistics.offscreenBufferSwapped(displayHandle, displayBuffer, false);
+            }
             displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, false);
         }
     }
@@ -431,7 +583,7 @@ namespace ramses_internal
                     continue;
 
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
-                const SceneRenderExecutionIterator interruptState = display.renderScene(scene, displayBuffer, displayBufferInfo.viewport, m_rendererInterruptState.getExecutorState(), &m_frameTimer);
+                const SceneRenderExecutionIterator interruptState = display.renderScene(scene, displayBuffer, displayBufferInfo.viewport, m_rendererInterruptState.getExecutorState(), &m_frameTimer, displayInfo.gpuTimerQueries.get());
 
                 if (RendererInterruptState::IsInterrupted(interruptState))
                 {
@@ -443,7 +595,7 @@ namespace ramses_internal
                 }
                 m_rendererInterruptState = {};
 
-                onSceneWasRendered(scene);
+                onSceneWasRendered(displayHandle, scene);
                 LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToInterruptibleOffscreenBuffers scene fully rendered to interruptible OB " << displayBuffer.asMemoryHandle() << " on display " << displayHandle.asMemoryHandle() << ", scene " << sceneId.getValue());
             }
 
@@ -456,12 +608,18 @@ namespace ramses_internal
 
             //re-render framebuffer in next frame to reflect (finished!) changes in OB
             displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, true);
+            // consumers of the OB are not known here, cached layers might show its previous content
+            if (displayInfo.sceneLayerCache)
+                displayInfo.sceneLayerCache->markAllScenesModified();
+            if (displayInfo.damageTracker)
+                displayInfo.damageTracker->markFullRedraw();
         }
     }
 
     void Renderer::doOneRenderLoop()
     {
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin");
+        m_swapBuffersDuration = std::chrono::microseconds{ 0 };
 
         if (!m_skipUnmodifiedBuffers)
         {
@@ -471,6 +629,10 @@ namespace ramses_internal
                 auto& displayBufferSetup = display.second.buffersSetup;
                 for (const auto& buffer : displayBufferSetup.getDisplayBuffers())
                     displayBufferSetup.setDisplayBufferToBeRerendered(buffer.first, true);
+                if (display.second.sceneLayerCache)
+                    display.second.sceneLayerCache->markAllScenesModified();
+                if (display.second.damageTracker)
+                    display.second.damageTracker->markFullRedraw();
             }
         }
 
@@ -493,15 +655,27 @@ namespace ramses_internal
 
         m_profilerStatistics.startRegion(FrameProfilerStatistics::ERegion::DrawScenes);
         // FRAMEBUFFER AND OFFSCREEN BUFFERS
-        for (auto displayHandle : m_tempDisplaysToRender)
+        if (m_renderThreadPerDisplay)
         {
-            LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame to offscreen buffers on display " << displayHandle.asMemoryHandle());
-            renderToOffscreenBuffers(displayHandle, activeDisplay);
-            LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame to offscreen buffers on display " << displayHandle.asMemoryHandle());
+            renderDisplaysOnRenderThreads(activeDisplay);
+        }
+        else
+        {
+            for (auto displayHandle : m_tempDisplaysToRender)
+            {
+                const UInt64 renderStartTime = PlatformTime::GetMicrosecondsMonotonic();
+
+                LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame to offscreen buffers on display " << displayHandle.asMemoryHandle());
+                renderToOffscreenBuffers(displayHandle, activeDisplay);
+                LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame to offscreen buffers on display " << displayHandle.asMemoryHandle());
 
-            LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame to backbuffer on display " << displayHandle.asMemoryHandle());
-            renderToFramebuffer(displayHandle, activeDisplay);
-            LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame to backbuffer on display " << displayHandle.asMemoryHandle());
+                LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame to backbuffer on display " << displayHandle.asMemoryHandle());
+                if (renderToFramebuffer(displayHandle, activeDisplay))
+                    m_tempDisplaysToSwapBuffers.push_back(displayHandle);
+                LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame to backbuffer on display " << displayHandle.asMemoryHandle());
+
+                m_displays.find(displayHandle)->second.frameDuration = static_cast<UInt32>(PlatformTime::GetMicrosecondsMonotonic() - renderStartTime);
+            }
         }
 
         // INTERRUPTIBLE OFFSCREEN BUFFERS
@@ -524,25 +698,93 @@ namespace ramses_internal
 
         // SWAP BUFFERS
         m_profilerStatistics.startRegion(FrameProfilerStatistics::ERegion::SwapBuffersAndNotifyClients);
+        const UInt64 swapBuffersStartTime = PlatformTime::GetMicrosecondsMonotonic();
         ReorderDisplaysToStartWith(m_tempDisplaysToSwapBuffers, activeDisplay);
         for (auto displayHandle : m_tempDisplaysToSwapBuffers)
         {
+            const UInt64 swapStartTime = PlatformTime::GetMicrosecondsMonotonic();
             IDisplayController& displayController = getDisplayController(displayHandle);
             ActivateDisplayContext(displayHandle, activeDisplay, displayController);
-            displayController.swapBuffers();
+            const auto& damageTracker = m_displays.find(displayHandle)->second.damageTracker;
+            if (damageTracker)
+                displayController.swapBuffersWithDamage(damageTracker->getFrameDamage());
+            else
+                displayController.swapBuffers();
             m_statistics.framebufferSwapped(displayHandle);
+            m_latencyMonitor.recordFramebufferSwapped(displayHandle, LatencyMonitor::Clock::now());
             displayController.getEmbeddedCompositingManager().notifyClients();
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop swapBuffers on display " << displayHandle.asMemoryHandle());
+            m_displays.find(displayHandle)->second.frameDuration += static_cast<UInt32>(PlatformTime::GetMicrosecondsMonotonic() - swapStartTime);
         }
+        if (!m_tempDisplaysToSwapBuffers.empty())
+            m_swapBuffersDuration = std::chrono::microseconds{ PlatformTime::GetMicrosecondsMonotonic() - swapBuffersStartTime };
         m_profilerStatistics.endRegion(FrameProfilerStatistics::ERegion::SwapBuffersAndNotifyClients);
 
+        for (auto displayHandle : m_tempDisplaysToRender)
+            m_statistics.displayFrameRendered(displayHandle, m_displays.find(displayHandle)->second.frameDuration);
+
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop end");
     }
 
-    void Renderer::onSceneWasRendered(const RendererCachedScene& scene)
+    void Renderer::renderDisplaysOnRenderThreads(DisplayHandle& activeDisplay)
+    {
+        // a context can only be current on one thread, release it here so that the display's render thread can take it over
+        for (auto displayHandle : m_tempDisplaysToRender)
+            getDisplayController(displayHandle).disableContext();
+        activeDisplay = DisplayHandle::Invalid();
+
+        for (auto displayHandle : m_tempDisplaysToRender)
+        {
+            LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame on render thread of display " << displayHandle.asMemoryHandle());
+            m_displays.find(displayHandle)->second.renderThread->startFrame();
+        }
+
+        // scenes must not change while any display is still rendering, so wait for all of them
+        for (auto displayHandle : m_tempDisplaysToRender)
+        {
+            auto& displayInfo = m_displays.find(displayHandle)->second;
+            displayInfo.frameDuration = displayInfo.renderThread->waitForFrameFinished();
+            LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame on render thread of display " << displayHandle.asMemoryHandle());
+        }
+    }
+
+    void Renderer::renderDisplayFrame(DisplayHandle displayHandle)
+    {
+        // executed on render thread of the display
+        IDisplayController& displayController = getDisplayController(displayHandle);
+        displayController.enableContext();
+        DisplayHandle activeDisplay = displayHandle;
+
+        renderToOffscreenBuffers(displayHandle, activeDisplay);
+        if (renderToFramebuffer(displayHandle, activeDisplay))
+        {
+            const UInt64 swapBuffersStartTime = PlatformTime::GetMicrosecondsMonotonic();
+            const auto& damageTracker = m_displays.find(displayHandle)->second.damageTracker;
+            if (damageTracker)
+                displayController.swapBuffersWithDamage(damageTracker->getFrameDamage());
+            else
+                displayController.swapBuffers();
+            const std::chrono::microseconds swapBuffersDuration{ PlatformTime::GetMicrosecondsMonotonic() - swapBuffersStartTime };
+            {
+                PlatformLightweightGuard guard(m_displayThreadsLock);
+                m_swapBuffersDuration = std::max(m_swapBuffersDuration, swapBuffersDuration);
+                m_statistics.framebufferSwapped(displayHandle);
+                m_latencyMonitor.recordFramebufferSwapped(displayHandle, LatencyMonitor::Clock::now());
+            }
+            displayController.getEmbeddedCompositingManager().notifyClients();
+            LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderDisplayFrame swapBuffers on display " << displayHandle.asMemoryHandle());
+        }
+
+        displayController.disableContext();
+    }
+
+    void Renderer::onSceneWasRendered(DisplayHandle displayHandle, const RendererCachedScene& scene)
     {
         scene.markAllRenderOncePassesAsRendered();
+
+        PlatformLightweightGuard guard(m_displayThreadsLock);
         m_latencyMonitor.onRendered(scene.getSceneId());
+        m_latencyMonitor.recordSceneRendered(scene.getSceneId(), displayHandle, LatencyMonitor::Clock::now());
         m_statistics.sceneRendered(scene.getSceneId());
     }
 
@@ -562,6 +804,56 @@ namespace ramses_internal
             std::iter_swap(displays.begin(), displayToStartWithIt);
     }
 
+    Viewport Renderer::GetSceneFramebufferRegion(const RendererCachedScene& scene, const Viewport& framebufferViewport, const ProjectionParams& framebufferProjectionParams, const Matrix44f& rendererViewMatrix)
+    {
+        // scene can draw to framebuffer only within projected bounds of renderables in its render passes rendering to framebuffer,
+        // where bounds of a renderable are not known the viewport of its render pass is used
+        Viewport region(0u, 0u, 0u, 0u);
+        for (const auto& passInfo : scene.getSortedRenderingPasses())
+        {
+            if (passInfo.getType() != ERenderingPassType::RenderPass)
+                continue;
+
+            const RenderPassHandle passHandle = passInfo.getRenderPassHandle();
+            const RenderPass& renderPass = scene.getRenderPass(passHandle);
+            if (!renderPass.isEnabled || renderPass.renderTarget.isValid() || !renderPass.camera.isValid())
+                continue;
+
+            const Camera& camera = scene.getCamera(renderPass.camera);
+            const Bool rendererProjection = (camera.projectionType == ECameraProjectionType_Renderer);
+            const Viewport& passViewport = (rendererProjection ? framebufferViewport : camera.viewport);
+            const Matrix44f projectionMatrix = CameraMatrixHelper::ProjectionMatrix(rendererProjection ? framebufferProjectionParams :
+                ProjectionParams::Frustum(
+                    camera.projectionType,
+                    camera.frustum.leftPlane,
+                    camera.frustum.rightPlane,
+                    camera.frustum.bottomPlane,
+                    camera.frustum.topPlane,
+                    camera.frustum.nearPlane,
+                    camera.frustum.farPlane));
+            const Matrix44f viewProjectionMatrix = projectionMatrix * rendererViewMatrix * scene.updateMatrixCacheWithLinks(ETransformationMatrixType_Object, camera.node);
+
+            for (const auto renderableHandle : scene.getOrderedRenderablesForPass(passHandle))
+            {
+                const Renderable& renderable = scene.getRenderable(renderableHandle);
+                if (!renderable.isVisible)
+                    continue;
+
+                // instances are placed by shader, bounds of vertex positions do not cover them
+                if (renderable.instanceCount > 1u || !scene.getRenderablePositionBounds(renderableHandle).isValid)
+                {
+                    region = FramebufferDamageTracker::UniteRegions(region, passViewport);
+                    break;
+                }
+
+                const Matrix44f modelViewProjectionMatrix = viewProjectionMatrix * scene.getRenderableWorldMatrix(renderableHandle);
+                region = FramebufferDamageTracker::UniteRegions(region, FramebufferDamageTracker::ProjectBoundsToRegion(scene.getRenderablePositionBounds(renderableHandle), modelViewProjectionMatrix, passViewport));
+            }
+        }
+
+        return region;
+    }
+
     void Renderer::mapSceneToDisplayBuffer(SceneId sceneId, DisplayHandle displayHandle, DeviceResourceHandle buffer, Int32 globalSceneOrder)
     {
         assert(m_displays.find(displayHandle) != m_displays.cend());
@@ -619,6 +911,10 @@ namespace ramses_internal
         assert(displayBuffer.isValid());
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
+        if (displayInfo.sceneLayerCache && displayBuffer == displayInfo.frameBufferDeviceHandle)
+            displayInfo.sceneLayerCache->markSceneModified(sceneId);
+        if (displayInfo.damageTracker && displayBuffer == displayInfo.frameBufferDeviceHandle)
+            displayInfo.damageTracker->markSceneModified(sceneId);
     }
 
     void Renderer::setSkippingOfUnmodifiedBuffers(Bool enable)
@@ -690,6 +986,16 @@ namespace ramses_internal
         return m_memoryStatistics;
     }
 
+    LatencyMonitor& Renderer::getLatencyMonitor()
+    {
+        return m_latencyMonitor;
+    }
+
+    std::chrono::microseconds Renderer::getSwapBuffersDuration() const
+    {
+        return m_swapBuffersDuration;
+    }
+
     Bool Renderer::hasSystemCompositorController() const
     {
         return nullptr != m_systemCompositorController;
@@ -747,6 +1053,19 @@ namespace ramses_internal
         assert(m_displays.find(displayHandle) != m_displays.cend());
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.setClearColor(displayInfo.frameBufferDeviceHandle, clearColor);
+        if (displayInfo.damageTracker)
+            displayInfo.damageTracker->markFullRedraw();
+    }
+
+    void Renderer::markDisplayViewModified(DisplayHandle displayHandle)
+    {
+        assert(m_displays.find(displayHandle) != m_displays.cend());
+        auto& displayInfo = m_displays.find(displayHandle)->second;
+        displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, true);
+        if (displayInfo.sceneLayerCache)
+            displayInfo.sceneLayerCache->markAllScenesModified();
+        if (displayInfo.damageTracker)
+            displayInfo.damageTracker->markFullRedraw();
     }
 
     void Renderer::scheduleScreenshot(const ScreenshotInfo& screenshot)
@@ -762,22 +1081,87 @@ namespace ramses_internal
             displayBufferSetup.setDisplayBufferToBeRerendered(buffer.first, true);
     }
 
+    void Renderer::setPeriodicScreenshot(const ScreenshotInfo& screenshot, UInt32 frameInterval)
+    {
+        assert(hasDisplayController(screenshot.display));
+
+        // periodic screenshots do not force re-render, only frames which are rendered anyway are captured
+        auto& displayInfo = m_displays.find(screenshot.display)->second;
+        displayInfo.periodicScreenshot = screenshot;
+        displayInfo.periodicScreenshotInterval = frameInterval;
+        displayInfo.framesSincePeriodicScreenshot = 0u;
+    }
+
     void Renderer::processScheduledScreenshots(DisplayHandle display, IDisplayController& controller, DisplayHandle& activeDisplay)
     {
         assert(m_scheduledScreenshots.contains(display));
+        auto& displayInfo = m_displays.find(display)->second;
 
         ScreenshotInfoVector& displayScreenshots = *m_scheduledScreenshots.get(display);
         if (!displayScreenshots.empty())
             ActivateDisplayContext(display, activeDisplay, controller);
 
-        ramses_foreach(displayScreenshots, shotIt)
+        for (const auto& screenshot : displayScreenshots)
+            startScreenshot(display, screenshot);
+        // started all screenshots for this display!
+        displayScreenshots.clear();
+
+        if (displayInfo.periodicScreenshotInterval > 0u)
         {
-            m_processedScreenshots.push_back(*shotIt);
-            ScreenshotInfo& result = m_processedScreenshots.back();
-            result.success = controller.readPixels(result.rectangle.x, result.rectangle.y, result.rectangle.width, result.rectangle.height, result.pixelData);
+            if (displayInfo.framesSincePeriodicScreenshot == 0u)
+            {
+                ActivateDisplayContext(display, activeDisplay, controller);
+                startScreenshot(display, displayInfo.periodicScreenshot);
+            }
+            displayInfo.framesSincePeriodicScreenshot = (displayInfo.framesSincePeriodicScreenshot + 1u) % displayInfo.periodicScreenshotInterval;
+        }
+    }
+
+    void Renderer::startScreenshot(DisplayHandle display, const ScreenshotInfo& screenshot)
+    {
+        auto& displayInfo = m_displays.find(display)->second;
+        const ScreenshotInfo::Rectangle& rectangle = screenshot.rectangle;
+        const DeviceResourceHandle readPixelsHandle = displayInfo.displayController->startReadPixels(rectangle.x, rectangle.y, rectangle.width, rectangle.height);
+        if (readPixelsHandle.isValid())
+        {
+            displayInfo.pendingScreenshots.push_back({ screenshot, readPixelsHandle, 0u });
+        }
+        else
+        {
+            ScreenshotInfo result = screenshot;
+            result.success = false;
+
+            PlatformLightweightGuard guard(m_displayThreadsLock);
+            m_processedScreenshots.push_back(std::move(result));
+        }
+    }
+
+    void Renderer::finishPendingScreenshots(DisplayHandle display)
+    {
+        auto& displayInfo = m_displays.find(display)->second;
+        IDisplayController& controller = *displayInfo.displayController;
+        auto& pendingScreenshots = displayInfo.pendingScreenshots;
+
+        for (auto& pendingScreenshot : pendingScreenshots)
+            ++pendingScreenshot.framesPending;
+
+        // read backs finish in the order they were started, a read back that waited too long is finished even if that blocks
+        while (!pendingScreenshots.empty() &&
+            (pendingScreenshots.front().framesPending >= MaxFramesToFinishScreenshot || controller.isReadPixelsFinished(pendingScreenshots.front().readPixelsHandle)))
+        {
+            PendingScreenshot& pendingScreenshot = pendingScreenshots.front();
+            ScreenshotInfo result = std::move(pendingScreenshot.screenshot);
+            result.success = controller.finishReadPixels(pendingScreenshot.readPixelsHandle, result.rectangle.width, result.rectangle.height, result.pixelData);
+            if (!result.success)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "Renderer::finishPendingScreenshots: failed to read back pixels of display " << display.asMemoryHandle());
+                result.pixelData.clear();
+            }
+            pendingScreenshots.erase(pendingScreenshots.begin());
+
+            PlatformLightweightGuard guard(m_displayThreadsLock);
+            m_processedScreenshots.push_back(std::move(result));
         }
-        // processed all screenshots for this display!
-        displayScreenshots.clear();
     }
 
     void Renderer::dispatchProcessedScreenshots(ScreenshotInfoVector& screenshots)
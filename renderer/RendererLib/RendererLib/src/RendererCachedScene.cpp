@@ -15,8 +15,8 @@
 
 namespace ramses_internal
 {
-    RendererCachedScene::RendererCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
-        : TextureLinkCachedScene(sceneLinksManager, sceneInfo)
+    RendererCachedScene::RendererCachedScene(SceneLinksManager& sceneLinksManager, RenderStateCache& renderStateCache, TextureSamplerStatesCache& textureSamplerStatesCache, const SceneInfo& sceneInfo)
+        : TextureLinkCachedScene(sceneLinksManager, renderStateCache, textureSamplerStatesCache, sceneInfo)
         , m_renderableOrderingDirty(true)
     {
     }
@@ -27,6 +27,7 @@ namespace ramses_internal
         rd.deviceHandle = DeviceResourceHandle::Invalid();
         rd.hash = hash;
         rd.lastUpdateFrameCounter = 0;
+        rd.lastUsedFrameCounter = 0;
 
         m_resources.put(hash, rd);
         m_stateChangeSequences[hash].fill('\0');
@@ -50,9 +51,11 @@ namespace ramses_internal
         }
 
         setResourceStatus(hash, EResourceStatus_Unknown);
-        m_resources.remove(hash);
+        // hash might refer to the descriptor being removed, keep a copy for updating the list afterwards
+        const ResourceContentHash removedHash = hash;
+        m_resources.remove(removedHash);
 
-        updateListOfResourcesNotInUseByScenes(hash);
+        updateListOfResourcesNotInUseByScenes(removedHash);
     }
 
     Bool RendererClientResourceRegistry::containsResource(const ResourceContentHash& hash) const
@@ -82,7 +85,7 @@ namespace ramses_internal
         updateListOfResourcesNotInUseByScenes(hash);
     }
 
-    void RendererClientResourceRegistry::removeResourceRef(const ResourceContentHash& hash, SceneId sceneId)
+    void RendererClientResourceRegistry::removeResourceRef(const ResourceContentHash& hash, SceneId sceneId, UInt64 frameCounter)
     {
         LOG_TRACE(CONTEXT_RENDERER, "RendererResourceRegistry::removeResourceRef for scene (" << sceneId.getValue() << ") resource #" << StringUtils::HexFromResourceContentHash(hash));
         if (!m_resources.contains(hash))
@@ -100,6 +103,7 @@ namespace ramses_internal
             return;
         }
         rd.sceneUsage.erase(rd.sceneUsage.find(sceneId));
+        rd.lastUsedFrameCounter = frameCounter;
 
         updateListOfResourcesNotInUseByScenes(hash);
     }
@@ -111,7 +115,7 @@ namespace ramses_internal
         {
             LOG_ERROR(CONTEXT_RENDERER, "RendererResourceRegistry::getResourceDescriptor Resource not registered! #" << StringUtils::HexFromResourceContentHash(hash));
             assert(false);
-            static const ResourceDescriptor DummyRD = { EResourceStatus_Broken, EResourceType_Invalid, DeviceResourceHandle::Invalid(), ResourceContentHash::Invalid(), {}, {}, 0u, 0u };
+            static const ResourceDescriptor DummyRD = { EResourceStatus_Broken, EResourceType_Invalid, DeviceResourceHandle::Invalid(), ResourceContentHash::Invalid(), {}, {}, 0u, 0u, 0u, {} };
             return DummyRD;
         }
         return *res;
@@ -133,6 +137,13 @@ namespace ramses_internal
         }
     }
 
+    void RendererClientResourceRegistry::setResourcePositionBounds(const ResourceContentHash& hash, const BoundingBox& bounds)
+    {
+        assert(m_resources.contains(hash));
+        ResourceDescriptor& rd = *m_resources.get(hash);
+        rd.positionBounds = bounds;
+    }
+
     void RendererClientResourceRegistry::setResourceStatus(const ResourceContentHash& hash, EResourceStatus status, UInt64 updateFrameCounter)
     {
         assert(m_resources.contains(hash));
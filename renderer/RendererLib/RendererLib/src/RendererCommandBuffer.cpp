@@ -29,10 +29,10 @@ namespace ramses_internal
         RendererCommands::unpublishScene(sceneId);
     }
 
-    void RendererCommandBuffer::receiveScene(const SceneInfo& sceneInfo)
+    void RendererCommandBuffer::receiveScene(const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush)
     {
         PlatformGuard guard(m_lock);
-        RendererCommands::receiveScene(sceneInfo);
+        RendererCommands::receiveScene(sceneInfo, sceneInstanceEpoch, deltaSinceLastAppliedFlush);
     }
 
     void RendererCommandBuffer::subscribeScene(SceneId sceneId)
@@ -89,6 +89,12 @@ namespace ramses_internal
         RendererCommands::readPixels(displayHandle, filename, fullScreen, x, y, width, height, sendViaDLT);
     }
 
+    void RendererCommandBuffer::readPixelsPeriodically(DisplayHandle displayHandle, UInt32 x, UInt32 y, UInt32 width, UInt32 height, UInt32 frameInterval)
+    {
+        PlatformGuard guard(m_lock);
+        RendererCommands::readPixelsPeriodically(displayHandle, x, y, width, height, frameInterval);
+    }
+
     void RendererCommandBuffer::setClearColor(DisplayHandle displayHandle, const Vector4& color)
     {
         PlatformGuard guard(m_lock);
@@ -149,6 +155,12 @@ namespace ramses_internal
         RendererCommands::logRendererInfo(topic, verbose, nodeHandleFilter);
     }
 
+    void RendererCommandBuffer::querySceneLatencyStatistics(SceneId sceneId)
+    {
+        PlatformGuard guard(m_lock);
+        RendererCommands::querySceneLatencyStatistics(sceneId);
+    }
+
     void RendererCommandBuffer::systemCompositorControllerListIviSurfaces()
     {
         PlatformGuard guard(m_lock);
@@ -227,6 +239,18 @@ namespace ramses_internal
         RendererCommands::setFrameProfilerFilteredRegionFlags(flags);
     }
 
+    void RendererCommandBuffer::setFrameProfilerTraceCapture(Bool enable, UInt64 spikeThresholdMicrosec, const String& spikeDumpFilePrefix)
+    {
+        PlatformGuard guard(m_lock);
+        RendererCommands::setFrameProfilerTraceCapture(enable, spikeThresholdMicrosec, spikeDumpFilePrefix);
+    }
+
+    void RendererCommandBuffer::dumpFrameProfilerTrace(const String& fileName)
+    {
+        PlatformGuard guard(m_lock);
+        RendererCommands::dumpFrameProfilerTrace(fileName);
+    }
+
     void RendererCommandBuffer::setFrameTimerLimits(UInt64 limitForClientResourcesUploadMicrosec, UInt64 limitForSceneActionsApplyMicrosec, UInt64 limitForOffscreenBufferRenderMicrosec)
     {
         PlatformGuard guard(m_lock);
@@ -273,7 +297,7 @@ namespace ramses_internal
             case ERendererCommand_ReceivedScene:
             {
                 const SceneInfoCommand& cmd = commands.getCommandData<SceneInfoCommand>(i);
-                receiveScene(cmd.sceneInformation);
+                receiveScene(cmd.sceneInformation, cmd.sceneInstanceEpoch, cmd.deltaSinceLastAppliedFlush);
             }
             break;
             case ERendererCommand_SubscribeScene:
@@ -365,6 +389,12 @@ namespace ramses_internal
                 readPixels(cmd.displayHandle, cmd.filename, cmd.fullScreen, cmd.x, cmd.y, cmd.width, cmd.height, cmd.sendViaDLT);
             }
             break;
+            case ERendererCommand_ReadPixelsPeriodically:
+            {
+                const ReadPixelsCommand& cmd = commands.getCommandData<ReadPixelsCommand>(i);
+                readPixelsPeriodically(cmd.displayHandle, cmd.x, cmd.y, cmd.width, cmd.height, cmd.frameInterval);
+            }
+            break;
             case ERendererCommand_LinkSceneData:
             {
                 const DataLinkCommand& cmd = commands.getCommandData<DataLinkCommand>(i);
@@ -418,6 +448,12 @@ namespace ramses_internal
                 logRendererInfo(cmd.topic, cmd.verbose, cmd.nodeHandleFilter);
             }
             break;
+            case ERendererCommand_QuerySceneLatencyStatistics:
+            {
+                const SceneRenderCommand& cmd = commands.getCommandData<SceneRenderCommand>(i);
+                querySceneLatencyStatistics(cmd.sceneId);
+            }
+            break;
             case ERendererCommand_SystemCompositorControllerListIviSurfaces:
             {
                 systemCompositorControllerListIviSurfaces();
@@ -495,6 +531,18 @@ namespace ramses_internal
                 setFrameProfilerFilteredRegionFlags(cmd.newRegionFilterFlags);
             }
             break;
+            case ERendererCommand_FrameProfiler_TraceCapture:
+            {
+                const auto& cmd = commands.getCommandData<UpdateFrameProfilerCommand>(i);
+                setFrameProfilerTraceCapture(cmd.enableTraceCapture, cmd.traceSpikeThreshold, cmd.traceFileName);
+            }
+            break;
+            case ERendererCommand_FrameProfiler_DumpTrace:
+            {
+                const auto& cmd = commands.getCommandData<UpdateFrameProfilerCommand>(i);
+                dumpFrameProfilerTrace(cmd.traceFileName);
+            }
+            break;
             case ERendererCommand_SetClearColor:
             {
                 const auto& cmd = commands.getCommandData<SetClearColorCommand>(i);
@@ -11,6 +11,7 @@
 #include "RendererLib/Renderer.h"
 #include "RendererLib/RendererSceneUpdater.h"
 #include "RendererLib/SceneLinksManager.h"
+#include "RendererLib/LatencyMonitor.h"
 #include "RendererAPI/IDisplayController.h"
 #include "RendererEventCollector.h"
 #include "Utils/Bitmap.h"
@@ -74,8 +75,8 @@ namespace ramses_internal
             case ERendererCommand_ReceivedScene:
             {
                 const SceneInfoCommand& command = m_executedCommands.getCommandData<SceneInfoCommand>(i);
-                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " sceneId " << command.sceneInformation.sceneID);
-                m_rendererSceneUpdater.handleSceneReceived(command.sceneInformation);
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " sceneId " << command.sceneInformation.sceneID << " delta " << command.deltaSinceLastAppliedFlush);
+                m_rendererSceneUpdater.handleSceneReceived(command.sceneInformation, command.sceneInstanceEpoch, command.deltaSinceLastAppliedFlush);
                 break;
             }
             case ERendererCommand_SubscribeScene:
@@ -187,6 +188,26 @@ namespace ramses_internal
 
                 break;
             }
+            case ERendererCommand_ReadPixelsPeriodically:
+            {
+                const ReadPixelsCommand& command = m_executedCommands.getCommandData<ReadPixelsCommand>(i);
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " displayId " << command.displayHandle << " frameInterval " << command.frameInterval);
+                if (m_renderer.hasDisplayController(command.displayHandle))
+                {
+                    ScreenshotInfo screenshot;
+                    screenshot.rectangle = { command.x, command.y, command.width, command.height };
+                    screenshot.display = command.displayHandle;
+                    screenshot.sendViaDLT = false;
+                    m_renderer.setPeriodicScreenshot(screenshot, command.frameInterval);
+                }
+                else
+                {
+                    m_rendererEventCollector.addEvent(ERendererEventType_ReadPixelsFromFramebufferFailed, command.displayHandle);
+                    LOG_ERROR(CONTEXT_RENDERER, "RendererCommandExecutor::readPixelsPeriodically failed, unknown display " << command.displayHandle.asMemoryHandle());
+                }
+
+                break;
+            }
             case ERendererCommand_SetClearColor:
             {
                 const auto& command = m_executedCommands.getCommandData<SetClearColorCommand>(i);
@@ -211,6 +232,7 @@ namespace ramses_internal
                     {
                         IDisplayController& controller = m_renderer.getDisplayController(handle);
                         controller.setViewPosition(controller.getViewPosition() + command.displayMovement);
+                        m_renderer.markDisplayViewModified(handle);
                     }
                 }
                 break;
@@ -224,6 +246,7 @@ namespace ramses_internal
                     if (m_renderer.hasDisplayController(handle))
                     {
                         m_renderer.getDisplayController(handle).setViewPosition(command.displayMovement);
+                        m_renderer.markDisplayViewModified(handle);
                     }
                 }
                 break;
@@ -238,6 +261,7 @@ namespace ramses_internal
                     {
                         IDisplayController& controller = m_renderer.getDisplayController(handle);
                         controller.setViewRotation(controller.getViewRotation() + command.displayMovement);
+                        m_renderer.markDisplayViewModified(handle);
                     }
                 }
                 break;
@@ -251,6 +275,7 @@ namespace ramses_internal
                     if (m_renderer.hasDisplayController(handle))
                     {
                         m_renderer.getDisplayController(handle).setViewRotation(command.displayMovement);
+                        m_renderer.markDisplayViewModified(handle);
                     }
                 }
                 break;
@@ -314,6 +339,22 @@ namespace ramses_internal
                 RendererLogger::LogTopic(m_rendererSceneUpdater, command.topic, command.verbose, command.nodeHandleFilter);
                 break;
             }
+            case ERendererCommand_QuerySceneLatencyStatistics:
+            {
+                const SceneRenderCommand& command = m_executedCommands.getCommandData<SceneRenderCommand>(i);
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " sceneId " << command.sceneId);
+                const SceneLatencyHistograms* histograms = m_renderer.getLatencyMonitor().getLatencyHistograms(command.sceneId);
+                if (histograms != nullptr)
+                {
+                    m_rendererEventCollector.addEvent(ERendererEventType_SceneLatencyStatistics, command.sceneId,
+                        histograms->flushToApply.getSummary(), histograms->applyToRender.getSummary(), histograms->renderToSwap.getSummary());
+                }
+                else
+                {
+                    m_rendererEventCollector.addEvent(ERendererEventType_SceneLatencyStatisticsFailed, command.sceneId);
+                }
+                break;
+            }
             case ERendererCommand_LogRendererStatistics:
             {
                 LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType));
@@ -426,6 +467,34 @@ namespace ramses_internal
                 m_renderer.getProfilerStatistics().setFilteredRegionFlags(command.newRegionFilterFlags);
                 break;
             }
+            case ERendererCommand_FrameProfiler_TraceCapture:
+            {
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType));
+                const auto& command = m_executedCommands.getCommandData<UpdateFrameProfilerCommand>(i);
+                FrameTraceRecorder& traceRecorder = m_renderer.getProfilerStatistics().getTraceRecorder();
+                if (command.enableTraceCapture)
+                {
+                    if (!traceRecorder.isEnabled())
+                        traceRecorder.enable();
+                    traceRecorder.setSpikeDump(command.traceSpikeThreshold, command.traceFileName);
+                }
+                else
+                {
+                    traceRecorder.disable();
+                }
+                break;
+            }
+            case ERendererCommand_FrameProfiler_DumpTrace:
+            {
+                LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType));
+                const auto& command = m_executedCommands.getCommandData<UpdateFrameProfilerCommand>(i);
+                FrameTraceRecorder& traceRecorder = m_renderer.getProfilerStatistics().getTraceRecorder();
+                if (traceRecorder.isEnabled())
+                    traceRecorder.dumpToFile(command.traceFileName);
+                else
+                    LOG_ERROR(CONTEXT_RENDERER, "RendererCommandExecutor::dumpFrameProfilerTrace failed, trace capture is not enabled");
+                break;
+            }
             case ERendererCommand_SceneActions:
             {
                 SceneActionsCommand& command = m_executedCommands.getCommandData<SceneActionsCommand>(i);
@@ -32,10 +32,12 @@ namespace ramses_internal
         m_commands.addCommand(ERendererCommand_UnpublishedScene, cmd);
     }
 
-    void RendererCommands::receiveScene(const SceneInfo& sceneInfo)
+    void RendererCommands::receiveScene(const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush)
     {
         SceneInfoCommand cmd;
         cmd.sceneInformation = sceneInfo;
+        cmd.sceneInstanceEpoch = sceneInstanceEpoch;
+        cmd.deltaSinceLastAppliedFlush = deltaSinceLastAppliedFlush;
         m_commands.addCommand(ERendererCommand_ReceivedScene, cmd);
     }
 
@@ -130,9 +132,24 @@ namespace ramses_internal
         cmd.fullScreen = fullScreen;
         cmd.sendViaDLT = sendViaDLT;
         cmd.filename = filename;
+        cmd.frameInterval = 0u;
         m_commands.addCommand(ERendererCommand_ReadPixels, cmd);
     }
 
+    void RendererCommands::readPixelsPeriodically(DisplayHandle displayHandle, UInt32 x, UInt32 y, UInt32 width, UInt32 height, UInt32 frameInterval)
+    {
+        ReadPixelsCommand cmd;
+        cmd.displayHandle = displayHandle;
+        cmd.x = x;
+        cmd.y = y;
+        cmd.width = width;
+        cmd.height = height;
+        cmd.fullScreen = false;
+        cmd.sendViaDLT = false;
+        cmd.frameInterval = frameInterval;
+        m_commands.addCommand(ERendererCommand_ReadPixelsPeriodically, cmd);
+    }
+
     void RendererCommands::setClearColor(DisplayHandle displayHandle, const Vector4& color)
     {
         SetClearColorCommand cmd;
@@ -248,6 +265,13 @@ namespace ramses_internal
         m_commands.addCommand(ERendererCommand_LogRendererInfo, cmd);
     }
 
+    void RendererCommands::querySceneLatencyStatistics(SceneId sceneId)
+    {
+        SceneRenderCommand cmd;
+        cmd.sceneId = sceneId;
+        m_commands.addCommand(ERendererCommand_QuerySceneLatencyStatistics, cmd);
+    }
+
     void RendererCommands::logStatistics()
     {
         LogCommand cmd;
@@ -354,6 +378,22 @@ namespace ramses_internal
         m_commands.addCommand(ERendererCommand_FrameProfiler_RegionFilterFlags, cmd);
     }
 
+    void RendererCommands::setFrameProfilerTraceCapture(Bool enable, UInt64 spikeThresholdMicrosec, const String& spikeDumpFilePrefix)
+    {
+        UpdateFrameProfilerCommand cmd;
+        cmd.enableTraceCapture = enable;
+        cmd.traceSpikeThreshold = spikeThresholdMicrosec;
+        cmd.traceFileName = spikeDumpFilePrefix;
+        m_commands.addCommand(ERendererCommand_FrameProfiler_TraceCapture, cmd);
+    }
+
+    void RendererCommands::dumpFrameProfilerTrace(const String& fileName)
+    {
+        UpdateFrameProfilerCommand cmd;
+        cmd.traceFileName = fileName;
+        m_commands.addCommand(ERendererCommand_FrameProfiler_DumpTrace, cmd);
+    }
+
     void RendererCommands::setFrameTimerLimits(UInt64 limitForClientResourcesUploadMicrosec, UInt64 limitForSceneActionsApplyMicrosec, UInt64 limitForOffscreenBufferRenderMicrosec)
     {
         SetFrameTimerLimitsCommmand cmd;
@@ -51,6 +51,26 @@ namespace ramses_internal
         return m_kpiFilename;
     }
 
+    void RendererConfig::setDeviceTraceFileName(const String& filename)
+    {
+        m_deviceTraceFilename = filename;
+    }
+
+    const String& RendererConfig::getDeviceTraceFileName() const
+    {
+        return m_deviceTraceFilename;
+    }
+
+    void RendererConfig::setBinaryShaderCacheDirectory(const String& directory)
+    {
+        m_binaryShaderCacheDirectory = directory;
+    }
+
+    const String& RendererConfig::getBinaryShaderCacheDirectory() const
+    {
+        return m_binaryShaderCacheDirectory;
+    }
+
     void RendererConfig::enableSystemCompositorControl()
     {
         m_systemCompositorEnabled = true;
@@ -61,6 +81,16 @@ namespace ramses_internal
         return m_systemCompositorEnabled;
     }
 
+    void RendererConfig::enableRenderThreadPerDisplay()
+    {
+        m_renderThreadPerDisplayEnabled = true;
+    }
+
+    Bool RendererConfig::getRenderThreadPerDisplayEnabled() const
+    {
+        return m_renderThreadPerDisplayEnabled;
+    }
+
     std::chrono::microseconds RendererConfig::getFrameCallbackMaxPollTime() const
     {
         return m_frameCallbackMaxPollTime;
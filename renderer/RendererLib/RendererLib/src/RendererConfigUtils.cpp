@@ -23,14 +23,20 @@ namespace ramses_internal
                 "set socket name clients use to connect to the compositor embedded in the renderer")
             , waylandSocketEmbeddedGroup("wsegn"        , "wayland-socket-embedded-groupname" , config.getWaylandSocketEmbeddedGroup(), "groupname for permissions of embedded compositing socket")
             , systemCompositorControllerEnabled("scc"   , "enable-system-compositor-controller", false                      , "enable system compositor controller")
+            , renderThreadPerDisplayEnabled("rtpd"      , "render-thread-per-display", false                               , "render every display on its own thread")
             , kpiFilename               ("kpi"          , "kpioutputfile"           , config.getKPIFileName()               , "KPI filename")
+            , deviceTraceFilename       ("dtf"          , "device-trace-file"       , config.getDeviceTraceFileName()       , "record device commands into binary trace file (null platform only)")
+            , binaryShaderCacheDirectory("bscd"         , "binary-shader-cache-dir" , config.getBinaryShaderCacheDirectory(), "persist binary shaders in directory and load binaries of last run ahead of time")
         {
         }
 
         ArgumentString waylandSocketEmbedded;
         ArgumentString waylandSocketEmbeddedGroup;
         ArgumentBool   systemCompositorControllerEnabled;
+        ArgumentBool   renderThreadPerDisplayEnabled;
         ArgumentString kpiFilename;
+        ArgumentString deviceTraceFilename;
+        ArgumentString binaryShaderCacheDirectory;
 
         void print()
         {
@@ -40,7 +46,10 @@ namespace ramses_internal
                         sos << waylandSocketEmbedded.getHelpString();
                         sos << waylandSocketEmbeddedGroup.getHelpString();
                         sos << kpiFilename.getHelpString();
+                        sos << deviceTraceFilename.getHelpString();
+                        sos << binaryShaderCacheDirectory.getHelpString();
                         sos << systemCompositorControllerEnabled.getHelpString();
+                        sos << renderThreadPerDisplayEnabled.getHelpString();
                     }));
 
         }
@@ -71,6 +80,10 @@ namespace ramses_internal
             , borderless("bl", "borderless", config.getBorderlessState(), "disable window borders")
             , enableWarping("warp", "enable-warping", config.isWarpingEnabled(), "enable warping")
             , disableEffectDeletion("ded", "no-effect-delete", config.isEffectDeletionDisabled(), "disable effect deletion")
+            , enableSceneLayerCache("slc", "scene-layer-cache", config.isSceneLayerCacheEnabled(), "composite unchanged scenes from cached layers")
+            , enablePartialFramebufferRedraw("pfr", "partial-framebuffer-redraw", config.isPartialFramebufferRedrawEnabled(), "redraw only changed region of framebuffer")
+            , enableProgressiveTextureUpload("ptu", "progressive-texture-upload", config.isProgressiveTextureUploadEnabled(), "upload smallest texture mip levels first and stream in the rest")
+            , enableGpuTimerQueries("gtq", "gpu-timer-queries", config.isGpuTimerQueriesEnabled(), "measure GPU time of scenes and their passes, reported in periodic renderer log")
             , antialiasingMethod("aa", "antialiasing-method", "", "set antialiasing method (options: MSAA,  FXAA)")
             , antialiasingSampleCount("as", "aa-samples", config.getAntialiasingSampleCount(), "set antialiasing sample count")
             , waylandIviLayerId("lid", "waylandIviLayerId", config.getWaylandIviLayerID().getValue(), "set id of IVI layer the display surface will be added to")
@@ -109,6 +122,10 @@ namespace ramses_internal
 
         ArgumentBool enableWarping;
         ArgumentBool disableEffectDeletion;
+        ArgumentBool enableSceneLayerCache;
+        ArgumentBool enablePartialFramebufferRedraw;
+        ArgumentBool enableProgressiveTextureUpload;
+        ArgumentBool enableGpuTimerQueries;
         ArgumentString antialiasingMethod;
         ArgumentUInt32 antialiasingSampleCount;
         ArgumentUInt32 waylandIviLayerId;
@@ -161,6 +178,10 @@ namespace ramses_internal
                         {
                             sos << enableWarping.getHelpString();
                             sos << disableEffectDeletion.getHelpString();
+                            sos << enableSceneLayerCache.getHelpString();
+                            sos << enablePartialFramebufferRedraw.getHelpString();
+                            sos << enableProgressiveTextureUpload.getHelpString();
+                            sos << enableGpuTimerQueries.getHelpString();
                             sos << antialiasingMethod.getHelpString();
                             sos << antialiasingSampleCount.getHelpString();
                         }
@@ -174,11 +195,18 @@ namespace ramses_internal
         config.setWaylandSocketEmbedded(rendererArgs.waylandSocketEmbedded.parseValueFromCmdLine(parser));
         config.setWaylandSocketEmbeddedGroup(rendererArgs.waylandSocketEmbeddedGroup.parseValueFromCmdLine(parser));
         config.setKPIFileName(rendererArgs.kpiFilename.parseValueFromCmdLine(parser));
+        config.setDeviceTraceFileName(rendererArgs.deviceTraceFilename.parseValueFromCmdLine(parser));
+        config.setBinaryShaderCacheDirectory(rendererArgs.binaryShaderCacheDirectory.parseValueFromCmdLine(parser));
 
         if(rendererArgs.systemCompositorControllerEnabled.parseValueFromCmdLine(parser))
         {
             config.enableSystemCompositorControl();
         }
+
+        if (rendererArgs.renderThreadPerDisplayEnabled.parseValueFromCmdLine(parser))
+        {
+            config.enableRenderThreadPerDisplay();
+        }
     }
 
     void RendererConfigUtils::ApplyValuesFromCommandLine(const CommandLineParser& parser, DisplayConfig& config)
@@ -189,6 +217,10 @@ namespace ramses_internal
         config.setBorderlessState(rendererArgs.borderless.parseValueFromCmdLine(parser));
         config.setWarpingEnabled(rendererArgs.enableWarping.parseValueFromCmdLine(parser));
         config.setEffectDeletionDisabled(rendererArgs.disableEffectDeletion.parseValueFromCmdLine(parser));
+        config.setSceneLayerCacheEnabled(rendererArgs.enableSceneLayerCache.parseValueFromCmdLine(parser));
+        config.setPartialFramebufferRedrawEnabled(rendererArgs.enablePartialFramebufferRedraw.parseValueFromCmdLine(parser));
+        config.setProgressiveTextureUploadEnabled(rendererArgs.enableProgressiveTextureUpload.parseValueFromCmdLine(parser));
+        config.setGpuTimerQueriesEnabled(rendererArgs.enableGpuTimerQueries.parseValueFromCmdLine(parser));
         config.setDesiredWindowWidth(rendererArgs.windowWidth.parseValueFromCmdLine(parser));
         config.setDesiredWindowHeight(rendererArgs.windowHeight.parseValueFromCmdLine(parser));
         config.setWindowPositionX(rendererArgs.windowPositionX.parseValueFromCmdLine(parser));
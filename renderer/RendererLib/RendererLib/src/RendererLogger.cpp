@@ -29,6 +29,7 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/DisplaySetup.h"
 #include "RendererLib/StagingInfo.h"
+#include "RendererLib/LatencyMonitor.h"
 #include "FrameBufferInfo.h"
 #include "RenderExecutor.h"
 #include "RenderExecutorLogger.h"
@@ -97,6 +98,9 @@ namespace ramses_internal
         case ERendererLogTopic_EventQueue:
             LogEventQueue(updater, context);
             break;
+        case ERendererLogTopic_SceneLatencies:
+            LogSceneLatencies(updater, context);
+            break;
         case ERendererLogTopic_All:
             LogDisplays(updater, context);
             LogSceneStates(updater, context);
@@ -106,6 +110,7 @@ namespace ramses_internal
             LogLinks(updater.m_rendererScenes, context);
             LogEmbeddedCompositor(updater, context);
             LogEventQueue(updater, context);
+            LogSceneLatencies(updater, context);
             break;
         case ERendererLogTopic_PeriodicLog:
             LogPeriodicInfo(updater);
@@ -286,6 +291,16 @@ namespace ramses_internal
             }
             context.unindent();
 
+            const ClientResourceUploadingManager::CacheStatistics& cacheStats = resourceManager->m_resourceUploadingManager.getCacheStatistics();
+            context << "GPU cache: " << cacheStats.hits << " hits, " << cacheStats.misses << " misses, "
+                << cacheStats.evictedResources << " evicted (" << cacheStats.evictedBytes << " bytes)" << RendererLogContext::NewLine;
+
+            const RenderBufferPool& renderBufferPool = resourceManager->m_renderBufferPool;
+            const RenderBufferPool::Statistics& poolStats = renderBufferPool.getStatistics();
+            context << "Render buffer pool: " << poolStats.hits << " hits, " << poolStats.misses << " misses, "
+                << poolStats.evictedBuffers << " evicted (" << poolStats.evictedBytes << " bytes), "
+                << renderBufferPool.getRetainedBufferCount() << " retained (" << renderBufferPool.getRetainedSize() << " bytes)" << RendererLogContext::NewLine;
+
             if (context.isLogLevelFlagEnabled(ERendererLogLevelFlag_Details))
             {
                 context << RendererLogContext::NewLine << "Details: " << RendererLogContext::NewLine;
@@ -917,6 +932,43 @@ namespace ramses_internal
         EndSection("RENDERER EVENTS", context);
     }
 
+    void RendererLogger::LogSceneLatencies(const RendererSceneUpdater& updater, RendererLogContext& context)
+    {
+        StartSection("RENDERER SCENE LATENCIES", context);
+        context << "All values in microseconds, flush time stamp taken at client with millisecond precision" << RendererLogContext::NewLine << RendererLogContext::NewLine;
+        context.indent();
+
+        SceneIdVector knownSceneIds;
+        updater.m_sceneStateExecutor.m_scenesStateInfo.getKnownSceneIds(knownSceneIds);
+        for (const auto sceneId : knownSceneIds)
+        {
+            const SceneLatencyHistograms* histograms = updater.m_latencyMonitor.getLatencyHistograms(sceneId);
+            if (histograms == nullptr)
+                continue;
+
+            context << "Scene [id: " << sceneId.getValue() << "]" << RendererLogContext::NewLine;
+            context.indent();
+            {
+                StringOutputStream flushToApply;
+                histograms->flushToApply.writeSummaryToStream(flushToApply);
+                context << "Flush to apply:   " << flushToApply.c_str() << RendererLogContext::NewLine;
+
+                StringOutputStream applyToRender;
+                histograms->applyToRender.writeSummaryToStream(applyToRender);
+                context << "Apply to render:  " << applyToRender.c_str() << RendererLogContext::NewLine;
+
+                StringOutputStream renderToSwap;
+                histograms->renderToSwap.writeSummaryToStream(renderToSwap);
+                context << "Render to swap:   " << renderToSwap.c_str() << RendererLogContext::NewLine;
+            }
+            context << RendererLogContext::NewLine;
+            context.unindent();
+        }
+
+        context.unindent();
+        EndSection("RENDERER SCENE LATENCIES", context);
+    }
+
     void RendererLogger::LogPeriodicInfo(const RendererSceneUpdater& updater)
     {
         LOG_INFO_F(CONTEXT_PERIODIC, ([&](StringOutputStream& sos) {
@@ -957,6 +1009,8 @@ namespace ramses_internal
                     updater.m_renderer.getProfilerStatistics().writeLongestFrameTimingsToStream(sos);
                     sos << "\n";
                     updater.m_renderer.getMemoryStatistics().writeMemoryUsageSummaryToString(sos);
+                    sos << "\n";
+                    updater.m_latencyMonitor.writeLatencyHistogramsToStream(sos);
                 }));
 
         updater.m_renderer.getStatistics().reset();
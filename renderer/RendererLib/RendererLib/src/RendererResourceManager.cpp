@@ -34,12 +34,17 @@ namespace ramses_internal
         RequesterID requesterId,
         Bool keepEffects,
         const FrameTimer& frameTimer,
-        UInt64 clientResourceCacheSize)
+        UInt64 clientResourceCacheSize,
+        EGPUMemoryCachePolicy clientResourceCachePolicy,
+        Bool progressiveTextureUpload,
+        UInt64 renderBufferPoolSize,
+        Bool computeVertexPositionBounds)
         : m_id(requesterId)
         , m_resourceProvider(resourceProvider)
         , m_renderBackend(renderBackend)
         , m_embeddedCompositingManager(embeddedCompositingManager)
-        , m_resourceUploadingManager(m_clientResourceRegistry, uploader, renderBackend, keepEffects, frameTimer, clientResourceCacheSize)
+        , m_resourceUploadingManager(m_clientResourceRegistry, uploader, renderBackend, keepEffects, frameTimer, clientResourceCacheSize, clientResourceCachePolicy, progressiveTextureUpload, computeVertexPositionBounds)
+        , m_renderBufferPool(renderBufferPoolSize)
     {
     }
 
@@ -53,6 +58,8 @@ namespace ramses_internal
             if (m_offscreenBuffers.isAllocated(handle))
                 unloadOffscreenBuffer(handle);
         }
+        if (m_renderBufferPool.getRetainedBufferCount() > 0u)
+            m_renderBufferPool.deleteRetainedBuffers(m_renderBackend.getDevice());
 
         ramses_foreach(m_clientResourceRegistry.getAllResourceDescriptors(), res)
         {
@@ -69,6 +76,7 @@ namespace ramses_internal
     {
         for (const auto& resHash : resources)
         {
+            m_resourceUploadingManager.trackResourceReferenced(resHash);
             if (!m_clientResourceRegistry.containsResource(resHash))
             {
                 m_clientResourceRegistry.registerResource(resHash);
@@ -81,7 +89,7 @@ namespace ramses_internal
     {
         for (const auto& resHash : resources)
         {
-            m_clientResourceRegistry.removeResourceRef(resHash, sceneId);
+            m_clientResourceRegistry.removeResourceRef(resHash, sceneId, m_frameCounter);
         }
     }
 
@@ -272,7 +280,7 @@ namespace ramses_internal
         {
             if (resDesc.value.sceneUsage.contains(sceneId))
             {
-                m_clientResourceRegistry.removeResourceRef(resDesc.key, sceneId);
+                m_clientResourceRegistry.removeResourceRef(resDesc.key, sceneId, m_frameCounter);
             }
         }
     }
@@ -360,6 +368,11 @@ namespace ramses_internal
         return m_clientResourceRegistry.getResourceDescriptor(hash).deviceHandle;
     }
 
+    BoundingBox RendererResourceManager::getClientResourcePositionBounds(const ResourceContentHash& hash) const
+    {
+        return m_clientResourceRegistry.getResourceDescriptor(hash).positionBounds;
+    }
+
     DeviceResourceHandle RendererResourceManager::getRenderTargetDeviceHandle(RenderTargetHandle handle, SceneId sceneId) const
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
@@ -411,14 +424,8 @@ namespace ramses_internal
     {
         RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
         IDevice& device = m_renderBackend.getDevice();
-        const DeviceResourceHandle deviceHandle = device.uploadRenderBuffer(renderBuffer);
-
-        UInt32 memSize = renderBuffer.width * renderBuffer.height * GetTexelSizeFromFormat(renderBuffer.format);
-        const UInt32 sampleCount = renderBuffer.sampleCount;
-        if (0 != sampleCount)
-        {
-            memSize *= sampleCount;
-        }
+        const DeviceResourceHandle deviceHandle = m_renderBufferPool.acquire(device, renderBuffer);
+        const UInt32 memSize = RenderBufferPool::GetRenderBufferByteSize(renderBuffer);
 
         sceneResources.addRenderBuffer(renderBufferHandle, deviceHandle, memSize, ERenderBufferAccessMode_WriteOnly == renderBuffer.accessMode);
     }
@@ -429,7 +436,7 @@ namespace ramses_internal
         RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
         IDevice& device = m_renderBackend.getDevice();
-        device.deleteRenderBuffer(sceneResources.getRenderBufferDeviceHandle(renderBufferHandle));
+        m_renderBufferPool.release(device, sceneResources.getRenderBufferDeviceHandle(renderBufferHandle));
         sceneResources.removeRenderBuffer(renderBufferHandle);
     }
 
@@ -472,8 +479,8 @@ namespace ramses_internal
         m_offscreenBuffers.allocate(bufferHandle);
         OffscreenBufferDescriptor& offscreenBufferDesc = *m_offscreenBuffers.getMemory(bufferHandle);
 
-        offscreenBufferDesc.m_colorBufferHandle[0] = device.uploadRenderBuffer(RenderBuffer(width, height, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u));
-        offscreenBufferDesc.m_depthBufferHandle = device.uploadRenderBuffer(RenderBuffer(width, height, ERenderBufferType_DepthStencilBuffer, ETextureFormat_Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, 0u));
+        offscreenBufferDesc.m_colorBufferHandle[0] = m_renderBufferPool.acquire(device, RenderBuffer(width, height, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u));
+        offscreenBufferDesc.m_depthBufferHandle = m_renderBufferPool.acquire(device, RenderBuffer(width, height, ERenderBufferType_DepthStencilBuffer, ETextureFormat_Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, 0u));
         offscreenBufferDesc.m_estimatedVRAMUsage = width * height * ((isDoubleBuffered ? 2u : 1u) * GetTexelSizeFromFormat(ETextureFormat_RGBA8) + GetTexelSizeFromFormat(ETextureFormat_Depth24_Stencil8));
 
         DeviceHandleVector bufferDeviceHandles;
@@ -483,7 +490,7 @@ namespace ramses_internal
 
         if (isDoubleBuffered)
         {
-            offscreenBufferDesc.m_colorBufferHandle[1] = device.uploadRenderBuffer(RenderBuffer(width, height, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u));
+            offscreenBufferDesc.m_colorBufferHandle[1] = m_renderBufferPool.acquire(device, RenderBuffer(width, height, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u));
 
             DeviceHandleVector bufferDeviceHandles2;
             bufferDeviceHandles2.push_back(offscreenBufferDesc.m_colorBufferHandle[1]);
@@ -522,11 +529,11 @@ namespace ramses_internal
             device.deleteRenderTarget(offscreenBufferDesc.m_renderTargetHandle[1]);
             device.unpairRenderTargets(offscreenBufferDesc.m_renderTargetHandle[0]);
         }
-        device.deleteRenderBuffer(offscreenBufferDesc.m_colorBufferHandle[0]);
-        device.deleteRenderBuffer(offscreenBufferDesc.m_depthBufferHandle);
+        m_renderBufferPool.release(device, offscreenBufferDesc.m_colorBufferHandle[0]);
+        m_renderBufferPool.release(device, offscreenBufferDesc.m_depthBufferHandle);
         if (offscreenBufferDesc.m_colorBufferHandle[1].isValid())
         {
-            device.deleteRenderBuffer(offscreenBufferDesc.m_colorBufferHandle[1]);
+            m_renderBufferPool.release(device, offscreenBufferDesc.m_colorBufferHandle[1]);
         }
 
         m_offscreenBuffers.release(bufferHandle);
@@ -644,20 +651,29 @@ namespace ramses_internal
     void RendererResourceManager::updateDataBuffer(DataBufferHandle handle, UInt32 dataSizeInBytes, const Byte* data, SceneId sceneId)
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
-        const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
+        RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
         const DeviceResourceHandle deviceHandle = sceneResources.getDataBufferDeviceHandle(handle);
         assert(deviceHandle.isValid());
         const EDataBufferType dataBufferType = sceneResources.getDataBufferType(handle);
 
+        // buffers updated in many subsequent frames are likely still in use by GPU when updated again, stream those to avoid stalls
+        const Bool streamData = sceneResources.markDataBufferUpdated(handle, m_frameCounter) >= NumberOfSubsequentUpdatesToStreamDataBuffer;
+
         IDevice& device = m_renderBackend.getDevice();
         switch (dataBufferType)
         {
         case EDataBufferType::IndexBuffer:
-            device.uploadIndexBufferData(deviceHandle, data, dataSizeInBytes);
+            if (streamData)
+                device.streamIndexBufferData(deviceHandle, data, dataSizeInBytes);
+            else
+                device.uploadIndexBufferData(deviceHandle, data, dataSizeInBytes);
             break;
         case EDataBufferType::VertexBuffer:
-            device.uploadVertexBufferData(deviceHandle, data, dataSizeInBytes);
+            if (streamData)
+                device.streamVertexBufferData(deviceHandle, data, dataSizeInBytes);
+            else
+                device.uploadVertexBufferData(deviceHandle, data, dataSizeInBytes);
             break;
         default:
             LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::updateDataBuffer: can not updata data buffer with invalid type!");
@@ -144,7 +144,7 @@ namespace ramses_internal
     void RendererSceneResourceRegistry::addDataBuffer(DataBufferHandle handle, DeviceResourceHandle deviceHandle, EDataBufferType dataBufferType, UInt32 size)
     {
         assert(!m_dataBuffers.contains(handle));
-        m_dataBuffers.put(handle, { deviceHandle, size, dataBufferType });
+        m_dataBuffers.put(handle, { deviceHandle, size, dataBufferType, 0u, 0u });
     }
 
     void RendererSceneResourceRegistry::removeDataBuffer(DataBufferHandle handle)
@@ -175,6 +175,25 @@ namespace ramses_internal
         }
     }
 
+    UInt32 RendererSceneResourceRegistry::markDataBufferUpdated(DataBufferHandle handle, UInt64 frameIndex)
+    {
+        assert(m_dataBuffers.contains(handle));
+        DataBufferEntry& entry = *m_dataBuffers.get(handle);
+        assert(frameIndex >= entry.lastUpdateFrame);
+
+        if (entry.subsequentUpdateFrames == 0u || frameIndex - entry.lastUpdateFrame > MaxFramesBetweenSubsequentDataBufferUpdates)
+        {
+            entry.subsequentUpdateFrames = 1u;
+        }
+        else if (frameIndex != entry.lastUpdateFrame)
+        {
+            ++entry.subsequentUpdateFrames;
+        }
+        entry.lastUpdateFrame = frameIndex;
+
+        return entry.subsequentUpdateFrames;
+    }
+
     void RendererSceneResourceRegistry::addTextureBuffer(TextureBufferHandle handle, DeviceResourceHandle deviceHandle, UInt32 size)
     {
         assert(!m_textureBuffers.contains(handle));
@@ -20,6 +20,7 @@
 #include "RendererLib/RendererSceneUpdater.h"
 #include "RendererLib/SceneStateExecutor.h"
 #include "RendererLib/RendererResourceManager.h"
+#include "RendererLib/IResourceUploader.h"
 #include "RendererLib/DisplayConfig.h"
 #include "RendererLib/RendererScenes.h"
 #include "RendererLib/DataLinkUtils.h"
@@ -115,9 +116,10 @@ namespace ramses_internal
             IDisplayController& displayController = m_renderer.getDisplayController(handle);
             IRenderBackend& renderBackend = displayController.getRenderBackend();
             IEmbeddedCompositingManager& embeddedCompositingManager = displayController.getEmbeddedCompositingManager();
+            resourceUploader.deviceInitialized(renderBackend);
 
             // ownership of uploadStrategy is transferred into RendererResourceManager
-            RendererResourceManager* resourceManager = new RendererResourceManager(resourceProvider, resourceUploader, renderBackend, embeddedCompositingManager, RequesterID(handle.asMemoryHandle()), displayConfig.isEffectDeletionDisabled(), m_frameTimer, displayConfig.getGPUMemoryCacheSize());
+            RendererResourceManager* resourceManager = new RendererResourceManager(resourceProvider, resourceUploader, renderBackend, embeddedCompositingManager, RequesterID(handle.asMemoryHandle()), displayConfig.isEffectDeletionDisabled(), m_frameTimer, displayConfig.getGPUMemoryCacheSize(), displayConfig.getGPUMemoryCachePolicy(), displayConfig.isProgressiveTextureUploadEnabled(), displayConfig.getRenderBufferPoolSize(), displayConfig.isPartialFramebufferRedrawEnabled());
             m_displayResourceManagers.put(handle, resourceManager);
             m_rendererEventCollector.addEvent(ERendererEventType_DisplayCreated, handle);
 
@@ -262,6 +264,19 @@ namespace ramses_internal
             if (m_sceneStateExecutor.getSceneState(scene) == ESceneState_Rendered)
                 m_renderer.markBufferWithMappedSceneAsModified(scene);
         }
+
+        updateInternedStatesStatistics();
+    }
+
+    void RendererSceneUpdater::updateInternedStatesStatistics()
+    {
+        RendererStatistics& statistics = m_renderer.getStatistics();
+
+        const RenderStateCache& renderStateCache = m_rendererScenes.getRenderStateCache();
+        statistics.renderStatesInterned(renderStateCache.getUniqueCount(), renderStateCache.getRequestedCount());
+
+        const TextureSamplerStatesCache& textureSamplerStatesCache = m_rendererScenes.getTextureSamplerStatesCache();
+        statistics.textureSamplerStatesInterned(textureSamplerStatesCache.getUniqueCount(), textureSamplerStatesCache.getRequestedCount());
     }
 
     void RendererSceneUpdater::consolidatePendingSceneActions()
@@ -386,7 +401,13 @@ namespace ramses_internal
             if (resourceManager.hasClientResourcesToBeUploaded())
             {
                 activateDisplayContext(activeDisplay, displayHandle);
+                FrameTraceRecorder& traceRecorder = m_renderer.getProfilerStatistics().getTraceRecorder();
+                const UInt64 uploadStartTime = traceRecorder.isEnabled() ? PlatformTime::GetMicrosecondsMonotonic() : 0u;
                 resourceManager.uploadAndUnloadPendingClientResources();
+                if (traceRecorder.isEnabled())
+                {
+                    traceRecorder.recordClientResourcesUploaded(displayHandle.asMemoryHandle(), uploadStartTime, PlatformTime::GetMicrosecondsMonotonic() - uploadStartTime);
+                }
             }
         }
     }
@@ -411,7 +432,7 @@ namespace ramses_internal
 
                     for (const auto& streamTextureBufferUpdate : bufferUpdates)
                     {
-                        m_renderer.getStatistics().streamTextureUpdated(streamTextureBufferUpdate.key, streamTextureBufferUpdate.value);
+                        m_renderer.getStatistics().streamTextureUpdated(streamTextureBufferUpdate.key, streamTextureBufferUpdate.value.numberOfBufferUpdates, streamTextureBufferUpdate.value.uploadedBytes);
                     }
                 }
             }
@@ -486,11 +507,13 @@ namespace ramses_internal
         rendererScene.preallocateSceneSize(stagingInfo.sizeInformation);
 
         PendingFlushes& pendingFlushes = stagingInfo.pendingFlushes;
+        FrameTraceRecorder& traceRecorder = m_renderer.getProfilerStatistics().getTraceRecorder();
         UInt numFlushesApplied = 0u;
         UInt numActionsApplied = 0u;
         for (auto& pendingFlush : pendingFlushes)
         {
             const SceneVersionTag versionBefore = rendererScene.getSceneVersionTag();
+            const UInt64 flushApplyStartTime = traceRecorder.isEnabled() ? PlatformTime::GetMicrosecondsMonotonic() : 0u;
 
             const UInt sceneActionsItBefore = pendingFlush.sceneActionsIt;
             if (applyFlushPartially)
@@ -502,6 +525,11 @@ namespace ramses_internal
                 applySceneActions(rendererScene, pendingFlush);
             }
             numActionsApplied += pendingFlush.sceneActionsIt - sceneActionsItBefore;
+            if (traceRecorder.isEnabled())
+            {
+                traceRecorder.recordSceneFlushApplied(sceneID, pendingFlush.flushIndex, static_cast<UInt32>(pendingFlush.sceneActionsIt - sceneActionsItBefore),
+                    flushApplyStartTime, PlatformTime::GetMicrosecondsMonotonic() - flushApplyStartTime);
+            }
 
             if (pendingFlush.sceneActionsIt != pendingFlush.sceneActions.numberOfActions())
             {
@@ -524,7 +552,9 @@ namespace ramses_internal
             static const Vector<ESceneActionId> SceneActionsIgnoredForMarkingAsModified = { ESceneActionId_Flush, ESceneActionId_SetSceneVersionTag, ESceneActionId_SetAckFlushState };
             const auto it = std::find_if(pendingFlush.sceneActions.begin(), pendingFlush.sceneActions.end(),
                 [](const SceneActionCollection::SceneActionReader& a)->bool { return !SceneActionsIgnoredForMarkingAsModified.contains(a.type()); });
-            if (it != pendingFlush.sceneActions.end())
+            const Bool sceneModified = (it != pendingFlush.sceneActions.end());
+            m_latencyMonitor.recordFlushApplied(sceneID, pendingFlush.timeInfo.internalTimestamp, LatencyMonitor::Clock::now(), sceneModified);
+            if (sceneModified)
                 m_modifiedScenesToRerender.put(sceneID);
             else
                 m_latencyMonitor.onRendered(sceneID); // mark as rendered for latency monitor because this scene was updated but might not be rendered due to skip frame optimization
@@ -535,7 +565,10 @@ namespace ramses_internal
         // if scene is not shown, flush apply is equal to 'scene rendered' from the latency monitor point of view
         // this is to allow monitoring of latency of flushes only even if scene not rendered
         if (m_sceneStateExecutor.getSceneState(sceneID) != ESceneState_Rendered)
+        {
             m_latencyMonitor.onRendered(sceneID);
+            m_latencyMonitor.recordFlushNotRendered(sceneID);
+        }
 
         LOG_TRACE_F(CONTEXT_RENDERER, ([&](StringOutputStream& sos) {
             // log basic information for applied flushes
@@ -584,6 +617,12 @@ namespace ramses_internal
                 {
                     // process staged resource changes only if ALL pending flushes were applied
                     processStagedResourceChanges(sceneID, stagingInfo, activeDisplay);
+                    stagingInfo.lastAppliedFlushIndex = pendingFlushes.back().flushIndex;
+                }
+                else
+                {
+                    // resource changes of applied flushes get processed only together with the remaining ones
+                    stagingInfo.lastAppliedFlushIndex = 0u;
                 }
 
                 pendingFlushes.erase(pendingFlushes.cbegin(), pendingFlushes.cbegin() + numFlushesApplied);
@@ -825,7 +864,7 @@ namespace ramses_internal
         }
     }
 
-    void RendererSceneUpdater::destroyScene(SceneId sceneID)
+    void RendererSceneUpdater::destroyScene(SceneId sceneID, Bool retainSceneCopy)
     {
         m_renderer.resetRenderInterruptState();
         const ESceneState sceneState = m_sceneStateExecutor.getSceneState(sceneID);
@@ -840,7 +879,17 @@ namespace ramses_internal
         case ESceneState_MapRequested:
         case ESceneState_Subscribed:
         case ESceneState_SubscriptionPending:
-            m_rendererScenes.destroyScene(sceneID);
+            if (retainSceneCopy && canRetainScene(sceneID))
+            {
+                // flushes not applied yet will be resent on re-subscription
+                m_rendererScenes.getStagingInfo(sceneID).pendingFlushes.clear();
+                m_rendererScenes.retainScene(sceneID);
+                LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::destroyScene: retaining copy of scene " << sceneID.getValue() << " at flush " << m_rendererScenes.getRetainedStagingInfo(sceneID).lastAppliedFlushIndex);
+            }
+            else
+            {
+                m_rendererScenes.destroyScene(sceneID);
+            }
             m_renderer.getStatistics().untrackScene(sceneID);
         default:
             break;
@@ -861,6 +910,16 @@ namespace ramses_internal
         m_latencyMonitor.stopMonitoringScene(sceneID);
     }
 
+    Bool RendererSceneUpdater::canRetainScene(SceneId sceneID) const
+    {
+        // scene copy can only be resynchronized if it is exactly in state of the last flush applied,
+        // i.e. no later flush was applied partially
+        const StagingInfo& stagingInfo = m_rendererScenes.getStagingInfo(sceneID);
+        return !stagingInfo.sceneInstanceEpoch.isInvalid()
+            && stagingInfo.lastAppliedFlushIndex != 0u
+            && (stagingInfo.pendingFlushes.empty() || stagingInfo.pendingFlushes.front().sceneActionsIt == 0u);
+    }
+
     void RendererSceneUpdater::unloadSceneResourcesAndUnrefSceneResources(SceneId sceneId)
     {
         assert(m_rendererScenes.hasScene(sceneId));
@@ -917,7 +976,7 @@ namespace ramses_internal
     {
         if (m_sceneStateExecutor.checkIfCanBeUnpublished(sceneId))
         {
-            destroyScene(sceneId);
+            destroyScene(sceneId, true);
             m_sceneStateExecutor.setUnpublished(sceneId);
         }
     }
@@ -927,7 +986,15 @@ namespace ramses_internal
         if (m_sceneStateExecutor.checkIfCanBeSubscriptionRequested(sceneId))
         {
             assert(!m_rendererScenes.hasScene(sceneId));
-            m_sceneStateExecutor.setSubscriptionRequested(sceneId);
+            if (m_rendererScenes.hasRetainedScene(sceneId))
+            {
+                const StagingInfo& retainedStagingInfo = m_rendererScenes.getRetainedStagingInfo(sceneId);
+                m_sceneStateExecutor.setSubscriptionRequested(sceneId, retainedStagingInfo.sceneInstanceEpoch, retainedStagingInfo.lastAppliedFlushIndex);
+            }
+            else
+            {
+                m_sceneStateExecutor.setSubscriptionRequested(sceneId, Guid(), 0u);
+            }
         }
     }
 
@@ -938,7 +1005,7 @@ namespace ramses_internal
             return;
         }
 
-        destroyScene(sceneId);
+        destroyScene(sceneId, true);
         assert(!m_rendererScenes.hasScene(sceneId));
         m_sceneStateExecutor.setUnsubscribed(sceneId, indirect);
     }
@@ -1015,13 +1082,40 @@ namespace ramses_internal
         }
     }
 
-    void RendererSceneUpdater::handleSceneReceived(const SceneInfo& sceneInfo)
+    void RendererSceneUpdater::handleSceneReceived(const SceneInfo& sceneInfo, const Guid& sceneInstanceEpoch, Bool deltaSinceLastAppliedFlush)
     {
-        if (m_sceneStateExecutor.checkIfCanBeSubscriptionPending(sceneInfo.sceneID))
+        const SceneId sceneId = sceneInfo.sceneID;
+        if (!m_sceneStateExecutor.checkIfCanBeSubscriptionPending(sceneId))
         {
-            m_rendererScenes.createScene(sceneInfo);
-            m_sceneStateExecutor.setSubscriptionPending(sceneInfo.sceneID);
+            return;
         }
+
+        const Bool hasMatchingRetainedScene = m_rendererScenes.hasRetainedScene(sceneId) && m_rendererScenes.getRetainedStagingInfo(sceneId).sceneInstanceEpoch == sceneInstanceEpoch;
+        if (deltaSinceLastAppliedFlush && hasMatchingRetainedScene)
+        {
+            // retained scene is valid as it is, only the flushes it missed follow
+            LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::handleSceneReceived: restoring retained copy of scene " << sceneId.getValue() << " at flush " << m_rendererScenes.getRetainedStagingInfo(sceneId).lastAppliedFlushIndex);
+            m_rendererScenes.restoreRetainedScene(sceneId);
+            m_sceneStateExecutor.setSubscriptionPending(sceneId);
+            m_sceneStateExecutor.setSubscribed(sceneId);
+            return;
+        }
+
+        if (m_rendererScenes.hasRetainedScene(sceneId))
+        {
+            m_rendererScenes.destroyRetainedScene(sceneId);
+        }
+
+        if (deltaSinceLastAppliedFlush)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSceneReceived: received changes for scene " << sceneId.getValue() << " without matching scene copy, unsubscribing");
+            handleSceneUnsubscriptionRequest(sceneId, true);
+            return;
+        }
+
+        m_rendererScenes.createScene(sceneInfo);
+        m_rendererScenes.getStagingInfo(sceneId).sceneInstanceEpoch = sceneInstanceEpoch;
+        m_sceneStateExecutor.setSubscriptionPending(sceneId);
     }
 
     Bool RendererSceneUpdater::handleBufferCreateRequest(OffscreenBufferHandle buffer, DisplayHandle display, UInt32 width, UInt32 height, Bool isDoubleBuffered)
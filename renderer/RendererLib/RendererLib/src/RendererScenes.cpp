@@ -21,6 +21,10 @@ namespace ramses_internal
         {
             destroyScene(begin()->key);
         }
+        while (m_retainedScenes.count() != 0u)
+        {
+            destroyRetainedScene(m_retainedScenes.begin()->key);
+        }
     }
 
     RendererCachedScene& RendererScenes::createScene(const SceneInfo& sceneInfo)
@@ -29,7 +33,7 @@ namespace ramses_internal
         assert(!hasScene(sceneID));
 
         RendererSceneInfo rendererSceneInfo;
-        rendererSceneInfo.scene = new RendererCachedScene(*m_sceneLinksManager, sceneInfo);
+        rendererSceneInfo.scene = new RendererCachedScene(*m_sceneLinksManager, m_renderStateCache, m_textureSamplerStatesCache, sceneInfo);
         rendererSceneInfo.stagingInfo = new StagingInfo;
         put(sceneID, rendererSceneInfo);
 
@@ -49,6 +53,48 @@ namespace ramses_internal
         remove(sceneID);
     }
 
+    void RendererScenes::retainScene(SceneId sceneID)
+    {
+        assert(hasScene(sceneID));
+        assert(!hasRetainedScene(sceneID));
+
+        m_sceneLinksManager->handleSceneRetained(sceneID);
+
+        m_retainedScenes.put(sceneID, *get(sceneID));
+        remove(sceneID);
+    }
+
+    Bool RendererScenes::hasRetainedScene(SceneId sceneID) const
+    {
+        return m_retainedScenes.contains(sceneID);
+    }
+
+    const StagingInfo& RendererScenes::getRetainedStagingInfo(SceneId sceneID) const
+    {
+        assert(hasRetainedScene(sceneID));
+        return *m_retainedScenes.get(sceneID)->stagingInfo;
+    }
+
+    void RendererScenes::restoreRetainedScene(SceneId sceneID)
+    {
+        assert(hasRetainedScene(sceneID));
+        assert(!hasScene(sceneID));
+
+        put(sceneID, *m_retainedScenes.get(sceneID));
+        m_retainedScenes.remove(sceneID);
+    }
+
+    void RendererScenes::destroyRetainedScene(SceneId sceneID)
+    {
+        assert(hasRetainedScene(sceneID));
+
+        RendererSceneInfo& sceneInfo = *m_retainedScenes.get(sceneID);
+        delete(sceneInfo.stagingInfo);
+        delete(sceneInfo.scene);
+
+        m_retainedScenes.remove(sceneID);
+    }
+
     Bool RendererScenes::hasScene(SceneId sceneID) const
     {
         return contains(sceneID);
@@ -87,4 +133,24 @@ namespace ramses_internal
     {
         return *m_sceneLinksManager;
     }
+
+    const RenderStateCache& RendererScenes::getRenderStateCache() const
+    {
+        return m_renderStateCache;
+    }
+
+    RenderStateCache& RendererScenes::getRenderStateCache()
+    {
+        return m_renderStateCache;
+    }
+
+    const TextureSamplerStatesCache& RendererScenes::getTextureSamplerStatesCache() const
+    {
+        return m_textureSamplerStatesCache;
+    }
+
+    TextureSamplerStatesCache& RendererScenes::getTextureSamplerStatesCache()
+    {
+        return m_textureSamplerStatesCache;
+    }
 }
@@ -50,10 +50,42 @@ namespace ramses_internal
         m_displayStatistics[display].numFrameBufferSwapped++;
     }
 
-    void RendererStatistics::streamTextureUpdated(StreamTextureSourceId sourceId, UInt numUpdates)
+    void RendererStatistics::displayFrameRendered(DisplayHandle display, UInt32 frameDurationMicroseconds)
+    {
+        auto& dispStat = m_displayStatistics[display];
+        dispStat.numFramesRendered++;
+        dispStat.frameDuration.update(frameDurationMicroseconds);
+    }
+
+    void RendererStatistics::sceneLayerComposited(DisplayHandle display, UInt32 savedRenderCpuTimeMicroseconds)
+    {
+        auto& dispStat = m_displayStatistics[display];
+        dispStat.numSceneLayersComposited++;
+        dispStat.sceneLayersSavedRenderCpuTime += savedRenderCpuTimeMicroseconds;
+    }
+
+    void RendererStatistics::sceneLayersMemoryUsed(DisplayHandle display, UInt64 sizeInBytes)
+    {
+        m_displayStatistics[display].sceneLayersMemory = sizeInBytes;
+    }
+
+    void RendererStatistics::renderStatesInterned(UInt32 uniqueCount, UInt32 requestedCount)
+    {
+        m_numUniqueRenderStates = uniqueCount;
+        m_numRequestedRenderStates = requestedCount;
+    }
+
+    void RendererStatistics::textureSamplerStatesInterned(UInt32 uniqueCount, UInt32 requestedCount)
+    {
+        m_numUniqueTextureSamplerStates = uniqueCount;
+        m_numRequestedTextureSamplerStates = requestedCount;
+    }
+
+    void RendererStatistics::streamTextureUpdated(StreamTextureSourceId sourceId, UInt numUpdates, UInt uploadedBytes)
     {
         auto& strTexStat = m_streamTextureStatistics[sourceId];
         strTexStat.numUpdates += numUpdates;
+        strTexStat.uploadedBytes += uploadedBytes;
         if (strTexStat.lastFrameUpdated != m_frameNumber)
         {
             strTexStat.numFramesWhereUpdated++;
@@ -62,6 +94,41 @@ namespace ramses_internal
         strTexStat.maxUpdatesPerFrame = std::max(strTexStat.maxUpdatesPerFrame, numUpdates);
     }
 
+    void RendererStatistics::sceneGpuTimeMeasured(SceneId sceneId, UInt32 gpuTimeMicroseconds)
+    {
+        UpdateGpuTime(m_sceneStatistics[sceneId].gpuTime, gpuTimeMicroseconds);
+    }
+
+    void RendererStatistics::renderPassGpuTimeMeasured(SceneId sceneId, RenderPassHandle renderPass, UInt32 gpuTimeMicroseconds)
+    {
+        UpdateGpuTime(m_sceneStatistics[sceneId].renderPassGpuTime[renderPass], gpuTimeMicroseconds);
+    }
+
+    void RendererStatistics::blitPassGpuTimeMeasured(SceneId sceneId, BlitPassHandle blitPass, UInt32 gpuTimeMicroseconds)
+    {
+        UpdateGpuTime(m_sceneStatistics[sceneId].blitPassGpuTime[blitPass], gpuTimeMicroseconds);
+    }
+
+    void RendererStatistics::framePaced(UInt32 delayMicroseconds, Bool deadlineMissed)
+    {
+        m_numFramesPaced++;
+        if (deadlineMissed)
+            m_numPacingDeadlinesMissed++;
+        m_framePacingDelay.update(delayMicroseconds);
+    }
+
+    void RendererStatistics::UpdateGpuTime(GpuTimeStatistics& gpuTimeStats, UInt32 gpuTimeMicroseconds)
+    {
+        gpuTimeStats.numMeasured++;
+        gpuTimeStats.gpuTime.update(gpuTimeMicroseconds);
+    }
+
+    void RendererStatistics::WriteGpuTimeToStream(StringOutputStream& str, const GpuTimeStatistics& gpuTimeStats)
+    {
+        const auto& gpuTime = gpuTimeStats.gpuTime;
+        str << " (" << gpuTime.minValue << "/" << gpuTime.maxValue << "/" << static_cast<float>(gpuTime.sum) / gpuTimeStats.numMeasured << ")";
+    }
+
     void RendererStatistics::trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedClientResources, UInt numRemovedClientResources, UInt numSceneResourceActions)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -159,6 +226,9 @@ namespace ramses_internal
         m_drawCalls = 0u;
         m_frameDurationMin = std::numeric_limits<UInt32>::max();
         m_frameDurationMax = 0u;
+        m_numFramesPaced = 0u;
+        m_numPacingDeadlinesMissed = 0u;
+        m_framePacingDelay.reset();
 
         for (auto& sceneStatIt : m_sceneStatistics)
         {
@@ -179,11 +249,20 @@ namespace ramses_internal
             sceneStat.numClientResourcesRemovedPerFlush.reset();
             sceneStat.numSceneResourceActionsPerFlush.reset();
             sceneStat.numRendered = 0u;
+            sceneStat.gpuTime.numMeasured = 0u;
+            sceneStat.gpuTime.gpuTime.reset();
+            // passes are tracked again when measured, so that removed passes are not logged
+            sceneStat.renderPassGpuTime.clear();
+            sceneStat.blitPassGpuTime.clear();
         }
 
         for (auto& dispStat : m_displayStatistics)
         {
             dispStat.second.numFrameBufferSwapped = 0u;
+            dispStat.second.numFramesRendered = 0u;
+            dispStat.second.frameDuration.reset();
+            dispStat.second.numSceneLayersComposited = 0u;
+            dispStat.second.sceneLayersSavedRenderCpuTime = 0u;
             for (auto& obStat : dispStat.second.offscreenBufferStatistics)
             {
                 obStat.second.numSwapped = 0u;
@@ -194,6 +273,7 @@ namespace ramses_internal
         for (auto& strTexStat : m_streamTextureStatistics)
         {
             strTexStat.second.numUpdates = 0u;
+            strTexStat.second.uploadedBytes = 0u;
             strTexStat.second.numFramesWhereUpdated = 0u;
             strTexStat.second.maxUpdatesPerFrame = 0u;
             strTexStat.second.maxFramesWithNoUpdate = 0u;
@@ -211,6 +291,15 @@ namespace ramses_internal
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawcallsPerFrame " << getDrawCallsPerFrame() <<
             ", numFrames " << m_frameNumber;
+        if (m_numRequestedRenderStates > 0u)
+            str << ", renderStates unique/requested " << m_numUniqueRenderStates << "/" << m_numRequestedRenderStates;
+        if (m_numRequestedTextureSamplerStates > 0u)
+            str << ", samplerStates unique/requested " << m_numUniqueTextureSamplerStates << "/" << m_numRequestedTextureSamplerStates;
+        if (m_numFramesPaced > 0u)
+        {
+            str << ", pacedFrames " << m_numFramesPaced << ", missedDeadlines " << m_numPacingDeadlinesMissed;
+            str << ", pacingDelay us (" << m_framePacingDelay.minValue << "/" << m_framePacingDelay.maxValue << "/" << static_cast<float>(m_framePacingDelay.sum) / m_numFramesPaced << ")";
+        }
         str << "\n";
 
         for (const auto& dbStat : m_displayStatistics)
@@ -222,6 +311,17 @@ namespace ramses_internal
                 if (obStat.second.isInterruptible)
                     str << " (intr: " << obStat.second.numInterrupted << ")";
             }
+            if (dbStat.second.numFramesRendered > 0u)
+            {
+                const auto& frameDuration = dbStat.second.frameDuration;
+                str << "; frameTime us (" << frameDuration.minValue << "/" << frameDuration.maxValue << "/" << static_cast<float>(frameDuration.sum) / dbStat.second.numFramesRendered << ")";
+            }
+            if (dbStat.second.sceneLayersMemory > 0u)
+            {
+                str << "; layers composited " << dbStat.second.numSceneLayersComposited;
+                str << ", savedRenderCpuTime us " << dbStat.second.sceneLayersSavedRenderCpuTime;
+                str << ", layersMem KB " << dbStat.second.sceneLayersMemory / 1024u;
+            }
             str << "\n";
         }
 
@@ -251,6 +351,21 @@ namespace ramses_internal
                 str << ", RC-/F (" << numClientResourcesRemovedPerFlush.minValue << "/" << numClientResourcesRemovedPerFlush.maxValue << "/" << static_cast<float>(numClientResourcesRemovedPerFlush.sum) / sceneStats.numFlushesArrived << ")";
                 str << ", RS/F (" << numSceneResourceActionsPerFlush.minValue << "/" << numSceneResourceActionsPerFlush.maxValue << "/" << static_cast<float>(numSceneResourceActionsPerFlush.sum) / sceneStats.numFlushesArrived << ")";
             }
+            if (sceneStats.gpuTime.numMeasured > 0u)
+            {
+                str << ", gpuTime us";
+                WriteGpuTimeToStream(str, sceneStats.gpuTime);
+                for (const auto& passStats : sceneStats.renderPassGpuTime)
+                {
+                    str << ", RP" << passStats.first;
+                    WriteGpuTimeToStream(str, passStats.second);
+                }
+                for (const auto& passStats : sceneStats.blitPassGpuTime)
+                {
+                    str << ", BP" << passStats.first;
+                    WriteGpuTimeToStream(str, passStats.second);
+                }
+            }
             str << "\n";
         }
 
@@ -261,6 +376,7 @@ namespace ramses_internal
             str << ", framesUpd " << strTexStat.second.numFramesWhereUpdated;
             str << ", maxUpdInFrame " << strTexStat.second.maxUpdatesPerFrame;
             str << ", maxFramesWithNoUpd " << strTexStat.second.maxFramesWithNoUpdate;
+            str << ", uploadedKB " << strTexStat.second.uploadedBytes / 1024u;
             str << "\n";
         }
     }
@@ -14,14 +14,30 @@
 
 namespace ramses_internal
 {
-    ResourceCachedScene::ResourceCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
+    ResourceCachedScene::ResourceCachedScene(SceneLinksManager& sceneLinksManager, RenderStateCache& renderStateCache, TextureSamplerStatesCache& textureSamplerStatesCache, const SceneInfo& sceneInfo)
         : DataReferenceLinkCachedScene(sceneLinksManager, sceneInfo)
+        , m_renderStateCache(renderStateCache)
+        , m_textureSamplerStatesCache(textureSamplerStatesCache)
         , m_renderableResourcesDirtinessNeedsUpdate(false)
         , m_renderTargetsDirty(false)
         , m_blitPassesDirty(false)
     {
     }
 
+    ResourceCachedScene::~ResourceCachedScene()
+    {
+        for (const auto renderStateId : m_internedRenderStateIds)
+        {
+            if (renderStateId != RenderStateCache::InvalidId)
+                m_renderStateCache.release(renderStateId);
+        }
+        for (const auto samplerStatesId : m_internedTextureSamplerStatesIds)
+        {
+            if (samplerStatesId != TextureSamplerStatesCache::InvalidId)
+                m_textureSamplerStatesCache.release(samplerStatesId);
+        }
+    }
+
     template <typename T>
     void resizeContainerIfSmaller(T& container, UInt32 newSize)
     {
@@ -40,9 +56,14 @@ namespace ramses_internal
         resizeContainerIfSmaller(m_textureSamplersDirty, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_effectDeviceHandleCache, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_deviceHandleCacheForVertexAttributes, sizeInfo.datainstanceCount);
+        resizeContainerIfSmaller(m_positionBoundsCache, sizeInfo.datainstanceCount);
         resizeContainerIfSmaller(m_deviceHandleCacheForTextures, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_renderTargetCache, sizeInfo.renderTargetCount);
         resizeContainerIfSmaller(m_blitPassCache, sizeInfo.blitPassCount * 2u);
+        while (m_internedRenderStateIds.size() < sizeInfo.renderStateCount)
+            m_internedRenderStateIds.push_back(RenderStateCache::InvalidId);
+        while (m_internedTextureSamplerStatesIds.size() < sizeInfo.textureSamplerCount)
+            m_internedTextureSamplerStatesIds.push_back(TextureSamplerStatesCache::InvalidId);
     }
 
     RenderableHandle ResourceCachedScene::allocateRenderable(NodeHandle nodeHandle, RenderableHandle handle /*= RenderableHandle::Invalid()*/)
@@ -76,6 +97,8 @@ namespace ramses_internal
             {
                 m_deviceHandleCacheForVertexAttributes[indexIntoCache][i] = DeviceResourceHandle::Invalid();
             }
+            assert(indexIntoCache < m_positionBoundsCache.size());
+            m_positionBoundsCache[indexIntoCache] = BoundingBox();
         }
 
         setDataInstanceDirtyFlag(dataInstance, true);
@@ -98,6 +121,12 @@ namespace ramses_internal
         m_deviceHandleCacheForTextures[indexIntoCache] = DeviceResourceHandle::Invalid();
         setTextureSamplerDirtyFlag(actualHandle, true);
 
+        // sampler states cannot be changed after allocation, so the id is only acquired here
+        while (m_internedTextureSamplerStatesIds.size() <= indexIntoCache)
+            m_internedTextureSamplerStatesIds.push_back(TextureSamplerStatesCache::InvalidId);
+        assert(m_internedTextureSamplerStatesIds[indexIntoCache] == TextureSamplerStatesCache::InvalidId);
+        m_internedTextureSamplerStatesIds[indexIntoCache] = m_textureSamplerStatesCache.acquire(sampler.states);
+
         return actualHandle;
     }
 
@@ -105,6 +134,10 @@ namespace ramses_internal
     {
         setTextureSamplerDirtyFlag(handle, true);
         DataReferenceLinkCachedScene::releaseTextureSampler(handle);
+
+        UInt32& samplerStatesId = m_internedTextureSamplerStatesIds[handle.asMemoryHandle()];
+        m_textureSamplerStatesCache.release(samplerStatesId);
+        samplerStatesId = TextureSamplerStatesCache::InvalidId;
     }
 
     void ResourceCachedScene::releaseStreamTexture(StreamTextureHandle handle)
@@ -113,6 +146,108 @@ namespace ramses_internal
         DataReferenceLinkCachedScene::releaseStreamTexture(handle);
     }
 
+    RenderStateHandle ResourceCachedScene::allocateRenderState(RenderStateHandle stateHandle)
+    {
+        const RenderStateHandle actualHandle = DataReferenceLinkCachedScene::allocateRenderState(stateHandle);
+
+        const UInt32 indexIntoCache = actualHandle.asMemoryHandle();
+        while (m_internedRenderStateIds.size() <= indexIntoCache)
+            m_internedRenderStateIds.push_back(RenderStateCache::InvalidId);
+        assert(m_internedRenderStateIds[indexIntoCache] == RenderStateCache::InvalidId);
+        m_internedRenderStateIds[indexIntoCache] = m_renderStateCache.acquire(RenderStateBlock(getRenderState(actualHandle)));
+
+        return actualHandle;
+    }
+
+    void ResourceCachedScene::releaseRenderState(RenderStateHandle stateHandle)
+    {
+        DataReferenceLinkCachedScene::releaseRenderState(stateHandle);
+
+        UInt32& renderStateId = m_internedRenderStateIds[stateHandle.asMemoryHandle()];
+        m_renderStateCache.release(renderStateId);
+        renderStateId = RenderStateCache::InvalidId;
+    }
+
+    void ResourceCachedScene::setRenderStateBlendFactors(RenderStateHandle stateHandle, EBlendFactor srcColor, EBlendFactor destColor, EBlendFactor srcAlpha, EBlendFactor destAlpha)
+    {
+        DataReferenceLinkCachedScene::setRenderStateBlendFactors(stateHandle, srcColor, destColor, srcAlpha, destAlpha);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateBlendOperations(RenderStateHandle stateHandle, EBlendOperation operationColor, EBlendOperation operationAlpha)
+    {
+        DataReferenceLinkCachedScene::setRenderStateBlendOperations(stateHandle, operationColor, operationAlpha);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateCullMode(RenderStateHandle stateHandle, ECullMode cullMode)
+    {
+        DataReferenceLinkCachedScene::setRenderStateCullMode(stateHandle, cullMode);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateDrawMode(RenderStateHandle stateHandle, EDrawMode drawMode)
+    {
+        DataReferenceLinkCachedScene::setRenderStateDrawMode(stateHandle, drawMode);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateDepthFunc(RenderStateHandle stateHandle, EDepthFunc func)
+    {
+        DataReferenceLinkCachedScene::setRenderStateDepthFunc(stateHandle, func);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateDepthWrite(RenderStateHandle stateHandle, EDepthWrite flag)
+    {
+        DataReferenceLinkCachedScene::setRenderStateDepthWrite(stateHandle, flag);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateStencilFunc(RenderStateHandle stateHandle, EStencilFunc func, UInt32 ref, UInt8 mask)
+    {
+        DataReferenceLinkCachedScene::setRenderStateStencilFunc(stateHandle, func, ref, mask);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateStencilOps(RenderStateHandle stateHandle, EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass)
+    {
+        DataReferenceLinkCachedScene::setRenderStateStencilOps(stateHandle, sfail, dpfail, dppass);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::setRenderStateColorWriteMask(RenderStateHandle stateHandle, ColorWriteMask colorMask)
+    {
+        DataReferenceLinkCachedScene::setRenderStateColorWriteMask(stateHandle, colorMask);
+        updateInternedRenderState(stateHandle);
+    }
+
+    void ResourceCachedScene::updateInternedRenderState(RenderStateHandle stateHandle)
+    {
+        UInt32& renderStateId = m_internedRenderStateIds[stateHandle.asMemoryHandle()];
+        // acquire new state before releasing old one so that an unchanged state is not dropped from cache
+        const UInt32 newRenderStateId = m_renderStateCache.acquire(RenderStateBlock(getRenderState(stateHandle)));
+        m_renderStateCache.release(renderStateId);
+        renderStateId = newRenderStateId;
+    }
+
+    UInt32 ResourceCachedScene::getInternedRenderStateId(RenderStateHandle stateHandle) const
+    {
+        assert(stateHandle.asMemoryHandle() < m_internedRenderStateIds.size());
+        return m_internedRenderStateIds[stateHandle.asMemoryHandle()];
+    }
+
+    const RenderStateBlock& ResourceCachedScene::getInternedRenderState(UInt32 renderStateId) const
+    {
+        return m_renderStateCache.getValue(renderStateId);
+    }
+
+    UInt32 ResourceCachedScene::getInternedTextureSamplerStatesId(TextureSamplerHandle samplerHandle) const
+    {
+        assert(samplerHandle.asMemoryHandle() < m_internedTextureSamplerStatesIds.size());
+        return m_internedTextureSamplerStatesIds[samplerHandle.asMemoryHandle()];
+    }
+
     void ResourceCachedScene::setRenderableEffect(RenderableHandle renderableHandle, const ResourceContentHash& effectHash)
     {
         DataReferenceLinkCachedScene::setRenderableEffect(renderableHandle, effectHash);
@@ -213,6 +348,19 @@ namespace ramses_internal
         return m_deviceHandleCacheForVertexAttributes;
     }
 
+    const BoundingBox& ResourceCachedScene::getRenderablePositionBounds(RenderableHandle renderable) const
+    {
+        const DataInstanceHandle dataInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        if (!dataInstance.isValid())
+        {
+            static const BoundingBox UnknownBounds;
+            return UnknownBounds;
+        }
+
+        assert(dataInstance.asMemoryHandle() < m_positionBoundsCache.size());
+        return m_positionBoundsCache[dataInstance.asMemoryHandle()];
+    }
+
     const DeviceHandleVector& ResourceCachedScene::getCachedHandlesForTextureSamplers() const
     {
         return m_deviceHandleCacheForTextures;
@@ -315,6 +463,8 @@ namespace ramses_internal
         const DataLayout& geometryLayout = getDataLayout(geometryLayoutHandle);
 
         DeviceHandleVector& vertexAttributesCache = m_deviceHandleCacheForVertexAttributes[dataInstance.asMemoryHandle()];
+        BoundingBox& positionBounds = m_positionBoundsCache[dataInstance.asMemoryHandle()];
+        positionBounds = BoundingBox();
 
         // there has to be always at least indices field in geometry data layout
         static const DataFieldHandle indicesDataField(0u);
@@ -345,6 +495,14 @@ namespace ramses_internal
             {
                 return false;
             }
+
+            // content of data buffers changes over time, bounds are known only for static vertex arrays
+            const EFixedSemantics semantics = geometryLayout.getField(attributeField).semantics;
+            const bool isPositionField = semantics == EFixedSemantics_VertexPositionAttribute || semantics == EFixedSemantics_TextPositionsAttribute;
+            if (isPositionField && dataResource.hash.isValid() && dataResource.instancingDivisor == 0u)
+            {
+                positionBounds = resourceAccessor.getClientResourcePositionBounds(dataResource.hash);
+            }
         }
 
         return true;
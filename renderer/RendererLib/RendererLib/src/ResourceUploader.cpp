@@ -25,6 +25,14 @@ namespace ramses_internal
     {
     }
 
+    void ResourceUploader::deviceInitialized(IRenderBackend& renderBackend)
+    {
+        if (m_binaryShaderCache)
+        {
+            m_binaryShaderCache->deviceInitialized(renderBackend.getDevice().getDriverIdentification());
+        }
+    }
+
     DeviceResourceHandle ResourceUploader::uploadResource(IRenderBackend& renderBackend, ManagedResource res)
     {
         const IResource& resourceObject = *res.getResourceObject();
@@ -84,16 +92,89 @@ namespace ramses_internal
         }
     }
 
-    DeviceResourceHandle ResourceUploader::uploadTexture(IDevice& device, const TextureResource& texture)
+    DeviceResourceHandle ResourceUploader::uploadTextureMipTail(IRenderBackend& renderBackend, ManagedResource res, UInt32 mipTailMaxSize, UInt32& lowestUploadedMipLevel)
     {
-        const Bool generateMipsFlag = texture.getGenerateMipChainFlag();
+        const TextureResource& texture = *res.getResourceObject()->convertTo<TextureResource>();
+        IDevice& device = renderBackend.getDevice();
         const auto& mipDataSizes = texture.getMipDataSizes();
         const UInt32 numProvidedMipLevels = static_cast<UInt32>(mipDataSizes.size());
+        if (texture.getGenerateMipChainFlag() || numProvidedMipLevels < 2u)
+        {
+            lowestUploadedMipLevel = 0u;
+            return uploadTexture(device, texture);
+        }
+
+        // take as many of the smallest mip levels as fit into mip tail size, at least the smallest one
+        const UInt32 numFaces = GetNumberOfFaces(texture);
+        lowestUploadedMipLevel = numProvidedMipLevels - 1u;
+        UInt32 mipTailSize = mipDataSizes[lowestUploadedMipLevel] * numFaces;
+        while (lowestUploadedMipLevel > 0u && mipTailSize + mipDataSizes[lowestUploadedMipLevel - 1u] * numFaces <= mipTailMaxSize)
+        {
+            --lowestUploadedMipLevel;
+            mipTailSize += mipDataSizes[lowestUploadedMipLevel] * numFaces;
+        }
+
+        const DeviceResourceHandle textureDeviceHandle = AllocateTexture(device, texture);
+        for (UInt32 mipLevel = numProvidedMipLevels; mipLevel > lowestUploadedMipLevel; --mipLevel)
+        {
+            for (UInt32 face = 0u; face < numFaces; ++face)
+            {
+                UploadTextureMipLevelData(device, texture, textureDeviceHandle, mipLevel - 1u, face);
+            }
+        }
+
+        if (lowestUploadedMipLevel > 0u)
+        {
+            device.setTextureBaseMipLevel(textureDeviceHandle, lowestUploadedMipLevel);
+        }
+
+        return textureDeviceHandle;
+    }
+
+    void ResourceUploader::uploadTextureMipLevel(IRenderBackend& renderBackend, ManagedResource res, DeviceResourceHandle handle, UInt32 mipLevel)
+    {
+        const TextureResource& texture = *res.getResourceObject()->convertTo<TextureResource>();
+        IDevice& device = renderBackend.getDevice();
+        assert(mipLevel < texture.getMipDataSizes().size());
+
+        device.bindTexture(handle);
+        for (UInt32 face = 0u; face < GetNumberOfFaces(texture); ++face)
+        {
+            UploadTextureMipLevelData(device, texture, handle, mipLevel, face);
+        }
+        device.setTextureBaseMipLevel(handle, mipLevel);
+    }
+
+    DeviceResourceHandle ResourceUploader::uploadTexture(IDevice& device, const TextureResource& texture)
+    {
+        const Bool generateMipsFlag = texture.getGenerateMipChainFlag();
+        const UInt32 numProvidedMipLevels = static_cast<UInt32>(texture.getMipDataSizes().size());
         assert(numProvidedMipLevels == 1u || !generateMipsFlag);
+
+        const DeviceResourceHandle textureDeviceHandle = AllocateTexture(device, texture);
+        for (UInt32 face = 0u; face < GetNumberOfFaces(texture); ++face)
+        {
+            for (UInt32 mipLevel = 0u; mipLevel < numProvidedMipLevels; ++mipLevel)
+            {
+                UploadTextureMipLevelData(device, texture, textureDeviceHandle, mipLevel, face);
+            }
+        }
+
+        if (generateMipsFlag)
+        {
+            device.generateMipmaps(textureDeviceHandle);
+        }
+
+        return textureDeviceHandle;
+    }
+
+    DeviceResourceHandle ResourceUploader::AllocateTexture(IDevice& device, const TextureResource& texture)
+    {
+        const Bool generateMipsFlag = texture.getGenerateMipChainFlag();
+        const UInt32 numProvidedMipLevels = static_cast<UInt32>(texture.getMipDataSizes().size());
         const UInt32 numMipLevelsToAllocate = generateMipsFlag ? TextureMathUtils::GetMipLevelCount(texture.getWidth(), texture.getHeight(), texture.getDepth()) : numProvidedMipLevels;
         const UInt32 totalSizeInBytes = EstimateGPUAllocatedSizeOfTexture(texture, numMipLevelsToAllocate);
 
-        // allocate texture
         DeviceResourceHandle textureDeviceHandle;
         switch (texture.getTypeID())
         {
@@ -111,44 +192,46 @@ namespace ramses_internal
         }
         assert(textureDeviceHandle.isValid());
 
-        // upload texture data
-        const Byte* pData = reinterpret_cast<const Byte*>(texture.getData());
+        return textureDeviceHandle;
+    }
+
+    void ResourceUploader::UploadTextureMipLevelData(IDevice& device, const TextureResource& texture, DeviceResourceHandle textureDeviceHandle, UInt32 mipLevel, UInt32 face)
+    {
+        // data of all mip levels are stored one after another, for cube texture the whole mip chain of each face follows the previous face
+        const auto& mipDataSizes = texture.getMipDataSizes();
+        UInt32 dataOffset = 0u;
+        for (UInt32 i = 0u; i < mipDataSizes.size(); ++i)
+        {
+            dataOffset += mipDataSizes[i] * face + (i < mipLevel ? mipDataSizes[i] : 0u);
+        }
+        const Byte* pData = reinterpret_cast<const Byte*>(texture.getData()) + dataOffset;
+
         switch (texture.getTypeID())
         {
         case EResourceType_Texture2D:
         case EResourceType_Texture3D:
-            for (UInt32 mipLevel = 0u; mipLevel < mipDataSizes.size(); ++mipLevel)
-            {
-                const UInt32 width = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
-                const UInt32 height = TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
-                const UInt32 depth = TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
-                device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, 0u, width, height, depth, pData, mipDataSizes[mipLevel]);
-                pData += mipDataSizes[mipLevel];
-            }
+        {
+            const UInt32 width = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
+            const UInt32 height = TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
+            const UInt32 depth = TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
+            device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, 0u, width, height, depth, pData, mipDataSizes[mipLevel]);
             break;
+        }
         case EResourceType_TextureCube:
-            for (UInt32 i = 0; i < 6u; ++i)
-            {
-                const ETextureCubeFace faceId = static_cast<ETextureCubeFace>(i);
-                for (UInt32 mipLevel = 0u; mipLevel < mipDataSizes.size(); ++mipLevel)
-                {
-                    const UInt32 faceSize = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
-                    // texture faceID is encoded in Z offset
-                    device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, faceId, faceSize, faceSize, 1u, pData, mipDataSizes[mipLevel]);
-                    pData += mipDataSizes[mipLevel];
-                }
-            }
+        {
+            const UInt32 faceSize = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
+            // texture faceID is encoded in Z offset
+            device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, static_cast<ETextureCubeFace>(face), faceSize, faceSize, 1u, pData, mipDataSizes[mipLevel]);
             break;
+        }
         default:
             assert(false);
         }
+    }
 
-        if (generateMipsFlag)
-        {
-            device.generateMipmaps(textureDeviceHandle);
-        }
-
-        return textureDeviceHandle;
+    UInt32 ResourceUploader::GetNumberOfFaces(const TextureResource& texture)
+    {
+        return (texture.getTypeID() == EResourceType_TextureCube ? 6u : 1u);
     }
 
     ramses_internal::DeviceResourceHandle ResourceUploader::queryBinaryShaderCacheAndUploadEffect(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash)
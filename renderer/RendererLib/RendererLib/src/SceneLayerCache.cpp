@@ -0,0 +1,197 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/SceneLayerCache.h"
+#include "RendererLib/WarpingMeshData.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererAPI/IDevice.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    SceneLayerCache::SceneLayerCache(IDevice& device, UInt32 width, UInt32 height, UInt64 memoryBudget)
+        : m_device(device)
+        , m_width(width)
+        , m_height(height)
+        , m_memoryBudget(memoryBudget)
+        // default warping mesh is a screen filling quad
+        , m_compositingPass(device, WarpingMeshData())
+    {
+    }
+
+    SceneLayerCache::~SceneLayerCache()
+    {
+        for (const auto& layer : m_layers)
+            deleteLayer(layer.value);
+    }
+
+    Bool SceneLayerCache::CanCompositeScene(const RendererCachedScene& scene)
+    {
+        for (const auto& passInfo : scene.getSortedRenderingPasses())
+        {
+            // blit passes and passes with render target do not write to framebuffer
+            if (passInfo.getType() != ERenderingPassType::RenderPass)
+                continue;
+            const RenderPassHandle passHandle = passInfo.getRenderPassHandle();
+            const RenderPass& renderPass = scene.getRenderPass(passHandle);
+            if (!renderPass.isEnabled || renderPass.renderTarget.isValid())
+                continue;
+
+            for (const auto renderableHandle : scene.getOrderedRenderablesForPass(passHandle))
+            {
+                const Renderable& renderable = scene.getRenderable(renderableHandle);
+                if (!renderable.isVisible || !renderable.renderState.isValid())
+                    continue;
+
+                // premultiplied alpha blending over transparent black layer and compositing the layer the same way
+                // is equal to blending directly into framebuffer, any other blending or partial color write is not
+                const RenderState& state = scene.getRenderState(renderable.renderState);
+                const Bool premultipliedAlphaBlending =
+                    state.blendOperationColor == EBlendOperation_Add && state.blendOperationAlpha == EBlendOperation_Add &&
+                    state.blendFactorSrcColor == EBlendFactor_One && state.blendFactorDstColor == EBlendFactor_OneMinusSrcAlpha &&
+                    state.blendFactorSrcAlpha == EBlendFactor_One && state.blendFactorDstAlpha == EBlendFactor_OneMinusSrcAlpha;
+                // layers have no depth and stencil buffer, framebuffer depth and stencil are shared with other scenes
+                const Bool noDepthAndStencil = state.depthFunc == EDepthFunc_Disabled && state.depthWrite == EDepthWrite_Disabled && state.stencilFunc == EStencilFunc_Disabled;
+
+                if (!premultipliedAlphaBlending || !noDepthAndStencil || state.colorWriteMask != EColorWriteFlag_All)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    void SceneLayerCache::markSceneModified(SceneId sceneId)
+    {
+        m_modifiedScenes.put(sceneId);
+        Layer* layer = m_layers.get(sceneId);
+        if (layer != nullptr)
+            layer->valid = false;
+    }
+
+    void SceneLayerCache::markAllScenesModified()
+    {
+        m_allScenesModified = true;
+        for (auto& layer : m_layers)
+            layer.value.valid = false;
+    }
+
+    void SceneLayerCache::finishFrame(const Vector<SceneId>& shownScenes)
+    {
+        auto layerIt = m_layers.begin();
+        while (layerIt != m_layers.end())
+        {
+            if (std::find(shownScenes.cbegin(), shownScenes.cend(), layerIt->key) == shownScenes.cend())
+            {
+                deleteLayer(layerIt->value);
+                m_layers.remove(layerIt);
+            }
+            else
+                ++layerIt;
+        }
+
+        m_modifiedScenes.clear();
+        m_allScenesModified = false;
+    }
+
+    Bool SceneLayerCache::hasValidLayer(SceneId sceneId) const
+    {
+        const Layer* layer = m_layers.get(sceneId);
+        return layer != nullptr && layer->valid;
+    }
+
+    Bool SceneLayerCache::wasSceneModified(SceneId sceneId) const
+    {
+        return m_allScenesModified || m_modifiedScenes.hasElement(sceneId);
+    }
+
+    DeviceResourceHandle SceneLayerCache::getLayerRenderTarget(SceneId sceneId)
+    {
+        Layer* existingLayer = m_layers.get(sceneId);
+        if (existingLayer != nullptr)
+            return existingLayer->renderTarget;
+
+        if (getLayersMemorySize() + getLayerMemorySize() > m_memoryBudget)
+            return DeviceResourceHandle::Invalid();
+
+        Layer layer;
+        layer.colorBuffer = m_device.uploadRenderBuffer({ m_width, m_height, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u });
+        assert(layer.colorBuffer.isValid());
+
+        DeviceHandleVector renderTargetBuffers;
+        renderTargetBuffers.push_back(layer.colorBuffer);
+        layer.renderTarget = m_device.uploadRenderTarget(renderTargetBuffers);
+        assert(layer.renderTarget.isValid());
+
+        m_layers.put(sceneId, layer);
+        return layer.renderTarget;
+    }
+
+    void SceneLayerCache::setLayerRendered(SceneId sceneId, UInt32 renderCpuDurationMicroseconds)
+    {
+        Layer* layer = m_layers.get(sceneId);
+        assert(layer != nullptr);
+        layer->valid = true;
+        layer->renderCpuDuration = renderCpuDurationMicroseconds;
+    }
+
+    void SceneLayerCache::removeLayer(SceneId sceneId)
+    {
+        const Layer* layer = m_layers.get(sceneId);
+        if (layer != nullptr)
+        {
+            deleteLayer(*layer);
+            m_layers.remove(sceneId);
+        }
+    }
+
+    UInt32 SceneLayerCache::compositeLayer(SceneId sceneId, DeviceResourceHandle targetBuffer)
+    {
+        const Layer* layer = m_layers.get(sceneId);
+        assert(layer != nullptr && layer->valid);
+
+        m_device.activateRenderTarget(targetBuffer);
+        m_device.setViewport(0u, 0u, m_width, m_height);
+        m_device.cullMode(ECullMode_Disabled);
+        m_device.depthFunc(EDepthFunc_Disabled);
+        m_device.depthWrite(EDepthWrite_Disabled);
+        m_device.stencilFunc(EStencilFunc_Disabled, 0u, 0xFF);
+        m_device.colorMask(true, true, true, true);
+        // only scenes blending with premultiplied alpha are cached, so compositing their layer the same way
+        // gives the same result as blending the scene directly into the target
+        m_device.blendOperations(EBlendOperation_Add, EBlendOperation_Add);
+        m_device.blendFactors(EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha, EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha);
+        m_device.drawMode(EDrawMode_Triangles);
+
+        m_compositingPass.execute(layer->colorBuffer);
+
+        return layer->renderCpuDuration;
+    }
+
+    UInt32 SceneLayerCache::getLayerCount() const
+    {
+        return static_cast<UInt32>(m_layers.count());
+    }
+
+    UInt64 SceneLayerCache::getLayersMemorySize() const
+    {
+        return getLayerMemorySize() * m_layers.count();
+    }
+
+    UInt64 SceneLayerCache::getLayerMemorySize() const
+    {
+        // RGBA8 color only
+        return static_cast<UInt64>(m_width) * m_height * 4u;
+    }
+
+    void SceneLayerCache::deleteLayer(const Layer& layer)
+    {
+        m_device.deleteRenderTarget(layer.renderTarget);
+        m_device.deleteRenderBuffer(layer.colorBuffer);
+    }
+}
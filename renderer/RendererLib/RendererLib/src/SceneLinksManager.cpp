@@ -161,6 +161,15 @@ namespace ramses_internal
         m_textureLinkManager.removeSceneLinks(sceneId);
     }
 
+    void SceneLinksManager::handleSceneRetained(SceneId sceneId)
+    {
+        // retained scene will be used again, so its consumer slots are unlinked properly to restore their fallback values,
+        // removing scene drops transformation and data links without touching the scene itself
+        removeLinksOfConsumerScene(sceneId, m_transformationLinkManager);
+        removeLinksOfConsumerScene(sceneId, m_dataReferenceLinkManager);
+        handleSceneRemoved(sceneId);
+    }
+
     void SceneLinksManager::handleSceneUnmapped(SceneId sceneId)
     {
         m_textureLinkManager.removeSceneLinks(sceneId);
@@ -282,6 +291,18 @@ namespace ramses_internal
         }
     }
 
+    template <typename LINKMANAGER>
+    void SceneLinksManager::removeLinksOfConsumerScene(SceneId sceneId, LINKMANAGER& manager) const
+    {
+        SceneLinkVector links;
+        manager.getSceneLinks().getLinkedProviders(sceneId, links);
+        for (const auto& link : links)
+        {
+            assert(link.consumerSceneId == sceneId);
+            manager.removeDataLink(sceneId, link.consumerSlot);
+        }
+    }
+
     const TransformationLinkManager& SceneLinksManager::getTransformationLinkManager() const
     {
         return m_transformationLinkManager;
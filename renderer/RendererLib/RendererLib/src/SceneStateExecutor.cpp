@@ -30,10 +30,10 @@ namespace ramses_internal
         LOG_INFO(CONTEXT_RENDERER, "Scene "<< sceneId.getValue() << " is in state PUBLISHED");
     }
 
-    void SceneStateExecutor::setSubscriptionRequested(SceneId sceneId)
+    void SceneStateExecutor::setSubscriptionRequested(SceneId sceneId, const Guid& sceneInstanceEpoch, UInt64 lastAppliedFlushIndex)
     {
         assert(checkIfCanBeSubscriptionRequested(sceneId));
-        m_sceneGraphConsumerComponent.subscribeScene(m_scenesStateInfo.getSceneClientGuid(sceneId), sceneId);
+        m_sceneGraphConsumerComponent.subscribeScene(m_scenesStateInfo.getSceneClientGuid(sceneId), sceneId, sceneInstanceEpoch, lastAppliedFlushIndex);
         m_scenesStateInfo.setSceneState(sceneId, ESceneState_SubscriptionRequested);
         LOG_INFO(CONTEXT_RENDERER, "Scene " << sceneId.getValue() << " is in state SUBSCRIPTION REQUESTED");
     }
@@ -67,12 +67,12 @@ namespace ramses_internal
     }
 
     // Stereo display controller creates its own buffers and viewports per eye
-    SceneRenderExecutionIterator StereoDisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle, const Viewport&, const SceneRenderExecutionIterator& renderFrom, const FrameTimer*)
+    SceneRenderExecutionIterator StereoDisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle, const Viewport&, const SceneRenderExecutionIterator& renderFrom, const FrameTimer*, GpuTimerQueries* gpuTimerQueries)
     {
         // Stereo Rendering, one pass for left and one for right eye
         for (UInt32 eyeIndex = 0; eyeIndex < 2; eyeIndex++)
         {
-            const RenderExecutor executor(getRenderBackend().getDevice(), m_viewInfo[eyeIndex].m_fbInfo, renderFrom);
+            const RenderExecutor executor(getRenderBackend().getDevice(), m_viewInfo[eyeIndex].m_fbInfo, renderFrom, nullptr, gpuTimerQueries);
             executor.executeScene(scene, m_viewInfo[eyeIndex].m_viewMatrix);
         }
 
@@ -13,8 +13,8 @@
 
 namespace ramses_internal
 {
-    TextureLinkCachedScene::TextureLinkCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
-        : ResourceCachedScene(sceneLinksManager, sceneInfo)
+    TextureLinkCachedScene::TextureLinkCachedScene(SceneLinksManager& sceneLinksManager, RenderStateCache& renderStateCache, TextureSamplerStatesCache& textureSamplerStatesCache, const SceneInfo& sceneInfo)
+        : ResourceCachedScene(sceneLinksManager, renderStateCache, textureSamplerStatesCache, sceneInfo)
     {
     }
 
@@ -34,17 +34,19 @@ namespace ramses_internal
         RendererCommandBuffer& commandBuffer,
         ISceneGraphConsumerComponent& sceneGraphConsumerComponent,
         IPlatformFactory& platformFactory,
-        const String& monitorFilename)
+        const String& monitorFilename,
+        Bool renderThreadPerDisplay)
         : m_rendererCommandBuffer(commandBuffer)
         , m_latencyMonitor(m_rendererEventCollector)
         , m_rendererScenes(m_rendererEventCollector)
-        , m_renderer(platformFactory, m_rendererScenes, m_rendererEventCollector, m_frameTimer, m_latencyMonitor)
+        , m_renderer(platformFactory, m_rendererScenes, m_rendererEventCollector, m_frameTimer, m_latencyMonitor, renderThreadPerDisplay)
         , m_sceneStateExecutor(m_renderer, sceneGraphConsumerComponent, m_rendererEventCollector)
         , m_rendererSceneUpdater(m_renderer, m_rendererScenes, m_sceneStateExecutor, m_rendererEventCollector, m_frameTimer, m_latencyMonitor)
         , m_rendererCommandExecutor(m_renderer, m_rendererCommandBuffer, m_rendererSceneUpdater, m_rendererEventCollector, m_frameTimer)
         , m_cmdScreenshot                                  (m_rendererCommandBuffer)
         , m_cmdLogRendererInfo                             (m_rendererCommandBuffer)
         , m_cmdShowFrameProfiler                           (m_rendererCommandBuffer)
+        , m_cmdFrameTrace                                  (m_rendererCommandBuffer)
         , m_cmdPrintStatistics                             (m_rendererCommandBuffer)
         , m_cmdSetClearColor                               (m_rendererCommandBuffer)
         , m_cmdSkippingOfUnmodifiedBuffers                 (m_rendererCommandBuffer)
@@ -168,6 +170,7 @@ namespace ramses_internal
         ramsh.add(m_cmdScreenshot);
         ramsh.add(m_cmdLogRendererInfo);
         ramsh.add(m_cmdShowFrameProfiler);
+        ramsh.add(m_cmdFrameTrace);
         ramsh.add(*m_cmdShowSceneOnDisplayInternal);
         ramsh.add(m_cmdLinkSceneData);
         ramsh.add(m_cmdUnlinkSceneData);
@@ -11,6 +11,7 @@
 #include "RendererLib/RendererClientResourceRegistry.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
+#include "Resource/TextureResource.h"
 #include "ResourceProviderMock.h"
 #include "ResourceUploaderMock.h"
 #include "RenderBackendMock.h"
@@ -22,13 +23,13 @@ namespace ramses_internal{
 class AClientResourceUploadingManager : public ::testing::Test
 {
 public:
-    AClientResourceUploadingManager(bool keepEffects = false, UInt64 clientResourceCacheSize = 0u)
+    AClientResourceUploadingManager(bool keepEffects = false, UInt64 clientResourceCacheSize = 0u, EGPUMemoryCachePolicy cachePolicy = EGPUMemoryCachePolicy_LeastRecentlyUsed, bool progressiveTextureUpload = false, bool computeVertexPositionBounds = false)
         : dummyResource(EResourceType_IndexArray, 5, EDataType_UInt16, reinterpret_cast<const Byte*>(m_dummyData), ResourceCacheFlag_DoNotCache, String())
         , dummyEffectResource("", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache)
         , dummyManagedResourceCallback(managedResourceDeleter)
         , sceneId(66u)
         , frameTimer()
-        , rendererResourceUploader(resourceRegistry, uploader, rendererBackend, keepEffects, frameTimer, clientResourceCacheSize)
+        , rendererResourceUploader(resourceRegistry, uploader, rendererBackend, keepEffects, frameTimer, clientResourceCacheSize, cachePolicy, progressiveTextureUpload, computeVertexPositionBounds)
     {
     }
 
@@ -53,9 +54,9 @@ public:
         ASSERT_TRUE(resourceRegistry.getAllProvidedResources().contains(hash));
     }
 
-    void makeResourceUnused(ResourceContentHash hash)
+    void makeResourceUnused(ResourceContentHash hash, UInt64 frameCounter = 0u)
     {
-        resourceRegistry.removeResourceRef(hash, sceneId);
+        resourceRegistry.removeResourceRef(hash, sceneId, frameCounter);
         ASSERT_TRUE(resourceRegistry.getAllResourcesNotInUseByScenes().contains(hash));
     }
 
@@ -137,6 +138,54 @@ public:
     }
 };
 
+class AClientResourceUploadingManager_WithCostAwareVRAMCache : public AClientResourceUploadingManager
+{
+public:
+    AClientResourceUploadingManager_WithCostAwareVRAMCache()
+        : AClientResourceUploadingManager(false, 30u, EGPUMemoryCachePolicy_CostAware)
+    {
+    }
+};
+
+class AClientResourceUploadingManager_WithProgressiveTextureUpload : public AClientResourceUploadingManager
+{
+public:
+    AClientResourceUploadingManager_WithProgressiveTextureUpload()
+        : AClientResourceUploadingManager(false, 0u, EGPUMemoryCachePolicy_LeastRecentlyUsed, true)
+        , largeTexture(EResourceType_Texture2D, TextureMetaInfo(256u, 256u, 1u, ETextureFormat_R8, false, { 65536u, 16384u, 4096u, 1024u }), ResourceCacheFlag_DoNotCache, String())
+        , smallTexture(EResourceType_Texture2D, TextureMetaInfo(4u, 4u, 1u, ETextureFormat_R8, false, { 16u, 4u, 1u }), ResourceCacheFlag_DoNotCache, String())
+    {
+    }
+
+    void registerAndProvideTexture(ResourceContentHash hash, const TextureResource& texture)
+    {
+        resourceRegistry.registerResource(hash);
+        resourceRegistry.addResourceRef(hash, sceneId);
+        resourceRegistry.setResourceStatus(hash, EResourceStatus_Requested);
+        resourceRegistry.setResourceStatus(hash, EResourceStatus_Provided);
+        ManagedResource managedRes(texture, dummyManagedResourceCallback);
+        resourceRegistry.setResourceData(hash, managedRes, DeviceResourceHandle::Invalid(), EResourceType_Texture2D);
+    }
+
+protected:
+    const TextureResource largeTexture;
+    const TextureResource smallTexture;
+};
+
+class AClientResourceUploadingManager_WithVertexPositionBounds : public AClientResourceUploadingManager
+{
+public:
+    AClientResourceUploadingManager_WithVertexPositionBounds()
+        : AClientResourceUploadingManager(false, 0u, EGPUMemoryCachePolicy_LeastRecentlyUsed, false, true)
+    {
+    }
+
+protected:
+    static const Float m_positions[9];
+};
+
+const Float AClientResourceUploadingManager_WithVertexPositionBounds::m_positions[9] = { -1.f, 2.f, 0.5f, 3.f, -4.f, 0.f, 0.f, 0.f, -2.f };
+
 TEST_F(AClientResourceUploadingManager, hasNothingToUploadUnloadInitially)
 {
     EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
@@ -670,4 +719,270 @@ TEST_F(AClientResourceUploadingManager_WithVRAMCache, willUnloadResourcesOfSameO
     // destructor will unload kept resources
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3u);
 }
+
+TEST_F(AClientResourceUploadingManager_WithVRAMCache, unloadsLeastRecentlyUsedResourceFirst)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+    const ResourceContentHash res4(1237u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2);
+    registerAndProvideResource(res3);
+    EXPECT_CALL(uploader, uploadResource(_, _)).Times(3u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    makeResourceUnused(res2, 1u);
+    makeResourceUnused(res1, 2u);
+
+    // cache is full, the resource unused for the longest time is unloaded
+    registerAndProvideResource(res4);
+    EXPECT_CALL(uploader, unloadResource(_, _, res2, _));
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res2);
+    expectResourceUploaded(res1);
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    makeResourceUnused(res3);
+    makeResourceUnused(res4);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3u);
+}
+
+TEST_F(AClientResourceUploadingManager_WithCostAwareVRAMCache, keepsResourceExpensiveToUploadLongerThanCheapOne)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+    const ResourceContentHash res4(1237u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2);
+    registerAndProvideResource(res3);
+    // res1 takes at least 20ms to upload, it is kept as if it was used 200 frames later
+    EXPECT_CALL(uploader, uploadResource(_, _))
+        .WillOnce(InvokeWithoutArgs([]() { PlatformThread::Sleep(20u); return ResourceUploaderMock::FakeResourceDeviceHandle; }))
+        .WillRepeatedly(Return(ResourceUploaderMock::FakeResourceDeviceHandle));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    makeResourceUnused(res1, 1u);
+    makeResourceUnused(res2, 2u);
+
+    // cache is full, the cheap resource is unloaded even though it was used more recently
+    registerAndProvideResource(res4);
+    EXPECT_CALL(uploader, unloadResource(_, _, res2, _));
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res2);
+    expectResourceUploaded(res1);
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    makeResourceUnused(res3);
+    makeResourceUnused(res4);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3u);
+}
+
+TEST_F(AClientResourceUploadingManager_WithVRAMCache, countsCacheHitsMissesAndEvictedBytes)
+{
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+    const ResourceContentHash res4(1237u, 0u);
+
+    rendererResourceUploader.trackResourceReferenced(res1);
+    registerAndProvideResource(res1);
+    rendererResourceUploader.trackResourceReferenced(res2);
+    registerAndProvideResource(res2);
+    rendererResourceUploader.trackResourceReferenced(res3);
+    registerAndProvideResource(res3);
+    EXPECT_CALL(uploader, uploadResource(_, _)).Times(3u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    // unused resource kept in cache is reused
+    makeResourceUnused(res1);
+    rendererResourceUploader.trackResourceReferenced(res1);
+    resourceRegistry.addResourceRef(res1, sceneId);
+
+    // resource still used by a scene is neither hit nor miss
+    rendererResourceUploader.trackResourceReferenced(res2);
+
+    makeResourceUnused(res2);
+    rendererResourceUploader.trackResourceReferenced(res4);
+    registerAndProvideResource(res4);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    const ClientResourceUploadingManager::CacheStatistics& stats = rendererResourceUploader.getCacheStatistics();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(4u, stats.misses);
+    EXPECT_EQ(1u, stats.evictedResources);
+    EXPECT_EQ(10u, stats.evictedBytes);
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res3);
+    makeResourceUnused(res4);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3u);
+}
+
+TEST_F(AClientResourceUploadingManager_WithProgressiveTextureUpload, uploadsMipTailOfLargeTextureFirstAndRestOfMipLevelsInFollowingFrames)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideTexture(res, largeTexture);
+
+    // budget is exceeded right away, so one mip level per frame is uploaded
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    frameTimer.startFrame();
+    {
+        InSequence seq;
+        EXPECT_CALL(uploader, uploadTextureMipTail(_, _, ClientResourceUploadingManager::ProgressiveTextureMipTailSize, _)).WillOnce(DoAll(SetArgReferee<3>(2u), Return(ResourceUploaderMock::FakeResourceDeviceHandle)));
+        EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, ResourceUploaderMock::FakeResourceDeviceHandle, 1u));
+    }
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    // texture is usable already while rest of mip levels is uploaded
+    expectResourceUploaded(res);
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, ResourceUploaderMock::FakeResourceDeviceHandle, 0u));
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Texture2D, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
+TEST_F(AClientResourceUploadingManager_WithProgressiveTextureUpload, uploadsAllMipLevelsInOneFrameIfTimeBudgetAllows)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideTexture(res, largeTexture);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(uploader, uploadTextureMipTail(_, _, _, _)).WillOnce(DoAll(SetArgReferee<3>(3u), Return(ResourceUploaderMock::FakeResourceDeviceHandle)));
+        EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, _, 2u));
+        EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, _, 1u));
+        EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, _, 0u));
+    }
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+    expectResourceUploaded(res);
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+}
+
+TEST_F(AClientResourceUploadingManager_WithProgressiveTextureUpload, uploadsSmallTextureAtOnce)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideTexture(res, smallTexture);
+
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+    expectResourceUploaded(res);
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+}
+
+TEST_F(AClientResourceUploadingManager_WithProgressiveTextureUpload, stopsUploadingMipLevelsOfUnloadedTexture)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideTexture(res, largeTexture);
+
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    frameTimer.startFrame();
+    EXPECT_CALL(uploader, uploadTextureMipTail(_, _, _, _)).WillOnce(DoAll(SetArgReferee<3>(3u), Return(ResourceUploaderMock::FakeResourceDeviceHandle)));
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, _, 2u));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Texture2D, res, _));
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    expectResourceUnloaded(res);
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+}
+
+TEST_F(AClientResourceUploadingManager, doesNotComputeBoundsOfVertexArrayIfNotEnabled)
+{
+    const Float positions[3] = { 1.f, 2.f, 3.f };
+    const ArrayResource vertexArray(EResourceType_VertexArray, 1u, EDataType_Vector3F, reinterpret_cast<const Byte*>(positions), ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &vertexArray);
+
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+    EXPECT_FALSE(resourceRegistry.getResourceDescriptor(res).positionBounds.isValid);
+
+    unregisterResource(res);
+}
+
+TEST_F(AClientResourceUploadingManager_WithVertexPositionBounds, computesBoundsOfUploadedVertexArray)
+{
+    const ArrayResource vertexArray(EResourceType_VertexArray, 3u, EDataType_Vector3F, reinterpret_cast<const Byte*>(m_positions), ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &vertexArray);
+
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+
+    const BoundingBox& bounds = resourceRegistry.getResourceDescriptor(res).positionBounds;
+    EXPECT_TRUE(bounds.isValid);
+    EXPECT_EQ(Vector3(-1.f, -4.f, -2.f), bounds.minCorner);
+    EXPECT_EQ(Vector3(3.f, 2.f, 0.5f), bounds.maxCorner);
+
+    unregisterResource(res);
+}
+
+TEST_F(AClientResourceUploadingManager_WithVertexPositionBounds, computesBoundsOf2DVertexArrayInPlaneZ0)
+{
+    const ArrayResource vertexArray(EResourceType_VertexArray, 4u, EDataType_Vector2F, reinterpret_cast<const Byte*>(m_positions), ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &vertexArray);
+
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    const BoundingBox& bounds = resourceRegistry.getResourceDescriptor(res).positionBounds;
+    EXPECT_TRUE(bounds.isValid);
+    EXPECT_EQ(Vector3(-4.f, 0.f, 0.f), bounds.minCorner);
+    EXPECT_EQ(Vector3(0.5f, 3.f, 0.f), bounds.maxCorner);
+
+    unregisterResource(res);
+}
+
+TEST_F(AClientResourceUploadingManager_WithVertexPositionBounds, doesNotComputeBoundsOfVertexArrayWhichCannotHoldPositions)
+{
+    const ArrayResource vertexArray(EResourceType_VertexArray, 9u, EDataType_Float, reinterpret_cast<const Byte*>(m_positions), ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &vertexArray);
+
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_FALSE(resourceRegistry.getResourceDescriptor(res).positionBounds.isValid);
+
+    unregisterResource(res);
+}
 }
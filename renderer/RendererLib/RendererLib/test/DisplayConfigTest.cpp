@@ -40,6 +40,13 @@ TEST_F(AInternalDisplayConfig, hasDefaultValues)
     EXPECT_FALSE(m_config.isResizable());
     EXPECT_EQ(ramses_internal::ProjectionParams::Perspective(19.0f, 1280.f / 480.f, 0.1f, 1500.f), m_config.getProjectionParams());
     EXPECT_EQ(0u, m_config.getGPUMemoryCacheSize());
+    EXPECT_EQ(ramses_internal::EGPUMemoryCachePolicy_LeastRecentlyUsed, m_config.getGPUMemoryCachePolicy());
+    EXPECT_EQ(0u, m_config.getRenderBufferPoolSize());
+    EXPECT_FALSE(m_config.isSceneLayerCacheEnabled());
+    EXPECT_EQ(32u * 1024u * 1024u, m_config.getSceneLayerCacheMemoryBudget());
+    EXPECT_FALSE(m_config.isPartialFramebufferRedrawEnabled());
+    EXPECT_FALSE(m_config.isProgressiveTextureUploadEnabled());
+    EXPECT_FALSE(m_config.isGpuTimerQueriesEnabled());
     EXPECT_EQ(ramses_internal::Vector4(0.f,0.f,0.f,1.f), m_config.getClearColor());
     EXPECT_FALSE(m_config.getOffscreen());
 
@@ -100,6 +107,26 @@ TEST_F(AInternalDisplayConfig, setAndGetValues)
     m_config.setGPUMemoryCacheSize(256u);
     EXPECT_EQ(256u, m_config.getGPUMemoryCacheSize());
 
+    m_config.setGPUMemoryCachePolicy(ramses_internal::EGPUMemoryCachePolicy_CostAware);
+    EXPECT_EQ(ramses_internal::EGPUMemoryCachePolicy_CostAware, m_config.getGPUMemoryCachePolicy());
+
+    m_config.setRenderBufferPoolSize(512u);
+    EXPECT_EQ(512u, m_config.getRenderBufferPoolSize());
+
+    m_config.setSceneLayerCacheEnabled(true);
+    EXPECT_TRUE(m_config.isSceneLayerCacheEnabled());
+    m_config.setSceneLayerCacheMemoryBudget(1024u);
+    EXPECT_EQ(1024u, m_config.getSceneLayerCacheMemoryBudget());
+
+    m_config.setPartialFramebufferRedrawEnabled(true);
+    EXPECT_TRUE(m_config.isPartialFramebufferRedrawEnabled());
+
+    m_config.setProgressiveTextureUploadEnabled(true);
+    EXPECT_TRUE(m_config.isProgressiveTextureUploadEnabled());
+
+    m_config.setGpuTimerQueriesEnabled(true);
+    EXPECT_TRUE(m_config.isGpuTimerQueriesEnabled());
+
     m_config.setResizable(false);
     EXPECT_FALSE(m_config.isResizable());
 
@@ -142,6 +169,10 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
         "-bl",
         "-warp",
         "-ded",
+        "-slc",
+        "-pfr",
+        "-ptu",
+        "-gtq",
         "-aa", "MSAA",
         "-as", "4",
         "-lid", "101",
@@ -191,6 +222,10 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
     EXPECT_TRUE(config.getStartVisibleIvi());
     EXPECT_TRUE(config.isWarpingEnabled());
     EXPECT_TRUE(config.isEffectDeletionDisabled());
+    EXPECT_TRUE(config.isSceneLayerCacheEnabled());
+    EXPECT_TRUE(config.isPartialFramebufferRedrawEnabled());
+    EXPECT_TRUE(config.isProgressiveTextureUploadEnabled());
+    EXPECT_TRUE(config.isGpuTimerQueriesEnabled());
     EXPECT_TRUE(config.isResizable());
     EXPECT_TRUE(config.getOffscreen());
 }
@@ -87,6 +87,77 @@ namespace ramses_internal
         destroyDisplayController(displayController);
     }
 
+    TEST_F(ADisplayController, swapsBuffersWithDamagedRegion)
+    {
+        const Viewport damagedRegion(1u, 2u, 3u, 4u);
+        IDisplayController& displayController = createDisplayController();
+
+        InSequence seq;
+        EXPECT_CALL(m_renderBackend, getSurface());
+        EXPECT_CALL(m_renderBackend.surfaceMock, swapBuffersWithDamage(damagedRegion));
+        EXPECT_CALL(m_renderBackend.surfaceMock, frameRendered());
+        EXPECT_CALL(m_renderBackend, getDevice());
+        EXPECT_CALL(m_renderBackend.deviceMock, validateDeviceStatusHealthy());
+
+        displayController.swapBuffersWithDamage(damagedRegion);
+
+        destroyDisplayController(displayController);
+    }
+
+    TEST_F(ADisplayController, queriesBufferAgeFromSurface)
+    {
+        IDisplayController& displayController = createDisplayController();
+
+        EXPECT_CALL(m_renderBackend, getSurface());
+        EXPECT_CALL(m_renderBackend.surfaceMock, getBufferAge()).WillOnce(Return(2u));
+        EXPECT_EQ(2u, displayController.getDisplayBufferAge());
+
+        destroyDisplayController(displayController);
+    }
+
+    TEST_F(ADisplayController, clearsOnlyScissorRegionOfDisplayBuffer)
+    {
+        const Vector4 clearColor(0.1f, 0.2f, 0.3f, 0.4f);
+        const DeviceResourceHandle otherBuffer(123u);
+        IDisplayController& displayController = createDisplayController();
+
+        {
+            InSequence seq;
+            EXPECT_CALL(m_renderBackend.deviceMock, setScissorRegion(1u, 2u, 3u, 4u));
+            EXPECT_CALL(m_renderBackend.deviceMock, enableScissorTest(true));
+        }
+        displayController.setDisplayBufferScissorRegion(true, { 1u, 2u, 3u, 4u });
+        Mock::VerifyAndClearExpectations(&m_renderBackend.deviceMock);
+
+        EXPECT_CALL(m_renderBackend.deviceMock, enableScissorTest(_)).Times(0);
+        EXPECT_CALL(m_renderBackend.deviceMock, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle));
+        EXPECT_CALL(m_renderBackend.deviceMock, colorMask(true, true, true, true));
+        EXPECT_CALL(m_renderBackend.deviceMock, clearColor(clearColor));
+        EXPECT_CALL(m_renderBackend.deviceMock, depthWrite(EDepthWrite_Enabled));
+        EXPECT_CALL(m_renderBackend.deviceMock, clear(_));
+        displayController.clearBuffer(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, clearColor);
+        Mock::VerifyAndClearExpectations(&m_renderBackend.deviceMock);
+
+        {
+            InSequence seq;
+            EXPECT_CALL(m_renderBackend.deviceMock, enableScissorTest(false));
+            EXPECT_CALL(m_renderBackend.deviceMock, activateRenderTarget(otherBuffer));
+            EXPECT_CALL(m_renderBackend.deviceMock, colorMask(true, true, true, true));
+            EXPECT_CALL(m_renderBackend.deviceMock, clearColor(clearColor));
+            EXPECT_CALL(m_renderBackend.deviceMock, depthWrite(EDepthWrite_Enabled));
+            EXPECT_CALL(m_renderBackend.deviceMock, clear(_));
+            EXPECT_CALL(m_renderBackend.deviceMock, enableScissorTest(true));
+        }
+        displayController.clearBuffer(otherBuffer, clearColor);
+        Mock::VerifyAndClearExpectations(&m_renderBackend.deviceMock);
+
+        EXPECT_CALL(m_renderBackend.deviceMock, setScissorRegion(_, _, _, _)).Times(0);
+        EXPECT_CALL(m_renderBackend.deviceMock, enableScissorTest(false));
+        displayController.setDisplayBufferScissorRegion(false, {});
+
+        destroyDisplayController(displayController);
+    }
+
     TEST_F(ADisplayController, canHandleWindowEvents)
     {
         IDisplayController& displayController = createDisplayController();
@@ -130,11 +130,17 @@ TEST_F(AnEmbeddedCompositingManager, CanUpdateCompositingResources)
 
     UpdatedSceneIdSet updatedScenes;
     EXPECT_CALL(embeddedCompositorMock, dispatchUpdatedStreamTextureSourceIds()).WillOnce(Return(fakeUpdatedStreamTextureSourceIds));
-    EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, _, _));
+    StreamTextureBufferUpdate bufferUpdate;
+    bufferUpdate.numberOfBufferUpdates = 2u;
+    bufferUpdate.uploadedBytes = 1024u;
+    EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, _, _)).WillOnce(Return(bufferUpdate));
     StreamTextureBufferUpdates updates;
     embeddedCompositingManager.uploadResourcesAndGetUpdates(updatedScenes, updates);
     ASSERT_EQ(1u, updatedScenes.count());
     EXPECT_EQ(sceneId, *updatedScenes.begin());
+    ASSERT_EQ(1u, updates.count());
+    EXPECT_EQ(2u, updates[streamTextureSourceId].numberOfBufferUpdates);
+    EXPECT_EQ(1024u, updates[streamTextureSourceId].uploadedBytes);
 }
 
 TEST_F(AnEmbeddedCompositingManager, CanNotifyClients)
@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FramePacer.h"
+#include "gtest/gtest.h"
+
+using namespace ramses_internal;
+
+namespace
+{
+    const UInt64 FrameDuration = 16000u;
+    const UInt64 StartTime = 1000000u;
+}
+
+class AFramePacer : public ::testing::Test
+{
+public:
+    AFramePacer()
+        : pacer(std::chrono::microseconds{ FrameDuration })
+    {
+    }
+
+protected:
+    FramePacer pacer;
+};
+
+TEST_F(AFramePacer, doesNotDelayFirstFrame)
+{
+    EXPECT_EQ(0, pacer.getDelayBeforeNextFrame(StartTime).count());
+}
+
+TEST_F(AFramePacer, predictsTargetFrameDurationIfNoFrameFinishedYet)
+{
+    EXPECT_EQ(std::chrono::microseconds{ FrameDuration }, pacer.getPredictedRenderTime());
+}
+
+TEST_F(AFramePacer, predictsRenderTimeOfMostExpensiveRecentFrameWithSafetyMargin)
+{
+    pacer.frameFinished(StartTime, StartTime + 2000u, std::chrono::microseconds{ 0 });
+    EXPECT_EQ(static_cast<Int64>(2000u + FramePacer::MinimumSafetyMarginMicroseconds), pacer.getPredictedRenderTime().count());
+
+    pacer.frameFinished(StartTime + 16000u, StartTime + 26000u, std::chrono::microseconds{ 0 });
+    pacer.frameFinished(StartTime + 32000u, StartTime + 35000u, std::chrono::microseconds{ 0 });
+    // margin is 10% of render time if more than minimum
+    EXPECT_EQ(11000, pacer.getPredictedRenderTime().count());
+}
+
+TEST_F(AFramePacer, excludesTimeBlockedInSwapBuffersFromRenderTime)
+{
+    pacer.frameFinished(StartTime, StartTime + 15000u, std::chrono::microseconds{ 12000 });
+    EXPECT_EQ(static_cast<Int64>(3000u + FramePacer::MinimumSafetyMarginMicroseconds), pacer.getPredictedRenderTime().count());
+}
+
+TEST_F(AFramePacer, forgetsRenderTimeOfOldFrames)
+{
+    UInt64 frameStart = StartTime;
+    pacer.frameFinished(frameStart, frameStart + 10000u, std::chrono::microseconds{ 0 });
+    for (UInt32 i = 0u; i < FramePacer::NumFramesForPrediction; ++i)
+    {
+        frameStart += FrameDuration;
+        pacer.frameFinished(frameStart, frameStart + 2000u, std::chrono::microseconds{ 0 });
+    }
+    EXPECT_EQ(static_cast<Int64>(2000u + FramePacer::MinimumSafetyMarginMicroseconds), pacer.getPredictedRenderTime().count());
+}
+
+TEST_F(AFramePacer, delaysFrameToFinishJustBeforeNextDeadline)
+{
+    const UInt64 frameEnd = StartTime + 2000u;
+    EXPECT_FALSE(pacer.frameFinished(StartTime, frameEnd, std::chrono::microseconds{ 0 }));
+
+    // next deadline is one frame duration after end of first frame
+    const UInt64 predictedRenderTime = 2000u + FramePacer::MinimumSafetyMarginMicroseconds;
+    EXPECT_EQ(static_cast<Int64>(FrameDuration - predictedRenderTime), pacer.getDelayBeforeNextFrame(frameEnd).count());
+    EXPECT_EQ(static_cast<Int64>(FrameDuration - predictedRenderTime - 1000u), pacer.getDelayBeforeNextFrame(frameEnd + 1000u).count());
+}
+
+TEST_F(AFramePacer, doesNotDelayFrameIfPredictedRenderTimeExceedsTimeToDeadline)
+{
+    pacer.frameFinished(StartTime, StartTime + 2000u, std::chrono::microseconds{ 0 });
+    EXPECT_EQ(0, pacer.getDelayBeforeNextFrame(StartTime + 2000u + FrameDuration - 1000u).count());
+    EXPECT_EQ(0, pacer.getDelayBeforeNextFrame(StartTime + 2000u + FrameDuration + 1000u).count());
+}
+
+TEST_F(AFramePacer, keepsDeadlinesInIntervalOfTargetFrameDurationIfFramesFinishEarly)
+{
+    UInt64 deadline = StartTime + 2000u;
+    pacer.frameFinished(StartTime, deadline, std::chrono::microseconds{ 0 });
+
+    for (UInt32 i = 0u; i < 5u; ++i)
+    {
+        deadline += FrameDuration;
+        const UInt64 frameStart = deadline - 3000u;
+        EXPECT_FALSE(pacer.frameFinished(frameStart, deadline - 1000u, std::chrono::microseconds{ 0 }));
+    }
+
+    EXPECT_EQ(static_cast<Int64>(FrameDuration + 1000u) - pacer.getPredictedRenderTime().count(), pacer.getDelayBeforeNextFrame(deadline - 1000u).count());
+}
+
+TEST_F(AFramePacer, followsFramesFinishingSlightlyAfterDeadline)
+{
+    const UInt64 firstFrameEnd = StartTime + 2000u;
+    pacer.frameFinished(StartTime, firstFrameEnd, std::chrono::microseconds{ 0 });
+
+    // swap blocked until vsync that comes later than deadline
+    const UInt64 secondFrameEnd = firstFrameEnd + FrameDuration + 1000u;
+    EXPECT_FALSE(pacer.frameFinished(secondFrameEnd - 3000u, secondFrameEnd, std::chrono::microseconds{ 1000 }));
+
+    EXPECT_EQ(static_cast<Int64>(FrameDuration) - pacer.getPredictedRenderTime().count(), pacer.getDelayBeforeNextFrame(secondFrameEnd).count());
+}
+
+TEST_F(AFramePacer, reportsMissedDeadlineAndStartsOverFromEndOfLateFrame)
+{
+    const UInt64 firstFrameEnd = StartTime + 2000u;
+    pacer.frameFinished(StartTime, firstFrameEnd, std::chrono::microseconds{ 0 });
+
+    const UInt64 lateFrameEnd = firstFrameEnd + FrameDuration + FrameDuration / 2u + 1u;
+    // frame started too late, e.g. renderer thread was not scheduled in time
+    EXPECT_TRUE(pacer.frameFinished(lateFrameEnd - 3000u, lateFrameEnd, std::chrono::microseconds{ 0 }));
+
+    EXPECT_EQ(static_cast<Int64>(FrameDuration) - pacer.getPredictedRenderTime().count(), pacer.getDelayBeforeNextFrame(lateFrameEnd).count());
+    EXPECT_FALSE(pacer.frameFinished(lateFrameEnd, lateFrameEnd + FrameDuration, std::chrono::microseconds{ 0 }));
+}
+
+TEST_F(AFramePacer, startsOverWhenTargetFrameDurationChanges)
+{
+    pacer.frameFinished(StartTime, StartTime + 2000u, std::chrono::microseconds{ 0 });
+    pacer.setTargetFrameDuration(std::chrono::microseconds{ 2 * FrameDuration });
+    EXPECT_EQ(0, pacer.getDelayBeforeNextFrame(StartTime + 2000u).count());
+
+    EXPECT_FALSE(pacer.frameFinished(StartTime + 2000u, StartTime + 4000u, std::chrono::microseconds{ 0 }));
+    EXPECT_EQ(static_cast<Int64>(2 * FrameDuration) - pacer.getPredictedRenderTime().count(), pacer.getDelayBeforeNextFrame(StartTime + 4000u).count());
+}
+
+TEST_F(AFramePacer, forgetsEverythingOnReset)
+{
+    pacer.frameFinished(StartTime, StartTime + 2000u, std::chrono::microseconds{ 0 });
+    pacer.reset();
+    EXPECT_EQ(0, pacer.getDelayBeforeNextFrame(StartTime + 2000u).count());
+    EXPECT_EQ(std::chrono::microseconds{ FrameDuration }, pacer.getPredictedRenderTime());
+}
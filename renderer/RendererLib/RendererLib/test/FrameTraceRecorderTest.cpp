@@ -0,0 +1,154 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererLib/FrameTraceRecorder.h"
+#include "RendererLib/FrameProfilerStatistics.h"
+#include "Collections/StringOutputStream.h"
+#include "Utils/File.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AFrameTraceRecorder : public ::testing::Test
+{
+public:
+    String getChromeTrace() const
+    {
+        StringOutputStream str;
+        recorder.writeChromeTrace(str);
+        return str.release();
+    }
+
+protected:
+    FrameTraceRecorder recorder;
+};
+
+TEST_F(AFrameTraceRecorder, isDisabledByDefaultAndRecordsNothing)
+{
+    EXPECT_FALSE(recorder.isEnabled());
+    recorder.recordRegion(0u, 10u, 5u);
+    recorder.recordSceneFlushApplied(SceneId(1u), 2u, 3u, 10u, 5u);
+    recorder.recordClientResourcesUploaded(1u, 10u, 5u);
+    recorder.markFrameFinished();
+    EXPECT_EQ(0u, recorder.getNumberOfEvents());
+}
+
+TEST_F(AFrameTraceRecorder, recordsEventsInOrderWhenEnabled)
+{
+    recorder.enable();
+    EXPECT_TRUE(recorder.isEnabled());
+
+    recorder.recordRegion(static_cast<UInt32>(FrameProfilerStatistics::ERegion::ApplySceneActions), 100u, 20u);
+    recorder.recordSceneFlushApplied(SceneId(12u), 7u, 33u, 105u, 10u);
+    recorder.markFrameFinished();
+    recorder.recordClientResourcesUploaded(2u, 200u, 50u);
+
+    ASSERT_EQ(3u, recorder.getNumberOfEvents());
+
+    const auto& region = recorder.getEvent(0u);
+    EXPECT_EQ(FrameTraceRecorder::EEventType::Region, region.type);
+    EXPECT_EQ(static_cast<UInt32>(FrameProfilerStatistics::ERegion::ApplySceneActions), region.region);
+    EXPECT_EQ(0u, region.frameId);
+    EXPECT_EQ(100u, region.startTime);
+    EXPECT_EQ(20u, region.duration);
+
+    const auto& flush = recorder.getEvent(1u);
+    EXPECT_EQ(FrameTraceRecorder::EEventType::SceneFlushApplied, flush.type);
+    EXPECT_EQ(12u, flush.id);
+    EXPECT_EQ(7u, flush.value);
+    EXPECT_EQ(33u, flush.count);
+
+    const auto& upload = recorder.getEvent(2u);
+    EXPECT_EQ(FrameTraceRecorder::EEventType::ClientResourcesUploaded, upload.type);
+    EXPECT_EQ(2u, upload.id);
+    EXPECT_EQ(1u, upload.frameId);
+}
+
+TEST_F(AFrameTraceRecorder, keepsOnlyLatestEventsWhenRingBufferIsFull)
+{
+    recorder.enable(3u);
+    for (UInt64 i = 0u; i < 5u; ++i)
+        recorder.recordRegion(0u, i, 1u);
+
+    ASSERT_EQ(3u, recorder.getNumberOfEvents());
+    EXPECT_EQ(2u, recorder.getEvent(0u).startTime);
+    EXPECT_EQ(3u, recorder.getEvent(1u).startTime);
+    EXPECT_EQ(4u, recorder.getEvent(2u).startTime);
+}
+
+TEST_F(AFrameTraceRecorder, discardsEventsWhenDisabled)
+{
+    recorder.enable();
+    recorder.recordRegion(0u, 1u, 1u);
+    recorder.disable();
+    EXPECT_FALSE(recorder.isEnabled());
+    EXPECT_EQ(0u, recorder.getNumberOfEvents());
+}
+
+TEST_F(AFrameTraceRecorder, writesChromeTraceEvents)
+{
+    recorder.enable();
+    recorder.recordRegion(static_cast<UInt32>(FrameProfilerStatistics::ERegion::DrawScenes), 1000u, 250u);
+    recorder.recordSceneFlushApplied(SceneId(12u), 7u, 33u, 1005u, 10u);
+    recorder.recordClientResourcesUploaded(2u, 1100u, 50u);
+
+    const String trace = getChromeTrace();
+    EXPECT_EQ(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_GE(trace.find("\"ph\":\"X\",\"pid\":0,\"ts\":1000,\"dur\":250,\"tid\":0,\"cat\":\"region\",\"name\":\"DrawScenes\""), 0);
+    EXPECT_GE(trace.find("\"scene\":12,\"flushIndex\":7,\"numActions\":33"), 0);
+    EXPECT_GE(trace.find("\"ts\":1100,\"dur\":50,\"tid\":2"), 0);
+    EXPECT_EQ(static_cast<Int>(trace.getLength()) - 2, trace.find("]}"));
+}
+
+TEST_F(AFrameTraceRecorder, dumpsTraceToFileAndClearsEventsOnFrameTimeSpike)
+{
+    recorder.enable();
+    recorder.setSpikeDump(100u, "frameTraceRecorderTest");
+
+    recorder.recordRegion(0u, 1000u, 50u);
+    recorder.recordRegion(1u, 1050u, 40u);
+    recorder.markFrameFinished();
+    recorder.flushDumps();
+    EXPECT_EQ(0u, recorder.getNumberOfDumpedTraces());
+    EXPECT_EQ(2u, recorder.getNumberOfEvents());
+
+    recorder.recordRegion(0u, 2000u, 50u);
+    recorder.recordRegion(1u, 2050u, 60u);
+    recorder.markFrameFinished();
+    EXPECT_EQ(0u, recorder.getNumberOfEvents());
+
+    // file is written by background writer
+    recorder.flushDumps();
+    EXPECT_EQ(1u, recorder.getNumberOfDumpedTraces());
+
+    File dumpFile("frameTraceRecorderTest_1.json");
+    EXPECT_TRUE(dumpFile.exists());
+    dumpFile.remove();
+}
+
+TEST_F(AFrameTraceRecorder, writesDumpRequestedOnDemandWithEventsRecordedSoFar)
+{
+    recorder.enable();
+    recorder.recordRegion(static_cast<UInt32>(FrameProfilerStatistics::ERegion::DrawScenes), 1000u, 250u);
+    EXPECT_TRUE(recorder.dumpToFile("frameTraceRecorderTest_onDemand.json"));
+
+    // events recorded after dump was requested are not part of it
+    recorder.recordRegion(static_cast<UInt32>(FrameProfilerStatistics::ERegion::DrawScenes), 2000u, 250u);
+    recorder.flushDumps();
+    EXPECT_EQ(1u, recorder.getNumberOfDumpedTraces());
+    EXPECT_EQ(2u, recorder.getNumberOfEvents());
+
+    File dumpFile("frameTraceRecorderTest_onDemand.json");
+    ASSERT_TRUE(dumpFile.exists());
+    UInt fileSize = 0u;
+    EXPECT_EQ(EStatus_RAMSES_OK, dumpFile.getSizeInBytes(fileSize));
+    EXPECT_EQ(getChromeTrace().getLength() - String(",{\"ph\":\"X\",\"pid\":0,\"ts\":2000,\"dur\":250,\"tid\":0,\"cat\":\"region\",\"name\":\"DrawScenes\",\"args\":{\"frame\":0}}").getLength(), fileSize);
+    dumpFile.remove();
+}
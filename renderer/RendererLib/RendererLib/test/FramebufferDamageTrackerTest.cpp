@@ -0,0 +1,171 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/FramebufferDamageTracker.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include "Math3d/ProjectionParams.h"
+
+using namespace ramses_internal;
+
+class AFramebufferDamageTracker : public ::testing::Test
+{
+public:
+    AFramebufferDamageTracker()
+        : tracker(fullRegion)
+    {
+    }
+
+protected:
+    const Viewport fullRegion{ 0u, 0u, 100u, 50u };
+    const SceneId scene1{ 1u };
+    const SceneId scene2{ 2u };
+    const FramebufferDamageTracker::SceneRegions scenes{ { scene1, Viewport(0u, 0u, 20u, 10u) }, { scene2, Viewport(50u, 20u, 10u, 10u) } };
+    FramebufferDamageTracker tracker;
+};
+
+TEST_F(AFramebufferDamageTracker, redrawsFullFramebufferInitially)
+{
+    EXPECT_EQ(fullRegion, tracker.startFrame(scenes, 1u));
+    EXPECT_EQ(fullRegion, tracker.getFrameDamage());
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsOnlyRegionOfModifiedScene)
+{
+    tracker.startFrame(scenes, 1u);
+
+    tracker.markSceneModified(scene2);
+    EXPECT_EQ(Viewport(50u, 20u, 10u, 10u), tracker.startFrame(scenes, 1u));
+    EXPECT_EQ(Viewport(50u, 20u, 10u, 10u), tracker.getFrameDamage());
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsUnionOfRegionsOfAllModifiedScenes)
+{
+    tracker.startFrame(scenes, 1u);
+
+    tracker.markSceneModified(scene1);
+    tracker.markSceneModified(scene2);
+    EXPECT_EQ(Viewport(0u, 0u, 60u, 30u), tracker.startFrame(scenes, 1u));
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsPreviousAndCurrentRegionOfSceneWithChangedViewport)
+{
+    tracker.startFrame(scenes, 1u);
+
+    FramebufferDamageTracker::SceneRegions movedScenes = scenes;
+    movedScenes[1].second = Viewport(70u, 20u, 10u, 10u);
+    EXPECT_EQ(Viewport(50u, 20u, 30u, 10u), tracker.startFrame(movedScenes, 1u));
+}
+
+TEST_F(AFramebufferDamageTracker, clipsRegionToFramebuffer)
+{
+    tracker.startFrame(scenes, 1u);
+
+    FramebufferDamageTracker::SceneRegions movedScenes = scenes;
+    movedScenes[1].second = Viewport(90u, 40u, 20u, 20u);
+    EXPECT_EQ(Viewport(50u, 20u, 50u, 30u), tracker.startFrame(movedScenes, 1u));
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsFullFramebufferIfShownScenesChange)
+{
+    tracker.startFrame(scenes, 1u);
+
+    const FramebufferDamageTracker::SceneRegions oneScene{ scenes[0] };
+    EXPECT_EQ(fullRegion, tracker.startFrame(oneScene, 1u));
+
+    const FramebufferDamageTracker::SceneRegions reorderedScenes{ scenes[1], scenes[0] };
+    tracker.startFrame(scenes, 1u);
+    EXPECT_EQ(fullRegion, tracker.startFrame(reorderedScenes, 1u));
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsFullFramebufferWhenMarkedOrWithoutKnownChange)
+{
+    tracker.startFrame(scenes, 1u);
+
+    tracker.markSceneModified(scene1);
+    tracker.markFullRedraw();
+    EXPECT_EQ(fullRegion, tracker.startFrame(scenes, 1u));
+
+    EXPECT_EQ(fullRegion, tracker.startFrame(scenes, 1u));
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsFullFramebufferForBufferWithUndefinedContent)
+{
+    tracker.startFrame(scenes, 1u);
+
+    tracker.markSceneModified(scene1);
+    EXPECT_EQ(fullRegion, tracker.startFrame(scenes, 0u));
+    EXPECT_EQ(Viewport(0u, 0u, 20u, 10u), tracker.getFrameDamage());
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsDamageOfAllFramesSinceBackBufferWasRendered)
+{
+    tracker.startFrame(scenes, 1u);
+    tracker.markSceneModified(scene1);
+    tracker.startFrame(scenes, 1u);
+
+    tracker.markSceneModified(scene2);
+    EXPECT_EQ(Viewport(0u, 0u, 60u, 30u), tracker.startFrame(scenes, 2u));
+}
+
+TEST_F(AFramebufferDamageTracker, redrawsFullFramebufferForBufferOlderThanDamageHistory)
+{
+    tracker.startFrame(scenes, 1u);
+    for (UInt32 i = 0u; i < FramebufferDamageTracker::MaxBufferAge; ++i)
+    {
+        tracker.markSceneModified(scene1);
+        tracker.startFrame(scenes, 1u);
+    }
+
+    tracker.markSceneModified(scene1);
+    EXPECT_EQ(Viewport(0u, 0u, 20u, 10u), tracker.startFrame(scenes, FramebufferDamageTracker::MaxBufferAge));
+    tracker.markSceneModified(scene1);
+    EXPECT_EQ(fullRegion, tracker.startFrame(scenes, FramebufferDamageTracker::MaxBufferAge + 1u));
+}
+
+TEST_F(AFramebufferDamageTracker, computesUnionAndIntersectionOfRegions)
+{
+    const Viewport region1(0u, 0u, 20u, 10u);
+    const Viewport region2(10u, 5u, 20u, 10u);
+    const Viewport emptyRegion(0u, 0u, 0u, 0u);
+
+    EXPECT_EQ(Viewport(0u, 0u, 30u, 15u), FramebufferDamageTracker::UniteRegions(region1, region2));
+    EXPECT_EQ(region1, FramebufferDamageTracker::UniteRegions(region1, emptyRegion));
+    EXPECT_EQ(region2, FramebufferDamageTracker::UniteRegions(emptyRegion, region2));
+
+    EXPECT_EQ(Viewport(10u, 5u, 10u, 5u), FramebufferDamageTracker::IntersectRegions(region1, region2));
+    EXPECT_TRUE(FramebufferDamageTracker::IsEmptyRegion(FramebufferDamageTracker::IntersectRegions(region1, Viewport(20u, 0u, 5u, 5u))));
+}
+
+TEST_F(AFramebufferDamageTracker, projectsBoundsToRegionOfViewport)
+{
+    const BoundingBox bounds(Vector3(-0.5f, -0.5f, 0.f), Vector3(0.5f, 0.5f, 0.f));
+    // one pixel border around projected bounds
+    EXPECT_EQ(Viewport(24u, 11u, 52u, 28u), FramebufferDamageTracker::ProjectBoundsToRegion(bounds, Matrix44f::Identity, fullRegion));
+    EXPECT_EQ(Viewport(34u, 21u, 52u, 28u), FramebufferDamageTracker::ProjectBoundsToRegion(bounds, Matrix44f::Identity, Viewport(10u, 10u, 100u, 50u)));
+
+    const Matrix44f translation = Matrix44f::Translation(Vector3(1.f, 0.f, 0.f));
+    EXPECT_EQ(Viewport(74u, 11u, 26u, 28u), FramebufferDamageTracker::ProjectBoundsToRegion(bounds, translation, fullRegion));
+}
+
+TEST_F(AFramebufferDamageTracker, projectsBoundsOutsideOfViewportToEmptyRegion)
+{
+    const BoundingBox bounds(Vector3(2.f, 2.f, 0.f), Vector3(3.f, 3.f, 0.f));
+    EXPECT_TRUE(FramebufferDamageTracker::IsEmptyRegion(FramebufferDamageTracker::ProjectBoundsToRegion(bounds, Matrix44f::Identity, fullRegion)));
+}
+
+TEST_F(AFramebufferDamageTracker, projectsUnknownBoundsOrBoundsBehindCameraToWholeViewport)
+{
+    EXPECT_EQ(fullRegion, FramebufferDamageTracker::ProjectBoundsToRegion(BoundingBox(), Matrix44f::Identity, fullRegion));
+
+    const Matrix44f perspectiveProjection = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(90.f, 2.f, 0.1f, 100.f));
+    const BoundingBox boundsInFront(Vector3(-0.1f, -0.1f, -10.f), Vector3(0.1f, 0.1f, -5.f));
+    EXPECT_NE(fullRegion, FramebufferDamageTracker::ProjectBoundsToRegion(boundsInFront, perspectiveProjection, fullRegion));
+    const BoundingBox boundsCrossingCameraPlane(Vector3(-0.1f, -0.1f, -10.f), Vector3(0.1f, 0.1f, 5.f));
+    EXPECT_EQ(fullRegion, FramebufferDamageTracker::ProjectBoundsToRegion(boundsCrossingCameraPlane, perspectiveProjection, fullRegion));
+}
@@ -0,0 +1,219 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/GpuTimerQueries.h"
+#include "RendererLib/RendererStatistics.h"
+#include "DeviceMock.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AGpuTimerQueries : public ::testing::Test
+{
+public:
+    AGpuTimerQueries()
+        : queries(device)
+    {
+    }
+
+protected:
+    // writes timestamps for scene with one render pass and one blit pass, timestamp values are taken from query handle values
+    void renderScene(SceneId sceneId, UInt32 firstQuery)
+    {
+        EXPECT_CALL(device, writeGpuTimestamp())
+            .WillOnce(Return(DeviceResourceHandle(firstQuery)))
+            .WillOnce(Return(DeviceResourceHandle(firstQuery + 1u)))
+            .WillOnce(Return(DeviceResourceHandle(firstQuery + 2u)));
+        queries.sceneStarted(sceneId);
+        queries.passFinished(RenderingPassInfo(renderPass));
+        queries.passFinished(RenderingPassInfo(blitPass));
+        Mock::VerifyAndClearExpectations(&device);
+        expectNoDisjointTimer();
+    }
+
+    void expectNoDisjointTimer()
+    {
+        EXPECT_CALL(device, isGpuTimerDisjoint()).Times(AnyNumber()).WillRepeatedly(Return(false));
+    }
+
+    void expectQueriesFinished(UInt32 firstQuery, UInt64 sceneStart, UInt64 renderPassEnd, UInt64 blitPassEnd)
+    {
+        InSequence seq;
+        EXPECT_CALL(device, finishGpuTimestamp(DeviceResourceHandle(firstQuery))).WillOnce(Return(sceneStart));
+        EXPECT_CALL(device, finishGpuTimestamp(DeviceResourceHandle(firstQuery + 1u))).WillOnce(Return(renderPassEnd));
+        EXPECT_CALL(device, finishGpuTimestamp(DeviceResourceHandle(firstQuery + 2u))).WillOnce(Return(blitPassEnd));
+    }
+
+    bool logOutputContains(const String& str)
+    {
+        stats.frameFinished(0u);
+        StringOutputStream strstr;
+        stats.writeStatsToStream(strstr);
+        return strstr.release().find(str) >= 0;
+    }
+
+    StrictMock<DeviceMock> device;
+    GpuTimerQueries queries;
+    RendererStatistics stats;
+    const SceneId scene1{ 11u };
+    const SceneId scene2{ 22u };
+    const RenderPassHandle renderPass{ 1u };
+    const BlitPassHandle blitPass{ 2u };
+};
+
+TEST_F(AGpuTimerQueries, hasNoPendingQueriesInitially)
+{
+    EXPECT_FALSE(queries.hasPendingQueries());
+    queries.resolveQueries(stats);
+    EXPECT_FALSE(logOutputContains("gpuTime"));
+}
+
+TEST_F(AGpuTimerQueries, reportsGpuTimeOfSceneAndItsPassesWhenAvailable)
+{
+    renderScene(scene1, 10u);
+    EXPECT_TRUE(queries.hasPendingQueries());
+
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(true));
+    expectQueriesFinished(10u, 1000000u, 1300000u, 1500000u);
+    queries.resolveQueries(stats);
+
+    EXPECT_FALSE(queries.hasPendingQueries());
+    EXPECT_TRUE(logOutputContains("Scene 11: "));
+    EXPECT_TRUE(logOutputContains("gpuTime us (500/500/500.000000), RP1 (300/300/300.000000), BP2 (200/200/200.000000)"));
+}
+
+TEST_F(AGpuTimerQueries, reportsGpuTimeOfEachSceneSeparately)
+{
+    renderScene(scene1, 10u);
+    renderScene(scene2, 20u);
+
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(22u))).WillOnce(Return(true));
+    expectQueriesFinished(10u, 1000000u, 1100000u, 1200000u);
+    expectQueriesFinished(20u, 1200000u, 1600000u, 2000000u);
+    queries.resolveQueries(stats);
+
+    EXPECT_TRUE(logOutputContains("gpuTime us (200/200/200.000000), RP1 (100/100/100.000000), BP2 (100/100/100.000000)"));
+    EXPECT_TRUE(logOutputContains("gpuTime us (800/800/800.000000), RP1 (400/400/400.000000), BP2 (400/400/400.000000)"));
+}
+
+TEST_F(AGpuTimerQueries, sumsUpGpuTimeOfSceneRenderedInSeveralPartsWithinFrame)
+{
+    renderScene(scene1, 10u);
+    // rendering resumed after interruption
+    renderScene(scene1, 20u);
+
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(22u))).WillOnce(Return(true));
+    expectQueriesFinished(10u, 1000000u, 1100000u, 1200000u);
+    expectQueriesFinished(20u, 5000000u, 5200000u, 5300000u);
+    queries.resolveQueries(stats);
+
+    EXPECT_TRUE(logOutputContains("gpuTime us (500/500/500.000000), RP1 (300/300/300.000000), BP2 (200/200/200.000000)"));
+}
+
+TEST_F(AGpuTimerQueries, keepsQueriesPendingUntilAvailable)
+{
+    renderScene(scene1, 10u);
+
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(false));
+    queries.resolveQueries(stats);
+    EXPECT_TRUE(queries.hasPendingQueries());
+    EXPECT_FALSE(logOutputContains("gpuTime"));
+
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(true));
+    expectQueriesFinished(10u, 1000000u, 1300000u, 1500000u);
+    queries.resolveQueries(stats);
+    EXPECT_FALSE(queries.hasPendingQueries());
+    EXPECT_TRUE(logOutputContains("gpuTime us (500/500/500.000000)"));
+}
+
+TEST_F(AGpuTimerQueries, resolvesQueriesOfOlderFramesFirst)
+{
+    renderScene(scene1, 10u);
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(false));
+    queries.resolveQueries(stats);
+
+    renderScene(scene2, 20u);
+    {
+        InSequence seq;
+        EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(true));
+        EXPECT_CALL(device, finishGpuTimestamp(_)).Times(3u).WillRepeatedly(Return(0u));
+        EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(22u))).WillOnce(Return(false));
+    }
+    queries.resolveQueries(stats);
+    EXPECT_TRUE(queries.hasPendingQueries());
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_CALL(device, finishGpuTimestamp(_)).Times(3u);
+    queries.discardQueries();
+}
+
+TEST_F(AGpuTimerQueries, forcesResolvingQueriesAfterMaximumNumberOfFramesPending)
+{
+    renderScene(scene1, 10u);
+    for (UInt32 i = 0u; i < GpuTimerQueries::MaxFramesToResolve; ++i)
+    {
+        EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(false));
+        queries.resolveQueries(stats);
+        Mock::VerifyAndClearExpectations(&device);
+        expectNoDisjointTimer();
+    }
+
+    expectQueriesFinished(10u, 1000000u, 1300000u, 1500000u);
+    queries.resolveQueries(stats);
+    EXPECT_FALSE(queries.hasPendingQueries());
+    EXPECT_TRUE(logOutputContains("gpuTime us (500/500/500.000000)"));
+}
+
+TEST_F(AGpuTimerQueries, discardsAllQueriesWithoutReporting)
+{
+    renderScene(scene1, 10u);
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(false));
+    queries.resolveQueries(stats);
+    renderScene(scene2, 20u);
+
+    EXPECT_CALL(device, finishGpuTimestamp(_)).Times(6u);
+    queries.discardQueries();
+    EXPECT_FALSE(queries.hasPendingQueries());
+    EXPECT_FALSE(logOutputContains("gpuTime"));
+}
+
+TEST_F(AGpuTimerQueries, dropsAllPendingFramesWithoutReportingIfTimerWasDisjoint)
+{
+    renderScene(scene1, 10u);
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(false));
+    queries.resolveQueries(stats);
+    renderScene(scene2, 20u);
+
+    EXPECT_CALL(device, isGpuTimerDisjoint()).WillOnce(Return(true));
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(12u))).WillOnce(Return(true));
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(22u))).WillOnce(Return(false));
+    EXPECT_CALL(device, finishGpuTimestamp(_)).Times(3u).WillRepeatedly(Return(0u));
+    queries.resolveQueries(stats);
+    EXPECT_FALSE(logOutputContains("gpuTime"));
+    Mock::VerifyAndClearExpectations(&device);
+
+    // frame pending during disjoint operation is dropped even though it is resolved later
+    expectNoDisjointTimer();
+    EXPECT_CALL(device, isGpuTimestampAvailable(DeviceResourceHandle(22u))).WillOnce(Return(true));
+    EXPECT_CALL(device, finishGpuTimestamp(_)).Times(3u).WillRepeatedly(Return(0u));
+    queries.resolveQueries(stats);
+    EXPECT_FALSE(queries.hasPendingQueries());
+    EXPECT_FALSE(logOutputContains("gpuTime"));
+}
+
+TEST_F(AGpuTimerQueries, stopsMeasuringIfDeviceDoesNotSupportTimerQueries)
+{
+    EXPECT_CALL(device, writeGpuTimestamp()).WillOnce(Return(DeviceResourceHandle::Invalid()));
+    queries.sceneStarted(scene1);
+    queries.passFinished(RenderingPassInfo(renderPass));
+    queries.passFinished(RenderingPassInfo(blitPass));
+
+    EXPECT_FALSE(queries.hasPendingQueries());
+    queries.resolveQueries(stats);
+    EXPECT_FALSE(logOutputContains("gpuTime"));
+}
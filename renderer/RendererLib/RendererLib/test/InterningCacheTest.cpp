@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/InterningCache.h"
+#include "RendererLib/RenderStateCache.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AnInterningCache : public ::testing::Test
+{
+protected:
+    InterningCache<UInt64> cache;
+};
+
+TEST_F(AnInterningCache, isEmptyInitially)
+{
+    EXPECT_EQ(0u, cache.getUniqueCount());
+    EXPECT_EQ(0u, cache.getRequestedCount());
+}
+
+TEST_F(AnInterningCache, givesSameIdToEqualValues)
+{
+    bool isNew = false;
+    const UInt32 id1 = cache.acquire(13u, &isNew);
+    EXPECT_TRUE(isNew);
+    const UInt32 id2 = cache.acquire(13u, &isNew);
+    EXPECT_FALSE(isNew);
+    const UInt32 id3 = cache.acquire(14u, &isNew);
+    EXPECT_TRUE(isNew);
+
+    EXPECT_EQ(id1, id2);
+    EXPECT_NE(id1, id3);
+    EXPECT_EQ(13u, cache.getValue(id1));
+    EXPECT_EQ(14u, cache.getValue(id3));
+    EXPECT_EQ(2u, cache.getReferenceCount(id1));
+    EXPECT_EQ(2u, cache.getUniqueCount());
+    EXPECT_EQ(3u, cache.getRequestedCount());
+}
+
+TEST_F(AnInterningCache, keepsValueUntilLastReferenceReleased)
+{
+    const UInt32 id = cache.acquire(13u);
+    cache.acquire(13u);
+
+    EXPECT_FALSE(cache.release(id));
+    EXPECT_EQ(1u, cache.getUniqueCount());
+    EXPECT_EQ(13u, cache.getValue(id));
+
+    EXPECT_TRUE(cache.release(id));
+    EXPECT_EQ(0u, cache.getUniqueCount());
+    EXPECT_EQ(0u, cache.getRequestedCount());
+    EXPECT_EQ(0u, cache.getReferenceCount(id));
+}
+
+TEST_F(AnInterningCache, reusesIdOfReleasedValue)
+{
+    const UInt32 id1 = cache.acquire(13u);
+    const UInt32 id2 = cache.acquire(14u);
+    cache.release(id1);
+
+    bool isNew = false;
+    const UInt32 id3 = cache.acquire(15u, &isNew);
+    EXPECT_TRUE(isNew);
+    EXPECT_EQ(id1, id3);
+    EXPECT_EQ(15u, cache.getValue(id3));
+    EXPECT_EQ(14u, cache.getValue(id2));
+
+    // released value is new again
+    cache.acquire(13u, &isNew);
+    EXPECT_TRUE(isNew);
+    EXPECT_EQ(3u, cache.getUniqueCount());
+}
+
+TEST(ARenderStateCache, internsRenderStatesByValue)
+{
+    RenderStateCache cache;
+    RenderState renderState;
+    const UInt32 id1 = cache.acquire(RenderStateBlock(renderState));
+    const UInt32 id2 = cache.acquire(RenderStateBlock(renderState));
+    EXPECT_EQ(id1, id2);
+
+    renderState.stencilRefValue = 7u;
+    const UInt32 id3 = cache.acquire(RenderStateBlock(renderState));
+    EXPECT_NE(id1, id3);
+    EXPECT_EQ(7u, cache.getValue(id3).depthStencilState.m_stencilRefValue);
+
+    renderState.stencilRefValue = 0u;
+    renderState.colorWriteMask = EColorWriteFlag_Red;
+    const UInt32 id4 = cache.acquire(RenderStateBlock(renderState));
+    EXPECT_NE(id1, id4);
+    EXPECT_NE(id3, id4);
+    EXPECT_EQ(3u, cache.getUniqueCount());
+}
@@ -11,6 +11,7 @@
 #include "RendererLib/LatencyMonitor.h"
 #include "RendererEventCollector.h"
 #include "PlatformAbstraction/PlatformThread.h"
+#include "Collections/StringOutputStream.h"
 
 using namespace testing;
 using namespace ramses_internal;
@@ -352,3 +353,138 @@ TEST_F(ALatencyMonitor, stopsMonitoringScene)
     latencyMonitor.checkLatency(currentFakeTime + std::chrono::milliseconds(10));
     expectNoEvent();
 }
+
+TEST_F(ALatencyMonitor, hasNoLatencyHistogramsForSceneWithoutAppliedFlush)
+{
+    EXPECT_EQ(nullptr, latencyMonitor.getLatencyHistograms(scene1));
+    latencyMonitor.recordSceneRendered(scene1, DisplayHandle(0u), currentFakeTime);
+    latencyMonitor.recordFramebufferSwapped(DisplayHandle(0u), currentFakeTime);
+    EXPECT_EQ(nullptr, latencyMonitor.getLatencyHistograms(scene1));
+}
+
+TEST_F(ALatencyMonitor, recordsFlushToApplyToRenderToSwapLatencies)
+{
+    const DisplayHandle display(1u);
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime + std::chrono::microseconds(1000), true);
+    latencyMonitor.recordSceneRendered(scene1, display, currentFakeTime + std::chrono::microseconds(3000));
+    latencyMonitor.recordFramebufferSwapped(display, currentFakeTime + std::chrono::microseconds(3010));
+
+    const SceneLatencyHistograms* histograms = latencyMonitor.getLatencyHistograms(scene1);
+    ASSERT_TRUE(histograms != nullptr);
+    EXPECT_EQ(1u, histograms->flushToApply.getNumSamples());
+    EXPECT_EQ(1000u, histograms->flushToApply.getMaximum());
+    EXPECT_EQ(1u, histograms->applyToRender.getNumSamples());
+    EXPECT_EQ(2000u, histograms->applyToRender.getMaximum());
+    EXPECT_EQ(1u, histograms->renderToSwap.getNumSamples());
+    EXPECT_EQ(10u, histograms->renderToSwap.getMaximum());
+
+    // does not monitor latency limit
+    EXPECT_FALSE(latencyMonitor.isMonitoringScene(scene1));
+}
+
+TEST_F(ALatencyMonitor, recordsRenderLatencyOnlyForRenderingWithNewContent)
+{
+    const DisplayHandle display(1u);
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime, true);
+    latencyMonitor.recordSceneRendered(scene1, display, currentFakeTime + std::chrono::microseconds(100));
+    latencyMonitor.recordFramebufferSwapped(display, currentFakeTime + std::chrono::microseconds(200));
+
+    // rerendered without any new flush
+    latencyMonitor.recordSceneRendered(scene1, display, currentFakeTime + std::chrono::microseconds(300));
+    latencyMonitor.recordFramebufferSwapped(display, currentFakeTime + std::chrono::microseconds(400));
+
+    const SceneLatencyHistograms* histograms = latencyMonitor.getLatencyHistograms(scene1);
+    ASSERT_TRUE(histograms != nullptr);
+    EXPECT_EQ(1u, histograms->applyToRender.getNumSamples());
+    EXPECT_EQ(1u, histograms->renderToSwap.getNumSamples());
+}
+
+TEST_F(ALatencyMonitor, measuresRenderLatencyFromFirstOfMoreFlushesAppliedBeforeRendering)
+{
+    const DisplayHandle display(1u);
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime, true);
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime + std::chrono::microseconds(500), true);
+    latencyMonitor.recordSceneRendered(scene1, display, currentFakeTime + std::chrono::microseconds(700));
+
+    const SceneLatencyHistograms* histograms = latencyMonitor.getLatencyHistograms(scene1);
+    ASSERT_TRUE(histograms != nullptr);
+    EXPECT_EQ(2u, histograms->flushToApply.getNumSamples());
+    EXPECT_EQ(1u, histograms->applyToRender.getNumSamples());
+    EXPECT_EQ(700u, histograms->applyToRender.getMaximum());
+}
+
+TEST_F(ALatencyMonitor, doesNotRecordRenderLatencyForFlushesNotNeedingRendering)
+{
+    const DisplayHandle display(1u);
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime, false);
+    latencyMonitor.recordFlushApplied(scene2, currentFakeTime, currentFakeTime, true);
+    latencyMonitor.recordFlushNotRendered(scene2);
+    latencyMonitor.recordSceneRendered(scene1, display, currentFakeTime + std::chrono::microseconds(700));
+    latencyMonitor.recordSceneRendered(scene2, display, currentFakeTime + std::chrono::microseconds(700));
+    latencyMonitor.recordFramebufferSwapped(display, currentFakeTime + std::chrono::microseconds(800));
+
+    for (const auto scene : { scene1, scene2 })
+    {
+        const SceneLatencyHistograms* histograms = latencyMonitor.getLatencyHistograms(scene);
+        ASSERT_TRUE(histograms != nullptr);
+        EXPECT_EQ(1u, histograms->flushToApply.getNumSamples());
+        EXPECT_EQ(0u, histograms->applyToRender.getNumSamples());
+        EXPECT_EQ(0u, histograms->renderToSwap.getNumSamples());
+    }
+}
+
+TEST_F(ALatencyMonitor, recordsSwapLatencyOnlyForDisplayWhereSceneWasRendered)
+{
+    const DisplayHandle display1(1u);
+    const DisplayHandle display2(2u);
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime, true);
+    latencyMonitor.recordFlushApplied(scene2, currentFakeTime, currentFakeTime, true);
+    latencyMonitor.recordSceneRendered(scene1, display1, currentFakeTime + std::chrono::microseconds(100));
+    latencyMonitor.recordSceneRendered(scene2, display2, currentFakeTime + std::chrono::microseconds(100));
+    latencyMonitor.recordFramebufferSwapped(display2, currentFakeTime + std::chrono::microseconds(150));
+
+    EXPECT_EQ(0u, latencyMonitor.getLatencyHistograms(scene1)->renderToSwap.getNumSamples());
+    EXPECT_EQ(1u, latencyMonitor.getLatencyHistograms(scene2)->renderToSwap.getNumSamples());
+    EXPECT_EQ(50u, latencyMonitor.getLatencyHistograms(scene2)->renderToSwap.getMaximum());
+
+    latencyMonitor.recordFramebufferSwapped(display1, currentFakeTime + std::chrono::microseconds(400));
+    EXPECT_EQ(1u, latencyMonitor.getLatencyHistograms(scene1)->renderToSwap.getNumSamples());
+    EXPECT_EQ(300u, latencyMonitor.getLatencyHistograms(scene1)->renderToSwap.getMaximum());
+    EXPECT_EQ(1u, latencyMonitor.getLatencyHistograms(scene2)->renderToSwap.getNumSamples());
+}
+
+TEST_F(ALatencyMonitor, recordsZeroLatencyIfFlushTimeStampIsAheadOfRendererClock)
+{
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime + std::chrono::milliseconds(5), currentFakeTime, true);
+    EXPECT_EQ(1u, latencyMonitor.getLatencyHistograms(scene1)->flushToApply.getNumSamples());
+    EXPECT_EQ(0u, latencyMonitor.getLatencyHistograms(scene1)->flushToApply.getMaximum());
+}
+
+TEST_F(ALatencyMonitor, canResetLatencyHistograms)
+{
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime + std::chrono::microseconds(1000), true);
+    latencyMonitor.resetLatencyHistograms();
+    EXPECT_EQ(0u, latencyMonitor.getLatencyHistograms(scene1)->flushToApply.getNumSamples());
+}
+
+TEST_F(ALatencyMonitor, removesLatencyHistogramsWhenStoppingMonitoringScene)
+{
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime, true);
+    latencyMonitor.stopMonitoringScene(scene1);
+    EXPECT_EQ(nullptr, latencyMonitor.getLatencyHistograms(scene1));
+}
+
+TEST_F(ALatencyMonitor, writesLatencyHistogramsOfAllScenesToStream)
+{
+    latencyMonitor.recordFlushApplied(scene1, currentFakeTime, currentFakeTime + std::chrono::microseconds(20), true);
+    latencyMonitor.recordFlushApplied(scene2, currentFakeTime, currentFakeTime + std::chrono::microseconds(30), true);
+
+    StringOutputStream str;
+    latencyMonitor.writeLatencyHistogramsToStream(str);
+    const String expectedScene1 = "\n  scene 22: flushToApply [n:1 min:20 mean:20 p50:20 p90:20 p99:20 p99.9:20 max:20] applyToRender [n:0] renderToSwap [n:0]";
+    const String expectedScene2 = "\n  scene 23: flushToApply [n:1 min:30 mean:30 p50:30 p90:30 p99:30 p99.9:30 max:30] applyToRender [n:0] renderToSwap [n:0]";
+    const String output(str.c_str());
+    EXPECT_EQ(0, output.find("Scene latencies (us):"));
+    EXPECT_LT(0, output.find(expectedScene1));
+    EXPECT_LT(0, output.find(expectedScene2));
+}
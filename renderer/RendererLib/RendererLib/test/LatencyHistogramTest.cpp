@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/LatencyHistogram.h"
+#include "Collections/StringOutputStream.h"
+#include <algorithm>
+
+using namespace testing;
+using namespace ramses_internal;
+
+class ALatencyHistogram : public ::testing::Test
+{
+protected:
+    LatencyHistogram histogram;
+};
+
+TEST_F(ALatencyHistogram, isEmptyInitially)
+{
+    EXPECT_EQ(0u, histogram.getNumSamples());
+    EXPECT_EQ(0u, histogram.getMinimum());
+    EXPECT_EQ(0u, histogram.getMaximum());
+    EXPECT_EQ(0u, histogram.getMean());
+    EXPECT_EQ(0u, histogram.getValueAtPercentile(50.f));
+}
+
+TEST_F(ALatencyHistogram, mapsSmallValuesToOwnBuckets)
+{
+    for (UInt64 value = 0u; value < LatencyHistogram::SubBucketCount; ++value)
+    {
+        const UInt32 bucket = LatencyHistogram::GetBucketIndex(value);
+        EXPECT_EQ(value, bucket);
+        EXPECT_EQ(value, LatencyHistogram::GetBucketLowerBound(bucket));
+        EXPECT_EQ(value, LatencyHistogram::GetBucketUpperBound(bucket));
+    }
+}
+
+TEST_F(ALatencyHistogram, mapsEveryValueToBucketContainingIt)
+{
+    const UInt64 values[] = { 32u, 33u, 63u, 64u, 65u, 100u, 1000u, 16666u, 33333u, 1000000u, 123456789u, LatencyHistogram::MaxTrackableValue };
+    for (const auto value : values)
+    {
+        const UInt32 bucket = LatencyHistogram::GetBucketIndex(value);
+        EXPECT_LT(bucket, LatencyHistogram::BucketCount);
+        EXPECT_LE(LatencyHistogram::GetBucketLowerBound(bucket), value);
+        EXPECT_GE(LatencyHistogram::GetBucketUpperBound(bucket), value);
+    }
+}
+
+TEST_F(ALatencyHistogram, hasContinuousBucketsWithBoundedRelativeError)
+{
+    for (UInt32 bucket = 1u; bucket < LatencyHistogram::BucketCount; ++bucket)
+    {
+        EXPECT_EQ(LatencyHistogram::GetBucketUpperBound(bucket - 1u) + 1u, LatencyHistogram::GetBucketLowerBound(bucket));
+        const UInt64 lower = LatencyHistogram::GetBucketLowerBound(bucket);
+        const UInt64 width = LatencyHistogram::GetBucketUpperBound(bucket) - lower + 1u;
+        EXPECT_LE(width * LatencyHistogram::HalfSubBucketCount, std::max<UInt64>(lower, LatencyHistogram::HalfSubBucketCount));
+    }
+    EXPECT_EQ(LatencyHistogram::MaxTrackableValue, LatencyHistogram::GetBucketUpperBound(LatencyHistogram::BucketCount - 1u));
+}
+
+TEST_F(ALatencyHistogram, tracksMinMaxAndMean)
+{
+    histogram.record(100u);
+    histogram.record(300u);
+    histogram.record(200u);
+
+    EXPECT_EQ(3u, histogram.getNumSamples());
+    EXPECT_EQ(100u, histogram.getMinimum());
+    EXPECT_EQ(300u, histogram.getMaximum());
+    EXPECT_EQ(200u, histogram.getMean());
+}
+
+TEST_F(ALatencyHistogram, reportsPercentilesWithinBucketPrecision)
+{
+    for (UInt64 value = 1u; value <= 1000u; ++value)
+        histogram.record(value * 10u);
+
+    const auto expectNear = [this](UInt64 expected, Float percentile)
+    {
+        const UInt64 value = histogram.getValueAtPercentile(percentile);
+        EXPECT_GE(value, expected);
+        EXPECT_LE(value, expected + expected / LatencyHistogram::HalfSubBucketCount);
+    };
+    expectNear(5000u, 50.f);
+    expectNear(9000u, 90.f);
+    expectNear(9900u, 99.f);
+    EXPECT_EQ(10000u, histogram.getValueAtPercentile(100.f));
+    EXPECT_EQ(10u, histogram.getValueAtPercentile(0.f));
+}
+
+TEST_F(ALatencyHistogram, neverReportsPercentileOutsideOfRecordedRange)
+{
+    histogram.record(1001u);
+    EXPECT_EQ(1001u, histogram.getValueAtPercentile(1.f));
+    EXPECT_EQ(1001u, histogram.getValueAtPercentile(50.f));
+    EXPECT_EQ(1001u, histogram.getValueAtPercentile(99.9f));
+}
+
+TEST_F(ALatencyHistogram, clampsValuesAboveTrackableRange)
+{
+    histogram.record(LatencyHistogram::MaxTrackableValue + 12345u);
+    EXPECT_EQ(LatencyHistogram::MaxTrackableValue, histogram.getMaximum());
+    EXPECT_EQ(LatencyHistogram::MaxTrackableValue, histogram.getValueAtPercentile(50.f));
+}
+
+TEST_F(ALatencyHistogram, canBeReset)
+{
+    histogram.record(10u);
+    histogram.record(20000u);
+    histogram.reset();
+
+    EXPECT_EQ(0u, histogram.getNumSamples());
+    EXPECT_EQ(0u, histogram.getMaximum());
+    EXPECT_EQ(0u, histogram.getValueAtPercentile(99.f));
+
+    histogram.record(50u);
+    EXPECT_EQ(50u, histogram.getMinimum());
+    EXPECT_EQ(50u, histogram.getValueAtPercentile(99.f));
+}
+
+TEST_F(ALatencyHistogram, providesSummary)
+{
+    histogram.record(10u);
+    histogram.record(20u);
+
+    const LatencySummary summary = histogram.getSummary();
+    EXPECT_EQ(2u, summary.numSamples);
+    EXPECT_EQ(10u, summary.minimum);
+    EXPECT_EQ(20u, summary.maximum);
+    EXPECT_EQ(15u, summary.mean);
+    EXPECT_EQ(10u, summary.percentile50);
+    EXPECT_EQ(20u, summary.percentile90);
+    EXPECT_EQ(20u, summary.percentile99);
+    EXPECT_EQ(20u, summary.percentile999);
+
+    StringOutputStream str;
+    histogram.writeSummaryToStream(str);
+    EXPECT_STREQ("n:2 min:10 mean:15 p50:10 p90:20 p99:20 p99.9:20 max:20", str.c_str());
+}
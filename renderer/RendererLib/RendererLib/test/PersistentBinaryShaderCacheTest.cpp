@@ -0,0 +1,258 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/PersistentBinaryShaderCache.h"
+#include "Utils/File.h"
+#include "Utils/FileUtils.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <memory>
+
+using namespace ramses_internal;
+
+namespace
+{
+    const Char* const CacheDirectory = "persistentBinaryShaderCacheTest";
+    const Char* const DriverIdentification = "vendor gpu 1.0";
+    const ResourceContentHash EffectHash1(11u, 0u);
+    const ResourceContentHash EffectHash2(12u, 0u);
+    const UInt8 ShaderData1[] = { 12u, 34u, 56u, 78u };
+    const UInt8 ShaderData2[] = { 13u, 14u, 66u, 7u, 89u, 10u };
+    const UInt32 Format1 = 123u;
+    const UInt32 Format2 = 112u;
+}
+
+class APersistentBinaryShaderCache : public testing::Test
+{
+public:
+    APersistentBinaryShaderCache()
+    {
+        startNextRun();
+        m_cache->deviceInitialized(DriverIdentification);
+        m_cache->flush();
+    }
+
+    virtual ~APersistentBinaryShaderCache()
+    {
+        m_cache.reset();
+        File directory(CacheDirectory);
+        FileUtils::RemoveDirectory(directory);
+    }
+
+    // simulates restart of renderer, all pending writes are finished when previous cache is destroyed
+    void startNextRun()
+    {
+        m_cache.reset();
+        m_cache.reset(new PersistentBinaryShaderCache(CacheDirectory));
+    }
+
+    void storeBinaryShaders()
+    {
+        m_cache->storeBinaryShader(EffectHash1, ShaderData1, sizeof(ShaderData1), Format1);
+        m_cache->storeBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+        m_cache->flush();
+    }
+
+    void removeEntryFiles()
+    {
+        File(m_cache->getEntryFilePath(EffectHash1)).remove();
+        File(m_cache->getEntryFilePath(EffectHash2)).remove();
+    }
+
+    void expectBinaryShader(ResourceContentHash effectHash, const UInt8* data, UInt32 dataSize, UInt32 format)
+    {
+        ASSERT_TRUE(m_cache->hasBinaryShader(effectHash));
+        ASSERT_EQ(dataSize, m_cache->getBinaryShaderSize(effectHash));
+        EXPECT_EQ(format, m_cache->getBinaryShaderFormat(effectHash));
+
+        UInt8Vector buffer(dataSize);
+        m_cache->getBinaryShaderData(effectHash, buffer.data(), dataSize);
+        EXPECT_EQ(0, PlatformMemory::Compare(data, buffer.data(), dataSize));
+    }
+
+protected:
+    std::unique_ptr<PersistentBinaryShaderCache> m_cache;
+};
+
+TEST_F(APersistentBinaryShaderCache, doesNotCacheBinaryShadersBeforeDeviceInitialized)
+{
+    startNextRun();
+    EXPECT_FALSE(m_cache->shouldBinaryShaderBeCached(EffectHash1));
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+}
+
+TEST_F(APersistentBinaryShaderCache, providesStoredBinaryShaders)
+{
+    EXPECT_TRUE(m_cache->shouldBinaryShaderBeCached(EffectHash1));
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+
+    storeBinaryShaders();
+    expectBinaryShader(EffectHash1, ShaderData1, sizeof(ShaderData1), Format1);
+    expectBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+}
+
+TEST_F(APersistentBinaryShaderCache, writesEveryBinaryShaderToItsOwnFile)
+{
+    storeBinaryShaders();
+    EXPECT_TRUE(File(m_cache->getEntryFilePath(EffectHash1)).exists());
+    EXPECT_TRUE(File(m_cache->getEntryFilePath(EffectHash2)).exists());
+    EXPECT_NE(m_cache->getEntryFilePath(EffectHash1), m_cache->getEntryFilePath(EffectHash2));
+}
+
+TEST_F(APersistentBinaryShaderCache, providesBinaryShadersStoredInPreviousRun)
+{
+    storeBinaryShaders();
+
+    startNextRun();
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->flush();
+    expectBinaryShader(EffectHash1, ShaderData1, sizeof(ShaderData1), Format1);
+    expectBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+}
+
+TEST_F(APersistentBinaryShaderCache, doesNotProvideBinaryShadersOfOtherDriver)
+{
+    storeBinaryShaders();
+
+    startNextRun();
+    m_cache->deviceInitialized("vendor gpu 2.0");
+    m_cache->flush();
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash2));
+}
+
+TEST_F(APersistentBinaryShaderCache, keepsDriverOfFirstInitializedDevice)
+{
+    const String firstEntryFilePath = m_cache->getEntryFilePath(EffectHash1);
+    m_cache->deviceInitialized("vendor gpu 2.0");
+    EXPECT_EQ(firstEntryFilePath, m_cache->getEntryFilePath(EffectHash1));
+}
+
+TEST_F(APersistentBinaryShaderCache, loadsBinaryShadersOfEffectsInStartupManifestAheadOfTime)
+{
+    storeBinaryShaders();
+    EXPECT_TRUE(File(m_cache->getManifestFilePath()).exists());
+
+    startNextRun();
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->flush();
+
+    // binaries were loaded before they were requested, files are not needed anymore
+    removeEntryFiles();
+    expectBinaryShader(EffectHash1, ShaderData1, sizeof(ShaderData1), Format1);
+    expectBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+}
+
+TEST_F(APersistentBinaryShaderCache, listsOnlyEffectsUsedInLastRunInStartupManifest)
+{
+    storeBinaryShaders();
+
+    startNextRun();
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->binaryShaderUploaded(EffectHash2, true);
+    m_cache->flush();
+
+    startNextRun();
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->flush();
+
+    removeEntryFiles();
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+    expectBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+}
+
+TEST_F(APersistentBinaryShaderCache, doesNotLoadBinaryShadersAheadOfTimeWithoutStartupManifest)
+{
+    storeBinaryShaders();
+    File(m_cache->getManifestFilePath()).remove();
+
+    startNextRun();
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->flush();
+
+    // files are not read on lookup either
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash2));
+}
+
+TEST_F(APersistentBinaryShaderCache, ignoresCorruptFile)
+{
+    storeBinaryShaders();
+    {
+        File file(m_cache->getEntryFilePath(EffectHash1));
+        UInt fileSize = 0u;
+        ASSERT_EQ(EStatus_RAMSES_OK, file.getSizeInBytes(fileSize));
+        ASSERT_EQ(EStatus_RAMSES_OK, file.open(EFileMode_WriteExistingBinary));
+        ASSERT_EQ(EStatus_RAMSES_OK, file.seek(fileSize - 1u, EFileSeekOrigin_BeginningOfFile));
+        const Char corruptByte = 0;
+        ASSERT_EQ(EStatus_RAMSES_OK, file.write(&corruptByte, 1u));
+        file.close();
+    }
+
+    startNextRun();
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->flush();
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+    expectBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+}
+
+TEST_F(APersistentBinaryShaderCache, removesBinaryShaderWhichFailedToUpload)
+{
+    storeBinaryShaders();
+
+    m_cache->binaryShaderUploaded(EffectHash1, false);
+    m_cache->flush();
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+    EXPECT_FALSE(File(m_cache->getEntryFilePath(EffectHash1)).exists());
+    expectBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+
+    // recompiled binary replaces the broken one
+    m_cache->storeBinaryShader(EffectHash1, ShaderData2, sizeof(ShaderData2), Format2);
+    m_cache->flush();
+    EXPECT_TRUE(File(m_cache->getEntryFilePath(EffectHash1)).exists());
+    expectBinaryShader(EffectHash1, ShaderData2, sizeof(ShaderData2), Format2);
+}
+
+TEST_F(APersistentBinaryShaderCache, replacesFileOfBinaryShaderStoredAgain)
+{
+    storeBinaryShaders();
+    m_cache->storeBinaryShader(EffectHash1, ShaderData2, sizeof(ShaderData2), Format2);
+    m_cache->flush();
+    EXPECT_FALSE(File(m_cache->getEntryFilePath(EffectHash1) + ".tmp").exists());
+
+    startNextRun();
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->flush();
+    expectBinaryShader(EffectHash1, ShaderData2, sizeof(ShaderData2), Format2);
+}
+
+TEST_F(APersistentBinaryShaderCache, evictsOldestBinaryShadersBeyondMemoryLimit)
+{
+    m_cache.reset();
+    m_cache.reset(new PersistentBinaryShaderCache(CacheDirectory, sizeof(ShaderData2)));
+    m_cache->deviceInitialized(DriverIdentification);
+    storeBinaryShaders();
+
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash1));
+    expectBinaryShader(EffectHash2, ShaderData2, sizeof(ShaderData2), Format2);
+    // evicted binary is still written
+    EXPECT_TRUE(File(m_cache->getEntryFilePath(EffectHash1)).exists());
+}
+
+TEST_F(APersistentBinaryShaderCache, loadsBinaryShadersAheadOfTimeOnlyUpToMemoryLimit)
+{
+    storeBinaryShaders();
+
+    m_cache.reset();
+    m_cache.reset(new PersistentBinaryShaderCache(CacheDirectory, sizeof(ShaderData1)));
+    m_cache->deviceInitialized(DriverIdentification);
+    m_cache->flush();
+
+    expectBinaryShader(EffectHash1, ShaderData1, sizeof(ShaderData1), Format1);
+    EXPECT_FALSE(m_cache->hasBinaryShader(EffectHash2));
+}
@@ -0,0 +1,150 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/RenderBufferPool.h"
+#include "DeviceMock.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class ARenderBufferPool : public ::testing::Test
+{
+public:
+    ARenderBufferPool()
+        : pool(160u)
+    {
+    }
+
+    ~ARenderBufferPool()
+    {
+        EXPECT_CALL(device, deleteRenderBuffer(_)).Times(AnyNumber());
+        pool.deleteRetainedBuffers(device);
+    }
+
+protected:
+    DeviceResourceHandle acquireNew(const RenderBuffer& renderBuffer, DeviceResourceHandle deviceHandle)
+    {
+        EXPECT_CALL(device, uploadRenderBuffer(Eq(renderBuffer))).WillOnce(Return(deviceHandle));
+        const DeviceResourceHandle acquiredHandle = pool.acquire(device, renderBuffer);
+        Mock::VerifyAndClearExpectations(&device);
+        return acquiredHandle;
+    }
+
+    StrictMock<DeviceMock> device;
+    RenderBufferPool pool;
+
+    // 64 bytes each
+    const RenderBuffer colorBuffer{ 4u, 4u, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u };
+    const RenderBuffer depthBuffer{ 4u, 4u, ERenderBufferType_DepthStencilBuffer, ETextureFormat_Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, 0u };
+    // 256 bytes, larger than whole pool
+    const RenderBuffer multisampledBuffer{ 4u, 4u, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_WriteOnly, 4u };
+};
+
+TEST_F(ARenderBufferPool, computesRenderBufferByteSizeIncludingSamples)
+{
+    EXPECT_EQ(64u, RenderBufferPool::GetRenderBufferByteSize(colorBuffer));
+    EXPECT_EQ(64u, RenderBufferPool::GetRenderBufferByteSize(depthBuffer));
+    EXPECT_EQ(256u, RenderBufferPool::GetRenderBufferByteSize(multisampledBuffer));
+}
+
+TEST_F(ARenderBufferPool, reusesReleasedBufferOfEqualDescription)
+{
+    const DeviceResourceHandle handle = acquireNew(colorBuffer, DeviceResourceHandle(1u));
+    pool.release(device, handle);
+    EXPECT_EQ(1u, pool.getRetainedBufferCount());
+    EXPECT_EQ(64u, pool.getRetainedSize());
+
+    EXPECT_EQ(handle, pool.acquire(device, colorBuffer));
+    EXPECT_EQ(0u, pool.getRetainedBufferCount());
+    EXPECT_EQ(0u, pool.getRetainedSize());
+
+    EXPECT_EQ(1u, pool.getStatistics().hits);
+    EXPECT_EQ(1u, pool.getStatistics().misses);
+}
+
+TEST_F(ARenderBufferPool, doesNotReuseReleasedBufferOfDifferentDescription)
+{
+    const DeviceResourceHandle colorHandle = acquireNew(colorBuffer, DeviceResourceHandle(1u));
+    pool.release(device, colorHandle);
+
+    EXPECT_EQ(DeviceResourceHandle(2u), acquireNew(depthBuffer, DeviceResourceHandle(2u)));
+    EXPECT_EQ(1u, pool.getRetainedBufferCount());
+    EXPECT_EQ(0u, pool.getStatistics().hits);
+    EXPECT_EQ(2u, pool.getStatistics().misses);
+}
+
+TEST_F(ARenderBufferPool, reusesMostRecentlyReleasedBufferFirst)
+{
+    const DeviceResourceHandle handle1 = acquireNew(colorBuffer, DeviceResourceHandle(1u));
+    const DeviceResourceHandle handle2 = acquireNew(colorBuffer, DeviceResourceHandle(2u));
+    pool.release(device, handle1);
+    pool.release(device, handle2);
+
+    EXPECT_EQ(handle2, pool.acquire(device, colorBuffer));
+    EXPECT_EQ(handle1, pool.acquire(device, colorBuffer));
+}
+
+TEST_F(ARenderBufferPool, deletesLeastRecentlyReleasedBuffersWhenRetentionSizeExceeded)
+{
+    const DeviceResourceHandle handle1 = acquireNew(colorBuffer, DeviceResourceHandle(1u));
+    const DeviceResourceHandle handle2 = acquireNew(depthBuffer, DeviceResourceHandle(2u));
+    const DeviceResourceHandle handle3 = acquireNew(colorBuffer, DeviceResourceHandle(3u));
+
+    pool.release(device, handle1);
+    pool.release(device, handle2);
+    EXPECT_CALL(device, deleteRenderBuffer(handle1));
+    pool.release(device, handle3);
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_EQ(2u, pool.getRetainedBufferCount());
+    EXPECT_EQ(128u, pool.getRetainedSize());
+    EXPECT_EQ(1u, pool.getStatistics().evictedBuffers);
+    EXPECT_EQ(64u, pool.getStatistics().evictedBytes);
+}
+
+TEST_F(ARenderBufferPool, deletesReleasedBufferLargerThanRetentionSize)
+{
+    const DeviceResourceHandle handle = acquireNew(multisampledBuffer, DeviceResourceHandle(1u));
+
+    EXPECT_CALL(device, deleteRenderBuffer(handle));
+    pool.release(device, handle);
+    Mock::VerifyAndClearExpectations(&device);
+    EXPECT_EQ(0u, pool.getRetainedBufferCount());
+    EXPECT_EQ(0u, pool.getStatistics().evictedBuffers);
+}
+
+TEST_F(ARenderBufferPool, deletesAllRetainedBuffers)
+{
+    const DeviceResourceHandle handle1 = acquireNew(colorBuffer, DeviceResourceHandle(1u));
+    const DeviceResourceHandle handle2 = acquireNew(depthBuffer, DeviceResourceHandle(2u));
+    pool.release(device, handle1);
+    pool.release(device, handle2);
+
+    EXPECT_CALL(device, deleteRenderBuffer(handle1));
+    EXPECT_CALL(device, deleteRenderBuffer(handle2));
+    pool.deleteRetainedBuffers(device);
+    Mock::VerifyAndClearExpectations(&device);
+    EXPECT_EQ(0u, pool.getRetainedBufferCount());
+    EXPECT_EQ(0u, pool.getRetainedSize());
+}
+
+TEST(ARenderBufferPoolWithoutRetention, allocatesAndDeletesBuffersDirectly)
+{
+    StrictMock<DeviceMock> device;
+    RenderBufferPool pool(0u);
+    const RenderBuffer colorBuffer(4u, 4u, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u);
+
+    EXPECT_CALL(device, uploadRenderBuffer(Eq(colorBuffer))).Times(2).WillRepeatedly(Return(DeviceResourceHandle(1u)));
+    EXPECT_CALL(device, deleteRenderBuffer(DeviceResourceHandle(1u))).Times(2);
+    pool.release(device, pool.acquire(device, colorBuffer));
+    pool.release(device, pool.acquire(device, colorBuffer));
+
+    EXPECT_EQ(0u, pool.getRetainedBufferCount());
+    EXPECT_EQ(0u, pool.getStatistics().hits);
+    EXPECT_EQ(2u, pool.getStatistics().misses);
+}
@@ -110,7 +110,7 @@ namespace ramses_internal
     {
         ASSERT_EQ(&m_scene, &m_executorState.getScene());
 
-        RendererCachedScene otherScene(m_sceneLinksManager, SceneInfo(SceneId(33u)));
+        RendererCachedScene otherScene(m_sceneLinksManager, m_rendererScenes.getRenderStateCache(), m_rendererScenes.getTextureSamplerStatesCache(), SceneInfo(SceneId(33u)));
         m_executorState.setScene(otherScene);
         ASSERT_EQ(&otherScene, &m_executorState.getScene());
     }
@@ -15,6 +15,7 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/Renderer.h"
 #include "RendererLib/RendererScenes.h"
+#include "RendererLib/GpuTimerQueries.h"
 #include "SceneUtils/DataLayoutCreationHelper.h"
 #include "RendererEventCollector.h"
 #include "SceneAllocateHelper.h"
@@ -285,6 +286,63 @@ protected:
         return renderable;
     }
 
+    DataLayoutHandle createInstanceBatchingUniformLayout(UInt32 instanceModelMatricesCount)
+    {
+        DataFieldInfoVector dataFields(2u);
+        dataFields[0] = DataFieldInfo(EDataType_Vector4F, 1u, EFixedSemantics_Invalid);
+        dataFields[1] = DataFieldInfo(EDataType_Matrix44F, instanceModelMatricesCount, EFixedSemantics_InstanceModelMatrices);
+        return sceneAllocator.allocateDataLayout(dataFields);
+    }
+
+    DataInstanceHandle createInstanceBatchingGeometry()
+    {
+        // test data instance uses per instance attributes, which cannot be batched
+        const DataInstanceHandle geometry = createTestDataInstance().second;
+        scene.setDataResource(geometry, vertPosField, ResourceProviderMock::FakeVertArrayHash, DataBufferHandle::Invalid(), 0u);
+        scene.setDataResource(geometry, vertTexcoordField, ResourceProviderMock::FakeVertArrayHash2, DataBufferHandle::Invalid(), 0u);
+        return geometry;
+    }
+
+    DataInstanceHandle createInstanceBatchingUniforms(DataLayoutHandle layout, const Vector4& color)
+    {
+        const DataInstanceHandle uniforms = sceneAllocator.allocateDataInstance(layout);
+        scene.setDataSingleVector4f(uniforms, DataFieldHandle(0u), color);
+        return uniforms;
+    }
+
+    RenderableHandle createBatchableRenderable(DataInstanceHandle uniforms, DataInstanceHandle geometry, RenderGroupHandle group, Int32 order)
+    {
+        const RenderableHandle renderable = createTestRenderable({ uniforms, geometry });
+        scene.addRenderableToRenderGroup(group, renderable, order);
+        const TransformHandle transform = addTransformToRenderable(renderable);
+        scene.setTranslation(transform, Vector3(static_cast<Float>(order), 0.f, 0.f));
+        return renderable;
+    }
+
+    void allowAllDeviceCallsExceptDrawCalls()
+    {
+        EXPECT_CALL(device, activateRenderTarget(_)).Times(AnyNumber());
+        EXPECT_CALL(device, setViewport(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, depthFunc(_)).Times(AnyNumber());
+        EXPECT_CALL(device, depthWrite(_)).Times(AnyNumber());
+        EXPECT_CALL(device, stencilFunc(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, stencilOp(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, blendOperations(_, _)).Times(AnyNumber());
+        EXPECT_CALL(device, blendFactors(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, colorMask(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, cullMode(_)).Times(AnyNumber());
+        EXPECT_CALL(device, drawMode(_)).Times(AnyNumber());
+        EXPECT_CALL(device, activateShader(_)).Times(AnyNumber());
+        EXPECT_CALL(device, activateVertexBuffer(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, activateIndexBuffer(_)).Times(AnyNumber());
+        EXPECT_CALL(device, activateTexture(_, _)).Times(AnyNumber());
+        EXPECT_CALL(device, setTextureSampling(_, _, _, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, setConstant(_, _, Matcher<const Float*>(_))).Times(AnyNumber());
+        EXPECT_CALL(device, setConstant(_, _, Matcher<const Vector4*>(_))).Times(AnyNumber());
+        EXPECT_CALL(device, setConstant(_, _, Matcher<const Matrix22f*>(_))).Times(AnyNumber());
+        EXPECT_CALL(device, setConstant(_, _, Matcher<const Matrix44f*>(_))).Times(AnyNumber());
+    }
+
     TransformHandle addTransformToNode(NodeHandle node)
     {
         return sceneAllocator.allocateTransform(node);
@@ -374,7 +432,11 @@ protected:
         EXPECT_CALL(device, setConstant(fieldCameraViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedCameraViewMatrix)))))        .RetiresOnSaturation();
         EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                    .RetiresOnSaturation();
         EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureField))                                                                         .RetiresOnSaturation();
-        EXPECT_CALL(device, setTextureSampling(textureField, EWrapMethod_Clamp, EWrapMethod_Repeat, EWrapMethod_RepeatMirrored, ESamplingMethod_NearestWithMipmaps, 2u)).RetiresOnSaturation();
+        // all test renderables use same texture with same sampler states, so like the shader sampling is set only for first renderable
+        if (expectShaderActivation)
+        {
+            EXPECT_CALL(device, setTextureSampling(textureField, EWrapMethod_Clamp, EWrapMethod_Repeat, EWrapMethod_RepeatMirrored, ESamplingMethod_NearestWithMipmaps, 2u)).RetiresOnSaturation();
+        }
         EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const Float*>(Pointee(Eq(-666.f)))))                                           .RetiresOnSaturation();
         EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const Matrix22f*>(Pointee(Eq(Matrix22f(1,2,3,4))))))                   .RetiresOnSaturation();
         if (expectIndexBufferActivation)
@@ -439,11 +501,11 @@ protected:
         Mock::VerifyAndClearExpectations(&renderer);
     }
 
-    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr)
+    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr, GpuTimerQueries* gpuTimerQueries = nullptr)
     {
         const Viewport vp(fakeViewportX, fakeViewportY, fakeViewportWidth, fakeViewportHeight);
         const FrameBufferInfo fbInfo(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, projectionParams, vp);
-        RenderExecutor executor(device, fbInfo, renderFrom, frameTimer);
+        RenderExecutor executor(device, fbInfo, renderFrom, frameTimer, gpuTimerQueries);
 
         return executor.executeScene(scene, Matrix44f::Identity);
     }
@@ -822,6 +884,29 @@ TEST_F(ARenderExecutor, RenderStatesAppliedForEachRenderableIfDifferent)
     Mock::VerifyAndClearExpectations(&device);
 }
 
+TEST_F(ARenderExecutor, TextureSamplingAppliedAgainOnlyIfTextureUsedWithDifferentSamplerStates)
+{
+    const RenderPassHandle renderPass1 = createRenderPassWithCamera();
+    const RenderPassHandle renderPass2 = createRenderPassWithCamera();
+    const RenderPassHandle renderPass3 = createRenderPassWithCamera();
+    createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass1));
+    createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass2));
+    const DataInstances dataInstances = createTestDataInstance();
+    const TextureSamplerHandle otherSampler = sceneAllocator.allocateTextureSampler({ { EWrapMethod_Repeat, EWrapMethod_Repeat, EWrapMethod_Repeat, ESamplingMethod_Bilinear, 1u }, ResourceProviderMock::FakeTextureHash });
+    scene.setDataTextureSamplerHandle(dataInstances.first, textureField, otherSampler);
+    createTestRenderable(dataInstances, createRenderGroup(renderPass3));
+
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    EXPECT_CALL(device, setTextureSampling(textureField, EWrapMethod_Clamp, EWrapMethod_Repeat, EWrapMethod_RepeatMirrored, ESamplingMethod_NearestWithMipmaps, 2u));
+    EXPECT_CALL(device, setTextureSampling(textureField, EWrapMethod_Repeat, EWrapMethod_Repeat, EWrapMethod_Repeat, ESamplingMethod_Bilinear, 1u));
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(3u);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
 // ############################
 // Confidence testing
 // Needed for internal render loop because of high importance
@@ -940,6 +1025,41 @@ TEST_F(ARenderExecutor, ActivatesRenderTargetForRenderPassAfterExecutingBlitPass
     updateScenes();
 }
 
+TEST_F(ARenderExecutor, writesGpuTimestampsAtSceneStartAndAfterEachPass)
+{
+    const RenderBufferHandle sourceRenderBuffer = createRenderbuffer();
+    const RenderBufferHandle destinationRenderBuffer = createRenderbuffer();
+    const BlitPassHandle blitPass = createBlitPass(sourceRenderBuffer, destinationRenderBuffer);
+    const RenderPassHandle renderPass = createRenderPassWithCamera();
+
+    scene.setRenderPassRenderOrder(renderPass, 0);
+    scene.setBlitPassRenderOrder(blitPass, 1);
+    updateScenes();
+
+    GpuTimerQueries gpuTimerQueries(device);
+    {
+        InSequence s;
+        EXPECT_CALL(device, writeGpuTimestamp());
+        //render pass
+        EXPECT_CALL(device, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle));
+        EXPECT_CALL(device, setViewport(_, _, _, _));
+        EXPECT_CALL(device, writeGpuTimestamp());
+        //blit pass
+        EXPECT_CALL(device, blitRenderTargets(_, _, _, _, _));
+        EXPECT_CALL(device, writeGpuTimestamp());
+    }
+
+    executeScene({}, nullptr, &gpuTimerQueries);
+
+    EXPECT_CALL(device, finishGpuTimestamp(DeviceMock::FakeGpuTimestampDeviceHandle)).Times(3u);
+    gpuTimerQueries.discardQueries();
+
+    scene.releaseRenderBuffer(sourceRenderBuffer);
+    scene.releaseRenderBuffer(destinationRenderBuffer);
+    scene.releaseBlitPass(blitPass);
+    updateScenes();
+}
+
 TEST_F(ARenderExecutor, willRenderAllRenderablesIfWithinTimeBudget)
 {
     const RenderPassHandle pass1 = createRenderPassWithCamera(ECameraProjectionType_Perspective);
@@ -1112,4 +1232,166 @@ TEST_F(ARenderExecutor, willContinueRenderingWhereLeftOffLastRenderWhenInterrupt
     renderIterator = executeScene(renderIterator, &frameTimer);
     EXPECT_EQ(SceneRenderExecutionIterator(), renderIterator); // finished
 }
+
+TEST_F(ARenderExecutor, drawsRenderablesOneByOneIfInstanceBatchingDisabled)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometry = createInstanceBatchingGeometry();
+    const DataInstanceHandle uniforms = createInstanceBatchingUniforms(createInstanceBatchingUniformLayout(4u), Vector4(1.f));
+    for (Int32 i = 0; i < 3; ++i)
+        createBatchableRenderable(uniforms, geometry, group, i);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(3u);
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, batchesEqualRenderablesToSingleInstancedDrawCallWithTheirModelMatrices)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    scene.setRenderPassInstanceBatching(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometry = createInstanceBatchingGeometry();
+    const DataLayoutHandle layout = createInstanceBatchingUniformLayout(4u);
+    // renderables with own but equal uniforms can be batched as well as renderables sharing uniforms
+    const DataInstanceHandle uniforms1 = createInstanceBatchingUniforms(layout, Vector4(1.f));
+    const DataInstanceHandle uniforms2 = createInstanceBatchingUniforms(layout, Vector4(1.f));
+    createBatchableRenderable(uniforms1, geometry, group, 0);
+    createBatchableRenderable(uniforms1, geometry, group, 1);
+    createBatchableRenderable(uniforms2, geometry, group, 2);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    const auto hasBatchedModelMatrices = [](const Matrix44f* matrices)
+    {
+        return matrices[0] == Matrix44f::Translation(Vector3(0.f, 0.f, 0.f))
+            && matrices[1] == Matrix44f::Translation(Vector3(1.f, 0.f, 0.f))
+            && matrices[2] == Matrix44f::Translation(Vector3(2.f, 0.f, 0.f));
+    };
+    {
+        InSequence seq;
+        // only matrices of batched instances are uploaded, not whole array
+        EXPECT_CALL(device, setConstant(DataFieldHandle(1u), 3u, Matcher<const Matrix44f*>(Truly(hasBatchedModelMatrices))));
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 3u));
+    }
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, uploadsOnlyOwnModelMatrixForRenderableNotBatched)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometry = createInstanceBatchingGeometry();
+    const DataInstanceHandle uniforms = createInstanceBatchingUniforms(createInstanceBatchingUniformLayout(4u), Vector4(1.f));
+    createBatchableRenderable(uniforms, geometry, group, 0);
+    createBatchableRenderable(uniforms, geometry, group, 1);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    {
+        InSequence seq;
+        EXPECT_CALL(device, setConstant(DataFieldHandle(1u), 1u, Matcher<const Matrix44f*>(Pointee(Matrix44f::Translation(Vector3(0.f, 0.f, 0.f))))));
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u));
+        EXPECT_CALL(device, setConstant(DataFieldHandle(1u), 1u, Matcher<const Matrix44f*>(Pointee(Matrix44f::Translation(Vector3(1.f, 0.f, 0.f))))));
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u));
+    }
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, startsNewInstanceBatchWhenUniformValuesDiffer)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    scene.setRenderPassInstanceBatching(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometry = createInstanceBatchingGeometry();
+    const DataLayoutHandle layout = createInstanceBatchingUniformLayout(4u);
+    const DataInstanceHandle uniforms1 = createInstanceBatchingUniforms(layout, Vector4(1.f));
+    const DataInstanceHandle uniforms2 = createInstanceBatchingUniforms(layout, Vector4(0.5f));
+    createBatchableRenderable(uniforms1, geometry, group, 0);
+    createBatchableRenderable(uniforms1, geometry, group, 1);
+    createBatchableRenderable(uniforms2, geometry, group, 2);
+    createBatchableRenderable(uniforms1, geometry, group, 3);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    {
+        InSequence seq;
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 2u));
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2u);
+    }
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, limitsInstanceBatchToSizeOfModelMatricesArray)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    scene.setRenderPassInstanceBatching(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometry = createInstanceBatchingGeometry();
+    const DataInstanceHandle uniforms = createInstanceBatchingUniforms(createInstanceBatchingUniformLayout(4u), Vector4(1.f));
+    for (Int32 i = 0; i < 6; ++i)
+        createBatchableRenderable(uniforms, geometry, group, i);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    {
+        InSequence seq;
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 4u));
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 2u));
+    }
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, doesNotBatchRenderablesWithoutInstanceModelMatricesSemantic)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    scene.setRenderPassInstanceBatching(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+    // test data instance uses model matrix semantic, which differs per renderable
+    const DataInstanceHandle uniforms = createTestDataInstance().first;
+    const DataInstanceHandle geometry = createInstanceBatchingGeometry();
+    for (Int32 i = 0; i < 3; ++i)
+        createBatchableRenderable(uniforms, geometry, group, i);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(3u);
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, doesNotBatchRenderablesWithPerInstanceVertexAttributes)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    scene.setRenderPassInstanceBatching(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometry = createTestDataInstance().second;
+    const DataInstanceHandle uniforms = createInstanceBatchingUniforms(createInstanceBatchingUniformLayout(4u), Vector4(1.f));
+    for (Int32 i = 0; i < 3; ++i)
+        createBatchableRenderable(uniforms, geometry, group, i);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(3u);
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, doesNotBatchRenderablesWithMultipleInstances)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    scene.setRenderPassInstanceBatching(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometry = createInstanceBatchingGeometry();
+    const DataInstanceHandle uniforms = createInstanceBatchingUniforms(createInstanceBatchingUniformLayout(4u), Vector4(1.f));
+    const RenderableHandle renderable1 = createBatchableRenderable(uniforms, geometry, group, 0);
+    const RenderableHandle renderable2 = createBatchableRenderable(uniforms, geometry, group, 1);
+    scene.setRenderableInstanceCount(renderable1, 2u);
+    scene.setRenderableInstanceCount(renderable2, 2u);
+    updateScenes();
+
+    allowAllDeviceCallsExceptDrawCalls();
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 2u)).Times(2u);
+    executeScene();
+}
 }
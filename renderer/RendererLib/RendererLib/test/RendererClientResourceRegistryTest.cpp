@@ -110,6 +110,18 @@ TEST_F(ARendererResourceRegistry, canRemoveSceneUsageRef)
     EXPECT_TRUE(rd.sceneUsage.empty());
 }
 
+TEST_F(ARendererResourceRegistry, storesFrameOfLastSceneUsage)
+{
+    const SceneId sceneId(11u);
+    const ResourceContentHash resource(123u, 0u);
+    registry.registerResource(resource);
+    EXPECT_EQ(0u, registry.getResourceDescriptor(resource).lastUsedFrameCounter);
+
+    registry.addResourceRef(resource, sceneId);
+    registry.removeResourceRef(resource, sceneId, 42u);
+    EXPECT_EQ(42u, registry.getResourceDescriptor(resource).lastUsedFrameCounter);
+}
+
 TEST_F(ARendererResourceRegistry, canChangeResourceStatus)
 {
     const ResourceContentHash resource(123u, 0u);
@@ -37,7 +37,7 @@ TEST_F(ARendererCommandBuffer, gracefullyHandlesSceneActionsArrivingAfterUnsubsc
     const Guid clientID(true);
 
     queue.publishScene(sceneId, clientID);
-    queue.receiveScene(SceneInfo(sceneId));
+    queue.receiveScene(SceneInfo(sceneId), Guid(), false);
 
     queue.unsubscribeScene(sceneId, false);
 
@@ -100,7 +100,7 @@ TEST_F(ARendererCommandBuffer, canFetchAllTypesOfRendererCommands)
     //fill queue which is to be fetched by the RendererCommandBuffer
     queueToFetch.publishScene(sceneId, clientID);
     queueToFetch.unpublishScene(sceneId);
-    queueToFetch.receiveScene(sceneInfo);
+    queueToFetch.receiveScene(sceneInfo, Guid(), false);
     queueToFetch.subscribeScene(sceneId);
     queueToFetch.unsubscribeScene(sceneId, false);
     queueToFetch.createDisplay(displayConfig, resourceProvider, resourceUploader, displayHandle);
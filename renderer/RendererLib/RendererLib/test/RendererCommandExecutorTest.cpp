@@ -65,7 +65,7 @@ public:
         StrictMock<DisplayControllerMock>& displayControllerMock = getDisplayControllerMock(handle);
         EXPECT_CALL(displayControllerMock, getDisplayWidth()).Times(times);
         EXPECT_CALL(displayControllerMock, getDisplayHeight()).Times(times);
-        EXPECT_CALL(displayControllerMock, readPixels(_, _, _, _, _)).Times(times);
+        EXPECT_CALL(displayControllerMock, startReadPixels(_, _, _, _)).Times(times);
     }
 
     void expectReadPixelsInRenderLoop(DisplayHandle handle = DisplayHandle(0u))
@@ -123,7 +123,7 @@ public:
         const Guid clientID(true);
         m_commandBuffer.publishScene(sceneId, clientID);
         m_commandBuffer.subscribeScene(sceneId);
-        m_commandBuffer.receiveScene(SceneInfo(sceneId));
+        m_commandBuffer.receiveScene(SceneInfo(sceneId), Guid(), false);
 
         //receive initial flush
         SceneActionCollection sceneActions;
@@ -131,7 +131,7 @@ public:
         creator.flush(1u, false, false);
         m_commandBuffer.enqueueActionsForScene(sceneId, sceneActions.copy());
 
-        EXPECT_CALL(m_sceneGraphConsumerComponent, subscribeScene(clientID, sceneId));
+        EXPECT_CALL(m_sceneGraphConsumerComponent, subscribeScene(clientID, sceneId, Guid(), 0u));
         EXPECT_CALL(m_sceneUpdater, handleSceneActions(sceneId, SceneActionCollectionEq(sceneActions)));
         doCommandExecutorLoop();
 
@@ -369,7 +369,7 @@ TEST_P(ARendererCommandExecutor, readPixelsFromDisplay)
         EXPECT_CALL(m_platformFactoryMock.windowEventsPollingManagerMock, pollWindowsTillAnyCanRender());
     EXPECT_CALL(displayControllerMock, handleWindowEvents());
     EXPECT_CALL(displayControllerMock, canRenderNewFrame()).WillOnce(Return(true));
-    EXPECT_CALL(displayControllerMock, readPixels(x, y, width, height, _)).WillOnce(Return(true));
+    EXPECT_CALL(displayControllerMock, startReadPixels(x, y, width, height));
     expectReadPixelsInRenderLoop(); // needed overhead calls
     m_renderer.doOneRenderLoop();
 
@@ -377,6 +377,8 @@ TEST_P(ARendererCommandExecutor, readPixelsFromDisplay)
     m_rendererEventCollector.dispatchEvents(events);
     EXPECT_EQ(0u, events.size()); // Events are added by WindowedRenderer
 
+    // read back still pending is released with display
+    EXPECT_CALL(displayControllerMock, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, width, height, _));
     removeDisplayController(dummyDisplay);
 }
 
@@ -399,6 +401,20 @@ TEST_P(ARendererCommandExecutor, createsReadPixelsFailedEventIfTryingToReadPixel
     EXPECT_EQ(ERendererEventType_ReadPixelsFromFramebufferFailed, events.front().eventType);
 }
 
+TEST_P(ARendererCommandExecutor, createsReadPixelsFailedEventIfTryingToReadPixelsPeriodicallyFromInvalidDisplay)
+{
+    const DisplayHandle dummyDisplay(1u);
+
+    m_commandBuffer.readPixelsPeriodically(dummyDisplay, 1u, 2u, 3u, 4u, 5u);
+    doCommandExecutorLoop();
+
+    RendererEventVector events;
+    m_rendererEventCollector.dispatchEvents(events);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(dummyDisplay, events.front().displayHandle);
+    EXPECT_EQ(ERendererEventType_ReadPixelsFromFramebufferFailed, events.front().eventType);
+}
+
 TEST_P(ARendererCommandExecutor, readAndSavePixelsFromDisplay)
 {
     const DisplayHandle dummyDisplay = addDisplayController();
@@ -416,7 +432,7 @@ TEST_P(ARendererCommandExecutor, readAndSavePixelsFromDisplay)
         EXPECT_CALL(m_platformFactoryMock.windowEventsPollingManagerMock, pollWindowsTillAnyCanRender());
     EXPECT_CALL(displayControllerMock, handleWindowEvents());
     EXPECT_CALL(displayControllerMock, canRenderNewFrame()).WillOnce(Return(true));
-    EXPECT_CALL(displayControllerMock, readPixels(x, y, width, height, _)).WillOnce(Return(true));
+    EXPECT_CALL(displayControllerMock, startReadPixels(x, y, width, height));
     expectReadPixelsInRenderLoop(); // needed overhead calls
     m_renderer.doOneRenderLoop();
 
@@ -424,6 +440,7 @@ TEST_P(ARendererCommandExecutor, readAndSavePixelsFromDisplay)
     m_rendererEventCollector.dispatchEvents(events);
     EXPECT_EQ(0u, events.size()); // events are only added by the WindowedRenderer
 
+    EXPECT_CALL(displayControllerMock, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, width, height, _));
     removeDisplayController(dummyDisplay);
 }
 
@@ -442,7 +459,7 @@ TEST_P(ARendererCommandExecutor, readAndSaveFullscreenPixelsFromDisplay)
         EXPECT_CALL(m_platformFactoryMock.windowEventsPollingManagerMock, pollWindowsTillAnyCanRender());
     EXPECT_CALL(displayControllerMock, handleWindowEvents());
     EXPECT_CALL(displayControllerMock, canRenderNewFrame()).WillOnce(Return(true));
-    EXPECT_CALL(displayControllerMock, readPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight, _)).WillOnce(Return(true));
+    EXPECT_CALL(displayControllerMock, startReadPixels(0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight));
     expectReadPixelsInRenderLoop(); // needed overhead calls
     m_renderer.doOneRenderLoop();
 
@@ -450,6 +467,7 @@ TEST_P(ARendererCommandExecutor, readAndSaveFullscreenPixelsFromDisplay)
     m_rendererEventCollector.dispatchEvents(events);
     EXPECT_EQ(0u, events.size()); // events are only added by the WindowedRenderer
 
+    EXPECT_CALL(displayControllerMock, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, WindowMock::FakeWidth, WindowMock::FakeHeight, _));
     removeDisplayController(dummyDisplay);
 }
 
@@ -69,7 +69,8 @@ TEST_F(ARendererCommands, createsCommandForSceneCreation)
     String sceneName = "the scene";
     SceneId sceneId(12u);
     const SceneInfo sceneInfo(sceneId, sceneName);
-    queue.receiveScene(sceneInfo);
+    const Guid sceneInstanceEpoch(true);
+    queue.receiveScene(sceneInfo, sceneInstanceEpoch, true);
 
     EXPECT_EQ(1u, queue.getCommands().getTotalCommandCount());
     EXPECT_EQ(ERendererCommand_ReceivedScene, queue.getCommands().getCommandType(0));
@@ -78,6 +79,8 @@ TEST_F(ARendererCommands, createsCommandForSceneCreation)
 
     EXPECT_EQ(sceneName, command.sceneInformation.friendlyName);
     EXPECT_EQ(sceneId, command.sceneInformation.sceneID);
+    EXPECT_EQ(sceneInstanceEpoch, command.sceneInstanceEpoch);
+    EXPECT_TRUE(command.deltaSinceLastAppliedFlush);
 }
 
 TEST_F(ARendererCommands, createsCommandForSceneSubscription)
@@ -114,7 +117,7 @@ TEST_F(ARendererCommands, createsCommandForSceneUnsubscription)
 TEST_F(ARendererCommands, createsCommandForSceneDeletion)
 {
     SceneId sceneId(12u);
-    queue.receiveScene(SceneInfo(sceneId));   // default parameters
+    queue.receiveScene(SceneInfo(sceneId), Guid(), false);   // default parameters
     queue.unpublishScene(sceneId);
 
     EXPECT_EQ(2u, queue.getCommands().getTotalCommandCount());
@@ -259,6 +262,25 @@ TEST_F(ARendererCommands, createsCommandForReadPixels)
     EXPECT_EQ(filename, command.filename);
 }
 
+TEST_F(ARendererCommands, createsCommandForPeriodicReadPixels)
+{
+    const DisplayHandle displayHandle(1u);
+
+    queue.readPixelsPeriodically(displayHandle, 2u, 33u, 201u, 4u, 10u);
+
+    EXPECT_EQ(1u, queue.getCommands().getTotalCommandCount());
+    EXPECT_EQ(ERendererCommand_ReadPixelsPeriodically, queue.getCommands().getCommandType(0u));
+
+    const ReadPixelsCommand& command = queue.getCommands().getCommandData<ReadPixelsCommand>(0u);
+
+    EXPECT_EQ(displayHandle, command.displayHandle);
+    EXPECT_EQ(2u, command.x);
+    EXPECT_EQ(33u, command.y);
+    EXPECT_EQ(201u, command.width);
+    EXPECT_EQ(4u, command.height);
+    EXPECT_EQ(10u, command.frameInterval);
+}
+
 TEST_F(ARendererCommands, createsCommandsForDataLinking)
 {
     const SceneId providerScene(1u);
@@ -348,7 +370,7 @@ TEST_F(ARendererCommands, createsCommandForUnmappingSceneFromDisplays)
     const SceneId sceneId(33u);
     const Int32 sceneRenderOrder(1);
 
-    queue.receiveScene(SceneInfo(sceneId));   // default parameters
+    queue.receiveScene(SceneInfo(sceneId), Guid(), false);   // default parameters
     queue.mapSceneToDisplay(sceneId, displayId, sceneRenderOrder);
     queue.clear();
 
@@ -437,7 +459,7 @@ TEST_F(ARendererCommands, createsCommandsForLogging)
 TEST_F(ARendererCommands, clearsCommands)
 {
     const SceneId sceneId(12u);
-    queue.receiveScene(SceneInfo(sceneId));   // default parameters
+    queue.receiveScene(SceneInfo(sceneId), Guid(), false);   // default parameters
     queue.mapSceneToDisplay(SceneId(0u), DisplayHandle(0), 0);
     EXPECT_EQ(2u, queue.getCommands().getTotalCommandCount());
 
@@ -19,7 +19,10 @@ TEST(AInternalRendererConfig, hasDefaultValues)
     EXPECT_EQ(ramses_internal::String(""), config.getWaylandSocketEmbeddedGroup());
     EXPECT_EQ(-1, config.getWaylandSocketEmbeddedFD());
     EXPECT_FALSE(config.getSystemCompositorControlEnabled());
+    EXPECT_FALSE(config.getRenderThreadPerDisplayEnabled());
     EXPECT_STREQ("", config.getKPIFileName().c_str());
+    EXPECT_STREQ("", config.getDeviceTraceFileName().c_str());
+    EXPECT_STREQ("", config.getBinaryShaderCacheDirectory().c_str());
     EXPECT_EQ(std::chrono::microseconds{10000u}, config.getFrameCallbackMaxPollTime());
 }
 
@@ -30,6 +33,13 @@ TEST(AInternalRendererConfig, canEnableSystemCompositorControl)
     EXPECT_TRUE(config.getSystemCompositorControlEnabled());
 }
 
+TEST(AInternalRendererConfig, canEnableRenderThreadPerDisplay)
+{
+    ramses_internal::RendererConfig config;
+    config.enableRenderThreadPerDisplay();
+    EXPECT_TRUE(config.getRenderThreadPerDisplayEnabled());
+}
+
 TEST(AInternalRendererConfig, canGetSetWaylandSocketEmbedded)
 {
     ramses_internal::RendererConfig config;
@@ -62,6 +72,22 @@ TEST(AInternalRendererConfig, canSetGetKPIFilename)
     EXPECT_STREQ("filename", config.getKPIFileName().c_str());
 }
 
+TEST(AInternalRendererConfig, canSetGetDeviceTraceFilename)
+{
+    ramses_internal::RendererConfig config;
+    config.setDeviceTraceFileName("trace");
+
+    EXPECT_STREQ("trace", config.getDeviceTraceFileName().c_str());
+}
+
+TEST(AInternalRendererConfig, canSetGetBinaryShaderCacheDirectory)
+{
+    ramses_internal::RendererConfig config;
+    config.setBinaryShaderCacheDirectory("shaders");
+
+    EXPECT_STREQ("shaders", config.getBinaryShaderCacheDirectory().c_str());
+}
+
 TEST(AInternalRendererConfig, canSetGetMaxFramecallbackPollTime)
 {
     ramses_internal::RendererConfig config;
@@ -77,7 +103,9 @@ TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
         "app",
         "-wse", "wse",
         "-wsegn", "wsegn",
-        "-kpi", "filename"
+        "-kpi", "filename",
+        "-dtf", "trace",
+        "-bscd", "shaders"
     };
     ramses_internal::CommandLineParser parser(sizeof(args) / sizeof(ramses_internal::Char*), args);
 
@@ -87,4 +115,6 @@ TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
     EXPECT_STREQ("wse", config.getWaylandSocketEmbedded().c_str());
     EXPECT_STREQ("wsegn", config.getWaylandSocketEmbeddedGroup().c_str());
     EXPECT_STREQ("filename", config.getKPIFileName().c_str());
+    EXPECT_STREQ("trace", config.getDeviceTraceFileName().c_str());
+    EXPECT_STREQ("shaders", config.getBinaryShaderCacheDirectory().c_str());
 }
@@ -24,11 +24,11 @@ using namespace testing;
 class ARendererResourceManager : public ::testing::Test
 {
 public:
-    ARendererResourceManager(bool disableEffectDeletion = false)
+    ARendererResourceManager(bool disableEffectDeletion = false, UInt64 renderBufferPoolSize = 0u)
         : fakeSceneId(66u)
         , resUploader()
         , frameTimer()
-        , resourceManager(resourceProvider, resUploader, renderer, embeddedCompositingManager, RequesterID(1), disableEffectDeletion, frameTimer)
+        , resourceManager(resourceProvider, resUploader, renderer, embeddedCompositingManager, RequesterID(1), disableEffectDeletion, frameTimer, 0u, EGPUMemoryCachePolicy_LeastRecentlyUsed, false, renderBufferPoolSize)
     {
     }
 
@@ -371,6 +371,45 @@ TEST_F(ARendererResourceManager, canUploadAndUpdateAndUnloadDataBuffer_VertexBuf
     resourceManager.unloadDataBuffer(dataBuffer, fakeSceneId);
 }
 
+TEST_F(ARendererResourceManager, streamsDataBuffersUpdatedInSubsequentFrames)
+{
+    const DataBufferHandle indexBuffer(1u);
+    const DataBufferHandle vertexBuffer(2u);
+    EXPECT_CALL(renderer.deviceMock, allocateIndexBuffer(_, _));
+    EXPECT_CALL(renderer.deviceMock, allocateVertexBuffer(_, _));
+    resourceManager.uploadDataBuffer(indexBuffer, EDataBufferType::IndexBuffer, EDataType_UInt16, 1024u, fakeSceneId);
+    resourceManager.uploadDataBuffer(vertexBuffer, EDataBufferType::VertexBuffer, EDataType_Vector3F, 1024u, fakeSceneId);
+
+    const Byte dummyData[10] = {};
+    for (UInt32 frame = 0u; frame < 2u; ++frame)
+    {
+        EXPECT_CALL(renderer.deviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, dummyData, 7u));
+        EXPECT_CALL(renderer.deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, 7u));
+        resourceManager.updateDataBuffer(indexBuffer, 7u, dummyData, fakeSceneId);
+        resourceManager.updateDataBuffer(vertexBuffer, 7u, dummyData, fakeSceneId);
+        resourceManager.requestAndUnrequestPendingClientResources();
+        Mock::VerifyAndClearExpectations(&renderer.deviceMock);
+    }
+
+    EXPECT_CALL(renderer.deviceMock, streamIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, dummyData, 7u));
+    EXPECT_CALL(renderer.deviceMock, streamVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, 7u));
+    resourceManager.updateDataBuffer(indexBuffer, 7u, dummyData, fakeSceneId);
+    resourceManager.updateDataBuffer(vertexBuffer, 7u, dummyData, fakeSceneId);
+    Mock::VerifyAndClearExpectations(&renderer.deviceMock);
+
+    // not updated for a while, uploaded statically again
+    for (UInt32 frame = 0u; frame < 10u; ++frame)
+        resourceManager.requestAndUnrequestPendingClientResources();
+    EXPECT_CALL(renderer.deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, 7u));
+    resourceManager.updateDataBuffer(vertexBuffer, 7u, dummyData, fakeSceneId);
+    Mock::VerifyAndClearExpectations(&renderer.deviceMock);
+
+    EXPECT_CALL(renderer.deviceMock, deleteIndexBuffer(DeviceMock::FakeIndexBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteVertexBuffer(DeviceMock::FakeVertexBufferDeviceHandle));
+    resourceManager.unloadDataBuffer(indexBuffer, fakeSceneId);
+    resourceManager.unloadDataBuffer(vertexBuffer, fakeSceneId);
+}
+
 TEST_F(ARendererResourceManager, canUploadAndUpdateAndUnloadTextureBuffer_WithOneMipLevel)
 {
     InSequence seq;
@@ -973,4 +1012,60 @@ TEST_F(ARendererResourceManager, canUnreferenceAllResourcesUsedByAScene)
 
     resourceManager.unreferenceAllClientResourcesForScene(fakeSceneId2);
 }
+
+class ARendererResourceManagerWithRenderBufferPool : public ARendererResourceManager
+{
+public:
+    ARendererResourceManagerWithRenderBufferPool()
+        : ARendererResourceManager(false, 1024u)
+    {
+    }
+};
+
+TEST_F(ARendererResourceManagerWithRenderBufferPool, reusesRenderTargetBufferWhenUploadedAgainAfterUnload)
+{
+    const RenderBufferHandle bufferHandle(1u);
+    const RenderBuffer colorBuffer(4u, 4u, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u);
+    const DeviceResourceHandle bufferDeviceHandle(201u);
+
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(colorBuffer))).WillOnce(Return(bufferDeviceHandle));
+    resourceManager.uploadRenderTargetBuffer(bufferHandle, fakeSceneId, colorBuffer);
+    resourceManager.unloadRenderTargetBuffer(bufferHandle, fakeSceneId);
+    Mock::VerifyAndClearExpectations(&renderer.deviceMock);
+
+    resourceManager.uploadRenderTargetBuffer(bufferHandle, fakeSceneId, colorBuffer);
+    EXPECT_EQ(bufferDeviceHandle, resourceManager.getRenderTargetBufferDeviceHandle(bufferHandle, fakeSceneId));
+    resourceManager.unloadRenderTargetBuffer(bufferHandle, fakeSceneId);
+
+    // retained buffer is deleted with resource manager
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(bufferDeviceHandle));
+}
+
+TEST_F(ARendererResourceManagerWithRenderBufferPool, reusesBuffersOfUnloadedOffscreenBufferForSceneRenderTargetBuffer)
+{
+    const OffscreenBufferHandle offscreenBufferHandle(1u);
+    const DeviceResourceHandle colorBufferDeviceHandle(201u);
+    const DeviceResourceHandle depthBufferDeviceHandle(202u);
+
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(_)).WillOnce(Return(colorBufferDeviceHandle)).WillOnce(Return(depthBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, activateRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, colorMask(_, _, _, _));
+    EXPECT_CALL(renderer.deviceMock, clearColor(_));
+    EXPECT_CALL(renderer.deviceMock, depthWrite(_));
+    EXPECT_CALL(renderer.deviceMock, clear(_));
+    resourceManager.uploadOffscreenBuffer(offscreenBufferHandle, 4u, 4u, false);
+
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    resourceManager.unloadOffscreenBuffer(offscreenBufferHandle);
+    Mock::VerifyAndClearExpectations(&renderer.deviceMock);
+
+    const RenderBufferHandle bufferHandle(1u);
+    const RenderBuffer colorBuffer(4u, 4u, ERenderBufferType_ColorBuffer, ETextureFormat_RGBA8, ERenderBufferAccessMode_ReadWrite, 0u);
+    resourceManager.uploadRenderTargetBuffer(bufferHandle, fakeSceneId, colorBuffer);
+    EXPECT_EQ(colorBufferDeviceHandle, resourceManager.getRenderTargetBufferDeviceHandle(bufferHandle, fakeSceneId));
+
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(depthBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(colorBufferDeviceHandle));
+}
 }
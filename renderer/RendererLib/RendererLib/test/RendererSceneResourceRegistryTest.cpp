@@ -155,6 +155,23 @@ TEST_F(ARendererSceneResourceRegistry, canAddAndRemoveDataBuffers)
     EXPECT_TRUE(dbs.empty());
 }
 
+TEST_F(ARendererSceneResourceRegistry, countsSubsequentFramesWithDataBufferUpdates)
+{
+    const DataBufferHandle db(13u);
+    registry.addDataBuffer(db, DeviceResourceHandle(123u), EDataBufferType::VertexBuffer, 0u);
+
+    EXPECT_EQ(1u, registry.markDataBufferUpdated(db, 10u));
+    // multiple updates within same frame count once
+    EXPECT_EQ(1u, registry.markDataBufferUpdated(db, 10u));
+    EXPECT_EQ(2u, registry.markDataBufferUpdated(db, 11u));
+    // few frames gap is still subsequent update
+    EXPECT_EQ(3u, registry.markDataBufferUpdated(db, 13u));
+    // longer gap starts counting again
+    EXPECT_EQ(1u, registry.markDataBufferUpdated(db, 20u));
+
+    registry.removeDataBuffer(db);
+}
+
 TEST_F(ARendererSceneResourceRegistry, canGetDataBufferDeviceHAndle)
 {
     const DataBufferHandle db(13u);
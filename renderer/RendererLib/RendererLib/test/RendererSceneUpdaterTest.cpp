@@ -127,9 +127,9 @@ TEST_F(ARendererSceneUpdater, ignoresSceneActionsAddedBetweenUnsubscriptionAndRe
 
     performFlush(0u, false, SceneVersionTag(1u));
 
-    EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, getSceneId()));
+    EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, getSceneId(), Guid(), 0u));
     rendererSceneUpdater->handleSceneSubscriptionRequest(getSceneId());
-    rendererSceneUpdater->handleSceneReceived(SceneInfo(getSceneId()));
+    rendererSceneUpdater->handleSceneReceived(SceneInfo(getSceneId()), Guid(), false);
 
     // named flush ignored
     RendererEventVector events;
@@ -140,6 +140,105 @@ TEST_F(ARendererSceneUpdater, ignoresSceneActionsAddedBetweenUnsubscriptionAndRe
     }
 }
 
+TEST_F(ARendererSceneUpdater, retainsSceneCopyWhenUnsubscribedAndResubscribesWithItsSceneInstanceAndLastAppliedFlush)
+{
+    const Guid sceneInstanceEpoch(true);
+    createStagingScene();
+    publishScene();
+    requestSceneSubscription();
+    receiveScene(0u, sceneInstanceEpoch);
+    handleSceneActionCreateNode();
+    update();
+
+    EXPECT_CALL(sceneGraphConsumerComponent, unsubscribeScene(_, getSceneId()));
+    rendererSceneUpdater->handleSceneUnsubscriptionRequest(getSceneId(), false);
+    EXPECT_FALSE(rendererScenes.hasScene(getSceneId()));
+    EXPECT_TRUE(rendererScenes.hasRetainedScene(getSceneId()));
+
+    EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, getSceneId(), sceneInstanceEpoch, 1u));
+    rendererSceneUpdater->handleSceneSubscriptionRequest(getSceneId());
+}
+
+TEST_F(ARendererSceneUpdater, doesNotRetainSceneCopyWithUnappliedFlushWhenUnsubscribed)
+{
+    createStagingScene();
+    publishScene();
+    requestSceneSubscription();
+    receiveScene(0u, Guid(true));
+    handleSceneActionCreateNode();
+
+    EXPECT_CALL(sceneGraphConsumerComponent, unsubscribeScene(_, getSceneId()));
+    rendererSceneUpdater->handleSceneUnsubscriptionRequest(getSceneId(), false);
+    EXPECT_FALSE(rendererScenes.hasRetainedScene(getSceneId()));
+
+    EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, getSceneId(), Guid(), 0u));
+    rendererSceneUpdater->handleSceneSubscriptionRequest(getSceneId());
+}
+
+TEST_F(ARendererSceneUpdater, restoresRetainedSceneCopyWhenReceivingChangesSinceLastAppliedFlush)
+{
+    const Guid sceneInstanceEpoch(true);
+    createStagingScene();
+    publishScene();
+    requestSceneSubscription();
+    receiveScene(0u, sceneInstanceEpoch);
+    const NodeHandle nodeHandle = handleSceneActionCreateNode();
+    update();
+
+    EXPECT_CALL(sceneGraphConsumerComponent, unsubscribeScene(_, getSceneId()));
+    rendererSceneUpdater->handleSceneUnsubscriptionRequest(getSceneId(), false);
+    EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, getSceneId(), sceneInstanceEpoch, 1u));
+    rendererSceneUpdater->handleSceneSubscriptionRequest(getSceneId());
+    expectEvents({ ERendererEventType_SceneSubscribed, ERendererEventType_SceneUnsubscribed });
+
+    rendererSceneUpdater->handleSceneReceived(SceneInfo(getSceneId()), sceneInstanceEpoch, true);
+    EXPECT_FALSE(rendererScenes.hasRetainedScene(getSceneId()));
+    ASSERT_TRUE(rendererScenes.hasScene(getSceneId()));
+    EXPECT_TRUE(rendererScenes.getScene(getSceneId()).isNodeAllocated(nodeHandle));
+    EXPECT_EQ(ESceneState_Subscribed, sceneStateExecutor.getSceneState(getSceneId()));
+    expectEvents({ ERendererEventType_SceneSubscribed });
+}
+
+TEST_F(ARendererSceneUpdater, dropsRetainedSceneCopyWhenReceivingFullScene)
+{
+    createStagingScene();
+    publishScene();
+    requestSceneSubscription();
+    receiveScene(0u, Guid(true));
+    handleSceneActionCreateNode();
+    update();
+
+    EXPECT_CALL(sceneGraphConsumerComponent, unsubscribeScene(_, getSceneId()));
+    rendererSceneUpdater->handleSceneUnsubscriptionRequest(getSceneId(), false);
+    EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, getSceneId(), _, 1u));
+    rendererSceneUpdater->handleSceneSubscriptionRequest(getSceneId());
+
+    receiveScene(0u, Guid(true));
+    EXPECT_FALSE(rendererScenes.hasRetainedScene(getSceneId()));
+    EXPECT_EQ(0u, rendererScenes.getScene(getSceneId()).getNodeCount());
+}
+
+TEST_F(ARendererSceneUpdater, unsubscribesWhenReceivingChangesForOtherSceneInstance)
+{
+    createStagingScene();
+    publishScene();
+    requestSceneSubscription();
+    receiveScene(0u, Guid(true));
+    handleSceneActionCreateNode();
+    update();
+
+    EXPECT_CALL(sceneGraphConsumerComponent, unsubscribeScene(_, getSceneId()));
+    rendererSceneUpdater->handleSceneUnsubscriptionRequest(getSceneId(), false);
+    EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, getSceneId(), _, 1u));
+    rendererSceneUpdater->handleSceneSubscriptionRequest(getSceneId());
+
+    EXPECT_CALL(sceneGraphConsumerComponent, unsubscribeScene(_, getSceneId()));
+    rendererSceneUpdater->handleSceneReceived(SceneInfo(getSceneId()), Guid(true), true);
+    EXPECT_FALSE(rendererScenes.hasScene(getSceneId()));
+    EXPECT_FALSE(rendererScenes.hasRetainedScene(getSceneId()));
+    EXPECT_EQ(ESceneState_Published, sceneStateExecutor.getSceneState(getSceneId()));
+}
+
 TEST_F(ARendererSceneUpdater, canCreateAndDestroyDisplayContext)
 {
     createDisplayAndExpectSuccess();
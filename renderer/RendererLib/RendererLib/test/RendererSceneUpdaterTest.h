@@ -94,15 +94,15 @@ protected:
     void requestSceneSubscription(UInt32 sceneIndex = 0u)
     {
         const SceneId sceneId = getSceneId(sceneIndex);
-        EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, sceneId));
+        EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(_, sceneId, Guid(), 0u));
         rendererSceneUpdater->handleSceneSubscriptionRequest(sceneId);
         EXPECT_TRUE(sceneStateExecutor.getSceneState(sceneId) == ESceneState_SubscriptionRequested);
     }
 
-    void receiveScene(UInt32 sceneIndex = 0u)
+    void receiveScene(UInt32 sceneIndex = 0u, const Guid& sceneInstanceEpoch = Guid())
     {
         const SceneId sceneId = getSceneId(sceneIndex);
-        rendererSceneUpdater->handleSceneReceived(SceneInfo(sceneId));
+        rendererSceneUpdater->handleSceneReceived(SceneInfo(sceneId), sceneInstanceEpoch, false);
         EXPECT_TRUE(sceneStateExecutor.getSceneState(sceneId) == ESceneState_SubscriptionPending);
         EXPECT_TRUE(rendererScenes.hasScene(sceneId));
     }
@@ -853,10 +853,10 @@ protected:
         EXPECT_CALL(*displayMock.m_displayController, executePostProcessing());
         EXPECT_CALL(*displayMock.m_displayController, swapBuffers());
 
-        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(sceneIdx))), DisplayControllerMock::FakeFrameBufferHandle, _, _, _));
+        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(sceneIdx))), DisplayControllerMock::FakeFrameBufferHandle, _, _, _, _));
         SceneRenderExecutionIterator interruptedState;
         interruptedState.incrementRenderableIdx();
-        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(interruptedSceneIdx))), DeviceMock::FakeRenderTargetDeviceHandle, _, _, _)).WillOnce(Return(interruptedState));
+        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(interruptedSceneIdx))), DeviceMock::FakeRenderTargetDeviceHandle, _, _, _, _)).WillOnce(Return(interruptedState));
 
         renderer.doOneRenderLoop();
         EXPECT_TRUE(renderer.hasAnyBufferWithInterruptedRendering());
@@ -207,6 +207,89 @@ TEST_F(ARendererStatistics, tracksFramebufferAndOffscreenBufferSwapCounts)
     EXPECT_TRUE(logOutputContains("FB2: 1; OB22: 1; OB33: 1"));
 }
 
+TEST_F(ARendererStatistics, tracksFrameTimePerDisplay)
+{
+    stats.framebufferSwapped(disp1);
+    stats.displayFrameRendered(disp1, 100u);
+    stats.framebufferSwapped(disp2);
+    stats.displayFrameRendered(disp2, 1000u);
+    stats.frameFinished(0u);
+
+    stats.framebufferSwapped(disp1);
+    stats.displayFrameRendered(disp1, 300u);
+    stats.displayFrameRendered(disp2, 2000u);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("FB1: 2; frameTime us (100/300/200.000000)"));
+    EXPECT_TRUE(logOutputContains("FB2: 1; frameTime us (1000/2000/1500.000000)"));
+
+    stats.reset();
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("frameTime us"));
+}
+
+TEST_F(ARendererStatistics, tracksSceneLayerCachePerDisplay)
+{
+    stats.framebufferSwapped(disp1);
+    stats.sceneLayerComposited(disp1, 100u);
+    stats.sceneLayerComposited(disp1, 250u);
+    stats.sceneLayersMemoryUsed(disp1, 4096u);
+    stats.framebufferSwapped(disp2);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("FB1: 1; layers composited 2, savedRenderCpuTime us 350, layersMem KB 4"));
+    EXPECT_TRUE(logOutputContains("FB2: 1\n"));
+
+    stats.reset();
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("FB1: 0; layers composited 0, savedRenderCpuTime us 0, layersMem KB 4"));
+}
+
+TEST_F(ARendererStatistics, tracksGpuTimePerSceneAndPass)
+{
+    stats.sceneGpuTimeMeasured(sceneId1, 100u);
+    stats.renderPassGpuTimeMeasured(sceneId1, RenderPassHandle{ 1u }, 60u);
+    stats.renderPassGpuTimeMeasured(sceneId1, RenderPassHandle{ 2u }, 40u);
+    stats.frameFinished(0u);
+    stats.sceneGpuTimeMeasured(sceneId1, 300u);
+    stats.renderPassGpuTimeMeasured(sceneId1, RenderPassHandle{ 1u }, 200u);
+    stats.blitPassGpuTimeMeasured(sceneId1, BlitPassHandle{ 3u }, 100u);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("gpuTime us (100/300/200.000000), RP1 (60/200/130.000000), RP2 (40/40/40.000000), BP3 (100/100/100.000000)"));
+
+    stats.reset();
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("gpuTime us"));
+}
+
+TEST_F(ARendererStatistics, tracksFramePacing)
+{
+    stats.framePaced(2000u, false);
+    stats.frameFinished(0u);
+    stats.framePaced(0u, true);
+    stats.frameFinished(0u);
+    stats.framePaced(4000u, false);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("pacedFrames 3, missedDeadlines 1, pacingDelay us (0/4000/2000.000000)"));
+
+    stats.reset();
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("pacedFrames"));
+}
+
+TEST_F(ARendererStatistics, tracksInternedStates)
+{
+    stats.framebufferSwapped(disp1);
+    stats.renderStatesInterned(3u, 10u);
+    stats.textureSamplerStatesInterned(2u, 5u);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains(", renderStates unique/requested 3/10, samplerStates unique/requested 2/5\n"));
+    EXPECT_TRUE(logOutputContains("FB1: 1\n"));
+}
+
 TEST_F(ARendererStatistics, tracksInterruptibleOffscreenBuffer)
 {
     stats.offscreenBufferInterrupted(disp1, ob1);
@@ -235,23 +318,34 @@ TEST_F(ARendererStatistics, untracksOffscreenBuffer)
 TEST_F(ARendererStatistics, tracksStreamTextureSource)
 {
     const StreamTextureSourceId src{ 99u };
-    stats.streamTextureUpdated(src, 2u);
+    stats.streamTextureUpdated(src, 2u, 0u);
     stats.frameFinished(0u);
     stats.frameFinished(0u);
     stats.frameFinished(0u);
-    stats.streamTextureUpdated(src, 9u);
+    stats.streamTextureUpdated(src, 9u, 0u);
     stats.frameFinished(0u);
-    stats.streamTextureUpdated(src, 1u);
+    stats.streamTextureUpdated(src, 1u, 0u);
     stats.frameFinished(0u);
 
     EXPECT_TRUE(logOutputContains("numFrames 5"));
     EXPECT_TRUE(logOutputContains("SourceId 99: upd 12, framesUpd 3, maxUpdInFrame 9, maxFramesWithNoUpd 2"));
 }
 
+TEST_F(ARendererStatistics, tracksUploadedBytesOfStreamTextureSource)
+{
+    const StreamTextureSourceId src{ 99u };
+    stats.streamTextureUpdated(src, 1u, 2048u);
+    stats.frameFinished(0u);
+    stats.streamTextureUpdated(src, 1u, 1024u);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("SourceId 99: upd 2, framesUpd 2, maxUpdInFrame 1, maxFramesWithNoUpd 0, uploadedKB 3"));
+}
+
 TEST_F(ARendererStatistics, logsValidNumbersWhenStreamTextureInactive)
 {
     const StreamTextureSourceId src{ 99u };
-    stats.streamTextureUpdated(src, 2u); // will register source
+    stats.streamTextureUpdated(src, 2u, 0u); // will register source
     stats.reset();
     stats.frameFinished(0u);
     stats.frameFinished(0u);
@@ -263,7 +357,7 @@ TEST_F(ARendererStatistics, logsValidNumbersWhenStreamTextureInactive)
 TEST_F(ARendererStatistics, untracksStreamTextureSource)
 {
     const StreamTextureSourceId src{ 99u };
-    stats.streamTextureUpdated(src, 2u);
+    stats.streamTextureUpdated(src, 2u, 0u);
     stats.frameFinished(0u);
 
     stats.untrackStreamTexture(src);
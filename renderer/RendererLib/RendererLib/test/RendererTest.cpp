@@ -26,6 +26,7 @@
 #include "TestSceneHelper.h"
 #include "Common/Cpp11Macros.h"
 #include <map>
+#include <thread>
 
 using namespace ramses_internal;
 
@@ -144,13 +145,13 @@ public:
     void expectSceneRendered(DisplayHandle displayHandle, SceneId sceneId, DeviceResourceHandle buffer = DisplayControllerMock::FakeFrameBufferHandle)
     {
         DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
-        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneId)), buffer, _, sceneRenderBegin, nullptr));
+        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneId)), buffer, _, sceneRenderBegin, nullptr, _));
     }
 
     void expectSceneRenderedWithInterruptionEnabled(DisplayHandle displayHandle, SceneId sceneId, DeviceResourceHandle buffer, SceneRenderExecutionIterator expectedRenderBegin, SceneRenderExecutionIterator stateToSimulate)
     {
         DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
-        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneId)), buffer, _, expectedRenderBegin, &renderer.FrameTimerInstance)).WillOnce(Return(stateToSimulate));
+        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneId)), buffer, _, expectedRenderBegin, &renderer.FrameTimerInstance, _)).WillOnce(Return(stateToSimulate));
     }
 
     IScene& createScene(SceneId sceneId = SceneId())
@@ -960,21 +961,30 @@ TEST_P(ARenderer, canTakeASingleScreenshot)
     screenshot.display = displayHandle;
     screenshot.filename = "";
     renderer.scheduleScreenshot(screenshot);
-    EXPECT_CALL(*displayMock.m_displayController, readPixels(20u, 30u, 100u, 100u, _));
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(20u, 30u, 100u, 100u));
     expectFrameBufferRendered();
     expectSwapBuffers();
     doOneRendererLoop();
 
+    // read back is only started in the frame it was scheduled for
     ScreenshotInfoVector screenshots;
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(DisplayControllerMock::FakeReadPixelsHandle));
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, 100u, 100u, _));
+    expectFrameBufferRendered(displayHandle, true, false);
+    doOneRendererLoop();
+
     renderer.dispatchProcessedScreenshots(screenshots);
     ASSERT_EQ(1u, screenshots.size());
     EXPECT_TRUE(screenshots[0].success);
     EXPECT_EQ(displayHandle, screenshots[0].display);
     EXPECT_FALSE(screenshots[0].pixelData.empty());
-    EXPECT_EQ(80u * 70u * 4u, screenshots[0].pixelData.size());
+    EXPECT_EQ(100u * 100u * 4u, screenshots[0].pixelData.size());
 
     // check that screenshot request got deleted
-    EXPECT_CALL(*displayMock.m_displayController, readPixels(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(_, _, _, _)).Times(0);
     expectFrameBufferRendered(displayHandle, false, false);
     doOneRendererLoop();
 
@@ -983,6 +993,33 @@ TEST_P(ARenderer, canTakeASingleScreenshot)
     EXPECT_EQ(0u, screenshots.size());
 }
 
+TEST_P(ARenderer, reportsScreenshotAsFailedIfPixelsCouldNotBeReadBack)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+
+    ScreenshotInfo screenshot;
+    screenshot.rectangle = { 20u, 30u, 100u, 100u };
+    screenshot.display = displayHandle;
+    screenshot.filename = "";
+    renderer.scheduleScreenshot(screenshot);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(20u, 30u, 100u, 100u));
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(DisplayControllerMock::FakeReadPixelsHandle));
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, 100u, 100u, _)).WillOnce(Return(false));
+    expectFrameBufferRendered(displayHandle, true, false);
+    doOneRendererLoop();
+
+    ScreenshotInfoVector screenshots;
+    renderer.dispatchProcessedScreenshots(screenshots);
+    ASSERT_EQ(1u, screenshots.size());
+    EXPECT_FALSE(screenshots[0].success);
+    EXPECT_TRUE(screenshots[0].pixelData.empty());
+}
+
 TEST_P(ARenderer, canTakeMultipleScreenshotsForMultipleDisplays)
 {
     const DisplayHandle displayHandle1 = addDisplayController();
@@ -1014,11 +1051,11 @@ TEST_P(ARenderer, canTakeMultipleScreenshotsForMultipleDisplays)
     screenshot.display = displayHandle1;
     renderer.scheduleScreenshot(screenshot);
 
-    EXPECT_CALL(*displayMock1.m_displayController, readPixels(10u, 10u, 110u, 110u, _));
-    EXPECT_CALL(*displayMock2.m_displayController, readPixels(20u, 20u, 120u, 120u, _));
-    EXPECT_CALL(*displayMock1.m_displayController, readPixels(30u, 30u, 130u, 130u, _));
-    EXPECT_CALL(*displayMock2.m_displayController, readPixels(40u, 40u, 140u, 140u, _));
-    EXPECT_CALL(*displayMock1.m_displayController, readPixels(50u, 50u, 150u, 150u, _));
+    EXPECT_CALL(*displayMock1.m_displayController, startReadPixels(10u, 10u, 110u, 110u));
+    EXPECT_CALL(*displayMock2.m_displayController, startReadPixels(20u, 20u, 120u, 120u));
+    EXPECT_CALL(*displayMock1.m_displayController, startReadPixels(30u, 30u, 130u, 130u));
+    EXPECT_CALL(*displayMock2.m_displayController, startReadPixels(40u, 40u, 140u, 140u));
+    EXPECT_CALL(*displayMock1.m_displayController, startReadPixels(50u, 50u, 150u, 150u));
     expectFrameBufferRendered(displayHandle1);
     expectFrameBufferRendered(displayHandle2);
     expectSwapBuffers(displayHandle2);
@@ -1026,6 +1063,20 @@ TEST_P(ARenderer, canTakeMultipleScreenshotsForMultipleDisplays)
     doOneRendererLoop();
 
     ScreenshotInfoVector screenshots;
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+
+    EXPECT_CALL(*displayMock1.m_displayController, isReadPixelsFinished(_)).Times(3u);
+    EXPECT_CALL(*displayMock2.m_displayController, isReadPixelsFinished(_)).Times(2u);
+    EXPECT_CALL(*displayMock1.m_displayController, finishReadPixels(_, 110u, 110u, _));
+    EXPECT_CALL(*displayMock2.m_displayController, finishReadPixels(_, 120u, 120u, _));
+    EXPECT_CALL(*displayMock1.m_displayController, finishReadPixels(_, 130u, 130u, _));
+    EXPECT_CALL(*displayMock2.m_displayController, finishReadPixels(_, 140u, 140u, _));
+    EXPECT_CALL(*displayMock1.m_displayController, finishReadPixels(_, 150u, 150u, _));
+    expectFrameBufferRendered(displayHandle1, true, false);
+    expectFrameBufferRendered(displayHandle2, true, false);
+    doOneRendererLoop();
+
     renderer.dispatchProcessedScreenshots(screenshots);
     ASSERT_EQ(5u, screenshots.size());
     for (UInt32 i =0; i < screenshots.size(); i++)
@@ -1036,8 +1087,8 @@ TEST_P(ARenderer, canTakeMultipleScreenshotsForMultipleDisplays)
     }
 
     // check that screenshot request got deleted
-    EXPECT_CALL(*displayMock1.m_displayController, readPixels(_, _, _, _, _)).Times(0);
-    EXPECT_CALL(*displayMock2.m_displayController, readPixels(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(*displayMock1.m_displayController, startReadPixels(_, _, _, _)).Times(0);
+    EXPECT_CALL(*displayMock2.m_displayController, startReadPixels(_, _, _, _)).Times(0);
     expectFrameBufferRendered(displayHandle1, false, false);
     expectFrameBufferRendered(displayHandle2, false, false);
     doOneRendererLoop();
@@ -1058,7 +1109,7 @@ TEST_P(ARenderer, failsToCreateScreenshot)
     screenshot.filename = "";
 
     renderer.scheduleScreenshot(screenshot);
-    EXPECT_CALL(*displayMock.m_displayController, readPixels(0u, 0u, 100u, 100u, _)).WillOnce(Return(false));
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, 100u, 100u)).WillOnce(Return(DeviceResourceHandle::Invalid()));
     expectFrameBufferRendered();
     expectSwapBuffers();
     doOneRendererLoop();
@@ -1071,7 +1122,7 @@ TEST_P(ARenderer, failsToCreateScreenshot)
     EXPECT_TRUE(screenshots[0].pixelData.empty());
 
     // check that screenshot request got deleted
-    EXPECT_CALL(*displayMock.m_displayController, readPixels(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(_, _, _, _)).Times(0);
     expectFrameBufferRendered(displayHandle, false, false);
     doOneRendererLoop();
 
@@ -1080,6 +1131,117 @@ TEST_P(ARenderer, failsToCreateScreenshot)
     EXPECT_EQ(0u, screenshots.size());
 }
 
+TEST_P(ARenderer, finishesScreenshotReadBackAtLatestTwoFramesAfterItWasStarted)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+
+    ScreenshotInfo screenshot;
+    screenshot.rectangle = { 0u, 0u, 100u, 100u };
+    screenshot.display = displayHandle;
+    screenshot.filename = "";
+
+    renderer.scheduleScreenshot(screenshot);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, 100u, 100u));
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    // read back not finished by GPU yet, renderer does not wait for it
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(DisplayControllerMock::FakeReadPixelsHandle)).WillOnce(Return(false));
+    expectFrameBufferRendered(displayHandle, true, false);
+    doOneRendererLoop();
+
+    ScreenshotInfoVector screenshots;
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+
+    // second frame after start, read back is finished without polling
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, 100u, 100u, _));
+    expectFrameBufferRendered(displayHandle, true, false);
+    doOneRendererLoop();
+
+    renderer.dispatchProcessedScreenshots(screenshots);
+    ASSERT_EQ(1u, screenshots.size());
+    EXPECT_TRUE(screenshots[0].success);
+    EXPECT_EQ(100u * 100u * 4u, screenshots[0].pixelData.size());
+}
+
+TEST_P(ARenderer, takesPeriodicScreenshotEveryNthRenderedFrame)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    renderer.setSkippingOfUnmodifiedBuffers(false);
+
+    ScreenshotInfo screenshot;
+    screenshot.rectangle = { 0u, 0u, 10u, 10u };
+    screenshot.display = displayHandle;
+    screenshot.filename = "";
+    renderer.setPeriodicScreenshot(screenshot, 2u);
+
+    for (UInt32 frame = 0u; frame < 4u; ++frame)
+    {
+        if (frame % 2u == 0u)
+        {
+            EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, 10u, 10u));
+        }
+        else
+        {
+            EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(DisplayControllerMock::FakeReadPixelsHandle));
+            EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, 10u, 10u, _));
+        }
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        ScreenshotInfoVector screenshots;
+        renderer.dispatchProcessedScreenshots(screenshots);
+        EXPECT_EQ(frame % 2u, screenshots.size());
+    }
+
+    // stopped periodic screenshot
+    renderer.setPeriodicScreenshot(screenshot, 0u);
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(_, _, _, _)).Times(0);
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+}
+
+TEST_P(ARenderer, periodicScreenshotDoesNotForceRerenderOfDisplay)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+
+    ScreenshotInfo screenshot;
+    screenshot.rectangle = { 0u, 0u, 10u, 10u };
+    screenshot.display = displayHandle;
+    screenshot.filename = "";
+    renderer.setPeriodicScreenshot(screenshot, 1u);
+
+    // display is rendered initially
+    EXPECT_CALL(*displayMock.m_displayController, startReadPixels(0u, 0u, 10u, 10u));
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    // nothing changed, pending screenshot is finished but no new one started
+    EXPECT_CALL(*displayMock.m_displayController, isReadPixelsFinished(DisplayControllerMock::FakeReadPixelsHandle));
+    EXPECT_CALL(*displayMock.m_displayController, finishReadPixels(DisplayControllerMock::FakeReadPixelsHandle, 10u, 10u, _));
+    expectFrameBufferRendered(displayHandle, true, false);
+    doOneRendererLoop();
+
+    ScreenshotInfoVector screenshots;
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_EQ(1u, screenshots.size());
+
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    screenshots.clear();
+    renderer.dispatchProcessedScreenshots(screenshots);
+    EXPECT_TRUE(screenshots.empty());
+}
+
 TEST_P(ARenderer, willIgnoreScreenshotIfDisplayIsDestroyedAtTheSameTime)
 {
     const DisplayHandle displayHandle = addDisplayController();
@@ -1101,7 +1263,7 @@ TEST_P(ARenderer, willIgnoreScreenshotIfDisplayIsDestroyedAtTheSameTime)
     const DisplayHandle displayHandle2 = addDisplayController();
     EXPECT_EQ(displayHandle, displayHandle2);
     DisplayStrictMockInfo& displayMock2 = renderer.getDisplayMock(displayHandle2);
-    EXPECT_CALL(*displayMock2.m_displayController, readPixels(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(*displayMock2.m_displayController, startReadPixels(_, _, _, _)).Times(0);
     expectFrameBufferRendered();
     expectSwapBuffers();
     doOneRendererLoop();
@@ -1287,6 +1449,34 @@ TEST_P(ARenderer, doesNotSkipClearAndRerenderOffscreenBufferIfNoChangeToSceneBut
     unmapScene(sceneId);
 }
 
+TEST_P(ARenderer, clearAndRerenderIfDisplayViewMarkedAsModified)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+
+    const SceneId sceneId(12u);
+    createScene(sceneId);
+    mapSceneToDisplayBuffer(sceneId, displayHandle, 0);
+    showScene(sceneId);
+
+    expectSceneRendered(displayHandle, sceneId);
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    // no change
+    expectFrameBufferRendered(displayHandle, false, false);
+    doOneRendererLoop();
+
+    renderer.markDisplayViewModified(displayHandle);
+    expectSceneRendered(displayHandle, sceneId);
+    expectFrameBufferRendered();
+    expectSwapBuffers();
+    doOneRendererLoop();
+
+    hideScene(sceneId);
+    unmapScene(sceneId);
+}
+
 TEST_P(ARenderer, clearAndRerenderIfSceneMarkedAsChanged)
 {
     const DisplayHandle displayHandle = addDisplayController();
@@ -3271,3 +3461,119 @@ TEST_P(ARenderer, reportsSceneAsRenderedToLatencyMonitorOnlyAfterFullyRenderedAn
     latencyMonitor.stopMonitoringScene(sceneIdFB);
     latencyMonitor.stopMonitoringScene(sceneIdOBint);
 }
+
+class ARendererWithRenderThreadPerDisplay : public ::testing::Test
+{
+public:
+    ARendererWithRenderThreadPerDisplay()
+        : platformFactoryMock(false)
+        , latencyMonitor(rendererEventCollector)
+        , rendererScenes(rendererEventCollector)
+        , renderer(platformFactoryMock, rendererScenes, rendererEventCollector, latencyMonitor, true)
+    {
+    }
+
+    ~ARendererWithRenderThreadPerDisplay()
+    {
+        for (const auto display : createdDisplays)
+            renderer.destroyDisplayContext(display);
+    }
+
+    DisplayHandle addDisplayController()
+    {
+        static const DisplayConfig dummyConfig;
+        const DisplayHandle handle(static_cast<UInt32>(createdDisplays.size()));
+        renderer.createDisplayContext(dummyConfig, handle);
+        createdDisplays.push_back(handle);
+
+        return handle;
+    }
+
+    void expectFrameRenderedOnRenderThread(DisplayHandle display, bool expectRerender = true)
+    {
+        DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(display);
+        Sequence seq;
+        // create entry here so that render threads only write to their own element
+        renderThreadIds[display] = std::thread::id();
+
+        EXPECT_CALL(*displayMock.m_displayController, handleWindowEvents()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_displayController, canRenderNewFrame()).InSequence(seq).WillOnce(Return(true));
+        // released by renderer loop, taken over and released again by render thread
+        EXPECT_CALL(*displayMock.m_displayController, disableContext()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(seq).WillOnce(Invoke([this, display]() { renderThreadIds[display] = std::this_thread::get_id(); }));
+        if (expectRerender)
+        {
+            EXPECT_CALL(*displayMock.m_displayController, clearBuffer(DisplayControllerMock::FakeFrameBufferHandle, Renderer::DefaultClearColor)).InSequence(seq);
+            EXPECT_CALL(*displayMock.m_displayController, executePostProcessing()).InSequence(seq);
+            EXPECT_CALL(*displayMock.m_displayController, swapBuffers()).InSequence(seq);
+        }
+        EXPECT_CALL(*displayMock.m_embeddedCompositingManager, notifyClients()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_displayController, disableContext()).InSequence(seq);
+    }
+
+    void doOneRendererLoop()
+    {
+        renderer.getProfilerStatistics().markFrameFinished(std::chrono::microseconds{ 0u });
+        renderer.doOneRenderLoop();
+    }
+
+    bool statisticsContain(const String& str)
+    {
+        StringOutputStream strstr;
+        renderer.getStatistics().writeStatsToStream(strstr);
+        return strstr.release().find(str) >= 0;
+    }
+
+protected:
+    StrictMock<PlatformFactoryStrictMock>       platformFactoryMock;
+    RendererEventCollector                      rendererEventCollector;
+    LatencyMonitor                              latencyMonitor;
+    RendererScenes                              rendererScenes;
+    StrictMock<RendererMockWithStrictMockDisplay> renderer;
+
+    std::vector<DisplayHandle> createdDisplays;
+    std::map<DisplayHandle, std::thread::id> renderThreadIds;
+};
+
+TEST_F(ARendererWithRenderThreadPerDisplay, rendersAndSwapsEachDisplayOnItsOwnThread)
+{
+    const DisplayHandle display1 = addDisplayController();
+    const DisplayHandle display2 = addDisplayController();
+    EXPECT_TRUE(renderer.hasRenderThreadPerDisplay());
+
+    expectFrameRenderedOnRenderThread(display1);
+    expectFrameRenderedOnRenderThread(display2);
+    doOneRendererLoop();
+
+    ASSERT_EQ(2u, renderThreadIds.size());
+    EXPECT_NE(std::this_thread::get_id(), renderThreadIds[display1]);
+    EXPECT_NE(std::this_thread::get_id(), renderThreadIds[display2]);
+    EXPECT_NE(renderThreadIds[display1], renderThreadIds[display2]);
+}
+
+TEST_F(ARendererWithRenderThreadPerDisplay, keepsUsingSameThreadForDisplayAcrossFrames)
+{
+    const DisplayHandle display = addDisplayController();
+
+    expectFrameRenderedOnRenderThread(display);
+    doOneRendererLoop();
+    const std::thread::id renderThreadInFirstFrame = renderThreadIds[display];
+
+    expectFrameRenderedOnRenderThread(display, false);
+    doOneRendererLoop();
+    EXPECT_EQ(renderThreadInFirstFrame, renderThreadIds[display]);
+}
+
+TEST_F(ARendererWithRenderThreadPerDisplay, tracksFrameTimeAndSwapsPerDisplay)
+{
+    const DisplayHandle display1 = addDisplayController();
+    const DisplayHandle display2 = addDisplayController();
+
+    expectFrameRenderedOnRenderThread(display1);
+    expectFrameRenderedOnRenderThread(display2);
+    doOneRendererLoop();
+    renderer.getStatistics().frameFinished(0u);
+
+    EXPECT_TRUE(statisticsContain("FB0: 1; frameTime us ("));
+    EXPECT_TRUE(statisticsContain("FB1: 1; frameTime us ("));
+}
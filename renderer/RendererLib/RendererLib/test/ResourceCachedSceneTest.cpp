@@ -791,6 +791,41 @@ namespace ramses_internal
         EXPECT_EQ(vertexDataBufferDeviceHandle, deviceHandle);
     }
 
+    TEST_F(AResourceCachedScene, ProvidesBoundsOfVertexPositionsOfRenderable)
+    {
+        const BoundingBox bounds(Vector3(-1.f), Vector3(1.f));
+        ON_CALL(sceneHelper.resourceManager, getClientResourcePositionBounds(ResourceProviderMock::FakeVertArrayHash)).WillByDefault(Return(bounds));
+
+        const RenderableHandle renderable = sceneHelper.createRenderable();
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        EXPECT_FALSE(scene.getRenderablePositionBounds(renderable).isValid);
+
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectRenderableResourcesClean(renderable);
+        EXPECT_TRUE(scene.getRenderablePositionBounds(renderable).isValid);
+        EXPECT_EQ(bounds.minCorner, scene.getRenderablePositionBounds(renderable).minCorner);
+        EXPECT_EQ(bounds.maxCorner, scene.getRenderablePositionBounds(renderable).maxCorner);
+    }
+
+    TEST_F(AResourceCachedScene, HasNoBoundsOfVertexPositionsFromDataBuffer)
+    {
+        ON_CALL(sceneHelper.resourceManager, getClientResourcePositionBounds(ResourceProviderMock::FakeVertArrayHash)).WillByDefault(Return(BoundingBox(Vector3(-1.f), Vector3(1.f))));
+
+        const RenderableHandle renderable = sceneHelper.createRenderable();
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        const DataInstanceHandle vertexDataInstance = sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_TRUE(scene.getRenderablePositionBounds(renderable).isValid);
+
+        scene.setDataResource(vertexDataInstance, sceneHelper.vertAttribField, ResourceContentHash::Invalid(), verticesDataBuffer, 0u);
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.getRenderablePositionBounds(renderable).isValid);
+    }
+
     TEST_F(AResourceCachedScene, CanGetDeviceHandleForDataBuffer_AfterSwitchingFromNonExistingResource)
     {
         const RenderableHandle renderable = sceneHelper.createRenderable();
@@ -1016,4 +1051,79 @@ namespace ramses_internal
         const DeviceResourceHandle deviceHandle = scene.getCachedHandlesForTextureSamplers()[samplerRes.asMemoryHandle()];
         EXPECT_EQ(DeviceMock::FakeTextureDeviceHandle, deviceHandle);
     }
+
+    TEST_F(AResourceCachedScene, InternsEqualRenderStatesToSameId)
+    {
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+        EXPECT_EQ(scene.getInternedRenderStateId(state1), scene.getInternedRenderStateId(state2));
+
+        scene.setRenderStateCullMode(state2, ECullMode_FrontFacing);
+        EXPECT_NE(scene.getInternedRenderStateId(state1), scene.getInternedRenderStateId(state2));
+        EXPECT_EQ(ECullMode_FrontFacing, scene.getInternedRenderState(scene.getInternedRenderStateId(state2)).rasterizerState.m_cullMode);
+
+        scene.setRenderStateCullMode(state1, ECullMode_FrontFacing);
+        EXPECT_EQ(scene.getInternedRenderStateId(state1), scene.getInternedRenderStateId(state2));
+        EXPECT_EQ(1u, rendererScenes.getRenderStateCache().getUniqueCount());
+        EXPECT_EQ(2u, rendererScenes.getRenderStateCache().getRequestedCount());
+    }
+
+    TEST_F(AResourceCachedScene, InternsEqualRenderStatesOfDifferentScenesToSameId)
+    {
+        RendererCachedScene& otherScene = rendererScenes.createScene(SceneInfo(SceneId(12u)));
+        const RenderStateHandle state = sceneAllocator.allocateRenderState();
+        SceneAllocateHelper otherSceneAllocator(otherScene);
+        const RenderStateHandle otherState = otherSceneAllocator.allocateRenderState();
+        scene.setRenderStateDepthFunc(state, EDepthFunc_Always);
+        otherScene.setRenderStateDepthFunc(otherState, EDepthFunc_Always);
+
+        EXPECT_EQ(scene.getInternedRenderStateId(state), otherScene.getInternedRenderStateId(otherState));
+        EXPECT_EQ(1u, rendererScenes.getRenderStateCache().getUniqueCount());
+
+        rendererScenes.destroyScene(SceneId(12u));
+        EXPECT_EQ(1u, rendererScenes.getRenderStateCache().getRequestedCount());
+        EXPECT_EQ(EDepthFunc_Always, scene.getInternedRenderState(scene.getInternedRenderStateId(state)).depthStencilState.m_depthFunc);
+    }
+
+    TEST_F(AResourceCachedScene, ReleasesInternedRenderStateWithRenderState)
+    {
+        const RenderStateHandle state = sceneAllocator.allocateRenderState();
+        scene.setRenderStateDrawMode(state, EDrawMode_Lines);
+        EXPECT_EQ(1u, rendererScenes.getRenderStateCache().getRequestedCount());
+
+        scene.releaseRenderState(state);
+        EXPECT_EQ(0u, rendererScenes.getRenderStateCache().getUniqueCount());
+        EXPECT_EQ(0u, rendererScenes.getRenderStateCache().getRequestedCount());
+    }
+
+    TEST_F(AResourceCachedScene, InternsEqualTextureSamplerStatesToSameId)
+    {
+        const TextureSamplerStates states(EWrapMethod_Repeat, EWrapMethod_Clamp, EWrapMethod_Clamp, ESamplingMethod_Bilinear, 1u);
+        const TextureSamplerStates otherStates(EWrapMethod_Clamp, EWrapMethod_Clamp, EWrapMethod_Clamp, ESamplingMethod_Nearest, 1u);
+        const TextureSamplerHandle sampler1 = sceneAllocator.allocateTextureSampler({ states, ResourceContentHash(1u, 0u) });
+        const TextureSamplerHandle sampler2 = sceneAllocator.allocateTextureSampler({ states, ResourceContentHash(2u, 0u) });
+        const TextureSamplerHandle sampler3 = sceneAllocator.allocateTextureSampler({ otherStates, ResourceContentHash(1u, 0u) });
+
+        EXPECT_EQ(scene.getInternedTextureSamplerStatesId(sampler1), scene.getInternedTextureSamplerStatesId(sampler2));
+        EXPECT_NE(scene.getInternedTextureSamplerStatesId(sampler1), scene.getInternedTextureSamplerStatesId(sampler3));
+        EXPECT_EQ(2u, rendererScenes.getTextureSamplerStatesCache().getUniqueCount());
+        EXPECT_EQ(3u, rendererScenes.getTextureSamplerStatesCache().getRequestedCount());
+    }
+
+    TEST_F(AResourceCachedScene, ReleasesInternedTextureSamplerStatesWithTextureSamplerAndScene)
+    {
+        RendererCachedScene& otherScene = rendererScenes.createScene(SceneInfo(SceneId(12u)));
+        SceneAllocateHelper otherSceneAllocator(otherScene);
+        const TextureSamplerHandle sampler = sceneAllocator.allocateTextureSampler({ {}, ResourceContentHash(1u, 0u) });
+        const TextureSamplerHandle otherSampler = otherSceneAllocator.allocateTextureSampler({ {}, ResourceContentHash(1u, 0u) });
+        EXPECT_EQ(scene.getInternedTextureSamplerStatesId(sampler), otherScene.getInternedTextureSamplerStatesId(otherSampler));
+
+        scene.releaseTextureSampler(sampler);
+        EXPECT_EQ(1u, rendererScenes.getTextureSamplerStatesCache().getUniqueCount());
+        EXPECT_EQ(1u, rendererScenes.getTextureSamplerStatesCache().getRequestedCount());
+
+        rendererScenes.destroyScene(SceneId(12u));
+        EXPECT_EQ(0u, rendererScenes.getTextureSamplerStatesCache().getUniqueCount());
+        EXPECT_EQ(0u, rendererScenes.getTextureSamplerStatesCache().getRequestedCount());
+    }
 }
@@ -28,6 +28,7 @@ public:
     MOCK_CONST_METHOD3(getBinaryShaderData, void(ResourceContentHash, UInt8*, UInt32));
     MOCK_METHOD4(storeBinaryShader, void(ResourceContentHash, const UInt8*, UInt32, UInt32));
     MOCK_CONST_METHOD2(binaryShaderUploaded, void(ResourceContentHash, ramses_internal::Bool));
+    MOCK_METHOD1(deviceInitialized, void(const String&));
 };
 
 class BinaryShaderProviderFake : public BinaryShaderProviderMock
@@ -146,6 +147,72 @@ TEST_F(AResourceUploader, uploadsTexture2DResourceWithMipGen)
     EXPECT_EQ(123u, uploader.uploadResource(renderer, managedRes));
 }
 
+TEST_F(AResourceUploader, uploadsMipTailOfTexture2DResourceAndRemainingMipLevelsOneByOne)
+{
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat_R8, false, { 16u, 4u, 1u });
+    TextureResource res(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    ManagedResource managedRes(res, dummyManagedResourceCallback);
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
+    const Byte* data = res.getResourceData()->getRawData();
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, allocateTexture2D(4u, 4u, _, 3u, _)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 2u, 0u, 0u, 0u, 1u, 1u, 1u, data + 20u, 1u));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, 0u, 2u, 2u, 1u, data + 16u, 4u));
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 1u));
+    UInt32 lowestUploadedMipLevel = 0u;
+    EXPECT_EQ(123u, uploader.uploadTextureMipTail(renderer, managedRes, 5u, lowestUploadedMipLevel));
+    EXPECT_EQ(1u, lowestUploadedMipLevel);
+
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, 0u, 4u, 4u, 1u, data, 16u));
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 0u));
+    uploader.uploadTextureMipLevel(renderer, managedRes, DeviceResourceHandle(123), 0u);
+}
+
+TEST_F(AResourceUploader, uploadsAtLeastSmallestMipLevelOfTextureCubeResourceAsMipTail)
+{
+    const TextureMetaInfo texDesc(2u, 2u, 1u, ETextureFormat_R8, false, { 4u, 1u });
+    TextureResource res(EResourceType_TextureCube, texDesc, ResourceCacheFlag_DoNotCache, String());
+    ManagedResource managedRes(res, dummyManagedResourceCallback);
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
+    const Byte* data = res.getResourceData()->getRawData();
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, allocateTextureCube(2u, _, 2u, _)).WillOnce(Return(DeviceResourceHandle(123)));
+    for (UInt32 i = 0u; i < 6u; ++i)
+    {
+        EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, i, 1u, 1u, 1u, data + i * 5u + 4u, 1u));
+    }
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 1u));
+    UInt32 lowestUploadedMipLevel = 0u;
+    EXPECT_EQ(123u, uploader.uploadTextureMipTail(renderer, managedRes, 0u, lowestUploadedMipLevel));
+    EXPECT_EQ(1u, lowestUploadedMipLevel);
+
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    for (UInt32 i = 0u; i < 6u; ++i)
+    {
+        EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, i, 2u, 2u, 1u, data + i * 5u, 4u));
+    }
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 0u));
+    uploader.uploadTextureMipLevel(renderer, managedRes, DeviceResourceHandle(123), 0u);
+}
+
+TEST_F(AResourceUploader, uploadsWholeTextureWithMipGenInsteadOfMipTail)
+{
+    const TextureMetaInfo texDesc(4u, 1u, 1u, ETextureFormat_R8, true, MipDataSizeVector(1u));
+    TextureResource res(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    ManagedResource managedRes(res, dummyManagedResourceCallback);
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
+
+    EXPECT_CALL(renderer.deviceMock, allocateTexture2D(4u, 1u, _, 3u, 7u)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, 0u, 4u, 1u, 1u, _, _));
+    EXPECT_CALL(renderer.deviceMock, generateMipmaps(DeviceResourceHandle(123)));
+    UInt32 lowestUploadedMipLevel = 1u;
+    EXPECT_EQ(123u, uploader.uploadTextureMipTail(renderer, managedRes, 0u, lowestUploadedMipLevel));
+    EXPECT_EQ(0u, lowestUploadedMipLevel);
+}
+
 TEST_F(AResourceUploader, uploadsTexture3DResource)
 {
     const UInt32 mipCount = 2u;
@@ -338,6 +405,22 @@ TEST_F(AResourceUploader, doesNotTryToGetBinaryShaderFromDeviceIfEffectDidNotCom
     EXPECT_FALSE(uploaderWithBinaryProvider.uploadResource(renderer, managedRes).isValid());
 }
 
+TEST_F(AResourceUploader, passesDriverIdentificationOfInitializedDeviceToBinaryShaderCache)
+{
+    StrictMock<BinaryShaderProviderMock> binaryShaderProvider;
+    ResourceUploader uploaderWithBinaryProvider(&binaryShaderProvider);
+
+    EXPECT_CALL(renderer.deviceMock, getDriverIdentification()).WillOnce(Return(String("vendor gpu 1.2.3")));
+    EXPECT_CALL(binaryShaderProvider, deviceInitialized(String("vendor gpu 1.2.3")));
+    uploaderWithBinaryProvider.deviceInitialized(renderer);
+}
+
+TEST_F(AResourceUploader, doesNotQueryDriverIdentificationWithoutBinaryShaderCache)
+{
+    EXPECT_CALL(renderer.deviceMock, getDriverIdentification()).Times(0);
+    uploader.deviceInitialized(renderer);
+}
+
 TEST_F(AResourceUploader, unloadsVertexArrayResource)
 {
     const DeviceResourceHandle handle(123u);
@@ -0,0 +1,215 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/SceneLayerCache.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererEventCollector.h"
+#include "DeviceMock.h"
+#include "TestSceneHelper.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class ASceneLayerCache : public ::testing::Test
+{
+public:
+    ASceneLayerCache()
+        : cache(device, 16u, 8u, 2u * 16u * 8u * 4u)
+    {
+    }
+
+protected:
+    NiceMock<DeviceMock> device;
+    SceneLayerCache cache;
+    const SceneId scene1{ 1u };
+    const SceneId scene2{ 2u };
+    const DeviceResourceHandle framebuffer{ 100u };
+};
+
+TEST_F(ASceneLayerCache, hasNoLayersInitially)
+{
+    EXPECT_EQ(0u, cache.getLayerCount());
+    EXPECT_EQ(0u, cache.getLayersMemorySize());
+    EXPECT_FALSE(cache.hasValidLayer(scene1));
+    EXPECT_FALSE(cache.wasSceneModified(scene1));
+}
+
+TEST_F(ASceneLayerCache, createsLayerRenderTargetOnlyOnce)
+{
+    EXPECT_CALL(device, uploadRenderBuffer(_));
+    EXPECT_CALL(device, uploadRenderTarget(_));
+    const DeviceResourceHandle renderTarget = cache.getLayerRenderTarget(scene1);
+    EXPECT_EQ(DeviceMock::FakeRenderTargetDeviceHandle, renderTarget);
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_CALL(device, uploadRenderBuffer(_)).Times(0);
+    EXPECT_CALL(device, uploadRenderTarget(_)).Times(0);
+    EXPECT_EQ(renderTarget, cache.getLayerRenderTarget(scene1));
+
+    EXPECT_EQ(1u, cache.getLayerCount());
+    EXPECT_EQ(16u * 8u * 4u, cache.getLayersMemorySize());
+    EXPECT_FALSE(cache.hasValidLayer(scene1));
+}
+
+TEST_F(ASceneLayerCache, compositesRenderedLayerToTargetBuffer)
+{
+    const DeviceResourceHandle renderTarget = cache.getLayerRenderTarget(scene1);
+    cache.setLayerRendered(scene1, 123u);
+    EXPECT_TRUE(cache.hasValidLayer(scene1));
+
+    {
+        InSequence seq;
+        EXPECT_CALL(device, activateRenderTarget(framebuffer));
+        EXPECT_CALL(device, depthFunc(EDepthFunc_Disabled));
+        EXPECT_CALL(device, blendFactors(EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha, EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha));
+        EXPECT_CALL(device, activateTexture(DeviceMock::FakeRenderBufferDeviceHandle, _));
+        EXPECT_CALL(device, drawIndexedTriangles(_, _, _));
+    }
+    EXPECT_CALL(device, activateRenderTarget(renderTarget)).Times(0);
+
+    EXPECT_EQ(123u, cache.compositeLayer(scene1, framebuffer));
+}
+
+TEST_F(ASceneLayerCache, invalidatesLayerOfModifiedScene)
+{
+    cache.getLayerRenderTarget(scene1);
+    cache.setLayerRendered(scene1, 0u);
+    cache.getLayerRenderTarget(scene2);
+    cache.setLayerRendered(scene2, 0u);
+
+    cache.markSceneModified(scene1);
+    EXPECT_FALSE(cache.hasValidLayer(scene1));
+    EXPECT_TRUE(cache.hasValidLayer(scene2));
+    EXPECT_TRUE(cache.wasSceneModified(scene1));
+    EXPECT_FALSE(cache.wasSceneModified(scene2));
+
+    cache.finishFrame({ scene1, scene2 });
+    EXPECT_FALSE(cache.wasSceneModified(scene1));
+    EXPECT_EQ(2u, cache.getLayerCount());
+}
+
+TEST_F(ASceneLayerCache, invalidatesAllLayersWhenAllScenesModified)
+{
+    cache.getLayerRenderTarget(scene1);
+    cache.setLayerRendered(scene1, 0u);
+
+    cache.markAllScenesModified();
+    EXPECT_FALSE(cache.hasValidLayer(scene1));
+    EXPECT_TRUE(cache.wasSceneModified(scene1));
+    EXPECT_TRUE(cache.wasSceneModified(scene2));
+
+    cache.finishFrame({ scene1 });
+    EXPECT_FALSE(cache.wasSceneModified(scene2));
+}
+
+TEST_F(ASceneLayerCache, deletesLayersOfScenesNotShownInFrame)
+{
+    cache.getLayerRenderTarget(scene1);
+    cache.getLayerRenderTarget(scene2);
+
+    EXPECT_CALL(device, deleteRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle));
+    EXPECT_CALL(device, deleteRenderBuffer(DeviceMock::FakeRenderBufferDeviceHandle));
+    cache.finishFrame({ scene2 });
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_EQ(1u, cache.getLayerCount());
+    EXPECT_FALSE(cache.hasValidLayer(scene1));
+}
+
+TEST_F(ASceneLayerCache, doesNotCreateLayerExceedingMemoryBudget)
+{
+    const SceneId scene3{ 3u };
+    EXPECT_TRUE(cache.getLayerRenderTarget(scene1).isValid());
+    EXPECT_TRUE(cache.getLayerRenderTarget(scene2).isValid());
+
+    EXPECT_CALL(device, uploadRenderBuffer(_)).Times(0);
+    EXPECT_CALL(device, uploadRenderTarget(_)).Times(0);
+    EXPECT_FALSE(cache.getLayerRenderTarget(scene3).isValid());
+    EXPECT_EQ(2u, cache.getLayerCount());
+}
+
+TEST_F(ASceneLayerCache, removedLayerFreesMemoryForOtherScene)
+{
+    const SceneId scene3{ 3u };
+    cache.getLayerRenderTarget(scene1);
+    cache.getLayerRenderTarget(scene2);
+
+    EXPECT_CALL(device, deleteRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle));
+    EXPECT_CALL(device, deleteRenderBuffer(DeviceMock::FakeRenderBufferDeviceHandle));
+    cache.removeLayer(scene1);
+    Mock::VerifyAndClearExpectations(&device);
+    EXPECT_FALSE(cache.hasValidLayer(scene1));
+    EXPECT_EQ(1u, cache.getLayerCount());
+
+    EXPECT_TRUE(cache.getLayerRenderTarget(scene3).isValid());
+}
+
+class ASceneLayerCacheCompositingCheck : public ::testing::Test
+{
+public:
+    ASceneLayerCacheCompositingCheck()
+        : rendererScenes(rendererEventCollector)
+        , scene(rendererScenes.createScene(SceneInfo()))
+        , sceneAllocator(scene)
+        , sceneHelper(scene)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderableHandle renderable = sceneHelper.createRenderable(sceneHelper.createRenderGroup(pass));
+        renderState = sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(renderable, renderState);
+        scene.setRenderStateBlendFactors(renderState, EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha, EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha);
+        scene.setRenderStateBlendOperations(renderState, EBlendOperation_Add, EBlendOperation_Add);
+        scene.setRenderStateDepthFunc(renderState, EDepthFunc_Disabled);
+        scene.setRenderStateDepthWrite(renderState, EDepthWrite_Disabled);
+        scene.setRenderStateStencilFunc(renderState, EStencilFunc_Disabled, 0u, 0xff);
+    }
+
+protected:
+    bool canComposite()
+    {
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        return SceneLayerCache::CanCompositeScene(scene);
+    }
+
+    RendererEventCollector rendererEventCollector;
+    RendererScenes rendererScenes;
+    RendererCachedScene& scene;
+    SceneAllocateHelper sceneAllocator;
+    TestSceneHelper sceneHelper;
+    RenderStateHandle renderState;
+};
+
+TEST_F(ASceneLayerCacheCompositingCheck, allowsSceneBlendingWithPremultipliedAlphaWithoutDepthAndStencil)
+{
+    EXPECT_TRUE(canComposite());
+}
+
+TEST_F(ASceneLayerCacheCompositingCheck, rejectsSceneWithOpaqueRenderable)
+{
+    scene.setRenderStateBlendOperations(renderState, EBlendOperation_Disabled, EBlendOperation_Disabled);
+    EXPECT_FALSE(canComposite());
+}
+
+TEST_F(ASceneLayerCacheCompositingCheck, rejectsSceneBlendingWithNonPremultipliedAlpha)
+{
+    scene.setRenderStateBlendFactors(renderState, EBlendFactor_SrcAlpha, EBlendFactor_OneMinusSrcAlpha, EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha);
+    EXPECT_FALSE(canComposite());
+}
+
+TEST_F(ASceneLayerCacheCompositingCheck, rejectsSceneBlendingDependingOnDestination)
+{
+    scene.setRenderStateBlendFactors(renderState, EBlendFactor_DstAlpha, EBlendFactor_OneMinusSrcAlpha, EBlendFactor_One, EBlendFactor_OneMinusSrcAlpha);
+    EXPECT_FALSE(canComposite());
+}
+
+TEST_F(ASceneLayerCacheCompositingCheck, rejectsSceneUsingDepthTest)
+{
+    scene.setRenderStateDepthFunc(renderState, EDepthFunc_SmallerEqual);
+    EXPECT_FALSE(canComposite());
+}
@@ -73,8 +73,8 @@ namespace ramses_internal
 
         void subscribeScene()
         {
-            EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(senderID, sceneId));
-            sceneStateExecutor.setSubscriptionRequested(sceneId);
+            EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(senderID, sceneId, Guid(), 0u));
+            sceneStateExecutor.setSubscriptionRequested(sceneId, Guid(), 0u);
             EXPECT_EQ(ESceneState_SubscriptionRequested, sceneStateExecutor.getSceneState(sceneId));
         }
 
@@ -623,8 +623,8 @@ namespace ramses_internal
     TEST_F(ASceneStateExecutor, requestsSubscriptionForPublishedScene)
     {
         publishScene();
-        EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(senderID, sceneId));
-        sceneStateExecutor.setSubscriptionRequested(sceneId);
+        EXPECT_CALL(sceneGraphConsumerComponent, subscribeScene(senderID, sceneId, Guid(), 0u));
+        sceneStateExecutor.setSubscriptionRequested(sceneId, Guid(), 0u);
         expectNoRendererEvent();
     }
 
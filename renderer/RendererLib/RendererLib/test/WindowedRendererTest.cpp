@@ -137,8 +137,13 @@ TEST_F(AWindowedRendererWithDisplay, takeScreenshotGeneratesSuccessEvent)
     m_commandBuffer.readPixels(displayHandle, "", false, 0u, 0u, WindowMock::FakeWidth, WindowMock::FakeHeight);
     updateAndRender();
 
+    // pixels are read back asynchronously and reported in next frame
     RendererEventVector events;
     m_renderer.dispatchRendererEvents(events);
+    EXPECT_TRUE(events.empty());
+
+    updateAndRender();
+    m_renderer.dispatchRendererEvents(events);
     ASSERT_EQ(1u, events.size());
     EXPECT_EQ(displayHandle, events[0].displayHandle);
     EXPECT_EQ(WindowMock::FakeWidth * WindowMock::FakeHeight * 4u, events[0].pixelData.size());
@@ -165,6 +170,7 @@ TEST_F(AWindowedRendererWithDisplay, saveScreenshotToFileWithFullscreenDoesNotGe
 
     m_commandBuffer.readPixels(displayHandle, filename, true, 0u, 0u, 1u, 1u);
     updateAndRender();
+    updateAndRender();
 
     // expect file has been written
     ramses_capu::File screenshotFile(filename);
@@ -30,6 +30,7 @@ namespace ramses_internal
         ~DeviceMock() override;
 
         MOCK_CONST_METHOD0(getDeviceTypeId, EDeviceTypeId());
+        MOCK_CONST_METHOD0(getDriverIdentification, String());
         MOCK_METHOD0(init, Bool());
 
         MOCK_METHOD1(clear, void(UInt32));
@@ -68,10 +69,12 @@ namespace ramses_internal
 
         MOCK_METHOD2(allocateVertexBuffer, DeviceResourceHandle(EDataType, UInt32));
         MOCK_METHOD3(uploadVertexBufferData, void(DeviceResourceHandle, const Byte*, UInt32));
+        MOCK_METHOD3(streamVertexBufferData, void(DeviceResourceHandle, const Byte*, UInt32));
         MOCK_METHOD1(deleteVertexBuffer, void(DeviceResourceHandle));
         MOCK_METHOD3(activateVertexBuffer, void(DeviceResourceHandle, DataFieldHandle, UInt32));
         MOCK_METHOD2(allocateIndexBuffer, DeviceResourceHandle(EDataType, UInt32));
         MOCK_METHOD3(uploadIndexBufferData, void(DeviceResourceHandle, const Byte*, UInt32));
+        MOCK_METHOD3(streamIndexBufferData, void(DeviceResourceHandle, const Byte*, UInt32));
         MOCK_METHOD1(deleteIndexBuffer, void(DeviceResourceHandle));
         MOCK_METHOD1(activateIndexBuffer, void(DeviceResourceHandle));
 
@@ -86,8 +89,10 @@ namespace ramses_internal
         MOCK_METHOD4(allocateTextureCube, DeviceResourceHandle(UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes));
         MOCK_METHOD1(bindTexture, void(DeviceResourceHandle handle));
         MOCK_METHOD1(generateMipmaps, void(DeviceResourceHandle handle));
+        MOCK_METHOD2(setTextureBaseMipLevel, void(DeviceResourceHandle handle, UInt32 baseMipLevel));
         MOCK_METHOD10(uploadTextureData, void(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize));
         MOCK_METHOD5(uploadStreamTexture2D, DeviceResourceHandle(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data));
+        MOCK_METHOD6(updateStreamTexture2D, UInt32(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const PixelRectangle& updatedRegion));
         MOCK_METHOD1(deleteTexture, void(DeviceResourceHandle));
         MOCK_METHOD2(activateTexture, void(DeviceResourceHandle, DataFieldHandle));
 
@@ -110,6 +115,13 @@ namespace ramses_internal
         MOCK_METHOD1(deleteBlitPassRenderTargets, void(DeviceResourceHandle));
 
         MOCK_METHOD5(readPixels, void(UInt8*, UInt32, UInt32, UInt32, UInt32));
+        MOCK_METHOD4(startReadPixels, DeviceResourceHandle(UInt32, UInt32, UInt32, UInt32));
+        MOCK_METHOD1(isReadPixelsFinished, Bool(DeviceResourceHandle));
+        MOCK_METHOD2(finishReadPixels, Bool(DeviceResourceHandle, UInt8*));
+        MOCK_METHOD0(writeGpuTimestamp, DeviceResourceHandle());
+        MOCK_METHOD1(isGpuTimestampAvailable, Bool(DeviceResourceHandle));
+        MOCK_METHOD1(finishGpuTimestamp, UInt64(DeviceResourceHandle));
+        MOCK_METHOD0(isGpuTimerDisjoint, Bool());
 
         MOCK_CONST_METHOD0(getTotalGpuMemoryUsageInKB, UInt32());
         MOCK_CONST_METHOD0(getDrawCallCount, UInt32());
@@ -131,6 +143,8 @@ namespace ramses_internal
         static const DeviceResourceHandle FakeRenderBufferDeviceHandle           ;
         static const DeviceResourceHandle FakeTextureSamplerDeviceHandle         ;
         static const DeviceResourceHandle FakeBlitPassRenderTargetDeviceHandle   ;
+        static const DeviceResourceHandle FakeReadPixelsDeviceHandle             ;
+        static const DeviceResourceHandle FakeGpuTimestampDeviceHandle           ;
 
     private:
         void createDefaultMockCalls();
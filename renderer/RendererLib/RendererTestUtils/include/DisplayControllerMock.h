@@ -29,17 +29,25 @@ public:
 
     static const DeviceResourceHandle FakeFrameBufferHandle;
     static const ProjectionParams FakeProjectionParams;
+    static const DeviceResourceHandle FakeReadPixelsHandle;
 
     MOCK_METHOD0(handleWindowEvents, void());
     MOCK_CONST_METHOD0(canRenderNewFrame, bool());
     MOCK_METHOD0(enableContext, void());
+    MOCK_METHOD0(disableContext, void());
     MOCK_METHOD0(swapBuffers, void());
+    MOCK_METHOD1(swapBuffersWithDamage, void(const Viewport&));
+    MOCK_CONST_METHOD0(getDisplayBufferAge, UInt32());
+    MOCK_METHOD2(setDisplayBufferScissorRegion, void(Bool, const Viewport&));
     MOCK_METHOD2(clearBuffer, void(DeviceResourceHandle, const Vector4&));
     MOCK_CONST_METHOD2(logSceneContent, void(RendererLogContext& context, const RendererCachedScene& scene));
-    MOCK_METHOD5(renderScene, SceneRenderExecutionIterator(const RendererCachedScene&, DeviceResourceHandle, const Viewport&, const SceneRenderExecutionIterator&, const FrameTimer*));
+    MOCK_METHOD6(renderScene, SceneRenderExecutionIterator(const RendererCachedScene&, DeviceResourceHandle, const Viewport&, const SceneRenderExecutionIterator&, const FrameTimer*, GpuTimerQueries*));
     MOCK_METHOD0(executePostProcessing, void());
     MOCK_CONST_METHOD0(getDisplayBuffer, DeviceResourceHandle());
     MOCK_METHOD5(readPixels, ramses_internal::Bool(UInt32 x, UInt32 y, UInt32 width, UInt32 height, Vector<UInt8>& dataOut));
+    MOCK_METHOD4(startReadPixels, DeviceResourceHandle(UInt32 x, UInt32 y, UInt32 width, UInt32 height));
+    MOCK_METHOD1(isReadPixelsFinished, ramses_internal::Bool(DeviceResourceHandle readPixelsHandle));
+    MOCK_METHOD4(finishReadPixels, Bool(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, Vector<UInt8>& dataOut));
     MOCK_METHOD1(setProjectionParams, void(const ProjectionParams& params));
     MOCK_CONST_METHOD0(isWarpingEnabled, bool());
     MOCK_METHOD1(setWarpingMeshData, void(const WarpingMeshData& meshData));
@@ -58,6 +66,7 @@ public:
 
 private:
     static ramses_internal::Bool ResizePixelBuffer(UInt32 x, UInt32 y, UInt32 width, UInt32 height, Vector<UInt8>& dataOut);
+    static ramses_internal::Bool ResizeFinishedPixelBuffer(DeviceResourceHandle readPixelsHandle, UInt32 width, UInt32 height, Vector<UInt8>& dataOut);
 };
 }
 #endif
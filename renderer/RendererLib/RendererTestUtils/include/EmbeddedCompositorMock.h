@@ -30,7 +30,7 @@ namespace ramses_internal
         MOCK_METHOD0(dispatchNewStreamTextureSourceIds, StreamTextureSourceIdSet());
         MOCK_METHOD0(dispatchObsoleteStreamTextureSourceIds, StreamTextureSourceIdSet());
         MOCK_METHOD1(endFrame, void(Bool));
-        MOCK_METHOD3(uploadCompositingContentForStreamTexture, UInt32(StreamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter&));
+        MOCK_METHOD3(uploadCompositingContentForStreamTexture, StreamTextureBufferUpdate(StreamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter&));
         MOCK_CONST_METHOD1(isContentAvailableForStreamTexture, Bool (StreamTextureSourceId));
         MOCK_CONST_METHOD1(getNumberOfCommitedFramesForWaylandIviSurfaceSinceBeginningOfTime, UInt64(WaylandIviSurfaceId));
         MOCK_CONST_METHOD1(isBufferAttachedToWaylandIviSurface, Bool(WaylandIviSurfaceId));
@@ -36,7 +36,7 @@ class RendererMockWithMockDisplay : public ramses_internal::Renderer
 {
 public:
     RendererMockWithMockDisplay(const ramses_internal::IPlatformFactory& platformFactory, const RendererScenes& rendererScenes,
-        const RendererEventCollector& eventCollector, const LatencyMonitor& latencyMonitor);
+        const RendererEventCollector& eventCollector, const LatencyMonitor& latencyMonitor, Bool renderThreadPerDisplay = false);
 
     virtual void createDisplayContext(const ramses_internal::DisplayConfig& displayConfig, ramses_internal::DisplayHandle displayHandle) override;
     virtual void destroyDisplayContext(ramses_internal::DisplayHandle handle) override;
@@ -26,6 +26,7 @@ public:
 
     // IResourceDeviceHandleAccessor
     MOCK_CONST_METHOD1(getClientResourceDeviceHandle, DeviceResourceHandle(const ResourceContentHash&));
+    MOCK_CONST_METHOD1(getClientResourcePositionBounds, BoundingBox(const ResourceContentHash&));
     MOCK_CONST_METHOD2(getRenderTargetDeviceHandle, DeviceResourceHandle(RenderTargetHandle, SceneId));
     MOCK_CONST_METHOD2(getRenderTargetBufferDeviceHandle, DeviceResourceHandle(RenderBufferHandle, SceneId));
     MOCK_CONST_METHOD1(getOffscreenBufferDeviceHandle, DeviceResourceHandle(OffscreenBufferHandle));
@@ -21,8 +21,11 @@ namespace ramses_internal
     public:
         ResourceUploaderMock();
 
+        MOCK_METHOD1(deviceInitialized, void(IRenderBackend&));
         MOCK_METHOD2(uploadResource, DeviceResourceHandle(IRenderBackend&, ManagedResource));
         MOCK_METHOD4(unloadResource, void(IRenderBackend&, EResourceType, ResourceContentHash, DeviceResourceHandle));
+        MOCK_METHOD4(uploadTextureMipTail, DeviceResourceHandle(IRenderBackend&, ManagedResource, UInt32, UInt32&));
+        MOCK_METHOD4(uploadTextureMipLevel, void(IRenderBackend&, ManagedResource, DeviceResourceHandle, UInt32));
 
         static const DeviceResourceHandle FakeResourceDeviceHandle;
     };
@@ -12,6 +12,7 @@
 #include "renderer_common_gmock_header.h"
 #include "gmock/gmock.h"
 #include "RendererAPI/ISurface.h"
+#include "SceneAPI/Viewport.h"
 
 #include "ContextMock.h"
 #include "WindowMock.h"
@@ -28,6 +29,8 @@ namespace ramses_internal
         MOCK_METHOD0(enable, Bool());
         MOCK_METHOD0(disable, Bool());
         MOCK_METHOD0(swapBuffers, ramses_internal::Bool());
+        MOCK_METHOD1(swapBuffersWithDamage, ramses_internal::Bool(const Viewport&));
+        MOCK_CONST_METHOD0(getBufferAge, UInt32());
         MOCK_METHOD0(frameRendered, void());
         MOCK_CONST_METHOD0(canRenderNewFrame, Bool());
 
@@ -12,6 +12,7 @@
 #include "renderer_common_gmock_header.h"
 #include "gmock/gmock.h"
 #include "RendererAPI/ITextureUploadingAdapter.h"
+#include "SceneAPI/PixelRectangle.h"
 
 
 namespace ramses_internal
@@ -22,7 +23,7 @@ namespace ramses_internal
         TextureUploadingAdapterMock();
         ~TextureUploadingAdapterMock();
 
-        MOCK_METHOD5(uploadTexture2D, void(DeviceResourceHandle, UInt32, UInt32, ETextureFormat, const UInt8*));
+        MOCK_METHOD6(uploadTexture2D, UInt32(DeviceResourceHandle, UInt32, UInt32, ETextureFormat, const UInt8*, const PixelRectangle&));
     };
 
     class TextureUploadingAdapterMockWithDestructor : public TextureUploadingAdapterMock
@@ -21,6 +21,8 @@ namespace ramses_internal
     const DeviceResourceHandle DeviceMock::FakeRenderBufferDeviceHandle(7777u);
     const DeviceResourceHandle DeviceMock::FakeTextureSamplerDeviceHandle(8888u);
     const DeviceResourceHandle DeviceMock::FakeBlitPassRenderTargetDeviceHandle(9999u);
+    const DeviceResourceHandle DeviceMock::FakeReadPixelsDeviceHandle(11110u);
+    const DeviceResourceHandle DeviceMock::FakeGpuTimestampDeviceHandle(12120u);
 
     DeviceMock::DeviceMock()
     {
@@ -57,6 +59,12 @@ namespace ramses_internal
         ON_CALL(*this, uploadTextureSampler(_,_,_,_,_)).WillByDefault(Return(FakeTextureSamplerDeviceHandle));
         ON_CALL(*this, uploadRenderTarget(_)).WillByDefault(Return(FakeRenderTargetDeviceHandle));
         ON_CALL(*this, getFramebufferRenderTarget()).WillByDefault(Return(FakeFrameBufferRenderTargetDeviceHandle));
+        ON_CALL(*this, startReadPixels(_, _, _, _)).WillByDefault(Return(FakeReadPixelsDeviceHandle));
+        ON_CALL(*this, isReadPixelsFinished(_)).WillByDefault(Return(true));
+        ON_CALL(*this, finishReadPixels(_, _)).WillByDefault(Return(true));
+        ON_CALL(*this, writeGpuTimestamp()).WillByDefault(Return(FakeGpuTimestampDeviceHandle));
+        ON_CALL(*this, isGpuTimestampAvailable(_)).WillByDefault(Return(true));
+        ON_CALL(*this, isGpuTimerDisjoint()).WillByDefault(Return(false));
     }
 
     DeviceMockWithDestructor::DeviceMockWithDestructor()
@@ -17,9 +17,9 @@ using namespace testing;
 
 template <template<typename> class MOCK_TYPE>
 RendererMockWithMockDisplay<MOCK_TYPE>::RendererMockWithMockDisplay(const IPlatformFactory& platformFactory, const RendererScenes& rendererScenes,
-    const RendererEventCollector& eventCollector, const LatencyMonitor& latencyMonitor)
+    const RendererEventCollector& eventCollector, const LatencyMonitor& latencyMonitor, Bool renderThreadPerDisplay)
     : Renderer(const_cast<IPlatformFactory&>(platformFactory), const_cast<RendererScenes&>(rendererScenes),
-        const_cast<RendererEventCollector&>(eventCollector), FrameTimerInstance, const_cast<LatencyMonitor&>(latencyMonitor))
+        const_cast<RendererEventCollector&>(eventCollector), FrameTimerInstance, const_cast<LatencyMonitor&>(latencyMonitor), renderThreadPerDisplay)
 {
 }
 
@@ -30,6 +30,7 @@ RendererResourceManagerMock::RendererResourceManagerMock()
 
     // no need to strictly test getters
     EXPECT_CALL(*this, getClientResourceDeviceHandle(_)).Times(AnyNumber());
+    EXPECT_CALL(*this, getClientResourcePositionBounds(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getDataBufferDeviceHandle(_, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getTextureBufferDeviceHandle(_, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getRenderTargetDeviceHandle(_, _)).Times(AnyNumber());
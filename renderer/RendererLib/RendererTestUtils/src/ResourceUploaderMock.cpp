@@ -18,5 +18,6 @@ namespace ramses_internal
     ResourceUploaderMock::ResourceUploaderMock()
     {
         ON_CALL(*this, uploadResource(_, _)).WillByDefault(Return(FakeResourceDeviceHandle));
+        ON_CALL(*this, uploadTextureMipTail(_, _, _, _)).WillByDefault(DoAll(SetArgReferee<3>(0u), Return(FakeResourceDeviceHandle)));
     }
 };
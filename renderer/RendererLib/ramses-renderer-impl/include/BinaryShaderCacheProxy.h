@@ -33,6 +33,8 @@ namespace ramses
 
         virtual void binaryShaderUploaded(ramses_internal::ResourceContentHash effectHash, bool success) const override;
 
+        virtual void deviceInitialized(const ramses_internal::String& driverIdentification) override;
+
     private:
         static effectId_t getEffectIdFromEffectHash(const ramses_internal::ResourceContentHash& effectHash);
 
@@ -9,6 +9,7 @@
 #ifndef RAMSES_DISPLAYCONFIGIMPL_H
 #define RAMSES_DISPLAYCONFIGIMPL_H
 
+#include "ramses-renderer-api/Types.h"
 #include "RendererLib/DisplayConfig.h"
 #include "StatusObjectImpl.h"
 #include "Utils/CommandLineParser.h"
@@ -43,6 +44,12 @@ namespace ramses
         status_t disableEffectDeletion();
         status_t setResizable(bool resizable);
         status_t setGPUMemoryCacheSize(uint64_t size);
+        status_t setGPUMemoryCachePolicy(EGPUMemoryCachePolicy policy);
+        status_t setRenderBufferPoolSize(uint64_t size);
+        status_t enableSceneLayerCache(uint64_t memoryBudget);
+        status_t enablePartialFramebufferRedraw();
+        status_t enableProgressiveTextureUpload();
+        status_t enableGpuTimerQueries();
         status_t setClearColor(float red, float green, float blue, float alpha);
         status_t setOffscreen(bool offscreenFlag);
         status_t setWindowsWindowHandle(void* hwnd);
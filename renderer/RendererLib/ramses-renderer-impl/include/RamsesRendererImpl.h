@@ -74,6 +74,7 @@ namespace ramses
         status_t assignSceneToFramebuffer(sceneId_t sceneId);
 
         status_t readPixels(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+        status_t readPixelsPeriodically(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t frameInterval);
         status_t updateWarpingMeshData(displayId_t displayId, const WarpingMeshData& newWarpingMeshData);
 
         status_t systemCompositorSetIviSurfaceVisibility(uint32_t surfaceId, bool visibility);
@@ -86,6 +87,7 @@ namespace ramses
 
         void logConfirmationEcho(const ramses_internal::String& text);
         status_t logRendererInfo();
+        status_t querySceneLatencyStatistics(sceneId_t sceneId);
 
         const ramses_internal::RendererCommands& getCommands() const;
 
@@ -95,6 +97,7 @@ namespace ramses
         bool isThreaded() const;
         status_t setMaximumFramerate(float maximumFramerate);
         float getMaximumFramerate() const;
+        status_t setFramePacing(bool enable);
         status_t setLoopMode(ELoopMode loopMode);
         ELoopMode getLoopMode() const;
         status_t setFrameTimerLimits(uint64_t limitForClientResourcesUpload, uint64_t limitForSceneActionsApply, uint64_t limitForOffscreenBufferRender);
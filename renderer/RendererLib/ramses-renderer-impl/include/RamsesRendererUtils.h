@@ -16,6 +16,7 @@
 #include "RendererLib/EKeyCode.h"
 #include "RendererLib/EKeyEventType.h"
 #include "RendererLib/EMouseEventType.h"
+#include "RendererLib/LatencyHistogram.h"
 #include "RendererLib/WindowedRenderer.h"
 #include "Utils/LogMacros.h"
 
@@ -30,6 +31,7 @@ namespace ramses
         static ramses::EMouseEvent  GetMouseEvent(    ramses_internal::EMouseEventType type);
         static ramses::EKeyEvent    GetKeyEvent(      ramses_internal::EKeyEventType   type);
         static ramses::EKeyCode     GetKeyCode(       ramses_internal::EKeyCode        keyCode);
+        static latencyStatistics_t  GetLatencyStatistics(const ramses_internal::LatencySummary& summary);
 
         static void DoOneLoop(ramses_internal::WindowedRenderer& renderer, ramses_internal::ELoopMode loopMode, std::chrono::microseconds sleepTime);
     };
@@ -24,6 +24,7 @@ namespace ramses
         RendererConfigImpl(int32_t argc, char const* const* argv);
 
         status_t enableSystemCompositorControl();
+        status_t enableRenderThreadPerDisplay();
         status_t setWaylandSocketEmbeddedGroup(const char* groupname);
         const char* getWaylandSocketEmbeddedGroup() const;
 
@@ -36,6 +37,8 @@ namespace ramses
         status_t setBinaryShaderCache(IBinaryShaderCache& cache);
         IBinaryShaderCache* getBinaryShaderCache() const;
 
+        status_t setBinaryShaderCacheDirectory(const char* directory);
+
         status_t setRendererResourceCache(IRendererResourceCache& cache);
         IRendererResourceCache* getRendererResourceCache() const;
 
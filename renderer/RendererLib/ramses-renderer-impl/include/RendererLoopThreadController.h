@@ -12,6 +12,7 @@
 #include "RendererAPI/ELoopMode.h"
 #include "PlatformAbstraction/PlatformThread.h"
 #include "PlatformAbstraction/PlatformConditionVariable.h"
+#include "RendererLib/FramePacer.h"
 
 namespace ramses_internal
 {
@@ -29,6 +30,7 @@ namespace ramses_internal
         Bool stopRendering();
         void setMaximumFramerate(Float maximumFramerate);
         Float getMaximumFramerate() const;
+        void setFramePacing(Bool enable);
         void setLoopMode(ELoopMode loopMode);
 
         void destroyRenderer();
@@ -36,6 +38,7 @@ namespace ramses_internal
     private:
         virtual void run() override;
         std::chrono::milliseconds sleepToControlFramerate(std::chrono::microseconds loopDuration, std::chrono::microseconds minimumFrameDuration);
+        void doOnePacedLoop(ELoopMode loopMode, std::chrono::microseconds targetFrameDuration);
 
         WindowedRenderer* m_windowedRenderer;
         PlatformWatchdog& m_watchdog;
@@ -46,6 +49,9 @@ namespace ramses_internal
         std::chrono::microseconds m_minimumFrameDuration;
         Bool m_threadStarted;
         ELoopMode m_loopMode = ELoopMode_UpdateAndRender;
+        Bool m_framePacing = false;
+        // used only by renderer thread
+        FramePacer m_framePacer;
 
         Bool m_destroyRenderer;
     };
@@ -64,6 +64,13 @@ namespace ramses
         m_cache.binaryShaderUploaded(effectId, success);
     }
 
+    void BinaryShaderCacheProxy::deviceInitialized(const ramses_internal::String& driverIdentification)
+    {
+        // user provided cache is responsible to provide binaries matching the driver,
+        // failed uploads are reported via binaryShaderUploaded
+        UNUSED(driverIdentification);
+    }
+
     ramses::effectId_t BinaryShaderCacheProxy::getEffectIdFromEffectHash(const ramses_internal::ResourceContentHash& effectHash)
     {
         const effectId_t effectId = { effectHash.lowPart, effectHash.highPart };
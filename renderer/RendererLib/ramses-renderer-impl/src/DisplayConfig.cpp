@@ -185,6 +185,48 @@ namespace ramses
         return status;
     }
 
+    status_t DisplayConfig::setGPUMemoryCachePolicy(EGPUMemoryCachePolicy policy)
+    {
+        const status_t status = impl.setGPUMemoryCachePolicy(policy);
+        LOG_HL_RENDERER_API1(status, policy);
+        return status;
+    }
+
+    status_t DisplayConfig::setRenderBufferPoolSize(uint64_t size)
+    {
+        const status_t status = impl.setRenderBufferPoolSize(size);
+        LOG_HL_RENDERER_API1(status, size);
+        return status;
+    }
+
+    status_t DisplayConfig::enableSceneLayerCache(uint64_t memoryBudget)
+    {
+        const status_t status = impl.enableSceneLayerCache(memoryBudget);
+        LOG_HL_RENDERER_API1(status, memoryBudget)
+        return status;
+    }
+
+    status_t DisplayConfig::enablePartialFramebufferRedraw()
+    {
+        const status_t status = impl.enablePartialFramebufferRedraw();
+        LOG_HL_RENDERER_API_NOARG(status)
+        return status;
+    }
+
+    status_t DisplayConfig::enableProgressiveTextureUpload()
+    {
+        const status_t status = impl.enableProgressiveTextureUpload();
+        LOG_HL_RENDERER_API_NOARG(status)
+        return status;
+    }
+
+    status_t DisplayConfig::enableGpuTimerQueries()
+    {
+        const status_t status = impl.enableGpuTimerQueries();
+        LOG_HL_RENDERER_API_NOARG(status)
+        return status;
+    }
+
     status_t DisplayConfig::setResizable(bool resizable)
     {
         const status_t status = impl.setResizable(resizable);
@@ -212,6 +212,57 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t DisplayConfigImpl::setGPUMemoryCachePolicy(EGPUMemoryCachePolicy policy)
+    {
+        switch (policy)
+        {
+        case EGPUMemoryCachePolicy_LeastRecentlyUsed:
+            m_internalConfig.setGPUMemoryCachePolicy(ramses_internal::EGPUMemoryCachePolicy_LeastRecentlyUsed);
+            return StatusOK;
+        case EGPUMemoryCachePolicy_CostAware:
+            m_internalConfig.setGPUMemoryCachePolicy(ramses_internal::EGPUMemoryCachePolicy_CostAware);
+            return StatusOK;
+        }
+
+        return addErrorEntry("DisplayConfig::setGPUMemoryCachePolicy failed - unknown policy");
+    }
+
+    status_t DisplayConfigImpl::setRenderBufferPoolSize(uint64_t size)
+    {
+        m_internalConfig.setRenderBufferPoolSize(size);
+        return StatusOK;
+    }
+
+    status_t DisplayConfigImpl::enableSceneLayerCache(uint64_t memoryBudget)
+    {
+        if (memoryBudget == 0u)
+        {
+            return addErrorEntry("DisplayConfig::enableSceneLayerCache failed - memory budget must be greater than zero");
+        }
+
+        m_internalConfig.setSceneLayerCacheEnabled(true);
+        m_internalConfig.setSceneLayerCacheMemoryBudget(memoryBudget);
+        return StatusOK;
+    }
+
+    status_t DisplayConfigImpl::enablePartialFramebufferRedraw()
+    {
+        m_internalConfig.setPartialFramebufferRedrawEnabled(true);
+        return StatusOK;
+    }
+
+    status_t DisplayConfigImpl::enableProgressiveTextureUpload()
+    {
+        m_internalConfig.setProgressiveTextureUploadEnabled(true);
+        return StatusOK;
+    }
+
+    status_t DisplayConfigImpl::enableGpuTimerQueries()
+    {
+        m_internalConfig.setGpuTimerQueriesEnabled(true);
+        return StatusOK;
+    }
+
     status_t DisplayConfigImpl::setClearColor(float red, float green, float blue, float alpha)
     {
         m_internalConfig.setClearColor(ramses_internal::Vector4(red, green, blue, alpha));
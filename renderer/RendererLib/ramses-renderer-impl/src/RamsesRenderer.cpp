@@ -75,6 +75,13 @@ namespace ramses
         return impl.getMaximumFramerate();
     }
 
+    status_t RamsesRenderer::setFramePacing(bool enable)
+    {
+        const status_t status = impl.setFramePacing(enable);
+        LOG_HL_RENDERER_API1(status, enable);
+        return status;
+    }
+
     ramses::status_t RamsesRenderer::setLoopMode(ELoopMode loopMode)
     {
         const status_t status = impl.setLoopMode(loopMode);
@@ -197,6 +204,13 @@ namespace ramses
         return status;
     }
 
+    status_t RamsesRenderer::readPixelsPeriodically(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t frameInterval)
+    {
+        const status_t status = impl.readPixelsPeriodically(displayId, x, y, width, height, frameInterval);
+        LOG_HL_RENDERER_API6(status, displayId, x, y, width, height, frameInterval);
+        return status;
+    }
+
     status_t RamsesRenderer::updateWarpingMeshData(displayId_t displayId, const WarpingMeshData& newWarpingMeshData)
     {
         const status_t status = impl.updateWarpingMeshData(displayId, newWarpingMeshData);
@@ -246,6 +260,13 @@ namespace ramses
         return status;
     }
 
+    status_t RamsesRenderer::querySceneLatencyStatistics(sceneId_t sceneId)
+    {
+        const status_t status = impl.querySceneLatencyStatistics(sceneId);
+        LOG_HL_RENDERER_API1(status, sceneId);
+        return status;
+    }
+
     status_t RamsesRenderer::setFrameTimerLimits(uint64_t limitForClientResourcesUpload, uint64_t limitForSceneActionsApply, uint64_t limitForOffscreenBufferRender)
     {
         const status_t status = impl.setFrameTimerLimits(limitForClientResourcesUpload, limitForSceneActionsApply, limitForOffscreenBufferRender);
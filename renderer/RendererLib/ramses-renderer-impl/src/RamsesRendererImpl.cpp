@@ -21,6 +21,7 @@
 #include "Platform_Base/PlatformFactory_Base.h"
 #include "RendererAPI/ISystemCompositorController.h"
 #include "BinaryShaderCacheProxy.h"
+#include "RendererLib/PersistentBinaryShaderCache.h"
 #include "RendererResourceCacheProxy.h"
 #include "RamsesRendererUtils.h"
 #include "Common/Cpp11Macros.h"
@@ -29,16 +30,32 @@
 
 namespace ramses
 {
+    static ramses_internal::IBinaryShaderCache* CreateBinaryShaderCache(const RendererConfigImpl& config)
+    {
+        if (config.getBinaryShaderCache())
+        {
+            return new BinaryShaderCacheProxy(*config.getBinaryShaderCache());
+        }
+
+        const ramses_internal::String& directory = config.getInternalRendererConfig().getBinaryShaderCacheDirectory();
+        if (directory.getLength() > 0u)
+        {
+            return new ramses_internal::PersistentBinaryShaderCache(directory);
+        }
+
+        return NULL;
+    }
+
     RamsesRendererImpl::RamsesRendererImpl(RamsesFramework& framework, const RendererConfig& config, ramses_internal::IPlatformFactory* platformFactory)
         : StatusObjectImpl()
         , m_internalConfig(config.impl.getInternalRendererConfig())
-        , m_binaryShaderCache(config.impl.getBinaryShaderCache() ? new BinaryShaderCacheProxy(*(config.impl.getBinaryShaderCache())) : NULL)
+        , m_binaryShaderCache(CreateBinaryShaderCache(config.impl))
         , m_rendererResourceCache(config.impl.getRendererResourceCache() ? new RendererResourceCacheProxy(*(config.impl.getRendererResourceCache())) : nullptr)
         , m_pendingRendererCommands()
         , m_rendererFrameworkLogic(framework.impl.getConnectionStatusUpdateNotifier(), framework.impl.getResourceComponent(), framework.impl.getScenegraphComponent(), m_rendererCommandBuffer, framework.impl.getFrameworkLock())
         , m_platformFactory(platformFactory != NULL ? platformFactory : ramses_internal::PlatformFactory_Base::CreatePlatformFactory(m_internalConfig))
         , m_resourceUploader(m_binaryShaderCache.get())
-        , m_renderer(new ramses_internal::WindowedRenderer(m_rendererCommandBuffer, framework.impl.getScenegraphComponent(), *m_platformFactory, m_internalConfig.getKPIFileName()))
+        , m_renderer(new ramses_internal::WindowedRenderer(m_rendererCommandBuffer, framework.impl.getScenegraphComponent(), *m_platformFactory, m_internalConfig.getKPIFileName(), m_internalConfig.getRenderThreadPerDisplayEnabled()))
         , m_nextDisplayId(0u)
         , m_nextOffscreenBufferId(0u)
         , m_systemCompositorEnabled(m_internalConfig.getSystemCompositorControlEnabled())
@@ -329,6 +346,16 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RamsesRendererImpl::readPixelsPeriodically(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t frameInterval)
+    {
+        ramses_internal::PlatformGuard guard(m_lock);
+
+        const ramses_internal::DisplayHandle displayHandle(displayId);
+        m_pendingRendererCommands.readPixelsPeriodically(displayHandle, x, y, width, height, frameInterval);
+
+        return StatusOK;
+    }
+
     status_t RamsesRendererImpl::systemCompositorSetIviSurfaceVisibility(uint32_t surfaceId, bool visibility)
     {
         ramses_internal::PlatformGuard guard(m_lock);
@@ -491,6 +518,16 @@ namespace ramses
             case ramses_internal::ERendererEventType_SceneUpdateLatencyBackBelowLimit:
                 rendererEventHandler.sceneUpdateLatencyBackBelowLimit(rendererEvent->sceneId.getValue());
                 break;
+            case ramses_internal::ERendererEventType_SceneLatencyStatistics:
+                rendererEventHandler.sceneLatencyStatisticsQueried(rendererEvent->sceneId.getValue(),
+                    RamsesRendererUtils::GetLatencyStatistics(rendererEvent->flushToApplyLatency),
+                    RamsesRendererUtils::GetLatencyStatistics(rendererEvent->applyToRenderLatency),
+                    RamsesRendererUtils::GetLatencyStatistics(rendererEvent->renderToSwapLatency),
+                    ERendererEventResult_OK);
+                break;
+            case ramses_internal::ERendererEventType_SceneLatencyStatisticsFailed:
+                rendererEventHandler.sceneLatencyStatisticsQueried(rendererEvent->sceneId.getValue(), latencyStatistics_t(), latencyStatistics_t(), latencyStatistics_t(), ERendererEventResult_FAIL);
+                break;
             case ramses_internal::ERendererEventType_SceneDataLinked:
                 rendererEventHandler.dataLinked(rendererEvent->providerSceneId.getValue(), rendererEvent->providerdataId.getValue(), rendererEvent->consumerSceneId.getValue(), rendererEvent->consumerdataId.getValue(), ERendererEventResult_OK);
                 break;
@@ -599,6 +636,13 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RamsesRendererImpl::querySceneLatencyStatistics(sceneId_t sceneId)
+    {
+        ramses_internal::PlatformGuard guard(m_lock);
+        m_pendingRendererCommands.querySceneLatencyStatistics(ramses_internal::SceneId(sceneId));
+        return StatusOK;
+    }
+
     ramses::status_t RamsesRendererImpl::startThread()
     {
         ramses_internal::PlatformGuard guard(m_lock);
@@ -666,6 +710,18 @@ namespace ramses
         return m_rendererLoopThreadController.getMaximumFramerate();
     }
 
+    ramses::status_t RamsesRendererImpl::setFramePacing(bool enable)
+    {
+        ramses_internal::PlatformGuard guard(m_lock);
+        if (ERendererLoopThreadType_UsingDoOneLoop == m_rendererLoopThreadType)
+        {
+            return addErrorEntry("RamsesRenderer::setFramePacing Can not call setFramePacing if doOneLoop is called before because it can only pace frames of rendering thread!");
+        }
+
+        m_rendererLoopThreadController.setFramePacing(enable);
+        return StatusOK;
+    }
+
     ramses::status_t RamsesRendererImpl::setLoopMode(ELoopMode loopMode)
     {
         ramses_internal::PlatformGuard guard(m_lock);
@@ -73,6 +73,20 @@ namespace ramses
         }
     }
 
+    latencyStatistics_t RamsesRendererUtils::GetLatencyStatistics(const ramses_internal::LatencySummary& summary)
+    {
+        latencyStatistics_t statistics;
+        statistics.numSamples = summary.numSamples;
+        statistics.minimum = summary.minimum;
+        statistics.maximum = summary.maximum;
+        statistics.mean = summary.mean;
+        statistics.percentile50 = summary.percentile50;
+        statistics.percentile90 = summary.percentile90;
+        statistics.percentile99 = summary.percentile99;
+        statistics.percentile999 = summary.percentile999;
+        return statistics;
+    }
+
     ramses::EKeyCode RamsesRendererUtils::GetKeyCode(ramses_internal::EKeyCode keyCode)
     {
         switch (keyCode)
@@ -45,6 +45,13 @@ namespace ramses
         return status;
     }
 
+    status_t RendererConfig::setBinaryShaderCacheDirectory(const char* directory)
+    {
+        const status_t status = impl.setBinaryShaderCacheDirectory(directory);
+        LOG_HL_RENDERER_API1(status, directory);
+        return status;
+    }
+
     status_t RendererConfig::setRendererResourceCache(IRendererResourceCache& cache)
     {
         const status_t status = impl.setRendererResourceCache(cache);
@@ -59,6 +66,13 @@ namespace ramses
         return status;
     }
 
+    status_t RendererConfig::enableRenderThreadPerDisplay()
+    {
+        const status_t status = impl.enableRenderThreadPerDisplay();
+        LOG_HL_RENDERER_API_NOARG(status)
+        return status;
+    }
+
     status_t RendererConfig::setWaylandSocketEmbeddedGroup(const char* groupname)
     {
         const status_t status = impl.setWaylandSocketEmbeddedGroup(groupname);
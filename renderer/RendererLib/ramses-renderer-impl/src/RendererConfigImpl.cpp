@@ -26,6 +26,12 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RendererConfigImpl::enableRenderThreadPerDisplay()
+    {
+        m_internalConfig.enableRenderThreadPerDisplay();
+        return StatusOK;
+    }
+
     status_t RendererConfigImpl::setWaylandSocketEmbeddedGroup(const char* groupname)
     {
         m_internalConfig.setWaylandSocketEmbeddedGroup(groupname);
@@ -43,6 +49,17 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RendererConfigImpl::setBinaryShaderCacheDirectory(const char* directory)
+    {
+        if (directory == nullptr || directory[0] == '\0')
+        {
+            return addErrorEntry("RendererConfig::setBinaryShaderCacheDirectory failed - directory must not be empty");
+        }
+
+        m_internalConfig.setBinaryShaderCacheDirectory(directory);
+        return StatusOK;
+    }
+
     status_t RendererConfigImpl::setRendererResourceCache(IRendererResourceCache& cache)
     {
         m_rendererResourceCache = &cache;
@@ -12,6 +12,7 @@
 #include "Watchdog/PlatformWatchdog.h"
 #include "RamsesRendererUtils.h"
 #include "RendererLib/WindowedRenderer.h"
+#include "Utils/LogMacros.h"
 
 namespace ramses_internal
 {
@@ -23,6 +24,7 @@ namespace ramses_internal
         , m_doRendering(false)
         , m_minimumFrameDuration(std::chrono::microseconds(std::chrono::seconds(1)) / 60)  // 60fps
         , m_threadStarted(false)
+        , m_framePacer(m_minimumFrameDuration)
         , m_destroyRenderer(false)
     {
     }
@@ -88,12 +90,14 @@ namespace ramses_internal
             Bool destroyRenderer = false;
             std::chrono::microseconds minimumFrameDuration{ 0 };
             ELoopMode loopMode = ELoopMode_UpdateAndRender;
+            Bool framePacing = false;
             {
                 PlatformLightweightGuard guard(m_lock);
                 minimumFrameDuration = m_minimumFrameDuration;
                 doRendering = m_doRendering;
                 destroyRenderer = m_destroyRenderer;
                 loopMode = m_loopMode;
+                framePacing = m_framePacing;
             }
 
             if (destroyRenderer)
@@ -105,12 +109,20 @@ namespace ramses_internal
             }
             else if (!doRendering)
             {
+                m_framePacer.reset();
                 PlatformLightweightGuard guard(m_lock);
                 m_sleepConditionVar.wait(&m_lock, m_watchdog.calculateTimeout());
             }
+            else if (framePacing)
+            {
+                assert(m_windowedRenderer != NULL);
+                doOnePacedLoop(loopMode, minimumFrameDuration);
+                loopStartTime = PlatformTime::GetMicrosecondsMonotonic();
+            }
             else
             {
                 assert(m_windowedRenderer != NULL);
+                m_framePacer.reset();
                 ramses::RamsesRendererUtils::DoOneLoop(*m_windowedRenderer, loopMode, lastLoopSleepTime);
 
                 const UInt64 loopEndTime = PlatformTime::GetMicrosecondsMonotonic();
@@ -142,6 +154,30 @@ namespace ramses_internal
         return std::chrono::milliseconds{ 0u };
     }
 
+    void RendererLoopThreadController::doOnePacedLoop(ELoopMode loopMode, std::chrono::microseconds targetFrameDuration)
+    {
+        // sleep before the frame instead of after it, so that scene updates arriving meanwhile still make it into the frame
+        m_framePacer.setTargetFrameDuration(targetFrameDuration);
+        const UInt64 sleepStartTime = PlatformTime::GetMicrosecondsMonotonic();
+        // millisecond sleep precision, cast to whole milliseconds (floor) so that frame rather starts too early than too late
+        const std::chrono::milliseconds sleepDuration = std::chrono::duration_cast<std::chrono::milliseconds>(m_framePacer.getDelayBeforeNextFrame(sleepStartTime));
+        if (sleepDuration.count() > 0)
+            PlatformThread::Sleep(static_cast<UInt32>(sleepDuration.count()));
+
+        const UInt64 frameStartTime = PlatformTime::GetMicrosecondsMonotonic();
+        ramses::RamsesRendererUtils::DoOneLoop(*m_windowedRenderer, loopMode, std::chrono::microseconds{ frameStartTime - sleepStartTime });
+        const UInt64 frameEndTime = PlatformTime::GetMicrosecondsMonotonic();
+
+        Renderer& renderer = m_windowedRenderer->getRenderer();
+        const Bool deadlineMissed = m_framePacer.frameFinished(frameStartTime, frameEndTime, renderer.getSwapBuffersDuration());
+        renderer.getStatistics().framePaced(static_cast<UInt32>(frameStartTime - sleepStartTime), deadlineMissed);
+        if (deadlineMissed)
+        {
+            LOG_TRACE(CONTEXT_PROFILING, "RendererLoopThreadController::doOnePacedLoop frame missed its deadline, frame time " << frameEndTime - frameStartTime
+                << "us, predicted render time " << m_framePacer.getPredictedRenderTime().count() << "us");
+        }
+    }
+
     void RendererLoopThreadController::setMaximumFramerate(Float maximumFramerate)
     {
         PlatformLightweightGuard guard(m_lock);
@@ -156,6 +192,12 @@ namespace ramses_internal
         return 1.0f / std::chrono::duration_cast<float_seconds>(m_minimumFrameDuration).count();
     }
 
+    void RendererLoopThreadController::setFramePacing(Bool enable)
+    {
+        PlatformLightweightGuard guard(m_lock);
+        m_framePacing = enable;
+    }
+
     void RendererLoopThreadController::setLoopMode(ELoopMode loopMode)
     {
         PlatformLightweightGuard guard(m_lock);
@@ -78,6 +78,8 @@ TEST_F(ADisplayConfig, hasDefaultValuesUponConstruction)
     EXPECT_EQ(defaultDisplayConfig.getStartVisibleIvi(), displayConfig.getStartVisibleIvi());
 
     EXPECT_EQ(defaultDisplayConfig.getGPUMemoryCacheSize(), displayConfig.getGPUMemoryCacheSize());
+    EXPECT_EQ(defaultDisplayConfig.getGPUMemoryCachePolicy(), displayConfig.getGPUMemoryCachePolicy());
+    EXPECT_EQ(defaultDisplayConfig.getRenderBufferPoolSize(), displayConfig.getRenderBufferPoolSize());
     EXPECT_EQ(defaultDisplayConfig.getClearColor(), displayConfig.getClearColor());
 }
 
@@ -184,6 +186,56 @@ TEST_F(ADisplayConfig, disablesEffectDeletion)
     EXPECT_TRUE(config.impl.getInternalDisplayConfig().isEffectDeletionDisabled());
 }
 
+TEST_F(ADisplayConfig, setsGPUMemoryCachePolicy)
+{
+    EXPECT_EQ(ramses::StatusOK, config.setGPUMemoryCachePolicy(ramses::EGPUMemoryCachePolicy_CostAware));
+    EXPECT_EQ(ramses_internal::EGPUMemoryCachePolicy_CostAware, config.impl.getInternalDisplayConfig().getGPUMemoryCachePolicy());
+
+    EXPECT_EQ(ramses::StatusOK, config.setGPUMemoryCachePolicy(ramses::EGPUMemoryCachePolicy_LeastRecentlyUsed));
+    EXPECT_EQ(ramses_internal::EGPUMemoryCachePolicy_LeastRecentlyUsed, config.impl.getInternalDisplayConfig().getGPUMemoryCachePolicy());
+}
+
+TEST_F(ADisplayConfig, setsRenderBufferPoolSize)
+{
+    EXPECT_EQ(ramses::StatusOK, config.setRenderBufferPoolSize(1024u));
+    EXPECT_EQ(1024u, config.impl.getInternalDisplayConfig().getRenderBufferPoolSize());
+}
+
+TEST_F(ADisplayConfig, enablesSceneLayerCache)
+{
+    EXPECT_FALSE(config.impl.getInternalDisplayConfig().isSceneLayerCacheEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enableSceneLayerCache(1024u));
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().isSceneLayerCacheEnabled());
+    EXPECT_EQ(1024u, config.impl.getInternalDisplayConfig().getSceneLayerCacheMemoryBudget());
+}
+
+TEST_F(ADisplayConfig, failsToEnableSceneLayerCacheWithoutMemoryBudget)
+{
+    EXPECT_NE(ramses::StatusOK, config.enableSceneLayerCache(0u));
+    EXPECT_FALSE(config.impl.getInternalDisplayConfig().isSceneLayerCacheEnabled());
+}
+
+TEST_F(ADisplayConfig, enablesPartialFramebufferRedraw)
+{
+    EXPECT_FALSE(config.impl.getInternalDisplayConfig().isPartialFramebufferRedrawEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enablePartialFramebufferRedraw());
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().isPartialFramebufferRedrawEnabled());
+}
+
+TEST_F(ADisplayConfig, enablesProgressiveTextureUpload)
+{
+    EXPECT_FALSE(config.impl.getInternalDisplayConfig().isProgressiveTextureUploadEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enableProgressiveTextureUpload());
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().isProgressiveTextureUploadEnabled());
+}
+
+TEST_F(ADisplayConfig, enablesGpuTimerQueries)
+{
+    EXPECT_FALSE(config.impl.getInternalDisplayConfig().isGpuTimerQueriesEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enableGpuTimerQueries());
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().isGpuTimerQueriesEnabled());
+}
+
 TEST_F(ADisplayConfig, enablesStereoDisplay)
 {
     EXPECT_EQ(ramses::StatusOK, config.enableStereoDisplay());
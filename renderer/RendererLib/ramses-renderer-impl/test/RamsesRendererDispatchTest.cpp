@@ -104,7 +104,7 @@ namespace ramses_internal
             updateAndDispatch(m_handler);
 
             // receive m_scene
-            m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(newSceneID)), EScenePublicationMode_LocalOnly);
+            m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(newSceneID)), Guid(), false, EScenePublicationMode_LocalOnly);
 
             // receive initial flush
             SceneActionCollection initialSceneActions;
@@ -1074,8 +1074,8 @@ namespace ramses_internal
         EXPECT_EQ(ramses::StatusOK, m_renderer.subscribeScene(customSceneProviderId));
         EXPECT_EQ(ramses::StatusOK, m_renderer.subscribeScene(customsceneConsumerId));
         updateAndDispatch(m_handler); // needed to process subscription request
-        m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(customSceneProviderId)), EScenePublicationMode_LocalOnly);
-        m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(customsceneConsumerId)), EScenePublicationMode_LocalOnly);
+        m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(customSceneProviderId)), Guid(), false, EScenePublicationMode_LocalOnly);
+        m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(customsceneConsumerId)), Guid(), false, EScenePublicationMode_LocalOnly);
 
         // create data slots
         const ramses_internal::NodeHandle node(7u);
@@ -1168,7 +1168,7 @@ namespace ramses_internal
                     EXPECT_EQ(ramses::StatusOK, m_renderer.subscribeScene(m_sceneId));
                     updateAndDispatch();
                     // receive m_scene
-                    m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(m_sceneId)), EScenePublicationMode_LocalOnly);
+                    m_sceneGraphSender.sendCreateScene(m_framework.impl.getParticipantAddress().getParticipantId(), SceneInfo(ramses_internal::SceneId(m_sceneId)), Guid(), false, EScenePublicationMode_LocalOnly);
                     // receive initial flush
                     SceneActionCollection initialSceneActions;
                     SceneActionCollectionCreator creator(initialSceneActions);
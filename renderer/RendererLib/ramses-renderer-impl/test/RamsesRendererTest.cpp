@@ -156,6 +156,7 @@ protected:
         EXPECT_NE(ramses::StatusOK, renderer.setMaximumFramerate(0.0f));
         EXPECT_NE(ramses::StatusOK, renderer.setMaximumFramerate(-5.0f));
         EXPECT_EQ(ramses::StatusOK, renderer.setMaximumFramerate(60.0f));
+        EXPECT_EQ(ramses::StatusOK, renderer.setFramePacing(true));
 
         callAllApiCoreFunctions(renderer);
         renderer.stopThread();
@@ -421,6 +422,13 @@ TEST_F(ARamsesRenderer, createsCommandForLoggingRenderInfo)
     checkForRendererCommand(0u, ramses_internal::ERendererCommand_LogRendererInfo);
 }
 
+TEST_F(ARamsesRenderer, createsCommandForQuerySceneLatencyStatistics)
+{
+    EXPECT_EQ(ramses::StatusOK, renderer.querySceneLatencyStatistics(ramses::sceneId_t(12u)));
+    checkForRendererCommandCount(1u);
+    checkForRendererCommand(0u, ramses_internal::ERendererCommand_QuerySceneLatencyStatistics);
+}
+
 /*
 * Update warping data
 */
@@ -529,6 +537,13 @@ TEST_F(ARamsesRendererWithDisplay, createsCommandForReadPixels)
     checkForRendererCommand(0u, ramses_internal::ERendererCommand_ReadPixels);
 }
 
+TEST_F(ARamsesRendererWithDisplay, createsCommandForPeriodicReadPixels)
+{
+    EXPECT_EQ(ramses::StatusOK, renderer.readPixelsPeriodically(displayId, 0u, 0u, 40u, 40u, 5u));
+    checkForRendererCommandCount(1u);
+    checkForRendererCommand(0u, ramses_internal::ERendererCommand_ReadPixelsPeriodically);
+}
+
 /*
 * SystemCompositorControl
 */
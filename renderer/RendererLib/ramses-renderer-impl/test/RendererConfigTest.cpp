@@ -31,6 +31,13 @@ TEST(ARendererConfig, canEnableSystemCompositor)
     EXPECT_TRUE(config.impl.getInternalRendererConfig().getSystemCompositorControlEnabled());
 }
 
+TEST(ARendererConfig, canEnableRenderThreadPerDisplay)
+{
+    ramses::RendererConfig config;
+    EXPECT_EQ(ramses::StatusOK, config.enableRenderThreadPerDisplay());
+    EXPECT_TRUE(config.impl.getInternalRendererConfig().getRenderThreadPerDisplayEnabled());
+}
+
 TEST(ARendererConfig, canBeCopyConstructed)
 {
     ramses::RendererConfig config;
@@ -48,6 +55,21 @@ TEST(ARendererConfig, canSetBinaryShaderCache)
     EXPECT_EQ(&cache, config.impl.getBinaryShaderCache());
 }
 
+TEST(ARendererConfig, canSetBinaryShaderCacheDirectory)
+{
+    ramses::RendererConfig config;
+    EXPECT_EQ(ramses::StatusOK, config.setBinaryShaderCacheDirectory("shaders"));
+    EXPECT_STREQ("shaders", config.impl.getInternalRendererConfig().getBinaryShaderCacheDirectory().c_str());
+}
+
+TEST(ARendererConfig, failsToSetEmptyBinaryShaderCacheDirectory)
+{
+    ramses::RendererConfig config;
+    EXPECT_NE(ramses::StatusOK, config.setBinaryShaderCacheDirectory(""));
+    EXPECT_NE(ramses::StatusOK, config.setBinaryShaderCacheDirectory(nullptr));
+    EXPECT_STREQ("", config.impl.getInternalRendererConfig().getBinaryShaderCacheDirectory().c_str());
+}
+
 TEST(ARendererConfig, canSetEmbeddedCompositingSocketPermissionsGroup)
 {
     ramses::RendererConfig config;
@@ -292,7 +292,8 @@ namespace ramses
         *        Uploaded resources are kept in GPU memory even if not in use by any scene anymore.
         *        They are only freed from memory in order to make space for new resources to be uploaded
         *        which would not fit in the cache otherwise.
-        *        First in first out method is used when deciding which unused resource to remove from cache.
+        *        The order in which unused resources are removed from cache is given by the cache policy,
+        *        see setGPUMemoryCachePolicy (least recently used first by default).
         *
         *        Note that the cache size does not act as hard limit, the renderer can still upload
         *        resources taking up more space. As long as cache limit is exceeded, newly unused resources are unloaded
@@ -307,6 +308,92 @@ namespace ramses
         */
         status_t setGPUMemoryCacheSize(uint64_t size);
 
+        /**
+        * @brief Set the policy deciding which unused resources are removed first from the GPU memory cache
+        *        when there is not enough space for new resources to be uploaded.
+        *        The policy has no effect if the cache is disabled (see setGPUMemoryCacheSize).
+        *
+        * @param[in] policy GPU resource cache policy, EGPUMemoryCachePolicy_LeastRecentlyUsed by default
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setGPUMemoryCachePolicy(EGPUMemoryCachePolicy policy);
+
+        /**
+        * @brief Set the size of the pool recycling render buffers (render target buffers of scenes and offscreen buffers).
+        *        Render buffers which are no longer used (e.g. when a scene is unmapped or an offscreen buffer destroyed)
+        *        are kept in GPU memory up to this size and reused when a render buffer of same size, format and sample count
+        *        is needed again, instead of allocating new GPU memory. Least recently released buffers are deleted first
+        *        when the pool size is exceeded.
+        *        Pool is disabled by default (size is 0), render buffers are then deleted immediately.
+        *
+        * @param[in] size Render buffer pool size in bytes. Disabled if 0 (default)
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setRenderBufferPoolSize(uint64_t size);
+
+        /**
+        * @brief Enable caching of rendered scenes in offscreen color layers of display size.
+        *        A scene mapped to the display framebuffer which did not change since it was last rendered
+        *        is composited from its layer instead of being rendered again when other scenes on the
+        *        display change, which saves rendering time at the cost of GPU memory for one layer per cached scene.
+        *        Only scenes which look the same when composited from a layer are cached, i.e. all their renderables
+        *        rendered to the framebuffer use premultiplied alpha blending (source factor One, destination factor
+        *        OneMinusSrcAlpha for color and alpha), write all color channels and use neither depth nor stencil.
+        *        Other scenes are always rendered directly.
+        *        Disabled by default.
+        *
+        * @param[in] memoryBudget Maximum GPU memory in bytes used by all layers of the display,
+        *                         scenes are not cached if their layer would exceed it
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableSceneLayerCache(uint64_t memoryBudget);
+
+        /**
+        * @brief Enable redrawing only the changed region of the display framebuffer.
+        *        The changed region is derived from the projected bounds of renderables rendering to framebuffer
+        *        of all scenes which were modified since the previous frame, rendering is limited to it by scissor test
+        *        and it is passed to the window system when swapping buffers where supported (EGL_KHR_swap_buffers_with_damage).
+        *        Bounds are known for renderables with vertex positions in a static 2D or 3D float vertex array marked
+        *        with a position semantic, for any other renderable the viewport of its render pass is used instead.
+        *        Back buffers with undefined content are always redrawn completely, the content age of back buffer
+        *        is taken into account where supported (EGL_EXT_buffer_age).
+        *        Renderables must not render outside of their vertex positions transformed by model, view and projection matrix.
+        *        Ignored for stereo displays. Disabled by default.
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enablePartialFramebufferRedraw();
+
+        /**
+        * @brief Enable progressive upload of texture resources which come with their whole mip chain.
+        *        Only the smallest mip levels of such texture are uploaded first, which makes the texture
+        *        usable right away with reduced detail. The higher mip levels are then uploaded one by one
+        *        over the following frames within the time budget for resource upload (see RamsesRenderer::setFrameTimerLimits),
+        *        at least one mip level per frame.
+        *        Helps scenes with large textures to be shown earlier, especially when resources arrive over slow connection.
+        *        Disabled by default.
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableProgressiveTextureUpload();
+
+        /**
+        * @brief Enable measuring GPU time of every rendered scene and of each of its render and blit passes
+        *        using GPU timer queries. Results are collected asynchronously a few frames later, so rendering does not
+        *        wait for the GPU, and they are reported per scene and per pass in the periodic renderer log.
+        *        Has no effect if the device does not support timer queries (OpenGL ES requires GL_EXT_disjoint_timer_query).
+        *        Adds a small overhead per pass, meant for profiling. Disabled by default.
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableGpuTimerQueries();
+
         /**
          * @brief Enables/disables resizing of the window (Default=Disabled)
          * @param[in] resizable The resizable flag
@@ -155,7 +155,8 @@ namespace ramses
         /**
         * @brief This method will be called when a read back of pixels from framebuffer
         *        was finished. This is the result of RamsesRenderer::readPixels call which
-        *        triggers an asynchronous read back from the internal device.
+        *        triggers an asynchronous read back from the internal device,
+        *        or of each periodic read back started by RamsesRenderer::readPixelsPeriodically.
         * @param pixelData Pointer to the pixel data in uncompressed RGBA8 format.
         *                  Check result and pixelDataSize first to determine the state and size of the data.
         *                  The data is available at the pointer only during the dispatch of this event.
@@ -269,6 +270,24 @@ namespace ramses
             UNUSED(available);
         }
 
+        /**
+        * @brief This method will be called as a result of RamsesRenderer::querySceneLatencyStatistics
+        * @param sceneId The scene id of the scene the statistics belong to
+        * @param flushToApply Latencies from flush call at client to the flush being applied on renderer
+        * @param applyToRender Latencies from flush being applied to the scene being rendered with new content
+        * @param renderToSwap Latencies from scene being rendered to the framebuffer being swapped
+        * @param result Can be ERendererEventResult_OK if succeeded, ERendererEventResult_FAIL if failed (scene is not subscribed or none of its flushes was applied yet)
+        */
+        virtual void sceneLatencyStatisticsQueried(sceneId_t sceneId, const latencyStatistics_t& flushToApply, const latencyStatistics_t& applyToRender, const latencyStatistics_t& renderToSwap, ERendererEventResult result)
+        {
+            // This callback has default implementation to keep existing event handlers compatible
+            UNUSED(sceneId);
+            UNUSED(flushToApply);
+            UNUSED(applyToRender);
+            UNUSED(renderToSwap);
+            UNUSED(result);
+        }
+
         /**
         * @brief This method will be called when a key has been pressed while a display's window was focused
         * @param displayId The display on which the event occurred
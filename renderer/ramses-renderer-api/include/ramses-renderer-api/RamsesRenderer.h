@@ -97,6 +97,26 @@ namespace ramses
         */
         float getMaximumFramerate() const;
 
+        /**
+        * @brief Enables or disables frame pacing for the render loop when it is running in renderer thread
+        *        using startThread. Without frame pacing the renderer thread renders a frame and then sleeps
+        *        the rest of the frame duration given by maximum frame rate, so scene updates arriving
+        *        during that sleep are shown only with the frame after.
+        *        With frame pacing the renderer thread sleeps before rendering a frame instead. It predicts
+        *        the time needed to update and render from recent frames and starts the frame so that it finishes
+        *        just before the next swap deadline, which lowers latency of scene updates. Deadlines follow
+        *        the maximum frame rate and swap buffers blocked until vsync.
+        *        Frames that missed their deadline are reported in the periodic renderer log.
+        *        Frame pacing is disabled by default.
+        *
+        *        This function can not be used in combination with doOneLoop.
+        * @param enable Enable or disable frame pacing
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setFramePacing(bool enable);
+
         /**
         * @brief Sets the mode of operation for render loop. This function affects the behavior of
         *        BOTH doOneLoop and startThread. Mode can be changed during run-time, in case of thread
@@ -424,6 +444,28 @@ namespace ramses
         */
         status_t readPixels(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 
+        /**
+        * @brief Starts or stops periodic read back of framebuffer memory, e.g. for streaming of display content.
+        * @details Same as RamsesRenderer::readPixels but the read back is repeated every frameInterval-th frame
+        *          rendered to the display's framebuffer. Frames are not rendered just for the purpose of the read back,
+        *          if there is no change in the display's content then nothing is read back.
+        *          The read back does not stall rendering, the pixel data of each read back is obtained as a renderer event
+        *          one or two frames later, see RamsesRenderer::dispatchEvents for details.
+        *          Calling this again replaces the previous periodic read back of the display, frameInterval 0 stops it.
+        *
+        * @param[in] displayId id of display to read pixels from.
+        * @param[in] x The starting offset in the original image (i.e. left border) in pixels.
+        * @param[in] y The starting offset in the original image (i.e. lower border) in pixels.
+        *          The origin of the image is supposed to be in the lower left corner.
+        * @param[in] width The width of the read image in pixels.
+        * @param[in] height The height of the read image in pixels.
+        * @param[in] frameInterval Read back every frameInterval-th rendered frame, 0 stops periodic read back.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        *         StatusOK does not guarantee successful read back, the result events have their own status.
+        */
+        status_t readPixelsPeriodically(displayId_t displayId, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t frameInterval);
+
         /////////////////////////////////////////////////
         //      System Compositor API
         /////////////////////////////////////////////////
@@ -514,6 +556,22 @@ namespace ramses
         */
         status_t logRendererInfo();
 
+        /**
+        * @brief Requests statistics of update latencies of a subscribed scene.
+        * @details The renderer tracks distributions of three consecutive latencies for every subscribed scene:
+        *          - from flush at client (using the time stamp of the flush call) to the flush being applied on renderer
+        *          - from flush applied to the scene being rendered with the new content
+        *          - from scene rendered to the framebuffer of its display being swapped
+        *          Statistics are collected since the scene was subscribed. The result is reported asynchronously
+        *          as renderer event IRendererEventHandler::sceneLatencyStatisticsQueried, see RamsesRenderer::dispatchEvents.
+        *          The statistics are also part of the periodic renderer log.
+        *
+        * @param[in] sceneId id of the scene to get latency statistics for.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t querySceneLatencyStatistics(sceneId_t sceneId);
+
         /**
         * Stores internal data for implementation specifics of RamsesRenderer
         */
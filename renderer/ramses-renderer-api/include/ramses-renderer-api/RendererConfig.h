@@ -59,6 +59,19 @@ namespace ramses
         */
         status_t setBinaryShaderCache(IBinaryShaderCache& cache);
 
+        /**
+        * @brief Persist binary shaders automatically in the given directory.
+        *        Every binary shader is stored in its own file keyed by effect id and GPU driver version,
+        *        files are written on a background thread after a shader was compiled.
+        *        Effects used by the renderer are recorded in a startup manifest, at next startup
+        *        their binary shaders are loaded ahead of time so that the effects are not compiled again.
+        *        Ignored if a binary shader cache is set using setBinaryShaderCache.
+        * @param[in] directory the directory to store binary shaders in, created if it does not exist
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setBinaryShaderCacheDirectory(const char* directory);
+
         /**
         * @brief Set the resource cache implementation to be used by the renderer.
         * @param[in] cache the resource cache to be used by the renderer.
@@ -77,6 +90,18 @@ namespace ramses
         */
         status_t enableSystemCompositorControl();
 
+        /**
+        * @brief Render every display on its own thread with its own context current.
+        *        By default all displays are rendered one after another on the renderer thread,
+        *        so that displays share one frame budget and wait for each other's buffer swaps.
+        *        With this enabled displays are rendered and swapped in parallel, scene updates
+        *        are still applied on the renderer thread while none of the displays is rendering.
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableRenderThreadPerDisplay();
+
         /**
          * @brief      Set the name to be used for the embedded compositing
          *             socket.
@@ -30,6 +30,16 @@ namespace ramses
          */
     };
 
+    /**
+    * @brief Specifies which unused resources are unloaded first when the GPU memory cache needs space
+    *        for new resources (see DisplayConfig::setGPUMemoryCacheSize)
+    */
+    enum EGPUMemoryCachePolicy
+    {
+        EGPUMemoryCachePolicy_LeastRecentlyUsed = 0, //!< Resources that were not used by any scene for the longest time are unloaded first
+        EGPUMemoryCachePolicy_CostAware              //!< Like least recently used, but resources which are expensive to upload again (eg. effects with long shader compile time) are kept longer
+    };
+
     /**
     * @brief Resource identifier used to refer to a resource on the renderer
     *
@@ -84,6 +94,23 @@ namespace ramses
     */
     typedef rendererResourceId_t effectId_t;
 
+    /**
+    * @brief Summary of a latency distribution measured by the renderer, all values in microseconds
+    *
+    * Percentile values are reported with a relative error below 1/16.
+    */
+    struct latencyStatistics_t
+    {
+        uint64_t numSamples = 0;    //!< Number of measured latencies, all other values are 0 if there is none
+        uint64_t minimum = 0;       //!< Lowest measured latency
+        uint64_t maximum = 0;       //!< Highest measured latency
+        uint64_t mean = 0;          //!< Average of measured latencies
+        uint64_t percentile50 = 0;  //!< Median latency
+        uint64_t percentile90 = 0;  //!< Latency not exceeded by 90% of measurements
+        uint64_t percentile99 = 0;  //!< Latency not exceeded by 99% of measurements
+        uint64_t percentile999 = 0; //!< Latency not exceeded by 99.9% of measurements
+    };
+
     /**
     * @brief Specifies the result of the operation referred to by renderer event
     *
@@ -294,6 +294,7 @@ void EffectConfig::initUniformSemanticNameTable()
     m_uniformSemanticNameTable.put("EEffectUniformSemantic_NormalMatrix", ramses::EEffectUniformSemantic_NormalMatrix);
     m_uniformSemanticNameTable.put("EEffectUniformSemantic_RendererScreenResolution", ramses::EEffectUniformSemantic_RendererScreenResolution);
     m_uniformSemanticNameTable.put("EEffectUniformSemantic_TextTexture", ramses::EEffectUniformSemantic_TextTexture);
+    m_uniformSemanticNameTable.put("EEffectUniformSemantic_InstanceModelMatrices", ramses::EEffectUniformSemantic_InstanceModelMatrices);
 }
 
 void EffectConfig::initAttributeSemanticNameTable()